@@ -48,8 +48,8 @@ public:
     : AddressedMessage() { };
 
     bool
-    setAddressAttributesAndPayload(const std::string address, const std::string contentType, const std::string descriptor, 
-    const std::string sourceGroup, const std::string sourceEntityId, const std::string sourceServiceId, const std::string payload)
+    setAddressAttributesAndPayload(std::string address, std::string contentType, std::string descriptor, 
+    std::string sourceGroup, std::string sourceEntityId, std::string sourceServiceId, std::string payload)
     {
         if (!AddressedMessage::isValidAddress(address))
         {
@@ -67,11 +67,8 @@ public:
         m_messageAttributes = uxas::stduxas::make_unique<MessageAttributes>();
         if (m_messageAttributes->setAttributes(std::move(contentType), std::move(descriptor), std::move(sourceGroup), std::move(sourceEntityId), std::move(sourceServiceId)))
         {
-            m_address.clear();
-            m_payload.clear();
-            m_address = address;
-            m_payload = payload;
-            m_string = m_address + s_addressAttributesDelimiter() + m_messageAttributes->getString() + s_addressAttributesDelimiter() + m_payload;
+            m_address = std::move(address);
+            setPayload(std::move(payload));
             m_isValid = true;
             return (m_isValid);
         }
@@ -87,7 +84,7 @@ public:
    updateSourceAttributes(const std::string sourceGroup, const std::string sourceEntityId, const std::string sourceServiceId)
    {
        m_isValid = m_isValid & m_messageAttributes->updateSourceAttributes(sourceGroup, sourceEntityId, sourceServiceId);
-       m_string = m_address + s_addressAttributesDelimiter() + m_messageAttributes->getString() + s_addressAttributesDelimiter() + m_payload;
+       updateDelimitedStringPrefix();
        return (m_isValid);
    };
 
@@ -95,12 +92,12 @@ public:
     updateAddress(const std::string address)
     {
         m_address = address;
-        m_string = m_address + s_addressAttributesDelimiter() + m_messageAttributes->getString() + s_addressAttributesDelimiter() + m_payload;
+        updateDelimitedStringPrefix();
         return (m_isValid);
     }
 
     bool
-    setAddressAttributesAndPayloadFromDelimitedString(const std::string delimitedString)
+    setAddressAttributesAndPayloadFromDelimitedString(std::string delimitedString)
     {
         if (delimitedString.length() >= s_minimumDelimitedAddressAttributeMessageStringLength)
         {
@@ -125,7 +122,7 @@ public:
     {
         if (m_messageAttributes)
         {
-            return m_string;
+            return (getDelimitedString());
         }
         else
         {
@@ -157,7 +154,7 @@ public:
 protected:
 
     bool
-    parseAddressedAttributedMessageStringAndSetFields(const std::string delimitedString)
+    parseAddressedAttributedMessageStringAndSetFields(std::string delimitedString)
     {
         std::string::size_type endOfAddressDelimIndex = delimitedString.find(*(s_addressAttributesDelimiter().c_str()));
         if (endOfAddressDelimIndex == std::string::npos
@@ -191,15 +188,19 @@ protected:
             return (m_isValid);
         }
 
-        m_address.clear();
-        m_payload.clear();
         m_address = delimitedString.substr(0, endOfAddressDelimIndex);
-        m_payload = delimitedString.substr(endOfMessageAttributesDelimIndex + 1, delimitedString.length() - (endOfMessageAttributesDelimIndex + 1));
-        m_string = delimitedString;
+        setPayloadFromDelimitedString(std::move(delimitedString), endOfMessageAttributesDelimIndex + 1);
         m_isValid = true;
         return (m_isValid);
     };
 
+    std::string
+    getDelimitedStringPrefix() const override
+    {
+        return (m_address + s_addressAttributesDelimiter()
+                + (m_messageAttributes ? m_messageAttributes->getString() : s_emptyString) + s_addressAttributesDelimiter());
+    };
+
     static std::string s_emptyString;
     std::unique_ptr<MessageAttributes> m_messageAttributes;
 
@@ -13,6 +13,8 @@
 #include "UxAS_Log.h"
 #include "UxAS_StringUtil.h"
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <cstdint>
 
@@ -75,7 +77,7 @@ public:
     virtual ~AddressedMessage() { }
 
     bool
-    setAddressAndPayload(const std::string address, const std::string payload)
+    setAddressAndPayload(std::string address, std::string payload)
     {
         if (!isValidAddress(address))
         {
@@ -90,20 +92,15 @@ public:
             return (m_isValid);
         }
 
-        m_address.clear();
-        m_payload.clear();
-        
-        m_address = address;
-        m_payload = payload;
-        
-        m_string = m_address + s_addressAttributesDelimiter() + m_payload;
-        
+        m_address = std::move(address);
+        setPayload(std::move(payload));
+
         m_isValid = true;
         return (m_isValid);
     };
 
     bool
-    setAddressAndPayloadFromDelimitedString(const std::string delimitedString)
+    setAddressAndPayloadFromDelimitedString(std::string delimitedString)
     {
         if (delimitedString.length() >= s_minimumDelimitedAddressMessageStringLength)
         {
@@ -144,6 +141,17 @@ public:
     const std::string&
     getPayload() const
     {
+        if (!m_isPayloadCurrent.load(std::memory_order_acquire))
+        {
+            // first access of a payload received within a delimited string 
+            // (concurrent const access is serialized)
+            std::lock_guard<std::mutex> lock(m_lazyFieldMutex);
+            if (!m_isPayloadCurrent.load(std::memory_order_relaxed))
+            {
+                m_payload.assign(m_string, m_payloadOffset, std::string::npos);
+                m_isPayloadCurrent.store(true, std::memory_order_release);
+            }
+        }
         return m_payload;
     };
 
@@ -155,21 +163,109 @@ public:
     const std::string&
     getString() const
     {
-        return (m_string);
+        return (getDelimitedString());
     };
 
 protected:
 
+    /** \brief Delimited string content preceding the payload (e.g., address and delimiter).
+     * 
+     * @return delimited string prefix.
+     */
+    virtual
+    std::string
+    getDelimitedStringPrefix() const
+    {
+        return (m_address + s_addressAttributesDelimiter());
+    };
+
+    /** \brief Delimited string accessor. The delimited string is only built 
+     * (copying the payload) when requested after the payload or a prefix field 
+     * changed (e.g., single-part or TCP transport of a message constructed 
+     * from multi-part fields). Concurrent const access is serialized.
+     * 
+     * @return delimited string.
+     */
+    const std::string&
+    getDelimitedString() const
+    {
+        if (!m_isStringCurrent.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(m_lazyFieldMutex);
+            if (!m_isStringCurrent.load(std::memory_order_relaxed))
+            {
+                std::string prefix = getDelimitedStringPrefix();
+                m_string.clear();
+                m_string.reserve(prefix.length() + m_payload.length());
+                m_string.append(prefix).append(m_payload);
+                m_payloadOffset = prefix.length();
+                m_isStringCurrent.store(true, std::memory_order_release);
+            }
+        }
+        return (m_string);
+    };
+
+    void
+    setPayload(std::string payload)
+    {
+        m_payload = std::move(payload);
+        m_isPayloadCurrent = true;
+        m_isStringCurrent = false;
+    };
+
+    /** \brief Adopt a received delimited string as the only copy of the 
+     * message. The payload is located by offset and only copied out of the 
+     * delimited string if <B><i>getPayload</i></B> is called.
+     * 
+     * @param delimitedString received delimited string.
+     * @param payloadOffset index of the first payload character.
+     */
+    void
+    setPayloadFromDelimitedString(std::string delimitedString, std::string::size_type payloadOffset)
+    {
+        m_string = std::move(delimitedString);
+        m_payloadOffset = payloadOffset;
+        m_isStringCurrent = true;
+        m_payload.clear();
+        m_isPayloadCurrent = false;
+    };
+
+    /** \brief Must be called after changing any field preceding the payload 
+     * in the delimited string (e.g., address). */
+    void
+    updateDelimitedStringPrefix()
+    {
+        if (m_isPayloadCurrent.load(std::memory_order_relaxed))
+        {
+            // re-built on request
+            m_isStringCurrent = false;
+        }
+        else
+        {
+            // payload only exists within the delimited string - replace preceding fields in place
+            std::string prefix = getDelimitedStringPrefix();
+            m_string.replace(0, m_payloadOffset, prefix);
+            m_payloadOffset = prefix.length();
+        }
+    };
+
     bool
-    parseAddressedMessageStringAndSetFields(const std::string delimitedString)
+    parseAddressedMessageStringAndSetFields(std::string delimitedString)
     {
         std::string::size_type endOfAddressDelimIndex = delimitedString.find(*(s_addressAttributesDelimiter().c_str()));
         if (endOfAddressDelimIndex != std::string::npos
             && endOfAddressDelimIndex <= (delimitedString.length() - s_minimumDelimitedAddressMessageStringLength)) // delimiter found and payload size > 0
         {
             std::string address = delimitedString.substr(0, endOfAddressDelimIndex);
-            std::string payload = delimitedString.substr(endOfAddressDelimIndex + 1, delimitedString.length() - (endOfAddressDelimIndex + 1));
-            return (setAddressAndPayload(std::move(address), std::move(payload)));
+            if (!isValidAddress(address))
+            {
+                m_isValid = false;
+                return (m_isValid);
+            }
+            m_address = std::move(address);
+            setPayloadFromDelimitedString(std::move(delimitedString), endOfAddressDelimIndex + 1);
+            m_isValid = true;
+            return (m_isValid);
         }
         else
         {
@@ -180,9 +276,25 @@ protected:
     };
 
     bool m_isValid{false};
-    std::string m_string;
     std::string m_address;
-    std::string m_payload;
+
+private:
+
+    /** \brief Delimited string (address, optional attributes and payload); 
+     * valid if <B><i>m_isStringCurrent</i></B> */
+    mutable std::string m_string;
+
+    /** \brief Payload; valid if <B><i>m_isPayloadCurrent</i></B> (otherwise 
+     * located within <B><i>m_string</i></B> at <B><i>m_payloadOffset</i></B>) */
+    mutable std::string m_payload;
+    mutable std::string::size_type m_payloadOffset{0};
+
+    /** \brief Lazily built fields are published by these flags (set under 
+     * <B><i>m_lazyFieldMutex</i></B> by const accessors), so concurrent 
+     * const access is safe. Non-const methods require exclusive access. */
+    mutable std::atomic<bool> m_isStringCurrent{true};
+    mutable std::atomic<bool> m_isPayloadCurrent{true};
+    mutable std::mutex m_lazyFieldMutex;
 
 };
 
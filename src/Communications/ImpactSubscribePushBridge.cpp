@@ -135,11 +135,10 @@ ImpactSubscribePushBridge::configure(const pugi::xml_node& bridgeXmlNode)
 bool
 ImpactSubscribePushBridge::initialize()
 {
-    int32_t zmqhighWaterMark{ 100000 };
-
     // push socket
     auto pushConfig = transport::ZeroMqSocketConfiguration(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
-        m_externalPushSocketAddress, ZMQ_PUSH, false, false, zmqhighWaterMark, zmqhighWaterMark);
+        m_externalPushSocketAddress, ZMQ_PUSH, false, false, 0, 0);
+    pushConfig.setTuning(m_zeroMqSocketTuning);
 
     try
     {
@@ -154,7 +153,8 @@ ImpactSubscribePushBridge::initialize()
 
     // sub socket
     auto subConfig = transport::ZeroMqSocketConfiguration(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
-        m_externalSubscribeSocketAddress, ZMQ_SUB, false, true, zmqhighWaterMark, zmqhighWaterMark);
+        m_externalSubscribeSocketAddress, ZMQ_SUB, false, true, 0, 0);
+    subConfig.setTuning(m_zeroMqSocketTuning);
     try
     {
         subscriber = transport::ZeroMqFabric::getInstance().createSocket(subConfig);
@@ -217,14 +217,7 @@ ImpactSubscribePushBridge::processReceivedSerializedLmcpMessage(
         UXAS_LOG_INFORM(s_typeName(), "::processReceivedSerializedLmcpMessage processing message with source service ID ", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId());
 
         // unpack message to get complete attributes
-        std::string message = receivedLmcpMessage->getPayload();
-        avtas::lmcp::ByteBuffer byteBuffer;
-        byteBuffer.allocate(message.size());
-        byteBuffer.put(reinterpret_cast<const uint8_t*> (message.c_str()), message.size());
-        byteBuffer.rewind();
-
-        std::shared_ptr<avtas::lmcp::Object> ptr_Object;
-        ptr_Object.reset(avtas::lmcp::Factory::getObject(byteBuffer));
+        std::shared_ptr<avtas::lmcp::Object> ptr_Object(LmcpObjectMessageReceiverPipe::deserializeMessage(receivedLmcpMessage->getPayload()));
         if(!ptr_Object)
         {
             UXAS_LOG_WARN(s_typeName(), "::processReceivedSerializedLmcpMessage received an invalid LMCP object, ignoring");
@@ -275,13 +268,7 @@ ImpactSubscribePushBridge::executeExternalSerializedLmcpObjectReceiveProcessing(
             std::string message = n_ZMQ::s_recv(*subscriber);
 
             // ignore impact address, construct UxAS address from valid LMCP message
-            avtas::lmcp::ByteBuffer byteBuffer;
-            byteBuffer.allocate(message.size());
-            byteBuffer.put(reinterpret_cast<const uint8_t*> (message.c_str()), message.size());
-            byteBuffer.rewind();
-
-            std::shared_ptr<avtas::lmcp::Object> ptr_Object;
-            ptr_Object.reset(avtas::lmcp::Factory::getObject(byteBuffer));
+            std::shared_ptr<avtas::lmcp::Object> ptr_Object(LmcpObjectMessageReceiverPipe::deserializeMessage(message));
             
             if(ptr_Object)
             {
@@ -290,7 +277,7 @@ ImpactSubscribePushBridge::executeExternalSerializedLmcpObjectReceiveProcessing(
 
                 // internal message addressing is formatted as 'broadcast' from 'fusion' group
                 // with entity ID set from configuration
-                recvdAddAttMsg->setAddressAttributesAndPayload(broadcast_address, "lmcp", broadcast_address, "fusion", std::to_string(m_externalID), std::to_string(m_networkId), message);
+                recvdAddAttMsg->setAddressAttributesAndPayload(broadcast_address, "lmcp", broadcast_address, "fusion", std::to_string(m_externalID), std::to_string(m_networkId), std::move(message));
 
                 // send message from the external entity to the local bus
                 if (recvdAddAttMsg->isValid())
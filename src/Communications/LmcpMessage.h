@@ -16,6 +16,7 @@
 
 #include "stdUniquePtr.h"
 
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -40,7 +41,7 @@ public:
     {
     };
 
-    LmcpMessage(std::unique_ptr<MessageAttributes> messageAttributes, std::unique_ptr<avtas::lmcp::Object> lmcpObject)
+    LmcpMessage(std::unique_ptr<MessageAttributes> messageAttributes, std::shared_ptr<const avtas::lmcp::Object> lmcpObject)
     {
         m_attributes = std::move(messageAttributes);
         m_object = std::move(lmcpObject);
@@ -52,11 +53,21 @@ public:
      */
     std::unique_ptr<MessageAttributes> m_attributes;
 
-    /** \brief Data payload to be transported.
+    /** \brief Data payload to be transported. A received payload may be 
+     * shared with other in-process network clients, so it is never modified.
      * 
      * @return data string sent/received via message system.
      */
-    std::shared_ptr<avtas::lmcp::Object> m_object;
+    std::shared_ptr<const avtas::lmcp::Object> m_object;
+
+    /** \brief Data payload for the generated <b>LMCP</b> type tests and 
+     * accessors, which take non-const objects. The payload must still not be
+     * modified (modify a clone instead).
+     * 
+     * @return data payload.
+     */
+    std::shared_ptr<avtas::lmcp::Object>
+    getObject() const { return (std::const_pointer_cast<avtas::lmcp::Object>(m_object)); };
 
 };
 
@@ -11,11 +11,13 @@
 
 #include "LmcpMessage.h"
 #include "MessageAttributes.h"
+#include "ZeroMqFabric.h"
 #include "ZeroMqSocketConfiguration.h"
 
 #include "avtas/lmcp/ByteBuffer.h"
 #include "avtas/lmcp/Factory.h"
 
+#include "UxAS_ConfigurationManager.h"
 #include "UxAS_Log.h"
 #include "Constants/UxAS_String.h"
 
@@ -26,11 +28,23 @@ namespace uxas
 namespace communications
 {
 
+LmcpObjectMessageReceiverPipe::~LmcpObjectMessageReceiverPipe()
+{
+    if (m_sharedReceiver)
+    {
+        LmcpObjectSharedMessageHub::getInstance().unregisterReceiver(m_sharedReceiver);
+    }
+};
+
 void
-LmcpObjectMessageReceiverPipe::initializePull(uint32_t entityId, uint32_t serviceId)
+LmcpObjectMessageReceiverPipe::initializePull(uint32_t entityId, uint32_t serviceId, uint32_t shardIndex)
 {
     initializeZmqSocket(entityId, serviceId, ZMQ_PULL,
-                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(), true);
+                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(shardIndex), true);
+    if (uxas::common::ConfigurationManager::getIsZeroMqBlockingReceive())
+    {
+        m_transportReceiver->enableBlockingReceive();
+    }
 };
 
 void
@@ -52,6 +66,15 @@ LmcpObjectMessageReceiverPipe::initializeSubscription(uint32_t entityId, uint32_
 {
     initializeZmqSocket(entityId, serviceId, ZMQ_SUB,
                         uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(), false);
+    // subscribe to the publish sockets of all additional LMCP network server shards
+    for (uint32_t shardIndex = 1; shardIndex < uxas::common::ConfigurationManager::getLmcpNetworkServerShardCount(); shardIndex++)
+    {
+        m_transportReceiver->addConnection(uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(shardIndex));
+    }
+    if (uxas::common::ConfigurationManager::getIsZeroMqBlockingReceive())
+    {
+        m_transportReceiver->enableBlockingReceive();
+    }
 };
 
 void
@@ -61,6 +84,20 @@ LmcpObjectMessageReceiverPipe::initializeStream(uint32_t entityId, uint32_t serv
     initializeZmqSocket(entityId, serviceId, ZMQ_STREAM, socketAddress, isServer);
 };
 
+void
+LmcpObjectMessageReceiverPipe::initializeSharedSubscription(uint32_t entityId, uint32_t serviceId)
+{
+    m_entityId = entityId;
+    m_serviceId = serviceId;
+    m_sharedReceiver = LmcpObjectSharedMessageHub::getInstance().registerReceiver(m_entityId, m_serviceId);
+};
+
+void
+LmcpObjectMessageReceiverPipe::setSocketTuning(const uxas::communications::transport::ZeroMqSocketConfiguration& socketTuning)
+{
+    m_socketTuning = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqSocketConfiguration>(socketTuning);
+};
+
 void
 LmcpObjectMessageReceiverPipe::initializeZmqSocket(uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType,
                                           const std::string& socketAddress, bool isServer)
@@ -68,19 +105,18 @@ LmcpObjectMessageReceiverPipe::initializeZmqSocket(uint32_t entityId, uint32_t s
     m_entityId = entityId;
     m_serviceId = serviceId;
 
-    // notes about zero mq send and receive high water mark:
-    // - in some cases, only one is relevant and other is ignored
-    // - in other cases, both high water marks are relevant
-    int32_t zmqhighWaterMark{100000};
-
     uxas::communications::transport::ZeroMqSocketConfiguration
     zmqLmcpNetworkReceiveSocket(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
                                   socketAddress,
                                   zmqSocketType,
                                   isServer,
                                   true,
-                                  zmqhighWaterMark,
-                                  zmqhighWaterMark);
+                                  0,
+                                  0);
+
+    // high water marks and other socket options are configured for the entity 
+    // (optionally overridden by the network client - see setSocketTuning)
+    zmqLmcpNetworkReceiveSocket.setTuning(m_socketTuning ? *m_socketTuning : uxas::communications::transport::ZeroMqFabric::getDefaultSocketTuning());
 
     m_transportReceiver = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqAddressedAttributedMessageReceiver>(
             (zmqSocketType == ZMQ_STREAM ? true : false));
@@ -90,24 +126,62 @@ LmcpObjectMessageReceiverPipe::initializeZmqSocket(uint32_t entityId, uint32_t s
 bool
 LmcpObjectMessageReceiverPipe::addLmcpObjectSubscriptionAddress(const std::string& address)
 {
+    if (m_sharedReceiver)
+    {
+        return (m_sharedReceiver->addSubscriptionAddress(address));
+    }
     return (m_transportReceiver->addSubscriptionAddress(address));
 };
 
 bool
 LmcpObjectMessageReceiverPipe::removeLmcpObjectSubscriptionAddress(const std::string& address)
 {
+    if (m_sharedReceiver)
+    {
+        return (m_sharedReceiver->removeSubscriptionAddress(address));
+    }
     return (m_transportReceiver->removeSubscriptionAddress(address));
 };
 
 bool
 LmcpObjectMessageReceiverPipe::removeAllLmcpObjectSubscriptionAddresses()
 {
+    if (m_sharedReceiver)
+    {
+        return (m_sharedReceiver->removeAllSubscriptionAddresses());
+    }
     return (m_transportReceiver->removeAllSubscriptionAddresses());
 };
 
+uint32_t
+LmcpObjectMessageReceiverPipe::forwardSerializedMessages(uint32_t maxMessageCount, uxas::communications::transport::ZeroMqSenderBase& destination)
+{
+    return (m_transportReceiver->forwardMessages(maxMessageCount, destination));
+};
+
+void
+LmcpObjectMessageReceiverPipe::interruptReceive()
+{
+    if (m_sharedReceiver)
+    {
+        m_sharedReceiver->interrupt();
+    }
+    else if (m_transportReceiver)
+    {
+        m_transportReceiver->interrupt();
+    }
+};
+
 std::unique_ptr<uxas::communications::data::LmcpMessage>
 LmcpObjectMessageReceiverPipe::getNextMessageObject()
 {
+    // shared subscription - LMCP object has already been de-serialized by the hub
+    if (m_sharedReceiver)
+    {
+        return (m_sharedReceiver->getNextMessage(uxas::common::ConfigurationManager::getIsZeroMqBlockingReceive()
+                ? -1 : uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms()));
+    }
+
     // get next zero mq message
     // limit attempts on each receiver to one
     std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> nextZeroMqMessage
@@ -134,27 +208,85 @@ LmcpObjectMessageReceiverPipe::getNextMessageObject()
     return (emptyLmcpMessage);
 };
 
+uint32_t
+LmcpObjectMessageReceiverPipe::getNextMessageObjects(uint32_t maxMessageCount,
+                                                     uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& lmcpMessages)
+{
+    // shared subscription - LMCP objects have already been de-serialized by the hub
+    if (m_sharedReceiver)
+    {
+        return (m_sharedReceiver->getNextMessages(uxas::common::ConfigurationManager::getIsZeroMqBlockingReceive()
+                ? -1 : uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms(),
+                maxMessageCount, lmcpMessages));
+    }
+
+    // re-use serialized message buffer between calls
+    if (!m_serializedMessageBatch || m_serializedMessageBatch->capacity() < maxMessageCount)
+    {
+        m_serializedMessageBatch = uxas::stduxas::make_unique< uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > >(maxMessageCount);
+    }
+
+    uint32_t lmcpMessageCount{0};
+    m_transportReceiver->getNextMessages(maxMessageCount, *m_serializedMessageBatch);
+    while (!m_serializedMessageBatch->empty())
+    {
+        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> nextZeroMqMessage = m_serializedMessageBatch->pop_front();
+        std::unique_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextZeroMqMessage->getPayload());
+        if (lmcpObject && !lmcpMessages.full())
+        {
+            lmcpMessages.push_back(uxas::stduxas::make_unique<uxas::communications::data::LmcpMessage>
+                                   (nextZeroMqMessage->getMessageAttributesOwnership(), std::move(lmcpObject)));
+            lmcpMessageCount++;
+        }
+    }
+    return (lmcpMessageCount);
+};
+
 std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
 LmcpObjectMessageReceiverPipe::getNextSerializedMessage()
 {
+    if (!m_transportReceiver)
+    {
+        UXAS_LOG_ERROR("LmcpObjectMessageReceiverPipe::getNextSerializedMessage serialized messages are not available for shared subscriptions");
+        return (std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>());
+    }
     return (m_transportReceiver->getNextMessage());
 };
 
+uint32_t
+LmcpObjectMessageReceiverPipe::getNextSerializedMessages(uint32_t maxMessageCount,
+                                                         uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& serializedMessages)
+{
+    if (!m_transportReceiver)
+    {
+        UXAS_LOG_ERROR("LmcpObjectMessageReceiverPipe::getNextSerializedMessages serialized messages are not available for shared subscriptions");
+        return (0);
+    }
+    return (m_transportReceiver->getNextMessages(maxMessageCount, serializedMessages));
+};
+
 
 std::unique_ptr<avtas::lmcp::Object>
 LmcpObjectMessageReceiverPipe::deserializeMessage(const std::string& payload)
 {
-    std::unique_ptr<avtas::lmcp::Object> lmcpObject;
-
-    // allocate memory
-    avtas::lmcp::ByteBuffer lmcpByteBuffer;
-    lmcpByteBuffer.allocate(payload.size());
-    lmcpByteBuffer.rewind();
+    return (deserializeMessage(payload.data(), payload.size()));
+};
 
-    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
+std::unique_ptr<avtas::lmcp::Object>
+LmcpObjectMessageReceiverPipe::deserializeMessage(const char* payloadData, size_t payloadSize)
+{
+    std::unique_ptr<avtas::lmcp::Object> lmcpObject;
+    if (payloadData == nullptr || payloadSize < 1)
     {
-        lmcpByteBuffer.putByte(payload[charIndex]); // TODO REVIEW
+        UXAS_LOG_ERROR("LmcpObjectMessageReceiverPipe::deserializeMessage cannot convert empty message payload into an LMCP object");
+        return (lmcpObject);
     }
+
+    // allocate memory and copy the payload in a single block (LMCP checksum 
+    // validation requires the buffer capacity to equal the serialized size)
+    avtas::lmcp::ByteBuffer lmcpByteBuffer;
+    lmcpByteBuffer.allocate(static_cast<uint32_t>(payloadSize));
+    lmcpByteBuffer.put(reinterpret_cast<const uint8_t*>(payloadData), static_cast<uint32_t>(payloadSize));
     lmcpByteBuffer.rewind();
     
     lmcpObject.reset(avtas::lmcp::Factory::getObject(lmcpByteBuffer));
@@ -12,8 +12,12 @@
 
 #include "AddressedAttributedMessage.h"
 #include "LmcpMessage.h"
+#include "LmcpObjectSharedMessageHub.h"
 
 #include "ZeroMqAddressedAttributedMessageReceiver.h"
+#include "ZeroMqSocketConfiguration.h"
+
+#include "UxAS_RingBuffer.h"
 
 #include "avtas/lmcp/Object.h"
 
@@ -39,7 +43,7 @@ public:
 
     LmcpObjectMessageReceiverPipe() { };
 
-    ~LmcpObjectMessageReceiverPipe() { };
+    ~LmcpObjectMessageReceiverPipe();
 
 private:
 
@@ -51,8 +55,14 @@ private:
 
 public:
 
+    /** \brief Set Zero MQ socket tuning options (high water marks, buffer 
+     * sizes, etc.) applied to sockets created by subsequent <B><i>initialize</i></B> 
+     * calls. Defaults to ZeroMqFabric::getDefaultSocketTuning if not set. */
+    void
+    setSocketTuning(const uxas::communications::transport::ZeroMqSocketConfiguration& socketTuning);
+
     void
-    initializePull(uint32_t entityId, uint32_t serviceId);
+    initializePull(uint32_t entityId, uint32_t serviceId, uint32_t shardIndex = 0);
     
     void
     initializeExternalSubscription(uint32_t entityId, uint32_t serviceId, const std::string& externalSocketAddress, bool isServer);
@@ -66,6 +76,14 @@ public:
     void
     initializeStream(uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer);
 
+    /** \brief Receive de-serialized <b>LMCP</b> objects from the in-process 
+     * <B><i>LmcpObjectSharedMessageHub</i></B> instead of subscribing to the 
+     * hub's Zero MQ publish socket. Only <B><i>getNextMessageObject</i></B> is 
+     * supported for shared subscriptions.
+     */
+    void
+    initializeSharedSubscription(uint32_t entityId, uint32_t serviceId);
+
     bool
     addLmcpObjectSubscriptionAddress(const std::string& address);
 
@@ -82,12 +100,66 @@ public:
     std::unique_ptr<uxas::communications::data::LmcpMessage>
     getNextMessageObject();
 
+    /** \brief Get all available LMCP messages (up to <b>maxMessageCount</b>).
+     * 
+     * @param maxMessageCount maximum count of messages added to <b>lmcpMessages</b>.
+     * @param lmcpMessages caller-provided buffer the messages are added to.
+     * @return count of messages added to <b>lmcpMessages</b>.
+     */
+    uint32_t
+    getNextMessageObjects(uint32_t maxMessageCount,
+                          uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& lmcpMessages);
+
     std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
     getNextSerializedMessage();
 
+    /** \brief Get all available serialized LMCP messages (up to <b>maxMessageCount</b>).
+     * 
+     * @param maxMessageCount maximum count of messages added to <b>serializedMessages</b>.
+     * @param serializedMessages caller-provided buffer the messages are added to.
+     * @return count of messages added to <b>serializedMessages</b>.
+     */
+    uint32_t
+    getNextSerializedMessages(uint32_t maxMessageCount,
+                              uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& serializedMessages);
+
+    /** \brief Forward available serialized LMCP messages (up to <b>maxMessageCount</b>) 
+     * frame-by-frame to <b>destination</b> without parsing or copying them.
+     * 
+     * @param maxMessageCount maximum count of messages forwarded.
+     * @param destination sender the messages are forwarded to.
+     * @return count of messages forwarded.
+     */
+    uint32_t
+    forwardSerializedMessages(uint32_t maxMessageCount, uxas::communications::transport::ZeroMqSenderBase& destination);
+
+    /** \brief Wake a thread blocked in <B><i>getNextMessageObject</i></B> or 
+     * <B><i>getNextSerializedMessage</i></B> (thread-safe). Only required when 
+     * blocking receive is enabled (see ConfigurationManager::getIsZeroMqBlockingReceive).
+     */
+    void
+    interruptReceive();
+
+    /** \brief De-serialize an <b>LMCP</b> object from a serialized payload.
+     * 
+     * @param payload serialized <b>LMCP</b> object.
+     * @return <b>LMCP</b> object (empty if de-serialization fails).
+     */
+    static
     std::unique_ptr<avtas::lmcp::Object>
     deserializeMessage(const std::string& payload);
 
+    /** \brief De-serialize an <b>LMCP</b> object directly from a received 
+     * buffer (e.g., Zero MQ message data) without an intermediate string.
+     * 
+     * @param payloadData pointer to serialized <b>LMCP</b> object.
+     * @param payloadSize number of bytes of serialized <b>LMCP</b> object.
+     * @return <b>LMCP</b> object (empty if de-serialization fails).
+     */
+    static
+    std::unique_ptr<avtas::lmcp::Object>
+    deserializeMessage(const char* payloadData, size_t payloadSize);
+
 private:
 
     void
@@ -103,6 +175,14 @@ protected:
 
     std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageReceiver> m_transportReceiver;
 
+    /** \brief Zero MQ socket tuning options (empty implies entity defaults) */
+    std::unique_ptr<uxas::communications::transport::ZeroMqSocketConfiguration> m_socketTuning;
+
+    std::shared_ptr<LmcpObjectSharedMessageHub::Receiver> m_sharedReceiver;
+
+    /** \brief Received serialized messages pending de-serialization (batch receive) */
+    std::unique_ptr< uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > > m_serializedMessageBatch;
+
 };
 
 }; //namespace communications
@@ -12,24 +12,27 @@
 #include "avtas/lmcp/ByteBuffer.h"
 #include "avtas/lmcp/Factory.h"
 
+#include "ZeroMqFabric.h"
 #include "ZeroMqSocketConfiguration.h"
 
 #include "SerialHelper.h"
 
+#include "UxAS_ConfigurationManager.h"
 #include "Constants/UxAS_String.h"
 
 #include "stdUniquePtr.h"
 
+
 namespace uxas
 {
 namespace communications
 {
 
 void
-LmcpObjectMessageSenderPipe::initializePublish(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId)
+LmcpObjectMessageSenderPipe::initializePublish(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, uint32_t shardIndex)
 {
     initializeZmqSocket(sourceGroup, entityId, serviceId, ZMQ_PUB,
-                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(), true);
+                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(shardIndex), true);
 };
 
 void
@@ -49,8 +52,11 @@ LmcpObjectMessageSenderPipe::initializeExternalPub(const std::string& sourceGrou
 void
 LmcpObjectMessageSenderPipe::initializePush(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId)
 {
+    // every message of this sender is pushed to the one LMCP network server shard 
+    // selected by its service ID, so the messages of a sender remain ordered
+    uint32_t shardIndex = serviceId % uxas::common::ConfigurationManager::getLmcpNetworkServerShardCount();
     initializeZmqSocket(sourceGroup, entityId, serviceId, ZMQ_PUSH,
-                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(), false);
+                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(shardIndex), false);
 };
 
 void
@@ -59,30 +65,49 @@ LmcpObjectMessageSenderPipe::initializeStream(const std::string& sourceGroup, ui
     initializeZmqSocket(sourceGroup, entityId, serviceId, ZMQ_STREAM, socketAddress, isServer);
 };
 
+void
+LmcpObjectMessageSenderPipe::setSocketTuning(const uxas::communications::transport::ZeroMqSocketConfiguration& socketTuning)
+{
+    m_socketTuning = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqSocketConfiguration>(socketTuning);
+};
+
 void
 LmcpObjectMessageSenderPipe::initializeZmqSocket(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType,
                                                  const std::string& socketAddress, bool isServer)
 {
     m_entityId = entityId;
     m_serviceId = serviceId;
+    m_transportSender = createTransportSender(sourceGroup, zmqSocketType, socketAddress, isServer);
+};
 
-    // notes about zero mq send and receive high water mark:
-    // - in some cases, only one is relevant and other is ignored
-    // - in other cases, both high water marks are relevant
-    int32_t zmqhighWaterMark{100000};
-
+std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender>
+LmcpObjectMessageSenderPipe::createTransportSender(const std::string& sourceGroup, int32_t zmqSocketType,
+                                                   const std::string& socketAddress, bool isServer)
+{
     uxas::communications::transport::ZeroMqSocketConfiguration
     zmqLmcpNetworkSendSocket(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
                              socketAddress,
                              zmqSocketType,
                              isServer,
                              false,
-                             zmqhighWaterMark,
-                             zmqhighWaterMark);
+                             0,
+                             0);
 
-    m_transportSender = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender>(
+    // high water marks and other socket options are configured for the entity 
+    // (optionally overridden by the network client - see setSocketTuning)
+    zmqLmcpNetworkSendSocket.setTuning(m_socketTuning ? *m_socketTuning : uxas::communications::transport::ZeroMqFabric::getDefaultSocketTuning());
+
+    std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender> transportSender
+            = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender>(
             (zmqSocketType == ZMQ_STREAM ? true : false));
-    m_transportSender->initialize(sourceGroup, m_entityId, m_serviceId, zmqLmcpNetworkSendSocket);
+    transportSender->initialize(sourceGroup, m_entityId, m_serviceId, zmqLmcpNetworkSendSocket);
+    return (transportSender);
+};
+
+uxas::communications::transport::ZeroMqAddressedAttributedMessageSender&
+LmcpObjectMessageSenderPipe::getTransportSender()
+{
+    return (*m_transportSender);
 };
 
 void
@@ -95,10 +120,7 @@ LmcpObjectMessageSenderPipe::sendBroadcastMessage(std::unique_ptr<avtas::lmcp::O
 void
 LmcpObjectMessageSenderPipe::sendLimitedCastMessage(const std::string& castAddress, std::unique_ptr<avtas::lmcp::Object> lmcpObject)
 {
-    avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
-    std::string serializedPayload = std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
-    delete lmcpByteBuffer;
-    m_transportSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), std::move(serializedPayload));
+    m_transportSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), serializeMessage(lmcpObject.get()));
 };
 
 void
@@ -118,10 +140,15 @@ LmcpObjectMessageSenderPipe::sendSharedBroadcastMessage(const std::shared_ptr<av
 void
 LmcpObjectMessageSenderPipe::sendSharedLimitedCastMessage(const std::string& castAddress, const std::shared_ptr<avtas::lmcp::Object>& lmcpObject)
 {
-    avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
-    std::string serializedPayload = std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
-    delete lmcpByteBuffer;
-    m_transportSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), std::move(serializedPayload));
+    m_transportSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), serializeMessage(lmcpObject.get()));
+};
+
+std::string
+LmcpObjectMessageSenderPipe::serializeMessage(const avtas::lmcp::Object* lmcpObject)
+{
+    // the serialized string is moved (not copied) through the transport sender
+    std::unique_ptr<avtas::lmcp::ByteBuffer> lmcpByteBuffer(avtas::lmcp::Factory::packMessage(lmcpObject, true));
+    return (std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity()));
 };
 
 }; //namespace communications
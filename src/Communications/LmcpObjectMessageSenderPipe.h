@@ -11,6 +11,7 @@
 #define UXAS_MESSAGE_LMCP_OBJECT_MESSAGE_SENDER_PIPE_H
 
 #include "ZeroMqAddressedAttributedMessageSender.h"
+#include "ZeroMqSocketConfiguration.h"
 
 #include "avtas/lmcp/Object.h"
 
@@ -48,8 +49,14 @@ private:
 
 public:
 
+    /** \brief Set Zero MQ socket tuning options (high water marks, buffer 
+     * sizes, etc.) applied to sockets created by subsequent <B><i>initialize</i></B> 
+     * calls. Defaults to ZeroMqFabric::getDefaultSocketTuning if not set. */
     void
-    initializePublish(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId);
+    setSocketTuning(const uxas::communications::transport::ZeroMqSocketConfiguration& socketTuning);
+
+    void
+    initializePublish(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, uint32_t shardIndex = 0);
 
     void
     initializeExternalPush(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId,
@@ -58,6 +65,14 @@ public:
     initializeExternalPub(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId,
                           const std::string& externalSocketAddress, bool isServer);
     
+    /** \brief Push to the <b>LMCP</b> network server. With several network 
+     * server shards, the shard is selected by <b>serviceId</b> (modulo the shard 
+     * count), so all messages of this sender pass through one shard.
+     * 
+     * Ordering guarantee: messages sent through this pipe are received by 
+     * each subscriber in the order they were sent. There is no ordering 
+     * guarantee between messages of different senders.
+     */
     void
     initializePush(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId);
 
@@ -79,12 +94,31 @@ public:
     void
     sendSharedLimitedCastMessage(const std::string& castAddress, const std::shared_ptr<avtas::lmcp::Object>& lmcpObject);
 
+    /** \brief Serialize an <b>LMCP</b> object into a payload string.
+     * 
+     * @param lmcpObject <b>LMCP</b> object to be serialized.
+     * @return serialized <b>LMCP</b> object.
+     */
+    static
+    std::string
+    serializeMessage(const avtas::lmcp::Object* lmcpObject);
+
+    /** \brief Transport sender used for all messages sent by this pipe.
+     * 
+     * @return transport sender.
+     */
+    uxas::communications::transport::ZeroMqAddressedAttributedMessageSender&
+    getTransportSender();
+
 private:
 
     void
     initializeZmqSocket(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType, 
             const std::string& socketAddress, bool isServer);
 
+    std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender>
+    createTransportSender(const std::string& sourceGroup, int32_t zmqSocketType, const std::string& socketAddress, bool isServer);
+
 public:
 
     uint32_t m_entityId;
@@ -94,6 +128,9 @@ private:
 
     std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender> m_transportSender;
 
+    /** \brief Zero MQ socket tuning options (empty implies entity defaults) */
+    std::unique_ptr<uxas::communications::transport::ZeroMqSocketConfiguration> m_socketTuning;
+
 };
 
 }; //namespace communications
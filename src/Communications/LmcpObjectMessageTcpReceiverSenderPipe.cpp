@@ -10,10 +10,12 @@
 #include "LmcpObjectMessageTcpReceiverSenderPipe.h"
 
 #include "LmcpMessage.h"
+#include "LmcpObjectMessageReceiverPipe.h"
+#include "LmcpObjectMessageSenderPipe.h"
 #include "MessageAttributes.h"
+#include "ZeroMqFabric.h"
 #include "ZeroMqSocketConfiguration.h"
 
-#include "avtas/lmcp/ByteBuffer.h"
 #include "avtas/lmcp/Factory.h"
 
 #include "UxAS_Log.h"
@@ -32,6 +34,19 @@ LmcpObjectMessageTcpReceiverSenderPipe::initializeStream(uint32_t entityId, uint
     initializeZmqSocket(entityId, serviceId, ZMQ_STREAM, socketAddress, isServer);
 };
 
+void
+LmcpObjectMessageTcpReceiverSenderPipe::setSocketTuning(const uxas::communications::transport::ZeroMqSocketConfiguration& socketTuning)
+{
+    m_socketTuning = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqSocketConfiguration>(socketTuning);
+};
+
+void
+LmcpObjectMessageTcpReceiverSenderPipe::setLengthPrefixedFraming(bool isLengthPrefixed, bool isChecksumEnabled)
+{
+    m_isLengthPrefixedFraming = isLengthPrefixed;
+    m_isFramingChecksumEnabled = isChecksumEnabled;
+};
+
 void
 LmcpObjectMessageTcpReceiverSenderPipe::initializeZmqSocket(uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType,
                                           const std::string& socketAddress, bool isServer)
@@ -39,21 +54,21 @@ LmcpObjectMessageTcpReceiverSenderPipe::initializeZmqSocket(uint32_t entityId, u
     m_entityId = entityId;
     m_serviceId = serviceId;
 
-    // notes about zero mq send and receive high water mark:
-    // - in some cases, only one is relevant and other is ignored
-    // - in other cases, both high water marks are relevant
-    int32_t zmqhighWaterMark{100000};
-
     uxas::communications::transport::ZeroMqSocketConfiguration
     zmqLmcpNetworkReceiveSocket(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
                                   socketAddress,
                                   zmqSocketType,
                                   isServer,
                                   true,
-                                  zmqhighWaterMark,
-                                  zmqhighWaterMark);
+                                  0,
+                                  0);
+
+    // high water marks and other socket options are configured for the entity 
+    // (optionally overridden by the network client - see setSocketTuning)
+    zmqLmcpNetworkReceiveSocket.setTuning(m_socketTuning ? *m_socketTuning : uxas::communications::transport::ZeroMqFabric::getDefaultSocketTuning());
 
     m_transportTcpReceiverSender = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqAddressedAttributedMessageTcpReceiverSender>();
+    m_transportTcpReceiverSender->setLengthPrefixedFraming(m_isLengthPrefixedFraming, m_isFramingChecksumEnabled);
     m_transportTcpReceiverSender->initialize(m_entityId, m_serviceId, zmqLmcpNetworkReceiveSocket);
 };
 
@@ -108,26 +123,7 @@ LmcpObjectMessageTcpReceiverSenderPipe::getNextSerializedMessage()
 std::unique_ptr<avtas::lmcp::Object>
 LmcpObjectMessageTcpReceiverSenderPipe::deserializeMessage(const std::string& payload)
 {
-    std::unique_ptr<avtas::lmcp::Object> lmcpObject;
-
-    // allocate memory
-    avtas::lmcp::ByteBuffer lmcpByteBuffer;
-    lmcpByteBuffer.allocate(payload.size());
-    lmcpByteBuffer.rewind();
-
-    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
-    {
-        lmcpByteBuffer.putByte(payload[charIndex]); // TODO REVIEW
-    }
-    lmcpByteBuffer.rewind();
-    
-    lmcpObject.reset(avtas::lmcp::Factory::getObject(lmcpByteBuffer));
-    if (!lmcpObject)
-    {
-        UXAS_LOG_ERROR("LmcpObjectMessageTcpReceiverSenderPipe::deserializeMessage failed to convert message payload string into an LMCP object");
-    }
-
-    return (lmcpObject);
+    return (LmcpObjectMessageReceiverPipe::deserializeMessage(payload));
 };
 
 void
@@ -140,10 +136,8 @@ LmcpObjectMessageTcpReceiverSenderPipe::sendBroadcastMessage(std::unique_ptr<avt
 void
 LmcpObjectMessageTcpReceiverSenderPipe::sendLimitedCastMessage(const std::string& castAddress, std::unique_ptr<avtas::lmcp::Object> lmcpObject)
 {
-    avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
-    std::string serializedPayload = std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
-    delete lmcpByteBuffer;
-    m_transportTcpReceiverSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), serializedPayload);
+    m_transportTcpReceiverSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), 
+                                              LmcpObjectMessageSenderPipe::serializeMessage(lmcpObject.get()));
 };
 
 void
@@ -163,10 +157,8 @@ LmcpObjectMessageTcpReceiverSenderPipe::sendSharedBroadcastMessage(const std::sh
 void
 LmcpObjectMessageTcpReceiverSenderPipe::sendSharedLimitedCastMessage(const std::string& castAddress, const std::shared_ptr<avtas::lmcp::Object>& lmcpObject)
 {
-    avtas::lmcp::ByteBuffer* byteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
-    std::string serializedPayload = std::string(reinterpret_cast<char*>(byteBuffer->array()), byteBuffer->capacity());
-    delete byteBuffer;
-    m_transportTcpReceiverSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), serializedPayload);
+    m_transportTcpReceiverSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), 
+                                              LmcpObjectMessageSenderPipe::serializeMessage(lmcpObject.get()));
 };
 
 }; //namespace communications
@@ -14,6 +14,7 @@
 #include "LmcpMessage.h"
 
 #include "ZeroMqAddressedAttributedMessageTcpReceiverSender.h"
+#include "ZeroMqSocketConfiguration.h"
 
 #include "avtas/lmcp/Object.h"
 //#include "transport/ZeroMqAddressedAttributedMessageTcpReceiverSender.h"
@@ -52,6 +53,18 @@ private:
 
 public:
 
+    /** \brief Set Zero MQ socket tuning options (high water marks, buffer 
+     * sizes, etc.) applied to sockets created by subsequent <B><i>initialize</i></B> 
+     * calls. Defaults to ZeroMqFabric::getDefaultSocketTuning if not set. */
+    void
+    setSocketTuning(const uxas::communications::transport::ZeroMqSocketConfiguration& socketTuning);
+
+    /** \brief Configure TCP stream framing applied by subsequent <B><i>initialize</i></B> 
+     * calls (see ZeroMqAddressedAttributedMessageTcpReceiverSender::setLengthPrefixedFraming). 
+     * Defaults to sentinel framing (negotiated to length-prefixed framing by the peer). */
+    void
+    setLengthPrefixedFraming(bool isLengthPrefixed, bool isChecksumEnabled);
+
     void
     initializeStream(uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer);
 
@@ -103,6 +116,12 @@ protected:
 
     std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageTcpReceiverSender> m_transportTcpReceiverSender;
 
+    /** \brief Zero MQ socket tuning options (empty implies entity defaults) */
+    std::unique_ptr<uxas::communications::transport::ZeroMqSocketConfiguration> m_socketTuning;
+
+    bool m_isLengthPrefixedFraming{false};
+    bool m_isFramingChecksumEnabled{false};
+
 };
 
 }; //namespace communications
@@ -12,6 +12,7 @@
 
 #include "LmcpObjectNetworkSerialBridge.h"
 #include "LmcpObjectNetworkTcpBridge.h"
+#include "LmcpObjectNetworkSharedMemoryBridge.h"
 #include "LmcpObjectNetworkSubscribePushBridge.h"
 #include "LmcpObjectNetworkPublishPullBridge.h"
 #include "LmcpObjectNetworkZeroMqZyreBridge.h"
@@ -192,6 +193,10 @@ LmcpObjectNetworkBridgeManager::createBridge(const pugi::xml_node& bridgeXmlNode
         {
             newBridge = uxas::stduxas::make_unique<LmcpObjectNetworkTcpBridge>();
         }
+        else if (LmcpObjectNetworkSharedMemoryBridge::s_typeName().compare(bridgeType) == 0)
+        {
+            newBridge = uxas::stduxas::make_unique<LmcpObjectNetworkSharedMemoryBridge>();
+        }
         else if (LmcpObjectNetworkSubscribePushBridge::s_typeName().compare(bridgeType) == 0)
         {
             newBridge = uxas::stduxas::make_unique<LmcpObjectNetworkSubscribePushBridge>();
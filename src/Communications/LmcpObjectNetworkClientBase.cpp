@@ -8,8 +8,8 @@
 // ===============================================================================
 
 #include "LmcpObjectNetworkClientBase.h"
+#include "ZeroMqFabric.h"
 
-#include "avtas/lmcp/ByteBuffer.h"
 #include "avtas/lmcp/Factory.h"
 #include "uxas/messages/uxnative/KillService.h"
 
@@ -74,6 +74,45 @@ LmcpObjectNetworkClientBase::configureNetworkClient(const std::string& subclassT
     // network client can be terminated via received KillService message
     addSubscriptionAddress(uxas::messages::uxnative::KillService::Subscription);
 
+    // Zero MQ socket tuning - entity defaults, optionally overridden by network client XML
+    m_zeroMqSocketTuning = uxas::communications::transport::ZeroMqFabric::getDefaultSocketTuning();
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqHighWaterMark().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_receiveHighWaterMark = networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqHighWaterMark().c_str()).as_int();
+        m_zeroMqSocketTuning.m_sendHighWaterMark = m_zeroMqSocketTuning.m_receiveHighWaterMark;
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting Zero MQ high water mark ", m_zeroMqSocketTuning.m_sendHighWaterMark);
+    }
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqSendBufferSize().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_sendBufferSize = networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqSendBufferSize().c_str()).as_int();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting Zero MQ send buffer size ", m_zeroMqSocketTuning.m_sendBufferSize);
+    }
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqReceiveBufferSize().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_receiveBufferSize = networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqReceiveBufferSize().c_str()).as_int();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting Zero MQ receive buffer size ", m_zeroMqSocketTuning.m_receiveBufferSize);
+    }
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqTcpKeepAlive().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_tcpKeepAlive = networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqTcpKeepAlive().c_str()).as_int();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting Zero MQ TCP keep-alive ", m_zeroMqSocketTuning.m_tcpKeepAlive);
+    }
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqTcpKeepAliveIdle().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_tcpKeepAliveIdle = networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqTcpKeepAliveIdle().c_str()).as_int();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting Zero MQ TCP keep-alive idle ", m_zeroMqSocketTuning.m_tcpKeepAliveIdle);
+    }
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqAffinity().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_affinity = networkClientXmlNode.attribute(uxas::common::StringConstant::ZeroMqAffinity().c_str()).as_ullong();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting Zero MQ affinity ", m_zeroMqSocketTuning.m_affinity);
+    }
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::isZeroMqImmediate().c_str()).empty())
+    {
+        m_zeroMqSocketTuning.m_isImmediate = networkClientXmlNode.attribute(uxas::common::StringConstant::isZeroMqImmediate().c_str()).as_bool();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::configureNetworkClient setting isZeroMqImmediate ", m_zeroMqSocketTuning.m_isImmediate);
+    }
+
 #ifdef DEBUG_VERBOSE_LOGGING_ENABLED_MESSAGING
     std::stringstream xmlNd{""};
     networkClientXmlNode.print(xmlNd);
@@ -251,7 +290,20 @@ LmcpObjectNetworkClientBase::initializeNetworkClient()
 {
     UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::initializeNetworkClient method START");
 
-    m_lmcpObjectMessageReceiverPipe.initializeSubscription(m_entityId, m_networkId);
+    m_lmcpObjectMessageReceiverPipe.setSocketTuning(m_zeroMqSocketTuning);
+    m_lmcpObjectMessageSenderPipe.setSocketTuning(m_zeroMqSocketTuning);
+
+    if (m_receiveProcessingType == ReceiveProcessingType::LMCP
+            && uxas::common::ConfigurationManager::getInstance().getIsSharedLmcpObjectFanOut())
+    {
+        // receive LMCP objects that are de-serialized once by the LMCP network server
+        m_lmcpObjectMessageReceiverPipe.initializeSharedSubscription(m_entityId, m_networkId);
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::initializeNetworkClient receiving shared LMCP objects from the LMCP network server");
+    }
+    else
+    {
+        m_lmcpObjectMessageReceiverPipe.initializeSubscription(m_entityId, m_networkId);
+    }
 
     for (const auto& address : m_preStartLmcpSubscriptionAddresses)
     {
@@ -280,34 +332,20 @@ LmcpObjectNetworkClientBase::executeNetworkClient()
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method START");
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method START infinite while loop");
         m_isThreadStarted = true;
+        uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> > receivedLmcpMessages(m_maxReceiveBatchMessageCount);
+        uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> > processLmcpMessages(m_maxReceiveBatchMessageCount);
         while (!m_isTerminateNetworkClient)
         {
             try
             {
-                // get the next LMCP message (if any) from the LMCP network server
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient calling m_lmcpObjectMessageReceiverPipe.getNextMessageObject()");
-                std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage
-                        = m_lmcpObjectMessageReceiverPipe.getNextMessageObject();
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient completed calling m_lmcpObjectMessageReceiverPipe.getNextMessageObject()");
+                // get all available LMCP messages (if any) from the LMCP network server
+                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient calling m_lmcpObjectMessageReceiverPipe.getNextMessageObjects()");
+                m_lmcpObjectMessageReceiverPipe.getNextMessageObjects(m_maxReceiveBatchMessageCount, receivedLmcpMessages);
+                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient completed calling m_lmcpObjectMessageReceiverPipe.getNextMessageObjects()");
 
-                if (receivedLmcpMessage)
+                if (processReceivedLmcpMessageBatch(receivedLmcpMessages, processLmcpMessages))
                 {
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient processing received LMCP message");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", receivedLmcpMessage->m_attributes->getContentType(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", receivedLmcpMessage->m_attributes->getDescriptor(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", receivedLmcpMessage->m_attributes->getSourceGroup(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", receivedLmcpMessage->m_attributes->getSourceEntityId(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", receivedLmcpMessage->m_attributes->getSourceServiceId(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", receivedLmcpMessage->m_attributes->getString(), "]");
-                    if ((m_isBaseClassKillServiceProcessingPermitted
-                            && uxas::messages::uxnative::isKillService(receivedLmcpMessage->m_object)
-                            //&& m_entityIdString.compare(std::static_pointer_cast<uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object)->getEntityID()) == 0//TODO check entityID
-                            && m_networkIdString.compare(std::to_string(std::static_pointer_cast<uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object)->getServiceID())) == 0)
-                            || processReceivedLmcpMessage(std::move(receivedLmcpMessage)))
-                    {
-                        UXAS_LOG_INFORM(m_networkClientTypeName, "::executeNetworkClient starting termination since received [", uxas::messages::uxnative::KillService::TypeName, "] message ");
-                        m_isTerminateNetworkClient = true;
-                    }
+                    m_isTerminateNetworkClient = true;
                 }
             }
             catch (std::exception& ex)
@@ -359,45 +397,16 @@ LmcpObjectNetworkClientBase::executeSerializedNetworkClient()
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeSerializedNetworkClient method START");
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeSerializedNetworkClient method START infinite while loop");
         m_isThreadStarted = true;
+        uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > receivedSerializedLmcpObjects(m_maxReceiveBatchMessageCount);
+        uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > processSerializedLmcpObjects(m_maxReceiveBatchMessageCount);
         while (!m_isTerminateNetworkClient)
         {
-            // get the next serialized LMCP object message (if any) from the LMCP network server
-            std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
-                    nextReceivedSerializedLmcpObject
-                    = m_lmcpObjectMessageReceiverPipe.getNextSerializedMessage();
+            // get all available serialized LMCP object messages (if any) from the LMCP network server
+            m_lmcpObjectMessageReceiverPipe.getNextSerializedMessages(m_maxReceiveBatchMessageCount, receivedSerializedLmcpObjects);
 
-            if (nextReceivedSerializedLmcpObject)
+            if (processReceivedSerializedLmcpMessageBatch(receivedSerializedLmcpObjects, processSerializedLmcpObjects))
             {
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeSerializedNetworkClient processing received LMCP message");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Address:          [", nextReceivedSerializedLmcpObject->getAddress(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getContentType(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getDescriptor(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceGroup(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceEntityId(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceServiceId(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getString(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", nextReceivedSerializedLmcpObject->getPayload(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getString:        [", nextReceivedSerializedLmcpObject->getString(), "]");
-
-                if (m_isBaseClassKillServiceProcessingPermitted
-                        && nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getDescriptor()
-                        .rfind(uxas::messages::uxnative::KillService::Subscription) != std::string::npos)
-                {
-                    // reconstitute LMCP object
-                    std::shared_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextReceivedSerializedLmcpObject->getPayload());
-                    // check KillService serviceID == my serviceID
-                    if (uxas::messages::uxnative::isKillService(lmcpObject)
-                            //&& m_entityIdString.compare(std::static_pointer_cast<uxas::messages::uxnative::KillService>(lmcpObject)->getEntityID()) == 0//TODO check entityID
-                            && m_networkIdString.compare(std::to_string(std::static_pointer_cast<uxas::messages::uxnative::KillService>(lmcpObject)->getServiceID())) == 0)
-                    {
-                        UXAS_LOG_INFORM(m_networkClientTypeName, "::executeSerializedNetworkClient starting termination since received [", uxas::messages::uxnative::KillService::TypeName, "] message ");
-                        m_isTerminateNetworkClient = true;
-                    }
-                }
-                else if (processReceivedSerializedLmcpMessage(std::move(nextReceivedSerializedLmcpObject)))
-                {
-                    m_isTerminateNetworkClient = true;
-                }
+                m_isTerminateNetworkClient = true;
             }
         }
 
@@ -437,29 +446,166 @@ LmcpObjectNetworkClientBase::executeSerializedNetworkClient()
     }
 };
 
-std::shared_ptr<avtas::lmcp::Object>
-LmcpObjectNetworkClientBase::deserializeMessage(const std::string& payload)
+bool
+LmcpObjectNetworkClientBase::processReceivedLmcpMessageBatch(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages,
+                                                             uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& processLmcpMessages)
 {
-    std::shared_ptr<avtas::lmcp::Object> lmcpObject;
+    processLmcpMessages.clear();
 
-    // allocate memory
-    avtas::lmcp::ByteBuffer lmcpByteBuffer;
-    lmcpByteBuffer.allocate(payload.size());
-    lmcpByteBuffer.rewind();
+    bool isKillServiceReceived{false};
+    while (!receivedLmcpMessages.empty())
+    {
+        std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage = receivedLmcpMessages.pop_front();
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::processReceivedLmcpMessageBatch processing received LMCP message");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", receivedLmcpMessage->m_attributes->getContentType(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", receivedLmcpMessage->m_attributes->getDescriptor(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", receivedLmcpMessage->m_attributes->getSourceGroup(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", receivedLmcpMessage->m_attributes->getSourceEntityId(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", receivedLmcpMessage->m_attributes->getSourceServiceId(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", receivedLmcpMessage->m_attributes->getString(), "]");
+        if (m_isBaseClassKillServiceProcessingPermitted
+                && uxas::messages::uxnative::isKillService(receivedLmcpMessage->getObject().get())
+                //&& m_entityIdString.compare(std::static_pointer_cast<const uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object)->getEntityID()) == 0//TODO check entityID
+                && m_networkIdString.compare(std::to_string(std::static_pointer_cast<const uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object)->getServiceID())) == 0)
+        {
+            // messages received before the KillService message are processed, messages received after it are discarded
+            UXAS_LOG_INFORM(m_networkClientTypeName, "::processReceivedLmcpMessageBatch starting termination since received [", uxas::messages::uxnative::KillService::TypeName, "] message ");
+            isKillServiceReceived = true;
+            receivedLmcpMessages.clear();
+            break;
+        }
+        processLmcpMessages.push_back(std::move(receivedLmcpMessage));
+    }
 
-    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
+    // an exception thrown while processing a message only discards that message - 
+    // processing resumes with the messages remaining in the batch
+    bool isTerminate{false};
+    while (!processLmcpMessages.empty() && !isTerminate && !m_isTerminateNetworkClient)
     {
-        lmcpByteBuffer.putByte(payload[charIndex]); // TODO REVIEW
+        try
+        {
+            if (processReceivedLmcpMessages(processLmcpMessages))
+            {
+                UXAS_LOG_INFORM(m_networkClientTypeName, "::processReceivedLmcpMessageBatch starting termination since requested by received LMCP message processing");
+                isTerminate = true;
+            }
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_ERROR(m_networkClientTypeName, "::processReceivedLmcpMessageBatch continuing with [", processLmcpMessages.size(), "] remaining batch messages after EXCEPTION: ", ex.what());
+        }
     }
-    lmcpByteBuffer.rewind();
-    
-    lmcpObject.reset(avtas::lmcp::Factory::getObject(lmcpByteBuffer));
-    if (!lmcpObject)
+
+    return (isTerminate || isKillServiceReceived);
+};
+
+bool
+LmcpObjectNetworkClientBase::processReceivedSerializedLmcpMessageBatch(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& receivedSerializedLmcpMessages,
+                                                                       uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& processSerializedLmcpMessages)
+{
+    processSerializedLmcpMessages.clear();
+
+    bool isKillServiceReceived{false};
+    while (!receivedSerializedLmcpMessages.empty())
     {
-        UXAS_LOG_ERROR("LmcpObjectMessageReceiverPipe::deserializeMessage failed to convert message payload string into an LMCP object");
+        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+                nextReceivedSerializedLmcpObject = receivedSerializedLmcpMessages.pop_front();
+
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::processReceivedSerializedLmcpMessageBatch processing received LMCP message");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Address:          [", nextReceivedSerializedLmcpObject->getAddress(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getContentType(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getDescriptor(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceGroup(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceEntityId(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceServiceId(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getString(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", nextReceivedSerializedLmcpObject->getPayload(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getString:        [", nextReceivedSerializedLmcpObject->getString(), "]");
+
+        if (m_isBaseClassKillServiceProcessingPermitted
+                && nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getDescriptor()
+                .rfind(uxas::messages::uxnative::KillService::Subscription) != std::string::npos)
+        {
+            // reconstitute LMCP object
+            std::shared_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextReceivedSerializedLmcpObject->getPayload());
+            // check KillService serviceID == my serviceID
+            if (uxas::messages::uxnative::isKillService(lmcpObject)
+                    //&& m_entityIdString.compare(std::static_pointer_cast<uxas::messages::uxnative::KillService>(lmcpObject)->getEntityID()) == 0//TODO check entityID
+                    && m_networkIdString.compare(std::to_string(std::static_pointer_cast<uxas::messages::uxnative::KillService>(lmcpObject)->getServiceID())) == 0)
+            {
+                // messages received before the KillService message are processed, messages received after it are discarded
+                UXAS_LOG_INFORM(m_networkClientTypeName, "::processReceivedSerializedLmcpMessageBatch starting termination since received [", uxas::messages::uxnative::KillService::TypeName, "] message ");
+                isKillServiceReceived = true;
+                receivedSerializedLmcpMessages.clear();
+                break;
+            }
+        }
+        else
+        {
+            processSerializedLmcpMessages.push_back(std::move(nextReceivedSerializedLmcpObject));
+        }
     }
 
-    return (lmcpObject);
+    // an exception thrown while processing a message only discards that message - 
+    // processing resumes with the messages remaining in the batch
+    bool isTerminate{false};
+    while (!processSerializedLmcpMessages.empty() && !isTerminate && !m_isTerminateNetworkClient)
+    {
+        try
+        {
+            if (processReceivedSerializedLmcpMessages(processSerializedLmcpMessages))
+            {
+                isTerminate = true;
+            }
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_ERROR(m_networkClientTypeName, "::processReceivedSerializedLmcpMessageBatch continuing with [", processSerializedLmcpMessages.size(), "] remaining batch messages after EXCEPTION: ", ex.what());
+        }
+    }
+
+    return (isTerminate || isKillServiceReceived);
+};
+
+bool
+LmcpObjectNetworkClientBase::processReceivedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages)
+{
+    while (!receivedLmcpMessages.empty())
+    {
+        if (processReceivedLmcpMessage(receivedLmcpMessages.pop_front()))
+        {
+            receivedLmcpMessages.clear();
+            return (true);
+        }
+    }
+    return (false);
+};
+
+bool
+LmcpObjectNetworkClientBase::processReceivedSerializedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& receivedSerializedLmcpMessages)
+{
+    while (!receivedSerializedLmcpMessages.empty())
+    {
+        if (processReceivedSerializedLmcpMessage(receivedSerializedLmcpMessages.pop_front()))
+        {
+            receivedSerializedLmcpMessages.clear();
+            return (true);
+        }
+    }
+    return (false);
+};
+
+void
+LmcpObjectNetworkClientBase::terminateNetworkClient()
+{
+    m_isTerminateNetworkClient = true;
+    m_lmcpObjectMessageReceiverPipe.interruptReceive();
+};
+
+std::shared_ptr<avtas::lmcp::Object>
+LmcpObjectNetworkClientBase::deserializeMessage(const std::string& payload)
+{
+    return (std::shared_ptr<avtas::lmcp::Object>(LmcpObjectMessageReceiverPipe::deserializeMessage(payload)));
 };
 
 void
@@ -12,6 +12,9 @@
 
 #include "LmcpObjectMessageReceiverPipe.h"
 #include "LmcpObjectMessageSenderPipe.h"
+#include "ZeroMqSocketConfiguration.h"
+
+#include "UxAS_RingBuffer.h"
 
 #include "avtas/lmcp/Factory.h"
 
@@ -359,6 +362,61 @@ protected:
     virtual
     bool
     processReceivedSerializedLmcpMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedSerializedLmcpMessage) { return (false); };
+
+    /** \brief The virtual <B><i>processReceivedLmcpMessages</i></B> is invoked 
+     * by the <B><i>LmcpObjectNetworkClientBase</i></B> class with every 
+     * <b>LMCP</b> message received in a single wake-up (batch). The default 
+     * implementation invokes <B><i>processReceivedLmcpMessage</i></B> for each 
+     * message in order. Inheriting classes can override it to process bursts of 
+     * messages together. Implementations remove each message from the buffer 
+     * before processing it: if processing throws an exception, the exception is 
+     * logged and this method is invoked again with the messages remaining in the 
+     * buffer (only the message being processed is lost).
+     * 
+     * @param receivedLmcpMessages received <b>LMCP</b> messages (oldest first).
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    virtual
+    bool
+    processReceivedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages);
+
+    /** \brief The virtual <B><i>processReceivedSerializedLmcpMessages</i></B> is the 
+     * batch counterpart of <B><i>processReceivedSerializedLmcpMessage</i></B> 
+     * (see <B><i>processReceivedLmcpMessages</i></B>).
+     * 
+     * @param receivedSerializedLmcpMessages received AddressedAttributedMessage objects (oldest first).
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    virtual
+    bool
+    processReceivedSerializedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& receivedSerializedLmcpMessages);
+
+    /** \brief The <B><i>processReceivedLmcpMessageBatch</i></B> method is invoked 
+     * by the network client thread with the <b>LMCP</b> messages received in a 
+     * single wake-up. A <B><i>KillService</i></B> message addressed to this 
+     * network client terminates it only after the messages received before the 
+     * <B><i>KillService</i></B> message are processed (see 
+     * <B><i>processReceivedLmcpMessages</i></B>); the messages received after it 
+     * are discarded.
+     * 
+     * @param receivedLmcpMessages received <b>LMCP</b> messages (oldest first), emptied on return.
+     * @param processLmcpMessages buffer (at least as large as <b>receivedLmcpMessages</b>) of the messages to process.
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    bool
+    processReceivedLmcpMessageBatch(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages,
+                                    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& processLmcpMessages);
+
+    /** \brief The <B><i>processReceivedSerializedLmcpMessageBatch</i></B> method is 
+     * the serialized counterpart of <B><i>processReceivedLmcpMessageBatch</i></B>.
+     * 
+     * @param receivedSerializedLmcpMessages received AddressedAttributedMessage objects (oldest first), emptied on return.
+     * @param processSerializedLmcpMessages buffer (at least as large as <b>receivedSerializedLmcpMessages</b>) of the messages to process.
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    bool
+    processReceivedSerializedLmcpMessageBatch(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& receivedSerializedLmcpMessages,
+                                              uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& processSerializedLmcpMessages);
     
 public:
     /** \brief The <B><i>addSubscriptionAddress</i></B> can be invoked 
@@ -434,6 +492,14 @@ protected:
     void
     sendSharedLmcpObjectLimitedCastMessage(const std::string& castAddress, const std::shared_ptr<avtas::lmcp::Object>& lmcpObject);
 
+    /** \brief The <B><i>terminateNetworkClient</i></B> method can be invoked 
+     * from any thread to stop receiving and processing network messages. It 
+     * sets <B><i>m_isTerminateNetworkClient</i></B> and wakes the network 
+     * client thread (required when blocking receive is enabled).
+     */
+    void
+    terminateNetworkClient();
+
 private:
     
     /** \brief The <B><i>initializeNetworkClient</i></B> method is invoked by 
@@ -511,6 +577,14 @@ protected:
     uint32_t m_subclassTerminationWarnDuration_ms{3000};
     uint32_t m_subclassTerminationAttemptPeriod_ms{500};
 
+    /** \brief Maximum count of messages received and processed per wake-up */
+    uint32_t m_maxReceiveBatchMessageCount{256};
+
+    /** \brief Zero MQ socket tuning options of the network client's sockets 
+     * (entity defaults overridden by network client XML attributes, e.g., 
+     * ZeroMqHighWaterMark, ZeroMqSendBufferSize, ZeroMqTcpKeepAlive) */
+    uxas::communications::transport::ZeroMqSocketConfiguration m_zeroMqSocketTuning;
+
 private:
     
     /** \brief  */
@@ -93,6 +93,8 @@ LmcpObjectNetworkPublishPullBridge::configure(const pugi::xml_node& bridgeXmlNod
 bool
 LmcpObjectNetworkPublishPullBridge::initialize()
 {
+    m_externalLmcpObjectMessageReceiverPipe.setSocketTuning(m_zeroMqSocketTuning);
+    m_externalLmcpObjectMessageSenderPipe.setSocketTuning(m_zeroMqSocketTuning);
     m_externalLmcpObjectMessageReceiverPipe.initializeExternalPull(m_entityId, m_networkId,
         m_externalPullSocketAddress, true);
     UXAS_LOG_INFORM(s_typeName(), " external pull socket address is ", m_externalPullSocketAddress);
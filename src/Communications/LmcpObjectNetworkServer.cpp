@@ -9,6 +9,10 @@
 
 #include "LmcpObjectNetworkServer.h"
 
+#include "LmcpObjectSharedMessageHub.h"
+
+#include "UxAS_RingBuffer.h"
+
 #include "UxAS_ConfigurationManager.h"
 #include "UxAS_Log.h"
 
@@ -23,9 +27,12 @@ LmcpObjectNetworkServer::LmcpObjectNetworkServer()
 
 LmcpObjectNetworkServer::~LmcpObjectNetworkServer()
 {
-    if (m_thread && m_thread->joinable())
+    for (auto& shard : m_shards)
     {
-        m_thread->detach();
+        if (shard->m_thread && shard->m_thread->joinable())
+        {
+            shard->m_thread->detach();
+        }
     }
 };
 
@@ -33,6 +40,13 @@ bool
 LmcpObjectNetworkServer::configure()
 {
     m_entityId = uxas::common::ConfigurationManager::getInstance().getEntityId();
+    m_isSharedLmcpObjectFanOut = uxas::common::ConfigurationManager::getInstance().getIsSharedLmcpObjectFanOut();
+    m_isForwarder = uxas::common::ConfigurationManager::getInstance().getIsLmcpNetworkServerForwarder();
+    if (m_isForwarder && m_isSharedLmcpObjectFanOut)
+    {
+        UXAS_LOG_WARN("LmcpObjectNetworkServer::configure disabled forwarder mode (shared LMCP object fan-out requires parsed messages)");
+        m_isForwarder = false;
+    }
     return (true);
 };
 
@@ -44,8 +58,11 @@ LmcpObjectNetworkServer::initializeAndStart()
 
     if (isStarted)
     {
-        m_thread = uxas::stduxas::make_unique<std::thread>(&LmcpObjectNetworkServer::executeNetworkServer, this);
-        UXAS_LOG_INFORM("LmcpObjectNetworkServer::initializeAndStart started LMCP network server processing thread [", m_thread->get_id(), "]");
+        for (uint32_t shardIndex = 0; shardIndex < m_shards.size(); shardIndex++)
+        {
+            m_shards[shardIndex]->m_thread = uxas::stduxas::make_unique<std::thread>(&LmcpObjectNetworkServer::executeNetworkServer, this, shardIndex);
+            UXAS_LOG_INFORM("LmcpObjectNetworkServer::initializeAndStart started LMCP network server shard ", shardIndex, " processing thread [", m_shards[shardIndex]->m_thread->get_id(), "]");
+        }
     }
     return (isStarted);
 }
@@ -54,40 +71,85 @@ void
 LmcpObjectNetworkServer::terminate()
 {
     m_isTerminate = true;
+    for (auto& shard : m_shards)
+    {
+        shard->m_lmcpObjectMessageReceiverPipe.interruptReceive();
+    }
 }
 
 bool
 LmcpObjectNetworkServer::initialize()
 {
-    m_lmcpObjectMessageReceiverPipe.initializePull(m_entityId, m_networkId);
-    m_lmcpObjectMessageSenderPipe.initializePublish("", m_entityId, m_networkId);
-    UXAS_LOG_INFORM("LmcpObjectNetworkServer initialized LMCP network pull receiver and publish sender pipes");
+    uint32_t shardCount = uxas::common::ConfigurationManager::getLmcpNetworkServerShardCount();
+    m_shards.clear();
+    for (uint32_t shardIndex = 0; shardIndex < shardCount; shardIndex++)
+    {
+        std::unique_ptr<HubShard> shard = uxas::stduxas::make_unique<HubShard>();
+        shard->m_lmcpObjectMessageReceiverPipe.initializePull(m_entityId, m_networkId, shardIndex);
+        shard->m_lmcpObjectMessageSenderPipe.initializePublish("", m_entityId, m_networkId, shardIndex);
+        m_shards.push_back(std::move(shard));
+    }
+    UXAS_LOG_INFORM("LmcpObjectNetworkServer initialized LMCP network pull receiver and publish sender pipes for ", shardCount, " shard(s)");
+    if (m_isForwarder)
+    {
+        UXAS_LOG_INFORM("LmcpObjectNetworkServer enabled forwarding of serialized messages without parsing");
+    }
+    if (m_isSharedLmcpObjectFanOut)
+    {
+        // create the shared hub before shard threads start publishing to it
+        LmcpObjectSharedMessageHub::getInstance();
+        UXAS_LOG_INFORM("LmcpObjectNetworkServer enabled shared LMCP object fan-out to in-process network clients");
+    }
 
     return (true);
 };
 
 void
-LmcpObjectNetworkServer::executeNetworkServer()
+LmcpObjectNetworkServer::executeNetworkServer(uint32_t shardIndex)
 {
+    HubShard& shard = *m_shards[shardIndex];
+
+    if (m_isForwarder)
+    {
+        while (!m_isTerminate)
+        {
+            // forward all message frames (if any) sent to the LMCP network hub shard
+            shard.m_lmcpObjectMessageReceiverPipe.forwardSerializedMessages(m_maxReceiveBatchMessageCount,
+                                                                            shard.m_lmcpObjectMessageSenderPipe.getTransportSender());
+        }
+        UXAS_LOG_INFORM("LmcpObjectNetworkServer::executeNetworkServer exiting forwarding loop thread [", std::this_thread::get_id(), "]");
+        return;
+    }
+
+    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > receivedLmcpMessages(m_maxReceiveBatchMessageCount);
     while (!m_isTerminate)
     {
-        // get the next LMCP object message (if any) sent to the LMCP network hub
-        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedLmcpMessage 
-                = m_lmcpObjectMessageReceiverPipe.getNextSerializedMessage();
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("LmcpObjectNetworkServer::executeNetworkServer RECEIVED serialized message");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Address:          [", receivedLmcpMessage->getAddress(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", receivedLmcpMessage->getMessageAttributesReference()->getContentType(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", receivedLmcpMessage->getMessageAttributesReference()->getDescriptor(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", receivedLmcpMessage->getMessageAttributesReference()->getSourceGroup(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", receivedLmcpMessage->getMessageAttributesReference()->getString(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", receivedLmcpMessage->getPayload(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getString:        [", receivedLmcpMessage->getString(), "]");
-
-        if (receivedLmcpMessage)
+        // get all LMCP object messages (if any) sent to the LMCP network hub shard
+        shard.m_lmcpObjectMessageReceiverPipe.getNextSerializedMessages(m_maxReceiveBatchMessageCount, receivedLmcpMessages);
+
+        while (!receivedLmcpMessages.empty())
         {
-            m_lmcpObjectMessageSenderPipe.sendSerializedMessage(std::move(receivedLmcpMessage));
+            std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedLmcpMessage = receivedLmcpMessages.pop_front();
+
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("LmcpObjectNetworkServer::executeNetworkServer RECEIVED serialized message");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Address:          [", receivedLmcpMessage->getAddress(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", receivedLmcpMessage->getMessageAttributesReference()->getContentType(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", receivedLmcpMessage->getMessageAttributesReference()->getDescriptor(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", receivedLmcpMessage->getMessageAttributesReference()->getSourceGroup(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", receivedLmcpMessage->getMessageAttributesReference()->getString(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", receivedLmcpMessage->getPayload(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getString:        [", receivedLmcpMessage->getString(), "]");
+
+            // in-process network clients receive the (once) de-serialized LMCP object
+            if (m_isSharedLmcpObjectFanOut)
+            {
+                LmcpObjectSharedMessageHub::getInstance().publish(*receivedLmcpMessage);
+            }
+
+            // bridges and serialized network clients receive the serialized message
+            shard.m_lmcpObjectMessageSenderPipe.sendSerializedMessage(std::move(receivedLmcpMessage));
             UXAS_LOG_DEBUG_VERBOSE_MESSAGING("LmcpObjectNetworkServer::executeNetworkServer SENT serialized message");
         }
     }
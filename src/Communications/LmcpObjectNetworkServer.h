@@ -17,6 +17,7 @@
 #include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
 
 namespace uxas
 {
@@ -102,8 +103,10 @@ private:
     bool
     initialize();
 
+    /** \brief Receive (from the shard's pull socket) and publish (to the 
+     * shard's publish socket) messages until terminated. */
     void
-    executeNetworkServer();
+    executeNetworkServer(uint32_t shardIndex);
     
     /** \brief  this is the unique ID for the entity represented by this instance of the UxAS software, configured in component manager XML*/
     uint32_t m_entityId;
@@ -111,19 +114,34 @@ private:
     /** \brief unique ID of the component.  */
     uint32_t m_networkId{1};
 
-    /** \brief Pointer to the component's thread.  */
-    std::unique_ptr<std::thread> m_thread;
+    /** \brief Independent pull-publish message hub. Each network client pushes 
+     * all of its messages to the shard selected by its service ID and subscribes 
+     * to all shards, so messages from the same sender remain ordered. */
+    struct HubShard
+    {
+        uxas::communications::LmcpObjectMessageReceiverPipe m_lmcpObjectMessageReceiverPipe;
 
-protected:
+        uxas::communications::LmcpObjectMessageSenderPipe m_lmcpObjectMessageSenderPipe;
 
-    uxas::communications::LmcpObjectMessageReceiverPipe m_lmcpObjectMessageReceiverPipe;
+        /** \brief Pointer to the shard's thread.  */
+        std::unique_ptr<std::thread> m_thread;
+    };
 
-    uxas::communications::LmcpObjectMessageSenderPipe m_lmcpObjectMessageSenderPipe;
-    
-private:
+    std::vector< std::unique_ptr<HubShard> > m_shards;
 
     std::atomic<bool> m_isTerminate{false};
 
+    /** \brief Maximum count of messages received and forwarded per wake-up */
+    uint32_t m_maxReceiveBatchMessageCount{1024};
+
+    /** \brief true implies received messages are also de-serialized once and 
+     * delivered to in-process network clients via <B><i>LmcpObjectSharedMessageHub</i></B> */
+    bool m_isSharedLmcpObjectFanOut{false};
+
+    /** \brief true implies received message frames are forwarded to the 
+     * publish socket without parsing (not compatible with shared fan-out) */
+    bool m_isForwarder{false};
+
 };
 
 }; //namespace communications
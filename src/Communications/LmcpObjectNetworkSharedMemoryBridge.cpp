@@ -0,0 +1,275 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "LmcpObjectNetworkSharedMemoryBridge.h"
+
+#include "UxAS_Log.h"
+#include "Constants/UxAS_String.h"
+
+#include "stdUniquePtr.h"
+
+#include <chrono>
+#include <thread>
+
+namespace uxas
+{
+namespace communications
+{
+
+constexpr uint32_t LmcpObjectNetworkSharedMemoryBridge::s_sendTimeout_ms;
+constexpr uint32_t LmcpObjectNetworkSharedMemoryBridge::s_receiveWaitTimeout_ms;
+
+LmcpObjectNetworkSharedMemoryBridge::LmcpObjectNetworkSharedMemoryBridge()
+{
+};
+
+LmcpObjectNetworkSharedMemoryBridge::~LmcpObjectNetworkSharedMemoryBridge()
+{
+    if (m_sharedMemoryProcessingThread && m_sharedMemoryProcessingThread->joinable())
+    {
+        m_sharedMemoryProcessingThread->detach();
+    }
+};
+
+bool
+LmcpObjectNetworkSharedMemoryBridge::configure(const pugi::xml_node& bridgeXmlNode)
+{
+    bool isSuccess{true};
+
+    if (!bridgeXmlNode.attribute(uxas::common::StringConstant::SharedMemoryName().c_str()).empty())
+    {
+        m_sharedMemoryName = bridgeXmlNode.attribute(uxas::common::StringConstant::SharedMemoryName().c_str()).value();
+        UXAS_LOG_INFORM(s_typeName(), "::configure setting shared memory name to ", m_sharedMemoryName, " from XML configuration");
+    }
+    else
+    {
+        isSuccess = false;
+        UXAS_LOG_ERROR(s_typeName(), "::configure failed to find shared memory name in XML configuration");
+    }
+
+    if (isSuccess)
+    {
+        if (!bridgeXmlNode.attribute(uxas::common::StringConstant::Server().c_str()).empty())
+        {
+            m_isServer = bridgeXmlNode.attribute(uxas::common::StringConstant::Server().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::configure setting server boolean to ", m_isServer, " from XML configuration");
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::configure did not find server boolean in XML configuration; server boolean is ", m_isServer);
+        }
+    }
+
+    if (isSuccess)
+    {
+        if (!bridgeXmlNode.attribute(uxas::common::StringConstant::SharedMemorySize().c_str()).empty())
+        {
+            m_sharedMemorySize = bridgeXmlNode.attribute(uxas::common::StringConstant::SharedMemorySize().c_str()).as_uint();
+            UXAS_LOG_INFORM(s_typeName(), "::configure setting shared memory size to ", m_sharedMemorySize, " from XML configuration");
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::configure did not find shared memory size in XML configuration; shared memory size is ", m_sharedMemorySize);
+        }
+    }
+
+    if (isSuccess)
+    {
+        if (!bridgeXmlNode.attribute("ConsiderSelfGenerated").empty())
+        {
+            m_isConsideredSelfGenerated = bridgeXmlNode.attribute("ConsiderSelfGenerated").as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::configure setting 'ConsiderSelfGenerated' boolean to ", m_isConsideredSelfGenerated, " from XML configuration");
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::configure did not find 'ConsiderSelfGenerated' boolean in XML configuration; 'ConsiderSelfGenerated' boolean is ", m_isConsideredSelfGenerated);
+        }
+    }
+
+    if (isSuccess)
+    {
+        for (pugi::xml_node currentXmlNode = bridgeXmlNode.first_child(); currentXmlNode; currentXmlNode = currentXmlNode.next_sibling())
+        {
+            if (std::string(uxas::common::StringConstant::SubscribeToMessage().c_str()) == currentXmlNode.name())
+            {
+                std::string lmcpSubscribeAddress = currentXmlNode.attribute(uxas::common::StringConstant::MessageType().c_str()).value();
+                if (!lmcpSubscribeAddress.empty())
+                {
+                    addSubscriptionAddress(lmcpSubscribeAddress);
+                }
+            }
+            else if (std::string(uxas::common::StringConstant::TransformReceivedMessage().c_str()) == currentXmlNode.name())
+            {
+                const std::string lmcpAddress = currentXmlNode.attribute(uxas::common::StringConstant::MessageType().c_str()).value();
+                const std::string alias = currentXmlNode.attribute(uxas::common::StringConstant::Alias().c_str()).value();
+
+                if (!lmcpAddress.empty() && !alias.empty())
+                {
+                    m_messageAddressToAlias[lmcpAddress] = alias;
+                }
+            }
+        }
+
+        // do not forward any uni-cast messages addressed to this bridge
+        UXAS_LOG_INFORM(s_typeName(), "::configure adding non-forward address [", getNetworkClientUnicastAddress(m_entityId, m_networkId), "]");
+        m_nonImportForwardAddresses.emplace(getNetworkClientUnicastAddress(m_entityId, m_networkId));
+        m_nonExportForwardAddresses.emplace(getNetworkClientUnicastAddress(m_entityId, m_networkId));
+    }
+
+    return (isSuccess);
+};
+
+bool
+LmcpObjectNetworkSharedMemoryBridge::initialize()
+{
+    UXAS_LOG_INFORM(s_typeName(), "::initialize - START");
+    if (m_isServer)
+    {
+        // server creates the segment up front; clients attach in the receive processing thread
+        if (!m_sharedMemoryChannel.open(m_sharedMemoryName, m_sharedMemorySize, true))
+        {
+            UXAS_LOG_ERROR(s_typeName(), "::initialize failed to create shared memory ", m_sharedMemoryName);
+            return (false);
+        }
+        m_isSharedMemoryChannelOpen = true;
+    }
+    UXAS_LOG_INFORM(s_typeName(), "::initialize succeeded");
+    return (true);
+};
+
+bool
+LmcpObjectNetworkSharedMemoryBridge::start()
+{
+    m_sharedMemoryProcessingThread = uxas::stduxas::make_unique<std::thread>(&LmcpObjectNetworkSharedMemoryBridge::executeSharedMemoryReceiveProcessing, this);
+    UXAS_LOG_INFORM(s_typeName(), "::start shared memory receive processing thread [", m_sharedMemoryProcessingThread->get_id(), "]");
+    return (true);
+};
+
+bool
+LmcpObjectNetworkSharedMemoryBridge::terminate()
+{
+    m_isTerminate = true;
+    if (m_isSharedMemoryChannelOpen)
+    {
+        // wake the receive thread (clients set the open flag only after attaching)
+        m_sharedMemoryChannel.interrupt();
+    }
+    if (m_sharedMemoryProcessingThread && m_sharedMemoryProcessingThread->joinable())
+    {
+        m_sharedMemoryProcessingThread->join();
+        UXAS_LOG_INFORM(s_typeName(), "::terminate calling thread completed m_sharedMemoryProcessingThread join");
+    }
+    else
+    {
+        UXAS_LOG_WARN(s_typeName(), "::terminate unexpectedly could not join m_sharedMemoryProcessingThread");
+    }
+    m_isSharedMemoryChannelOpen = false;
+    m_sharedMemoryChannel.close();
+    return (true);
+};
+
+bool
+LmcpObjectNetworkSharedMemoryBridge::processReceivedSerializedLmcpMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedLmcpMessage)
+{
+    // send message to the co-located entity
+    UXAS_LOG_DEBUGGING(s_typeName(), "::processReceivedSerializedLmcpMessage [", m_entityIdNetworkIdUnicastString,
+            "] before processing serialized message having address ", receivedLmcpMessage->getAddress(),
+                  " and size ", receivedLmcpMessage->getPayload().size());
+
+    if (m_nonExportForwardAddresses.find(receivedLmcpMessage->getAddress()) != m_nonExportForwardAddresses.end())
+    {
+        UXAS_LOG_INFORM(s_typeName(), "::processReceivedSerializedLmcpMessage ignoring non-export message with address ", receivedLmcpMessage->getAddress(), ", source entity ID ", receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId(), " and source service ID ", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId());
+    }
+    else if (!m_isSharedMemoryChannelOpen)
+    {
+        UXAS_LOG_WARN(s_typeName(), "::processReceivedSerializedLmcpMessage dropping message with address ", receivedLmcpMessage->getAddress(), " since shared memory ", m_sharedMemoryName, " is not yet connected");
+    }
+    else
+    {
+        // a full ring blocks (back-pressure, sleeping until the other entity 
+        // receives a message) until the other entity catches up or the timeout expires
+        bool isSent = m_sharedMemoryChannel.send(receivedLmcpMessage->getString());
+        if (!isSent && !m_isTerminate
+                && m_sharedMemoryChannel.waitForSend(receivedLmcpMessage->getString().size(), s_sendTimeout_ms))
+        {
+            isSent = m_sharedMemoryChannel.send(receivedLmcpMessage->getString());
+        }
+        if (!isSent)
+        {
+            UXAS_LOG_WARN(s_typeName(), "::processReceivedSerializedLmcpMessage dropping message with address ", receivedLmcpMessage->getAddress(), " and size ", receivedLmcpMessage->getString().size(), " since shared memory ", m_sharedMemoryName, " is full");
+        }
+    }
+
+    return (false); // always false implies never terminating bridge from here
+};
+
+void
+LmcpObjectNetworkSharedMemoryBridge::executeSharedMemoryReceiveProcessing()
+{
+    try
+    {
+        while (!m_isTerminate && !m_isSharedMemoryChannelOpen)
+        {
+            if (m_sharedMemoryChannel.open(m_sharedMemoryName, 0, false))
+            {
+                m_isSharedMemoryChannelOpen = true;
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+
+        std::string serializedMessage;
+        while (!m_isTerminate)
+        {
+            if (!m_sharedMemoryChannel.receive(serializedMessage))
+            {
+                // sleep until the other entity sends a message (or terminate interrupts the wait)
+                m_sharedMemoryChannel.waitForReceive(s_receiveWaitTimeout_ms);
+                continue;
+            }
+
+            auto receivedMessage = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+            if (!receivedMessage->setAddressAttributesAndPayloadFromDelimitedString(std::move(serializedMessage)))
+            {
+                UXAS_LOG_WARN(s_typeName(), "::executeSharedMemoryReceiveProcessing ignoring invalid message from shared memory ", m_sharedMemoryName);
+                continue;
+            }
+
+            if (m_nonImportForwardAddresses.find(receivedMessage->getAddress()) == m_nonImportForwardAddresses.end())
+            {
+                if (m_isConsideredSelfGenerated)
+                {
+                    receivedMessage->updateSourceAttributes("SharedMemoryBridge", std::to_string(m_entityId), std::to_string(m_networkId));
+                }
+
+                const auto it = m_messageAddressToAlias.find(receivedMessage->getAddress());
+                if (it != m_messageAddressToAlias.cend())
+                {
+                    receivedMessage->updateAddress(it->second);
+                }
+
+                sendSerializedLmcpObjectMessage(std::move(receivedMessage));
+            }
+            else
+            {
+                UXAS_LOG_INFORM(s_typeName(), "::executeSharedMemoryReceiveProcessing ignoring non-import message with address ", receivedMessage->getAddress(), ", source entity ID ", receivedMessage->getMessageAttributesReference()->getSourceEntityId(), " and source service ID ", receivedMessage->getMessageAttributesReference()->getSourceServiceId());
+            }
+        }
+        UXAS_LOG_INFORM(s_typeName(), "::executeSharedMemoryReceiveProcessing exiting infinite loop thread [", std::this_thread::get_id(), "]");
+    }
+    catch (std::exception& ex)
+    {
+        UXAS_LOG_ERROR(s_typeName(), "::executeSharedMemoryReceiveProcessing EXCEPTION: ", ex.what());
+    }
+};
+
+}; //namespace communications
+}; //namespace uxas
@@ -0,0 +1,144 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_LMCP_OBJECT_NETWORK_SHARED_MEMORY_BRIDGE_H
+#define UXAS_MESSAGE_LMCP_OBJECT_NETWORK_SHARED_MEMORY_BRIDGE_H
+
+#include "LmcpObjectNetworkClientBase.h"
+#include "SharedMemoryMessageChannel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace uxas
+{
+namespace communications
+{
+
+/** \class LmcpObjectNetworkSharedMemoryBridge
+    \brief A bridge that connects two co-located UxAS entities through shared memory.
+
+ *
+ *
+ *  @par Description:
+ * The <B>Shared Memory Bridge<B/> exchanges serialized LMCP messages with a
+ * UxAS entity on the same host through a POSIX shared memory segment holding
+ * a lock-free ring buffer per direction (see <B><i>SharedMemoryMessageChannel</i></B>).
+ * Messages are copied once into and once out of shared memory; no sockets or
+ * kernel calls are involved in the steady state. Import/export filtering and
+ * message aliasing behave as for the <B>TCP Bridge<B/>.
+ *
+ * @par Details:
+ * <ul style="padding-left:1em;margin-left:0">
+ * <li> Subscription -
+ * Subscribed messages are configured through <B><I>SubscribeToMessage<I/><B/>
+ * XML nodes. Received message addresses can be aliased through
+ * <B><I>TransformReceivedMessage<I/><B/> XML nodes.
+ *
+ * <li> Client/Server -
+ * Exactly one of the two connected bridges must set the configuration
+ * attribute <B><I>Server<I/><B/> to "true" (the default). The server creates
+ * the shared memory segment; the client attaches to it (retrying until the
+ * server is up). Restarting the server requires restarting the client.
+ *
+ * <li> Addressing -
+ * The attribute <B><I>SharedMemoryName<I/><B/> names the shared memory object
+ * (e.g., "uxas_400_to_500"). The server attribute <B><I>SharedMemorySize<I/><B/>
+ * sets the capacity of each ring in bytes (default 4 MiB).
+ *
+ * <li> Platform -
+ * Not supported on Windows.
+ *
+ * </ul> @n
+ */
+
+class LmcpObjectNetworkSharedMemoryBridge : public LmcpObjectNetworkClientBase
+{
+public:
+
+    static const std::string&
+    s_typeName() { static std::string s_string("LmcpObjectNetworkSharedMemoryBridge"); return (s_string); };
+
+    LmcpObjectNetworkSharedMemoryBridge();
+
+    ~LmcpObjectNetworkSharedMemoryBridge();
+
+private:
+
+    /** \brief Copy construction not permitted */
+    LmcpObjectNetworkSharedMemoryBridge(LmcpObjectNetworkSharedMemoryBridge const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(LmcpObjectNetworkSharedMemoryBridge const&) = delete;
+
+public:
+
+    bool
+    configure(const pugi::xml_node& bridgeXmlNode) override;
+
+private:
+
+    bool
+    initialize() override;
+
+    bool
+    start() override;
+
+    bool
+    terminate() override;
+
+    bool
+    processReceivedSerializedLmcpMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+                                receivedLmcpMessage) override;
+
+    void
+    executeSharedMemoryReceiveProcessing();
+
+    /** \brief Maximum time to wait for space in a full outgoing ring before dropping a message */
+    static constexpr uint32_t s_sendTimeout_ms{1000};
+
+    /** \brief Maximum time the receive thread sleeps between checks for termination */
+    static constexpr uint32_t s_receiveWaitTimeout_ms{100};
+
+    std::atomic<bool> m_isTerminate{false};
+
+    /** \brief Shared memory receive processing thread.  */
+    std::unique_ptr<std::thread> m_sharedMemoryProcessingThread;
+
+    uxas::communications::transport::SharedMemoryMessageChannel m_sharedMemoryChannel;
+
+    /** \brief Set once <B><i>m_sharedMemoryChannel</i></B> is open (clients attach asynchronously) */
+    std::atomic<bool> m_isSharedMemoryChannelOpen{false};
+
+    std::set<std::string> m_nonImportForwardAddresses;
+    std::set<std::string> m_nonExportForwardAddresses;
+
+    /** \brief Name of the shared memory object shared with the other entity */
+    std::string m_sharedMemoryName;
+    /** \brief Capacity (bytes) of each ring buffer (server only) */
+    uint32_t m_sharedMemorySize{4 * 1024 * 1024};
+    /** \brief  If this is set to true the bridge creates the shared memory
+     segment. If it is false the bridge attaches to it. Defaults to true */
+    bool m_isServer{true};
+    /** \brief  If this is set to `true`, received messages are reported as if
+     * they originated from the entity hosting the bridge (see <B>TCP Bridge<B/>). */
+    bool m_isConsideredSelfGenerated{true};
+
+    std::map<std::string, std::string> m_messageAddressToAlias;
+};
+
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_LMCP_OBJECT_NETWORK_SHARED_MEMORY_BRIDGE_H */
@@ -114,6 +114,8 @@ LmcpObjectNetworkSubscribePushBridge::configure(const pugi::xml_node& bridgeXmlN
 bool
 LmcpObjectNetworkSubscribePushBridge::initialize()
 {
+    m_externalLmcpObjectMessageReceiverPipe.setSocketTuning(m_zeroMqSocketTuning);
+    m_externalLmcpObjectMessageSenderPipe.setSocketTuning(m_zeroMqSocketTuning);
     m_externalLmcpObjectMessageReceiverPipe.initializeExternalSubscription(m_entityId, m_networkId,
         m_externalSubscribeSocketAddress, false);
     UXAS_LOG_INFORM(s_typeName(), " external subscribe socket address is ", m_externalSubscribeSocketAddress);
@@ -70,6 +70,33 @@ LmcpObjectNetworkTcpBridge::configure(const pugi::xml_node& bridgeXmlNode)
         }
     }
 
+    if (isSuccess)
+    {
+        if (!bridgeXmlNode.attribute(uxas::common::StringConstant::TcpFraming().c_str()).empty())
+        {
+            std::string tcpFraming = bridgeXmlNode.attribute(uxas::common::StringConstant::TcpFraming().c_str()).value();
+            if (tcpFraming == "LengthPrefixed")
+            {
+                m_isLengthPrefixedFraming = true;
+            }
+            else if (tcpFraming != "Sentinel")
+            {
+                UXAS_LOG_WARN(s_typeName(), "::configure ignoring unknown TCP framing ", tcpFraming, " (expected LengthPrefixed or Sentinel)");
+            }
+            UXAS_LOG_INFORM(s_typeName(), "::configure setting length-prefixed framing boolean to ", m_isLengthPrefixedFraming, " from XML configuration");
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::configure did not find TCP framing in XML configuration; length-prefixed framing boolean is ", m_isLengthPrefixedFraming);
+        }
+
+        if (!bridgeXmlNode.attribute(uxas::common::StringConstant::TcpFramingChecksum().c_str()).empty())
+        {
+            m_isFramingChecksumEnabled = bridgeXmlNode.attribute(uxas::common::StringConstant::TcpFramingChecksum().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::configure setting framing checksum boolean to ", m_isFramingChecksumEnabled, " from XML configuration");
+        }
+    }
+
     if (isSuccess)
     {
         if (!bridgeXmlNode.attribute("ConsiderSelfGenerated").empty())
@@ -129,6 +156,8 @@ bool
 LmcpObjectNetworkTcpBridge::initialize()
 {
     UXAS_LOG_INFORM(s_typeName(), "::initialize - START");
+    m_externalLmcpObjectMessageTcpReceiverSenderPipe.setSocketTuning(m_zeroMqSocketTuning);
+    m_externalLmcpObjectMessageTcpReceiverSenderPipe.setLengthPrefixedFraming(m_isLengthPrefixedFraming, m_isFramingChecksumEnabled);
     m_externalLmcpObjectMessageTcpReceiverSenderPipe.initializeStream(m_entityId, m_networkId, m_tcpReceiveSendAddress, m_isServer);
     UXAS_LOG_INFORM(s_typeName(), "::initialize succeeded");
     return (true);
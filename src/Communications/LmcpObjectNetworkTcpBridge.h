@@ -66,6 +66,12 @@ namespace communications
  * file. The attribute: <B><I>TcpAddress<I/><B/> is used to set the address, 
  * see @ref m_ptr_ZsckTcpConnection.
  * 
+ * <li> Framing -
+ * The attribute: <B><I>TcpFraming<I/><B/> selects "Sentinel" (default, legacy)
+ * or "LengthPrefixed" (binary) framing of sent messages; received framing is
+ * detected automatically. <B><I>TcpFramingChecksum<I/><B/> adds a CRC32C to
+ * length-prefixed frames.
+ * 
  * 
  * 
  * </ul> @n
@@ -142,6 +148,13 @@ private:
      * simulation where the messages received would be considered self-generated in
      * normal operation. */
     bool m_isConsideredSelfGenerated{true};
+    /** \brief  If `TcpFraming` is set to "LengthPrefixed", messages are sent with
+     * binary length-prefixed framing. Otherwise ("Sentinel", the default), legacy
+     * sentinel framing is sent until the external entity sends length-prefixed frames. */
+    bool m_isLengthPrefixedFraming{false};
+    /** \brief  If `TcpFramingChecksum` is set to `true`, length-prefixed frames
+     * include a CRC32C of the message. Defaults to false (TCP is checksummed). */
+    bool m_isFramingChecksumEnabled{false};
     
     std::map<std::string, std::string> m_messageAddressToAlias;
 };
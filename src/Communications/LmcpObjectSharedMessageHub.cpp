@@ -0,0 +1,218 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "LmcpObjectSharedMessageHub.h"
+
+#include "LmcpObjectMessageReceiverPipe.h"
+
+#include "UxAS_Log.h"
+
+#include "stdUniquePtr.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace uxas
+{
+namespace communications
+{
+
+LmcpObjectSharedMessageHub&
+LmcpObjectSharedMessageHub::getInstance()
+{
+    // first time/one time creation (thread-safe initialization of function-local static)
+    static LmcpObjectSharedMessageHub s_instance;
+    return (s_instance);
+};
+
+std::shared_ptr<LmcpObjectSharedMessageHub::Receiver>
+LmcpObjectSharedMessageHub::registerReceiver(uint32_t entityId, uint32_t serviceId)
+{
+    std::shared_ptr<Receiver> receiver = std::make_shared<Receiver>(entityId, serviceId);
+    std::lock_guard<std::mutex> lock(m_receiversMutex);
+    m_receivers.push_back(receiver);
+    UXAS_LOG_INFORM("LmcpObjectSharedMessageHub::registerReceiver registered receiver for entity ID ", entityId, " and network ID ", serviceId);
+    return (receiver);
+};
+
+void
+LmcpObjectSharedMessageHub::unregisterReceiver(const std::shared_ptr<Receiver>& receiver)
+{
+    std::lock_guard<std::mutex> lock(m_receiversMutex);
+    m_receivers.erase(std::remove(m_receivers.begin(), m_receivers.end(), receiver), m_receivers.end());
+};
+
+uint32_t
+LmcpObjectSharedMessageHub::publish(uxas::communications::data::AddressedAttributedMessage& serializedLmcpMessage)
+{
+    const std::unique_ptr<uxas::communications::data::MessageAttributes>& attributes = serializedLmcpMessage.getMessageAttributesReference();
+    if (!serializedLmcpMessage.isValid() || !attributes)
+    {
+        return (0);
+    }
+
+    std::vector< std::shared_ptr<Receiver> > subscribedReceivers;
+    {
+        std::lock_guard<std::mutex> lock(m_receiversMutex);
+        for (auto& receiver : m_receivers)
+        {
+            if (receiver->isMessageAccepted(serializedLmcpMessage.getAddress(), attributes->getSourceEntityId(), attributes->getSourceServiceId()))
+            {
+                subscribedReceivers.push_back(receiver);
+            }
+        }
+    }
+
+    if (subscribedReceivers.empty())
+    {
+        return (0);
+    }
+
+    // de-serialize once for all subscribed receivers
+    std::shared_ptr<const avtas::lmcp::Object> lmcpObject(LmcpObjectMessageReceiverPipe::deserializeMessage(serializedLmcpMessage.getPayload()));
+    if (!lmcpObject)
+    {
+        return (0);
+    }
+
+    for (auto& receiver : subscribedReceivers)
+    {
+        receiver->pushMessage(uxas::stduxas::make_unique<uxas::communications::data::MessageAttributes>(*attributes), lmcpObject);
+    }
+    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("LmcpObjectSharedMessageHub::publish delivered ", attributes->getDescriptor(), " to ", subscribedReceivers.size(), " receivers");
+
+    return (static_cast<uint32_t>(subscribedReceivers.size()));
+};
+
+bool
+LmcpObjectSharedMessageHub::Receiver::addSubscriptionAddress(const std::string& address)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (m_subscriptionAddresses.emplace(address).second);
+};
+
+bool
+LmcpObjectSharedMessageHub::Receiver::removeSubscriptionAddress(const std::string& address)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (m_subscriptionAddresses.erase(address) > 0);
+};
+
+bool
+LmcpObjectSharedMessageHub::Receiver::removeAllSubscriptionAddresses()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_subscriptionAddresses.clear();
+    return (true);
+};
+
+bool
+LmcpObjectSharedMessageHub::Receiver::isMessageAccepted(const std::string& address, const std::string& sourceEntityId, const std::string& sourceServiceId)
+{
+    // network clients do not receive their own messages
+    if (m_entityIdString == sourceEntityId && m_serviceIdString == sourceServiceId)
+    {
+        return (false);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& subscriptionAddress : m_subscriptionAddresses)
+    {
+        if (address.compare(0, subscriptionAddress.size(), subscriptionAddress) == 0)
+        {
+            return (true);
+        }
+    }
+    return (false);
+};
+
+void
+LmcpObjectSharedMessageHub::Receiver::pushMessage(std::unique_ptr<uxas::communications::data::MessageAttributes> messageAttributes,
+                                                  const std::shared_ptr<const avtas::lmcp::Object>& lmcpObject)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messages.push_back(SharedMessage{std::move(messageAttributes), lmcpObject});
+    }
+    m_messageAvailable.notify_one();
+};
+
+std::unique_ptr<uxas::communications::data::LmcpMessage>
+LmcpObjectSharedMessageHub::Receiver::getNextMessage(int32_t waitTime_ms)
+{
+    SharedMessage nextMessage;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitForMessages(lock, waitTime_ms);
+
+        if (!m_messages.empty())
+        {
+            nextMessage = std::move(m_messages.front());
+            m_messages.pop_front();
+        }
+    }
+
+    if (!nextMessage.m_object)
+    {
+        return (nullptr);
+    }
+    return (createMessage(nextMessage));
+};
+
+uint32_t
+LmcpObjectSharedMessageHub::Receiver::getNextMessages(int32_t waitTime_ms, uint32_t maxMessageCount,
+                                                      uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& messages)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    waitForMessages(lock, waitTime_ms);
+    size_t messageCount = (std::min)({static_cast<size_t>(maxMessageCount), static_cast<size_t>(messages.capacity() - messages.size()), m_messages.size()});
+    for (size_t i = 0; i < messageCount; i++)
+    {
+        messages.push_back(createMessage(m_messages.front()));
+        m_messages.pop_front();
+    }
+    return (static_cast<uint32_t>(messageCount));
+};
+
+std::unique_ptr<uxas::communications::data::LmcpMessage>
+LmcpObjectSharedMessageHub::Receiver::createMessage(SharedMessage& sharedMessage)
+{
+    return (uxas::stduxas::make_unique<uxas::communications::data::LmcpMessage>(std::move(sharedMessage.m_attributes),
+            std::move(sharedMessage.m_object)));
+};
+
+void
+LmcpObjectSharedMessageHub::Receiver::waitForMessages(std::unique_lock<std::mutex>& lock, int32_t waitTime_ms)
+{
+    if (m_messages.empty())
+    {
+        if (waitTime_ms < 0)
+        {
+            m_messageAvailable.wait(lock, [this] { return (!m_messages.empty() || m_isInterrupted); });
+        }
+        else
+        {
+            m_messageAvailable.wait_for(lock, std::chrono::milliseconds(waitTime_ms), [this] { return (!m_messages.empty() || m_isInterrupted); });
+        }
+    }
+    m_isInterrupted = false;
+};
+
+void
+LmcpObjectSharedMessageHub::Receiver::interrupt()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isInterrupted = true;
+    }
+    m_messageAvailable.notify_one();
+};
+
+}; //namespace communications
+}; //namespace uxas
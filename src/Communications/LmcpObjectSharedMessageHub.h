@@ -0,0 +1,198 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_LMCP_OBJECT_SHARED_MESSAGE_HUB_H
+#define UXAS_MESSAGE_LMCP_OBJECT_SHARED_MESSAGE_HUB_H
+
+#include "AddressedAttributedMessage.h"
+#include "LmcpMessage.h"
+
+#include "UxAS_RingBuffer.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace uxas
+{
+namespace communications
+{
+
+/** \class LmcpObjectSharedMessageHub
+ *
+ * \par Description:
+ * The <B><i>LmcpObjectSharedMessageHub</i></B> delivers <b>LMCP</b> objects to
+ * in-process network clients without repeated de-serialization. The
+ * <B><i>LmcpObjectNetworkServer</i></B> publishes each received message to the
+ * hub, which de-serializes the payload once (only if at least one registered
+ * receiver subscribes to the message address) and hands the same
+ * (const) <b>LMCP</b> object instance to every subscribed receiver.
+ *
+ * \par Immutability:
+ * The shared object is never modified. Every receiver's
+ * <B><i>LmcpMessage</i></B> holds the same const object (see
+ * <B><i>LmcpMessage::m_object</i></B>); a network client that needs to modify
+ * a received object modifies a clone.
+ *
+ * \par Threading:
+ * <B><i>LmcpObjectSharedMessageHub</i></B> is thread-safe. Each
+ * <B><i>Receiver</i></B> is intended to be consumed by a single thread.
+ *
+ * \n
+ */
+class LmcpObjectSharedMessageHub final
+{
+public:
+
+    /** \class Receiver
+     *
+     * \par Description:
+     * Per network client message queue and subscription address set.
+     * Subscription addresses are matched as prefixes of the message address
+     * (consistent with Zero MQ SUB socket filtering).
+     *
+     * \n
+     */
+    class Receiver final
+    {
+    public:
+
+        Receiver(uint32_t entityId, uint32_t serviceId)
+        : m_entityIdString(std::to_string(entityId)), m_serviceIdString(std::to_string(serviceId)) { };
+
+        bool
+        addSubscriptionAddress(const std::string& address);
+
+        bool
+        removeSubscriptionAddress(const std::string& address);
+
+        bool
+        removeAllSubscriptionAddresses();
+
+        /** \brief Returns true if any subscription address is a prefix of
+         * the message address and the message was not sent by this receiver's
+         * network client. */
+        bool
+        isMessageAccepted(const std::string& address, const std::string& sourceEntityId, const std::string& sourceServiceId);
+
+        void
+        pushMessage(std::unique_ptr<uxas::communications::data::MessageAttributes> messageAttributes,
+                    const std::shared_ptr<const avtas::lmcp::Object>& lmcpObject);
+
+        /** \brief Get next shared LMCP message, waiting up to <b>waitTime_ms</b>
+         * milliseconds for a message to arrive.
+         *
+         * @param waitTime_ms maximum wait duration in milliseconds (-1 waits 
+         * until a message arrives or <B><i>interrupt</i></B> is called).
+         * @return <b>LMCP</b> message object (empty if none available).
+         */
+        std::unique_ptr<uxas::communications::data::LmcpMessage>
+        getNextMessage(int32_t waitTime_ms);
+
+        /** \brief Get all queued shared LMCP messages (up to <b>maxMessageCount</b>), 
+         * waiting up to <b>waitTime_ms</b> milliseconds only if none are queued.
+         *
+         * @param waitTime_ms maximum wait duration in milliseconds (-1 waits 
+         * until a message arrives or <B><i>interrupt</i></B> is called).
+         * @param maxMessageCount maximum count of messages added to <b>messages</b>.
+         * @param messages caller-provided buffer the messages are added to.
+         * @return count of messages added to <b>messages</b>.
+         */
+        uint32_t
+        getNextMessages(int32_t waitTime_ms, uint32_t maxMessageCount,
+                        uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& messages);
+
+        /** \brief Wake a thread waiting in <B><i>getNextMessage</i></B>. */
+        void
+        interrupt();
+
+    private:
+
+        /** \brief Queued message attributes and shared (const) object. */
+        struct SharedMessage
+        {
+            std::unique_ptr<uxas::communications::data::MessageAttributes> m_attributes;
+            std::shared_ptr<const avtas::lmcp::Object> m_object;
+        };
+
+        /** \brief Create a network client message sharing the (const) object. */
+        static std::unique_ptr<uxas::communications::data::LmcpMessage>
+        createMessage(SharedMessage& sharedMessage);
+
+        /** \brief Wait (<b>lock</b> must hold <B><i>m_mutex</i></B>) until a 
+         * message is queued, <B><i>interrupt</i></B> is called or 
+         * <b>waitTime_ms</b> elapses. */
+        void
+        waitForMessages(std::unique_lock<std::mutex>& lock, int32_t waitTime_ms);
+
+        std::string m_entityIdString;
+        std::string m_serviceIdString;
+
+        std::mutex m_mutex;
+        std::condition_variable m_messageAvailable;
+        bool m_isInterrupted{false};
+        std::deque<SharedMessage> m_messages;
+        std::unordered_set<std::string> m_subscriptionAddresses;
+    };
+
+    static LmcpObjectSharedMessageHub& getInstance();
+
+    ~LmcpObjectSharedMessageHub() { };
+
+private:
+
+    /** \brief Public, direct construction not permitted (singleton pattern) */
+    LmcpObjectSharedMessageHub() { };
+
+    /** \brief Copy construction not permitted */
+    LmcpObjectSharedMessageHub(LmcpObjectSharedMessageHub const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(LmcpObjectSharedMessageHub const&) = delete;
+
+public:
+
+    /** \brief Creates and registers a shared message receiver for a network client.
+     *
+     * @param entityId UxAS entity ID of the network client.
+     * @param serviceId network ID of the network client.
+     * @return registered receiver.
+     */
+    std::shared_ptr<Receiver>
+    registerReceiver(uint32_t entityId, uint32_t serviceId);
+
+    void
+    unregisterReceiver(const std::shared_ptr<Receiver>& receiver);
+
+    /** \brief De-serializes the payload of a serialized <b>LMCP</b> message
+     * at most once and delivers the resulting object to every subscribed
+     * receiver.
+     *
+     * @param serializedLmcpMessage message with serialized <b>LMCP</b> object payload.
+     * @return number of receivers the message was delivered to.
+     */
+    uint32_t
+    publish(uxas::communications::data::AddressedAttributedMessage& serializedLmcpMessage);
+
+private:
+
+    std::mutex m_receiversMutex;
+    std::vector< std::shared_ptr<Receiver> > m_receivers;
+
+};
+
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_LMCP_OBJECT_SHARED_MESSAGE_HUB_H */
@@ -43,8 +43,8 @@ public:
     MessageAttributes() { };
 
     bool
-    setAttributes(const std::string contentType, const std::string descriptor,
-                  const std::string sourceGroup, const std::string sourceEntityId, const std::string sourceServiceId)
+    setAttributes(std::string contentType, std::string descriptor,
+                  std::string sourceGroup, std::string sourceEntityId, std::string sourceServiceId)
     {
         if (contentType.length() < 1)
         {
@@ -74,18 +74,11 @@ public:
             return (m_isValid);
         }
 
-        m_contentType.clear();
-        m_descriptor.clear();
-        m_sourceGroup.clear();
-        m_sourceEntityId.clear();
-        m_sourceServiceId.clear();
-        m_string.clear();
-        
-        m_contentType = contentType;
-        m_descriptor = descriptor;
-        m_sourceGroup = sourceGroup;
-        m_sourceEntityId = sourceEntityId;
-        m_sourceServiceId = sourceServiceId;
+        m_contentType = std::move(contentType);
+        m_descriptor = std::move(descriptor);
+        m_sourceGroup = std::move(sourceGroup);
+        m_sourceEntityId = std::move(sourceEntityId);
+        m_sourceServiceId = std::move(sourceServiceId);
         
         m_string = m_contentType + AddressedMessage::s_fieldDelimiter()
                 + m_descriptor + AddressedMessage::s_fieldDelimiter()
@@ -0,0 +1,430 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "SharedMemoryMessageChannel.h"
+
+#include "UxAS_Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+namespace
+{
+
+size_t
+alignToCacheLine(size_t size)
+{
+    return ((size + 63) & ~static_cast<size_t>(63));
+};
+
+}; //namespace
+
+constexpr uint64_t SharedMemoryMessageChannel::s_magic;
+constexpr uint32_t SharedMemoryMessageChannel::s_version;
+constexpr uint32_t SharedMemoryMessageChannel::s_lengthSize;
+
+SharedMemoryMessageChannel::~SharedMemoryMessageChannel()
+{
+    close();
+};
+
+size_t
+SharedMemoryMessageChannel::getRingOffset(uint32_t ringIndex, uint32_t ringCapacity)
+{
+    return (alignToCacheLine(sizeof (SegmentHeader))
+            + ringIndex * (alignToCacheLine(sizeof (RingHeader)) + alignToCacheLine(ringCapacity)));
+};
+
+size_t
+SharedMemoryMessageChannel::getSegmentSize(uint32_t ringCapacity)
+{
+    return (getRingOffset(2, ringCapacity));
+};
+
+bool
+SharedMemoryMessageChannel::open(const std::string& name, uint32_t ringCapacity, bool isServer)
+{
+#ifdef _WIN32
+    UXAS_LOG_ERROR("SharedMemoryMessageChannel::open shared memory channels are not supported on this platform");
+    return (false);
+#else
+    close();
+
+    if (!std::atomic<uint64_t>().is_lock_free())
+    {
+        UXAS_LOG_ERROR("SharedMemoryMessageChannel::open requires lock-free 64-bit atomics");
+        return (false);
+    }
+
+    m_name = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    m_isServer = isServer;
+
+    int fileDescriptor{-1};
+    size_t segmentSize{0};
+    if (m_isServer)
+    {
+        if (ringCapacity <= s_lengthSize)
+        {
+            UXAS_LOG_ERROR("SharedMemoryMessageChannel::open invalid ring capacity ", ringCapacity);
+            return (false);
+        }
+        segmentSize = getSegmentSize(ringCapacity);
+        // an existing segment (e.g., left by a previous run) is re-used and its header re-initialized 
+        // below - truncating it would raise SIGBUS in a process that still has it mapped
+        struct stat segmentStat;
+        fileDescriptor = shm_open(m_name.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fileDescriptor < 0 || fstat(fileDescriptor, &segmentStat) != 0
+                || (static_cast<size_t>(segmentStat.st_size) < segmentSize && ftruncate(fileDescriptor, static_cast<off_t>(segmentSize)) != 0))
+        {
+            UXAS_LOG_ERROR("SharedMemoryMessageChannel::open failed to create shared memory ", m_name, " errno ", errno);
+            if (fileDescriptor >= 0)
+            {
+                ::close(fileDescriptor);
+                shm_unlink(m_name.c_str());
+            }
+            return (false);
+        }
+    }
+    else
+    {
+        struct stat segmentStat;
+        fileDescriptor = shm_open(m_name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+        if (fileDescriptor < 0)
+        {
+            // server has not created the segment yet
+            return (false);
+        }
+        if (fstat(fileDescriptor, &segmentStat) != 0 || static_cast<size_t>(segmentStat.st_size) < sizeof (SegmentHeader))
+        {
+            ::close(fileDescriptor);
+            return (false);
+        }
+        segmentSize = static_cast<size_t>(segmentStat.st_size);
+    }
+
+    void* segment = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    ::close(fileDescriptor); // mapping remains valid
+    if (segment == MAP_FAILED)
+    {
+        UXAS_LOG_ERROR("SharedMemoryMessageChannel::open failed to map shared memory ", m_name, " errno ", errno);
+        if (m_isServer)
+        {
+            shm_unlink(m_name.c_str());
+        }
+        return (false);
+    }
+
+    SegmentHeader* segmentHeader{nullptr};
+    if (m_isServer)
+    {
+        segmentHeader = new (segment) SegmentHeader;
+        // invalidate a re-used segment before re-initializing the rings
+        segmentHeader->m_magic.store(0, std::memory_order_release);
+        segmentHeader->m_version = s_version;
+        segmentHeader->m_ringCapacity = ringCapacity;
+        for (uint32_t ringIndex = 0; ringIndex < 2; ringIndex++)
+        {
+            RingHeader* ring = new (static_cast<uint8_t*>(segment) + getRingOffset(ringIndex, ringCapacity)) RingHeader;
+            ring->m_capacity = ringCapacity;
+            ring->m_writeIndex.store(0, std::memory_order_relaxed);
+            ring->m_writeSequence.store(0, std::memory_order_relaxed);
+            ring->m_isConsumerWaiting.store(0, std::memory_order_relaxed);
+            ring->m_readIndex.store(0, std::memory_order_relaxed);
+            ring->m_readSequence.store(0, std::memory_order_relaxed);
+            ring->m_isProducerWaiting.store(0, std::memory_order_relaxed);
+        }
+        // clients attach only after the rings are initialized
+        segmentHeader->m_magic.store(s_magic, std::memory_order_release);
+    }
+    else
+    {
+        segmentHeader = static_cast<SegmentHeader*>(segment);
+        ringCapacity = segmentHeader->m_ringCapacity;
+        if (segmentHeader->m_magic.load(std::memory_order_acquire) != s_magic
+                || segmentHeader->m_version != s_version
+                || ringCapacity <= s_lengthSize
+                || segmentSize < getSegmentSize(ringCapacity))
+        {
+            // not (yet) initialized by the server
+            munmap(segment, segmentSize);
+            return (false);
+        }
+    }
+
+    m_segment = segment;
+    m_segmentSize = segmentSize;
+    m_ringCapacity = ringCapacity;
+
+    uint32_t sendRingIndex = m_isServer ? 0 : 1;
+    uint32_t receiveRingIndex = m_isServer ? 1 : 0;
+    uint8_t* segmentBytes = static_cast<uint8_t*>(m_segment);
+    m_sendRing = reinterpret_cast<RingHeader*>(segmentBytes + getRingOffset(sendRingIndex, ringCapacity));
+    m_sendData = segmentBytes + getRingOffset(sendRingIndex, ringCapacity) + alignToCacheLine(sizeof (RingHeader));
+    m_receiveRing = reinterpret_cast<RingHeader*>(segmentBytes + getRingOffset(receiveRingIndex, ringCapacity));
+    m_receiveData = segmentBytes + getRingOffset(receiveRingIndex, ringCapacity) + alignToCacheLine(sizeof (RingHeader));
+
+    UXAS_LOG_INFORM("SharedMemoryMessageChannel::open ", (m_isServer ? "created " : "attached to "), m_name, " with ring capacity ", ringCapacity);
+    return (true);
+#endif
+};
+
+void
+SharedMemoryMessageChannel::close()
+{
+#ifndef _WIN32
+    if (m_segment)
+    {
+        munmap(m_segment, m_segmentSize);
+        if (m_isServer)
+        {
+            shm_unlink(m_name.c_str());
+        }
+    }
+#endif
+    m_segment = nullptr;
+    m_segmentSize = 0;
+    m_ringCapacity = 0;
+    m_sendRing = nullptr;
+    m_sendData = nullptr;
+    m_receiveRing = nullptr;
+    m_receiveData = nullptr;
+};
+
+bool
+SharedMemoryMessageChannel::send(const std::string& message)
+{
+    if (!m_sendRing)
+    {
+        return (false);
+    }
+
+    uint64_t capacity = m_ringCapacity;
+    uint64_t recordSize = s_lengthSize + message.size();
+    if (recordSize > capacity)
+    {
+        UXAS_LOG_ERROR("SharedMemoryMessageChannel::send message size ", message.size(), " exceeds ring capacity ", capacity);
+        return (false);
+    }
+
+    uint64_t writeIndex = m_sendRing->m_writeIndex.load(std::memory_order_relaxed);
+    uint64_t readIndex = m_sendRing->m_readIndex.load(std::memory_order_acquire);
+    // the read index is written by the other process (an invalid index is treated as a full ring)
+    if (writeIndex - readIndex > capacity || capacity - (writeIndex - readIndex) < recordSize)
+    {
+        return (false);
+    }
+
+    uint32_t length = static_cast<uint32_t>(message.size());
+    writeRingData(capacity, m_sendData, writeIndex, &length, s_lengthSize);
+    writeRingData(capacity, m_sendData, writeIndex + s_lengthSize, message.data(), message.size());
+    // publish the record to the consumer
+    m_sendRing->m_writeIndex.store(writeIndex + recordSize, std::memory_order_release);
+    signalSequence(m_sendRing->m_writeSequence, m_sendRing->m_isConsumerWaiting);
+    return (true);
+};
+
+bool
+SharedMemoryMessageChannel::receive(std::string& message)
+{
+    if (!m_receiveRing)
+    {
+        return (false);
+    }
+
+    uint64_t readIndex = m_receiveRing->m_readIndex.load(std::memory_order_relaxed);
+    uint64_t writeIndex = m_receiveRing->m_writeIndex.load(std::memory_order_acquire);
+    if (writeIndex == readIndex)
+    {
+        return (false);
+    }
+
+    // indexes and lengths are written by the other process - validate before copying
+    uint64_t capacity = m_ringCapacity;
+    uint64_t queuedSize = writeIndex - readIndex;
+    uint32_t length{0};
+    if (queuedSize >= s_lengthSize && queuedSize <= capacity)
+    {
+        readRingData(capacity, m_receiveData, readIndex, &length, s_lengthSize);
+    }
+    if (queuedSize < s_lengthSize || queuedSize > capacity || length > queuedSize - s_lengthSize)
+    {
+        UXAS_LOG_ERROR("SharedMemoryMessageChannel::receive discarding ", queuedSize, " bytes of invalid data (record length ", length,
+                       ") from shared memory ", m_name);
+        m_receiveRing->m_readIndex.store(writeIndex, std::memory_order_release);
+        signalSequence(m_receiveRing->m_readSequence, m_receiveRing->m_isProducerWaiting);
+        return (false);
+    }
+
+    message.resize(length);
+    if (length > 0)
+    {
+        readRingData(capacity, m_receiveData, readIndex + s_lengthSize, &message[0], length);
+    }
+    // release the record space to the producer
+    m_receiveRing->m_readIndex.store(readIndex + s_lengthSize + length, std::memory_order_release);
+    signalSequence(m_receiveRing->m_readSequence, m_receiveRing->m_isProducerWaiting);
+    return (true);
+};
+
+template <typename IsReady>
+bool
+SharedMemoryMessageChannel::waitForSequence(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& isWaiting, uint32_t timeout_ms, IsReady isReady)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    uint32_t interruptCount = m_interruptCount.load();
+    while (true)
+    {
+        // read the sequence before checking, so a change made after the check ends the wait
+        uint32_t expectedSequence = sequence.load();
+        if (isReady())
+        {
+            return (true);
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline || m_interruptCount.load() != interruptCount)
+        {
+            return (false);
+        }
+        isWaiting.store(1);
+        waitOnAddress(sequence, expectedSequence,
+                      static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count()) + 1);
+        isWaiting.store(0);
+    }
+};
+
+bool
+SharedMemoryMessageChannel::waitForReceive(uint32_t timeout_ms)
+{
+    if (!m_receiveRing)
+    {
+        return (false);
+    }
+    RingHeader* ring = m_receiveRing;
+    return (waitForSequence(ring->m_writeSequence, ring->m_isConsumerWaiting, timeout_ms, [ring]
+    {
+        return (ring->m_writeIndex.load(std::memory_order_acquire) != ring->m_readIndex.load(std::memory_order_relaxed));
+    }));
+};
+
+bool
+SharedMemoryMessageChannel::waitForSend(size_t messageSize, uint32_t timeout_ms)
+{
+    if (!m_sendRing || s_lengthSize + messageSize > m_ringCapacity)
+    {
+        return (false);
+    }
+    RingHeader* ring = m_sendRing;
+    uint64_t capacity = m_ringCapacity;
+    uint64_t recordSize = s_lengthSize + messageSize;
+    return (waitForSequence(ring->m_readSequence, ring->m_isProducerWaiting, timeout_ms, [ring, capacity, recordSize]
+    {
+        uint64_t queuedSize = ring->m_writeIndex.load(std::memory_order_relaxed) - ring->m_readIndex.load(std::memory_order_acquire);
+        return (queuedSize <= capacity && capacity - queuedSize >= recordSize);
+    }));
+};
+
+void
+SharedMemoryMessageChannel::interrupt()
+{
+    m_interruptCount.fetch_add(1);
+    // spurious sequence changes are harmless to (both processes') waiters
+    if (m_receiveRing)
+    {
+        m_receiveRing->m_writeSequence.fetch_add(1);
+        wakeOnAddress(m_receiveRing->m_writeSequence);
+    }
+    if (m_sendRing)
+    {
+        m_sendRing->m_readSequence.fetch_add(1);
+        wakeOnAddress(m_sendRing->m_readSequence);
+    }
+};
+
+void
+SharedMemoryMessageChannel::signalSequence(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& isWaiting)
+{
+    sequence.fetch_add(1);
+    // the wake-up system call is only needed if the peer is (about to be) sleeping
+    if (isWaiting.load() != 0)
+    {
+        wakeOnAddress(sequence);
+    }
+};
+
+void
+SharedMemoryMessageChannel::waitOnAddress(std::atomic<uint32_t>& sequence, uint32_t expectedSequence, uint64_t timeout_us)
+{
+#ifdef __linux__
+    static_assert(sizeof (std::atomic<uint32_t>) == sizeof (uint32_t), "futex word must be 32 bits");
+    struct timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(timeout_us / 1000000);
+    timeout.tv_nsec = static_cast<long>((timeout_us % 1000000) * 1000);
+    // shared (not private) futex since the word is mapped by two processes
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&sequence), FUTEX_WAIT, expectedSequence, &timeout, nullptr, 0);
+#else
+    // no cross-process wait primitive - poll with a short sleep
+    if (sequence.load() == expectedSequence)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(std::min<uint64_t>(timeout_us, 1000)));
+    }
+#endif
+};
+
+void
+SharedMemoryMessageChannel::wakeOnAddress(std::atomic<uint32_t>& sequence)
+{
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&sequence), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+#endif
+};
+
+void
+SharedMemoryMessageChannel::writeRingData(uint64_t capacity, uint8_t* data, uint64_t index, const void* source, size_t size)
+{
+    size_t position = static_cast<size_t>(index % capacity);
+    size_t firstSize = std::min(size, static_cast<size_t>(capacity) - position);
+    std::memcpy(data + position, source, firstSize);
+    std::memcpy(data, static_cast<const uint8_t*>(source) + firstSize, size - firstSize);
+};
+
+void
+SharedMemoryMessageChannel::readRingData(uint64_t capacity, const uint8_t* data, uint64_t index, void* destination, size_t size)
+{
+    size_t position = static_cast<size_t>(index % capacity);
+    size_t firstSize = std::min(size, static_cast<size_t>(capacity) - position);
+    std::memcpy(destination, data + position, firstSize);
+    std::memcpy(static_cast<uint8_t*>(destination) + firstSize, data, size - firstSize);
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
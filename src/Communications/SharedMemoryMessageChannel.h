@@ -0,0 +1,216 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_TRANSPORT_SHARED_MEMORY_MESSAGE_CHANNEL_H
+#define UXAS_MESSAGE_TRANSPORT_SHARED_MEMORY_MESSAGE_CHANNEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+/** \class SharedMemoryMessageChannel
+ *
+ * \par Description:
+ * Bi-directional message channel between two processes on the same host.
+ * The channel is a POSIX shared memory segment (<b>shm_open</b>/<b>mmap</b>)
+ * holding two lock-free single-producer/single-consumer ring buffers, one per
+ * direction. Each message is stored as a 4-byte length followed by the
+ * message bytes. A waiting consumer (producer) sleeps on a futex in the ring
+ * header that the peer wakes after adding (removing) a message; the wake-up
+ * system call is only made when the peer is waiting. Data read from the
+ * shared segment (capacity, indexes and lengths) is validated before use.
+ *
+ * The server creates (and finally removes) the segment; the client attaches
+ * to an existing segment. The server sends on ring 0 and receives on ring 1;
+ * the client does the opposite.
+ *
+ * \par Threading:
+ * One thread may call <B><i>send</i></B> and one (other) thread may call
+ * <B><i>receive</i></B>. Not supported on Windows.
+ *
+ * \n
+ */
+class SharedMemoryMessageChannel final
+{
+public:
+
+    SharedMemoryMessageChannel() { };
+
+    ~SharedMemoryMessageChannel();
+
+private:
+
+    /** \brief Copy construction not permitted */
+    SharedMemoryMessageChannel(SharedMemoryMessageChannel const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(SharedMemoryMessageChannel const&) = delete;
+
+public:
+
+    /** \brief Create (server) or attach to (client) the named shared memory
+     * segment. Clients fail until the server has created and initialized
+     * the segment (retry later).
+     *
+     * @param name shared memory object name (e.g., "/uxas_entity_100_200").
+     * @param ringCapacity capacity of each ring in bytes (server only).
+     * @param isServer true creates the segment; false attaches to it.
+     * @return true if the channel is open.
+     */
+    bool
+    open(const std::string& name, uint32_t ringCapacity, bool isServer);
+
+    /** \brief Unmap the segment (the server also removes it). */
+    void
+    close();
+
+    bool
+    isOpen() const { return (m_segment != nullptr); };
+
+    /** \brief Copy a message into the outgoing ring.
+     *
+     * @param message message bytes.
+     * @return true if sent; false if the channel is not open, the message
+     * cannot fit in the ring or the ring is currently full.
+     */
+    bool
+    send(const std::string& message);
+
+    /** \brief Copy the next message (if any) out of the incoming ring.
+     * If the incoming ring holds an invalid record (e.g., corrupted by the 
+     * peer), all data currently queued in the ring is discarded.
+     *
+     * @param message set to the received message bytes.
+     * @return true if a message was received.
+     */
+    bool
+    receive(std::string& message);
+
+    /** \brief Wait until the incoming ring holds a message, 
+     * <B><i>interrupt</i></B> is called or <b>timeout_ms</b> elapses.
+     *
+     * @param timeout_ms maximum wait duration in milliseconds.
+     * @return true if a message is available.
+     */
+    bool
+    waitForReceive(uint32_t timeout_ms);
+
+    /** \brief Wait until the outgoing ring has space for <b>messageSize</b> 
+     * bytes, <B><i>interrupt</i></B> is called or <b>timeout_ms</b> elapses.
+     *
+     * @param messageSize size of the message to be sent.
+     * @param timeout_ms maximum wait duration in milliseconds.
+     * @return true if the message fits.
+     */
+    bool
+    waitForSend(size_t messageSize, uint32_t timeout_ms);
+
+    /** \brief Wake threads of this process waiting in <B><i>waitForReceive</i></B> 
+     * or <B><i>waitForSend</i></B> (thread-safe). */
+    void
+    interrupt();
+
+private:
+
+    /** \brief Ring header (producer and consumer fields on separate cache 
+     * lines to avoid false sharing). Indexes increase monotonically; ring 
+     * positions are index modulo capacity. Sequences are futex words 
+     * incremented after each index update; waiting flags indicate a 
+     * sleeping consumer/producer that must be woken. */
+    struct RingHeader
+    {
+        uint64_t m_capacity;
+        alignas(64) std::atomic<uint64_t> m_writeIndex;
+        std::atomic<uint32_t> m_writeSequence;
+        std::atomic<uint32_t> m_isConsumerWaiting;
+        alignas(64) std::atomic<uint64_t> m_readIndex;
+        std::atomic<uint32_t> m_readSequence;
+        std::atomic<uint32_t> m_isProducerWaiting;
+    };
+
+    /** \brief Segment header, followed by two rings (header and data) */
+    struct SegmentHeader
+    {
+        /** \brief Set last (release) by the server once the rings are initialized */
+        std::atomic<uint64_t> m_magic;
+        uint32_t m_version;
+        uint32_t m_ringCapacity;
+    };
+
+    static constexpr uint64_t s_magic{0x55784153484d454dULL}; // "UxASHMEM"
+    static constexpr uint32_t s_version{2};
+    static constexpr uint32_t s_lengthSize{sizeof (uint32_t)};
+
+    static size_t
+    getRingOffset(uint32_t ringIndex, uint32_t ringCapacity);
+
+    static size_t
+    getSegmentSize(uint32_t ringCapacity);
+
+    /** \brief Copy <b>size</b> bytes into ring data at <b>index</b> (wrapping). */
+    static void
+    writeRingData(uint64_t capacity, uint8_t* data, uint64_t index, const void* source, size_t size);
+
+    /** \brief Copy <b>size</b> bytes from ring data at <b>index</b> (wrapping). */
+    static void
+    readRingData(uint64_t capacity, const uint8_t* data, uint64_t index, void* destination, size_t size);
+
+    /** \brief Wait until <b>isReady</b> returns true, sleeping on the 
+     * <b>sequence</b> futex word (with <b>isWaiting</b> set) between checks.
+     *
+     * @return result of the final <b>isReady</b> check.
+     */
+    template <typename IsReady>
+    bool
+    waitForSequence(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& isWaiting, uint32_t timeout_ms, IsReady isReady);
+
+    /** \brief Increment <b>sequence</b> and wake a peer waiting on it (if any). */
+    static void
+    signalSequence(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& isWaiting);
+
+    /** \brief Sleep while <b>sequence</b> equals <b>expectedSequence</b> (at 
+     * most <b>timeout_us</b> microseconds; spurious wake-ups are possible). */
+    static void
+    waitOnAddress(std::atomic<uint32_t>& sequence, uint32_t expectedSequence, uint64_t timeout_us);
+
+    static void
+    wakeOnAddress(std::atomic<uint32_t>& sequence);
+
+    std::string m_name;
+    bool m_isServer{false};
+    void* m_segment{nullptr};
+    size_t m_segmentSize{0};
+
+    /** \brief Ring capacity validated when the channel was opened (the 
+     * capacity stored in the shared segment is not trusted afterwards) */
+    uint64_t m_ringCapacity{0};
+
+    /** \brief Incremented by <B><i>interrupt</i></B> to end waits */
+    std::atomic<uint32_t> m_interruptCount{0};
+
+    RingHeader* m_sendRing{nullptr};
+    uint8_t* m_sendData{nullptr};
+    RingHeader* m_receiveRing{nullptr};
+    uint8_t* m_receiveData{nullptr};
+
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_TRANSPORT_SHARED_MEMORY_MESSAGE_CHANNEL_H */
@@ -9,7 +9,10 @@
 
 #include "ZeroMqAddressedAttributedMessageReceiver.h"
 
+#include "ZeroMqFabric.h"
+
 #include "UxAS_ConfigurationManager.h"
+#include "UxAS_Log.h"
 #include "UxAS_Time.h"
 
 #include "stdUniquePtr.h"
@@ -18,6 +21,8 @@
 
 #include "czmq.h"
 
+#include <atomic>
+
 namespace uxas
 {
 namespace communications
@@ -25,6 +30,26 @@ namespace communications
 namespace transport
 {
 
+constexpr uint32_t ZeroMqAddressedAttributedMessageReceiver::s_maxDrainMessageCount;
+
+ZeroMqAddressedAttributedMessageReceiver::~ZeroMqAddressedAttributedMessageReceiver()
+{
+    std::lock_guard<std::mutex> lock(m_controlMutex);
+    uint32_t lingerDuration_ms(0);
+    if (m_controlSendSocket)
+    {
+        m_controlSendSocket->setsockopt(ZMQ_LINGER, &lingerDuration_ms, sizeof(lingerDuration_ms));
+        m_controlSendSocket->close();
+        m_controlSendSocket.reset();
+    }
+    if (m_controlReceiveSocket)
+    {
+        m_controlReceiveSocket->setsockopt(ZMQ_LINGER, &lingerDuration_ms, sizeof(lingerDuration_ms));
+        m_controlReceiveSocket->close();
+        m_controlReceiveSocket.reset();
+    }
+};
+
 std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
 ZeroMqAddressedAttributedMessageReceiver::getNextMessage()
 {
@@ -39,132 +64,433 @@ ZeroMqAddressedAttributedMessageReceiver::getNextMessage()
     }
     
     // no messages in queue, attempt to read from socket
-    if (m_zmqSocket)
-    {
-        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE zmq::pollitem_t");
-        zmq::pollitem_t pollItems [] = {
-            { *m_zmqSocket, 0, ZMQ_POLLIN, 0},
-        };
-        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage AFTER zmq::pollitem_t");
-
-        // http://api.zeromq.org/2-1:zmq-poll    
-        // If none of the requested events have occurred on any zmq_pollitem_t item, 
-        // zmq_poll() shall wait timeout microseconds for an event to occur on any of 
-        // the requested items. If the value of timeout is 0, zmq_poll() shall return 
-        // immediately. If the value of timeout is -1, zmq_poll() shall block 
-        // indefinitely until a requested event has occurred on at least one 
-        // zmq_pollitem_t. The resolution of timeout is 1 millisecond.
-        zmq::poll(&pollItems[0], 1, uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms()); // wait time units are milliseconds
-        if (pollItems[0].revents & ZMQ_POLLIN)
+    if (waitForMessages())
+    {
+        if (m_isTcpStream) // only used for bridging to other entities
         {
-            if (m_isTcpStream) // only used for bridging to other entities
+            processReceivedTcpStream();
+        }
+        else
+        {
+            // drain messages queued on the socket in a single wake-up (up to s_maxDrainMessageCount)
+            zmq::message_t firstFrame;
+            int32_t receiveFlags{0};
+            uint32_t drainCount{0};
+            while (drainCount < s_maxDrainMessageCount && m_zmqSocket->recv(&firstFrame, receiveFlags))
             {
-                try
-                {
-                    while (true)
-                    {
-                        // single-part AddressedAttributedMessage)
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_recv");
-                        zframe_t* frameData = zframe_recv(*m_zmqSocket);
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_data");
-                        byte* payloadData = zframe_data(frameData);
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_size");
-                        size_t payloadSize = zframe_size(frameData);
-
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP framePayload");
-                        std::string framePayload(reinterpret_cast<const char*> (payloadData), payloadSize);
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage TCP framePayload is: [", framePayload, "]");
-                        std::string recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString(framePayload);
-                        while (!recvdTcpDataSegment.empty())
-                        {
-                            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage processing complete object string segment");
-                            std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
-                                    = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                            if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
-                            {
-                                m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
-                            }
-                            else
-                            {
-                                UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
-                            }
-                            recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString("");
-                        }
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE zframe_destroy");
-                        zframe_destroy(&frameData);
-                        if (nextMsg || uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms() > -1)
-                        {
-                            break;
-                        }
-                    }
-                }
-                catch (std::exception& ex)
+                drainCount++;
+                std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdAddAttMsg = receiveMessage(firstFrame);
+                if (recvdAddAttMsg)
                 {
-                    UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::getNextMessage EXCEPTION: ", ex.what());
+                    m_recvdMsgs.push_back( std::move(recvdAddAttMsg) );
                 }
+                receiveFlags = ZMQ_DONTWAIT;
+            }
+        }
+    }
+
+    if(!m_recvdMsgs.empty())
+    {
+        nextMsg = std::move(m_recvdMsgs[0]);
+        m_recvdMsgs.pop_front();
+    }
+    return (nextMsg);
+};
+
+uint32_t
+ZeroMqAddressedAttributedMessageReceiver::getNextMessages(uint32_t maxMessageCount,
+                                                          uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& messages)
+{
+    uint32_t messageCount{0};
+
+    // previously received messages (e.g., multiple messages from a single TCP frame)
+    while (messageCount < maxMessageCount && !messages.full() && !m_recvdMsgs.empty())
+    {
+        messages.push_back(std::move(m_recvdMsgs.front()));
+        m_recvdMsgs.pop_front();
+        messageCount++;
+    }
+
+    int32_t receiveFlags{0};
+    if (messageCount == 0)
+    {
+        // nothing to return - wait (poll time-out or blocking) for messages
+        if (!waitForMessages())
+        {
+            return (messageCount);
+        }
+
+        if (m_isTcpStream)
+        {
+            processReceivedTcpStream();
+            while (messageCount < maxMessageCount && !messages.full() && !m_recvdMsgs.empty())
+            {
+                messages.push_back(std::move(m_recvdMsgs.front()));
+                m_recvdMsgs.pop_front();
+                messageCount++;
+            }
+            return (messageCount);
+        }
+    }
+    else if (m_isTcpStream || !m_zmqSocket)
+    {
+        return (messageCount);
+    }
+    else
+    {
+        // only take what is already queued on the socket
+        receiveFlags = ZMQ_DONTWAIT;
+    }
+
+    // drain messages queued on the socket directly into the caller's buffer 
+    // (up to s_maxDrainMessageCount socket messages, including invalid messages)
+    zmq::message_t firstFrame;
+    uint32_t drainCount{0};
+    while (messageCount < maxMessageCount && drainCount < s_maxDrainMessageCount && !messages.full() && m_zmqSocket->recv(&firstFrame, receiveFlags))
+    {
+        drainCount++;
+        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdAddAttMsg = receiveMessage(firstFrame);
+        if (recvdAddAttMsg)
+        {
+            messages.push_back(std::move(recvdAddAttMsg));
+            messageCount++;
+        }
+        receiveFlags = ZMQ_DONTWAIT;
+    }
+
+    return (messageCount);
+};
+
+uint32_t
+ZeroMqAddressedAttributedMessageReceiver::forwardMessages(uint32_t maxMessageCount, ZeroMqSenderBase& destination)
+{
+    uint32_t messageCount{0};
+    if (m_isTcpStream)
+    {
+        UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::forwardMessages not supported for TCP streams");
+        return (messageCount);
+    }
+
+    if (!waitForMessages())
+    {
+        return (messageCount);
+    }
+
+    zmq::message_t frame;
+    int32_t receiveFlags{0};
+    while (messageCount < maxMessageCount && m_zmqSocket->recv(&frame, receiveFlags))
+    {
+        // all frames of a multi-part message are available once the first frame is received
+        while (true)
+        {
+            int32_t isMoreFrames{0};
+            size_t isMoreFramesSize = sizeof(isMoreFrames);
+            m_zmqSocket->getsockopt(ZMQ_RCVMORE, &isMoreFrames, &isMoreFramesSize);
+            destination.sendFrame(frame, (isMoreFrames != 0));
+            if (isMoreFrames == 0)
+            {
+                break;
+            }
+            m_zmqSocket->recv(&frame);
+        }
+        messageCount++;
+        receiveFlags = ZMQ_DONTWAIT;
+    }
+
+    return (messageCount);
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::waitForMessages()
+{
+    if (!m_zmqSocket)
+    {
+        return (false);
+    }
+
+    if (m_isBlockingReceive && m_receiveThreadId != std::this_thread::get_id())
+    {
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        m_receiveThreadId = std::this_thread::get_id();
+    }
+
+    UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::waitForMessages BEFORE zmq::pollitem_t");
+    zmq::pollitem_t pollItems [] = {
+        { *m_zmqSocket, 0, ZMQ_POLLIN, 0},
+        { (m_isBlockingReceive ? static_cast<void*> (*m_controlReceiveSocket) : nullptr), 0, ZMQ_POLLIN, 0},
+    };
+    UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::waitForMessages AFTER zmq::pollitem_t");
+
+    // http://api.zeromq.org/2-1:zmq-poll    
+    // If none of the requested events have occurred on any zmq_pollitem_t item, 
+    // zmq_poll() shall wait timeout microseconds for an event to occur on any of 
+    // the requested items. If the value of timeout is 0, zmq_poll() shall return 
+    // immediately. If the value of timeout is -1, zmq_poll() shall block 
+    // indefinitely until a requested event has occurred on at least one 
+    // zmq_pollitem_t. The resolution of timeout is 1 millisecond.
+    if (m_isBlockingReceive)
+    {
+        // wake only on received data or an interrupt on the control socket
+        zmq::poll(&pollItems[0], 2, -1);
+    }
+    else
+    {
+        zmq::poll(&pollItems[0], 1, uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms()); // wait time units are milliseconds
+    }
+
+    if (m_isBlockingReceive && (pollItems[1].revents & ZMQ_POLLIN))
+    {
+        processControlMessages();
+    }
+
+    return ((pollItems[0].revents & ZMQ_POLLIN) ? true : false);
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::enableBlockingReceive()
+{
+    if (!m_zmqSocket)
+    {
+        UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::enableBlockingReceive failed since receive socket has not been initialized");
+        return (false);
+    }
+
+    if (m_isBlockingReceive)
+    {
+        return (true);
+    }
+
+    // each receiver has its own in-process control socket pair
+    static std::atomic<uint32_t> s_controlSocketCount{0};
+    std::string controlSocketAddress = "inproc://receiver_control_" + m_entityIdString + "_" + m_serviceIdString
+            + "_" + std::to_string(s_controlSocketCount++);
+    int32_t controlHighWaterMark{1000};
+
+    try
+    {
+        // bind before connect (in-process transport)
+        ZeroMqSocketConfiguration controlReceiveSocketConfiguration(NETWORK_NAME::zmqLmcpNetwork(), controlSocketAddress,
+                                                                    ZMQ_PAIR, true, true, controlHighWaterMark, controlHighWaterMark);
+        std::unique_ptr<zmq::socket_t> controlReceiveSocket = ZeroMqFabric::getInstance().createSocket(controlReceiveSocketConfiguration);
+
+        ZeroMqSocketConfiguration controlSendSocketConfiguration(NETWORK_NAME::zmqLmcpNetwork(), controlSocketAddress,
+                                                                 ZMQ_PAIR, false, false, controlHighWaterMark, controlHighWaterMark);
+        std::unique_ptr<zmq::socket_t> controlSendSocket = ZeroMqFabric::getInstance().createSocket(controlSendSocketConfiguration);
+
+        if (!controlReceiveSocket || !controlSendSocket)
+        {
+            UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::enableBlockingReceive failed to create control sockets for ", controlSocketAddress);
+            return (false);
+        }
+
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        m_controlReceiveSocket = std::move(controlReceiveSocket);
+        m_controlSendSocket = std::move(controlSendSocket);
+        m_isBlockingReceive = true;
+    }
+    catch (std::exception& ex)
+    {
+        UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::enableBlockingReceive, create control socket EXCEPTION: ", ex.what());
+        return (false);
+    }
+
+    UXAS_LOG_DEBUGGING("ZeroMqAddressedAttributedMessageReceiver::enableBlockingReceive enabled blocking receive with control socket ", controlSocketAddress);
+    return (true);
+};
+
+void
+ZeroMqAddressedAttributedMessageReceiver::interrupt()
+{
+    std::lock_guard<std::mutex> lock(m_controlMutex);
+    if (m_controlSendSocket)
+    {
+        try
+        {
+            // content is ignored - if the control queue is full, a wake-up is already pending
+            zmq::message_t interruptMessage;
+            m_controlSendSocket->send(interruptMessage, ZMQ_DONTWAIT);
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::interrupt EXCEPTION: ", ex.what());
+        }
+    }
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::addSubscriptionAddressToSocket(const std::string& address)
+{
+    if (deferSubscriptionChange(true, address))
+    {
+        return (m_zeroMqSocketConfiguration.m_zmqSocketType == ZMQ_SUB);
+    }
+    return (ZeroMqReceiverBase::addSubscriptionAddressToSocket(address));
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::removeSubscriptionAddressFromSocket(const std::string& address)
+{
+    if (deferSubscriptionChange(false, address))
+    {
+        return (m_zeroMqSocketConfiguration.m_zmqSocketType == ZMQ_SUB);
+    }
+    return (ZeroMqReceiverBase::removeSubscriptionAddressFromSocket(address));
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::deferSubscriptionChange(bool isAdd, const std::string& address)
+{
+    if (!m_isBlockingReceive)
+    {
+        return (false);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        // receiving thread not started yet or calling from the receiving thread
+        if (m_receiveThreadId == std::thread::id() || m_receiveThreadId == std::this_thread::get_id())
+        {
+            return (false);
+        }
+        m_pendingSubscriptionChanges.emplace_back(isAdd, address);
+    }
+    interrupt();
+    return (true);
+};
+
+void
+ZeroMqAddressedAttributedMessageReceiver::processControlMessages()
+{
+    zmq::message_t controlMessage;
+    while (m_controlReceiveSocket->recv(&controlMessage, ZMQ_DONTWAIT))
+    {
+        // discard interrupt messages (multiple interrupts imply a single wake-up)
+    }
+
+    std::deque< std::pair<bool, std::string> > subscriptionChanges;
+    {
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        subscriptionChanges.swap(m_pendingSubscriptionChanges);
+    }
+    for (const auto& subscriptionChange : subscriptionChanges)
+    {
+        if (subscriptionChange.first)
+        {
+            ZeroMqReceiverBase::addSubscriptionAddressToSocket(subscriptionChange.second);
+        }
+        else
+        {
+            ZeroMqReceiverBase::removeSubscriptionAddressFromSocket(subscriptionChange.second);
+        }
+    }
+};
+
+std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+ZeroMqAddressedAttributedMessageReceiver::receiveMessage(zmq::message_t& firstFrame)
+{
+    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdAddAttMsg;
+
+    // not a stream, so the first frame is either the address (multi-part)
+    // or the complete AddressedAttributedMessage (single-part)
+    if (uxas::common::ConfigurationManager::getIsZeroMqMultipartMessage())
+    {
+        std::string address(static_cast<const char*> (firstFrame.data()), firstFrame.size());
+        std::string contentType = n_ZMQ::s_recv(*m_zmqSocket);
+        std::string descriptor = n_ZMQ::s_recv(*m_zmqSocket);
+        std::string sourceGroup = n_ZMQ::s_recv(*m_zmqSocket);
+        std::string sourceEntityId = n_ZMQ::s_recv(*m_zmqSocket);
+        std::string sourceServiceId = n_ZMQ::s_recv(*m_zmqSocket);
+        std::string payload = n_ZMQ::s_recv(*m_zmqSocket);
+        if (m_entityIdString != sourceEntityId || m_serviceIdString != sourceServiceId)
+        {
+            std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdMultipartAddAttMsg
+                    = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+            if (recvdMultipartAddAttMsg->setAddressAttributesAndPayload(std::move(address), std::move(contentType), std::move(descriptor), std::move(sourceGroup),
+                                                                        std::move(sourceEntityId), std::move(sourceServiceId), std::move(payload)))
+            {
+                recvdAddAttMsg = std::move(recvdMultipartAddAttMsg);
             }
             else
             {
-                // not a stream, so should only be a single message
-                if (uxas::common::ConfigurationManager::getIsZeroMqMultipartMessage())
+                UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::receiveMessage failed to create AddressedAttributedMessage object from Zero MQ multi-part message");
+            }
+        }
+        else
+        {
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::receiveMessage ignoring ", descriptor, " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
+        }
+    }
+    else
+    {
+        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdSinglepartAddAttMsg
+                = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+        if (recvdSinglepartAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::string(static_cast<const char*> (firstFrame.data()), firstFrame.size())))
+        {
+            if (m_entityIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceEntityId()
+                    || m_serviceIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceServiceId())
+            {
+                recvdAddAttMsg = std::move(recvdSinglepartAddAttMsg);
+            }
+            else
+            {
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::receiveMessage ignoring ", recvdSinglepartAddAttMsg->getMessageAttributesReference()->getDescriptor(), " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
+            }
+        }
+        else
+        {
+            UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::receiveMessage failed to create AddressedAttributedMessage object from Zero MQ single-part message");
+        }
+    }
+
+    return (recvdAddAttMsg);
+};
+
+void
+ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream()
+{
+    try
+    {
+        while (true)
+        {
+            // single-part AddressedAttributedMessage)
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream BEFORE TCP zframe_recv");
+            zframe_t* frameData = zframe_recv(*m_zmqSocket);
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream BEFORE TCP zframe_data");
+            byte* payloadData = zframe_data(frameData);
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream BEFORE TCP zframe_size");
+            size_t payloadSize = zframe_size(frameData);
+
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream BEFORE TCP framePayload");
+            std::string framePayload(reinterpret_cast<const char*> (payloadData), payloadSize);
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream TCP framePayload is: [", framePayload, "]");
+            std::string recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString(framePayload);
+            while (!recvdTcpDataSegment.empty())
+            {
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream processing complete object string segment");
+                std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
+                        = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+                if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
                 {
-                    std::string address = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string contentType = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string descriptor = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string sourceGroup = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string sourceEntityId = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string sourceServiceId = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string payload = n_ZMQ::s_recv(*m_zmqSocket);
-                    if (m_entityIdString != sourceEntityId || m_serviceIdString != sourceServiceId)
-                    {
-                        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdMultipartAddAttMsg
-                                = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                        if (recvdMultipartAddAttMsg->setAddressAttributesAndPayload(std::move(address), std::move(contentType), std::move(descriptor), std::move(sourceGroup),
-                                                                                    std::move(sourceEntityId), std::move(sourceServiceId), std::move(payload)))
-                        {
-                            m_recvdMsgs.push_back( std::move(recvdMultipartAddAttMsg) );
-                        }
-                        else
-                        {
-                            UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from Zero MQ multi-part message");
-                        }
-                    }
-                    else
-                    {
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage ignoring ", descriptor, " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
-                    }
+                    m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
                 }
                 else
                 {
-                    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdSinglepartAddAttMsg
-                            = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                    if (recvdSinglepartAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(n_ZMQ::s_recv(*m_zmqSocket)))
-                    {
-                        if (m_entityIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceEntityId()
-                                || m_serviceIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceServiceId())
-                        {
-                            m_recvdMsgs.push_back( std::move(recvdSinglepartAddAttMsg) );
-                        }
-                        else
-                        {
-                            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage ignoring ", recvdSinglepartAddAttMsg->getMessageAttributesReference()->getDescriptor(), " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
-                        }
-                    }
-                    else
-                    {
-                        UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from Zero MQ single-part message");
-                    }
+                    UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
                 }
+                recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString("");
+            }
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream BEFORE zframe_destroy");
+            zframe_destroy(&frameData);
+            if (m_isBlockingReceive || uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms() > -1)
+            {
+                break;
             }
         }
-    } //if(m_zmqSocket)
-
-    if(!m_recvdMsgs.empty())
+    }
+    catch (std::exception& ex)
     {
-        nextMsg = std::move(m_recvdMsgs[0]);
-        m_recvdMsgs.pop_front();
+        UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::processReceivedTcpStream EXCEPTION: ", ex.what());
     }
-    return (nextMsg);
 };
 
 }; //namespace transport
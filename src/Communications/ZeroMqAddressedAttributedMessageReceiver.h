@@ -11,10 +11,15 @@
 #define UXAS_MESSAGE_TRANSPORT_ZERO_MQ_ADDRESSED_ATTRIBUTED_MESSAGE_RECEIVER_H
 
 #include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
 #include "ZeroMqReceiverBase.h"
+#include "ZeroMqSenderBase.h"
 
 #include "AddressedAttributedMessage.h"
 
+#include "UxAS_RingBuffer.h"
 #include "UxAS_SentinelSerialBuffer.h"
 
 namespace uxas
@@ -39,6 +44,9 @@ namespace transport
  * <li>removeSubscriptionAddress
  * <li>getNextMessage
  * </ul>
+ * When blocking receive is enabled, <B><i>interrupt</i></B> may be called from 
+ * any thread, and subscription address changes made from a thread other than 
+ * the receiving thread are deferred to the receiving thread.
  * 
  * \n
  */
@@ -50,7 +58,7 @@ public:
     ZeroMqAddressedAttributedMessageReceiver(bool isTcpStream = false)
     : ZeroMqReceiverBase(), m_isTcpStream(isTcpStream) { };
     
-    ~ZeroMqAddressedAttributedMessageReceiver() { };
+    ~ZeroMqAddressedAttributedMessageReceiver();
 
 private:
 
@@ -83,11 +91,110 @@ public:
      */
     std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
     getNextMessage();
-    
+
+    /** \brief Get all available AddressedAttributedMessage objects (up to 
+     * <b>maxMessageCount</b>) in a single call. Waits (poll time-out or 
+     * blocking receive) only if no messages are available, then drains every 
+     * message already queued on the socket without waiting.
+     * 
+     * @param maxMessageCount maximum count of messages added to <b>messages</b>.
+     * @param messages caller-provided buffer the received messages are added to 
+     * (receiving stops when the buffer is full).
+     * @return count of messages added to <b>messages</b>.
+     */
+    uint32_t
+    getNextMessages(uint32_t maxMessageCount,
+                    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& messages);
+
+    /** \brief Forward all available messages (up to <b>maxMessageCount</b>) 
+     * to <b>destination</b> frame by frame, without converting them into 
+     * AddressedAttributedMessage objects or copying frame content. Waits 
+     * (poll time-out or blocking receive) only if no messages are available. 
+     * Not supported for TCP streams.
+     * 
+     * @param maxMessageCount maximum count of messages forwarded.
+     * @param destination sender the frames are forwarded to.
+     * @return count of messages forwarded.
+     */
+    uint32_t
+    forwardMessages(uint32_t maxMessageCount, ZeroMqSenderBase& destination);
+
+    /** \brief Switch <B><i>getNextMessage</i></B> from polling with the configured 
+     * time-out to blocking until a message arrives or <B><i>interrupt</i></B> 
+     * is called. Must be invoked after <B><i>initialize</i></B>.
+     * 
+     * @return true if the control socket used to interrupt blocking receive was created.
+     */
+    bool
+    enableBlockingReceive();
+
+    /** \brief Wake a blocked <B><i>getNextMessage</i></B> call (thread-safe). 
+     * The woken call returns an empty message if no messages have been received. */
+    void
+    interrupt();
+
+    bool
+    addSubscriptionAddressToSocket(const std::string& address) override;
+
+    bool
+    removeSubscriptionAddressFromSocket(const std::string& address) override;
+
 private:
 
+    /** \brief Queues the subscription change for the receiving thread and 
+     * interrupts it if blocking receive is enabled and the caller is not the 
+     * receiving thread.
+     * 
+     * @param isAdd true to add subscription address; false to remove it.
+     * @param address subscription address.
+     * @return true if the change was deferred to the receiving thread.
+     */
+    bool
+    deferSubscriptionChange(bool isAdd, const std::string& address);
+
+    /** \brief Apply subscription changes requested by other threads and 
+     * discard pending interrupt messages. */
+    void
+    processControlMessages();
+
+    /** \brief Poll the receive socket (and the control socket if blocking 
+     * receive is enabled).
+     * 
+     * @return true if messages are available on the receive socket.
+     */
+    bool
+    waitForMessages();
+
+    /** \brief Convert the Zero MQ message starting with <b>firstFrame</b> 
+     * (remaining frames of multi-part messages are received from the socket) 
+     * into an AddressedAttributedMessage.
+     * 
+     * @return received message (empty if sent by this network client or invalid).
+     */
+    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+    receiveMessage(zmq::message_t& firstFrame);
+
+    void
+    processReceivedTcpStream();
+
+    /** \brief Maximum count of socket messages received in a single wake-up 
+     * (bounds the time and queue memory spent draining a busy socket) */
+    static constexpr uint32_t s_maxDrainMessageCount{256};
+
     bool m_isTcpStream{false};
 
+    /** \brief true implies <B><i>getNextMessage</i></B> blocks until a message 
+     * arrives or <B><i>interrupt</i></B> is called */
+    bool m_isBlockingReceive{false};
+
+    std::mutex m_controlMutex;
+    std::unique_ptr<zmq::socket_t> m_controlSendSocket;
+    std::unique_ptr<zmq::socket_t> m_controlReceiveSocket;
+    std::thread::id m_receiveThreadId;
+
+    /** \brief Subscription changes (true = add, false = remove) requested by other threads */
+    std::deque< std::pair<bool, std::string> > m_pendingSubscriptionChanges;
+
     uxas::common::SentinelSerialBuffer m_receiveTcpDataBuffer;
     std::deque< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > m_recvdMsgs;
 
@@ -23,7 +23,7 @@ namespace transport
 {
 
 void
-ZeroMqAddressedAttributedMessageSender::sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, const std::string payload)
+ZeroMqAddressedAttributedMessageSender::sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, std::string payload)
 {
     if (m_zmqSocket)
     {
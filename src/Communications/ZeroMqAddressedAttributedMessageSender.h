@@ -47,7 +47,7 @@ private:
 public:
 
     void
-    sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, const std::string payload);
+    sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, std::string payload);
     
     void
     sendAddressedAttributedMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> message);
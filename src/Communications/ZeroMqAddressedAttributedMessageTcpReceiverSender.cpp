@@ -24,11 +24,33 @@ namespace transport
 
 ZeroMqAddressedAttributedMessageTcpReceiverSender::~ZeroMqAddressedAttributedMessageTcpReceiverSender()
 {
-    for(auto c : m_clients)
-        zframe_destroy(&c);
     m_clients.clear();
 }
 
+ZeroMqAddressedAttributedMessageTcpReceiverSender::TcpPeer*
+ZeroMqAddressedAttributedMessageTcpReceiverSender::findPeer(zframe_t* identityFrame)
+{
+    for (auto& client : m_clients)
+    {
+        if (zframe_eq(client->m_identity, identityFrame))
+        {
+            return (client.get());
+        }
+    }
+    return (nullptr);
+};
+
+ZeroMqAddressedAttributedMessageTcpReceiverSender::TcpPeer&
+ZeroMqAddressedAttributedMessageTcpReceiverSender::addPeer(zframe_t* identityFrame)
+{
+    // framing of a new peer is detected anew from its own stream
+    std::unique_ptr<TcpPeer> peer = uxas::stduxas::make_unique<TcpPeer>();
+    peer->m_identity = identityFrame;
+    peer->m_isSendLengthPrefixed = m_isLengthPrefixedFramingConfigured;
+    m_clients.push_back(std::move(peer));
+    return (*m_clients.back());
+};
+
 std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
 ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage()
 {
@@ -116,17 +138,7 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage()
                 UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage zero-length data frame indicating client connect/disconnect");
 
                 // if the identityFrame is already in the client list, assume this is a disconnect and remove from client list
-                size_t clientindex = 0;
-                bool alreadyconnected = false;
-                for(size_t k=0; k<m_clients.size(); k++)
-                {
-                    if(zframe_eq(m_clients.at(k),identityFrame))
-                    {
-                        alreadyconnected = true;
-                        clientindex = k;
-                        break;
-                    }
-                }
+                bool alreadyconnected = (findPeer(identityFrame) != nullptr);
 
                 if(alreadyconnected)
                 {
@@ -136,15 +148,15 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage()
                     // clients in general and not worth tracking spurious
                     // disconnects due to reception of a zero length message
                     // disconnect logic is below if desired
-                    /*  auto clientdisconnect = m_clients.at(clientindex);
-                        m_clients.erase(m_clients.begin()+clientindex);
-                        zframe_destroy(&clientdisconnect); */
+                    /*  m_clients.erase(std::remove_if(m_clients.begin(), m_clients.end(),
+                            [identityFrame](const std::unique_ptr<TcpPeer>& c) { return (zframe_eq(c->m_identity, identityFrame)); }),
+                            m_clients.end()); */
                 }
                 else
                 {
                     UXAS_LOG_INFORM("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage detecting new client connect");
                     // save identity frame as new client
-                    m_clients.push_back(identityFrame);
+                    addPeer(identityFrame);
                 }
 
                 zframe_destroy(&frameData); // delete empty frame data
@@ -153,44 +165,17 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage()
 
             // at this point we have an actual data frame ready for processing
             // if for some reason, the identity of this actual data is not in the client list, add it
-            bool existingclient = false;
-            for(auto c : m_clients)
-            {
-                if(zframe_eq(c,identityFrame))
-                {
-                    existingclient = true;
-                    break;
-                }
-            }
-
-            if(!existingclient)
+            TcpPeer* peer = findPeer(identityFrame);
+            if(!peer)
             {
                 UXAS_LOG_INFORM("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage got a non-zero data packet from unknown client");
-                m_clients.push_back(identityFrame);
+                peer = &addPeer(identityFrame);
             }
             else
                 zframe_destroy(&identityFrame);
 
 
-            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage BEFORE TCP framePayload");
-            std::string framePayload(reinterpret_cast<const char*> (payloadData), payloadSize);
-            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage TCP framePayload is: [", framePayload, "]");
-            std::string recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString(framePayload);
-            while (!recvdTcpDataSegment.empty())
-            {
-                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage processing complete object string segment");
-                std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
-                        = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
-                {
-                    m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
-                }
-                else
-                {
-                    UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
-                }
-                recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString("");
-            }
+            processReceivedTcpData(*peer, reinterpret_cast<const char*> (payloadData), payloadSize);
             UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage BEFORE zframe_destroy");
             zframe_destroy(&frameData);
         }
@@ -209,7 +194,80 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage()
 };
 
 void
-ZeroMqAddressedAttributedMessageTcpReceiverSender::sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, const std::string& payload)
+ZeroMqAddressedAttributedMessageTcpReceiverSender::processReceivedTcpData(TcpPeer& peer, const char* data, size_t size)
+{
+    if (!peer.m_isReceiveFramingDetected)
+    {
+        peer.m_undetectedTcpData.append(data, size);
+        int32_t isFramedData = uxas::common::LengthPrefixedSerialBuffer::isFramedData(peer.m_undetectedTcpData.data(), peer.m_undetectedTcpData.size());
+        if (isFramedData < 0)
+        {
+            return; // need more bytes to detect framing
+        }
+        peer.m_isReceiveFramingDetected = true;
+        peer.m_isReceiveLengthPrefixed = (isFramedData > 0);
+        UXAS_LOG_INFORM("ZeroMqAddressedAttributedMessageTcpReceiverSender::processReceivedTcpData detected ", (peer.m_isReceiveLengthPrefixed ? "length-prefixed" : "sentinel"), " framing");
+        if (peer.m_isReceiveLengthPrefixed && !peer.m_isSendLengthPrefixed)
+        {
+            // peer supports length-prefixed framing - use it for replies
+            peer.m_isSendLengthPrefixed = true;
+        }
+        std::string undetectedTcpData = std::move(peer.m_undetectedTcpData);
+        peer.m_undetectedTcpData.clear();
+        processReceivedTcpData(peer, undetectedTcpData.data(), undetectedTcpData.size());
+        return;
+    }
+
+    if (peer.m_isReceiveLengthPrefixed)
+    {
+        peer.m_receiveLengthPrefixedDataBuffer.appendData(data, size);
+        std::string recvdTcpDataSegment;
+        while (peer.m_receiveLengthPrefixedDataBuffer.getNextPayloadString(recvdTcpDataSegment))
+        {
+            addReceivedMessage(std::move(recvdTcpDataSegment));
+        }
+    }
+    else
+    {
+        std::string recvdTcpDataSegment = peer.m_receiveTcpDataBuffer.getNextPayloadString(std::string(data, size));
+        while (!recvdTcpDataSegment.empty())
+        {
+            addReceivedMessage(std::move(recvdTcpDataSegment));
+            recvdTcpDataSegment = peer.m_receiveTcpDataBuffer.getNextPayloadString("");
+        }
+    }
+};
+
+void
+ZeroMqAddressedAttributedMessageTcpReceiverSender::addReceivedMessage(std::string delimitedString)
+{
+    UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::addReceivedMessage processing complete object string segment");
+    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
+            = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+    if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(delimitedString)))
+    {
+        m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
+    }
+    else
+    {
+        UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageTcpReceiverSender::addReceivedMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
+    }
+};
+
+void
+ZeroMqAddressedAttributedMessageTcpReceiverSender::setLengthPrefixedFraming(bool isLengthPrefixed, bool isChecksumEnabled)
+{
+    std::lock_guard<std::mutex> lock(m_data_guard);
+    m_isLengthPrefixedFramingConfigured = isLengthPrefixed;
+    m_isSendChecksumEnabled = isChecksumEnabled;
+    for (auto& client : m_clients)
+    {
+        client->m_isSendLengthPrefixed = isLengthPrefixed || (client->m_isReceiveFramingDetected && client->m_isReceiveLengthPrefixed);
+    }
+};
+
+void
+ZeroMqAddressedAttributedMessageTcpReceiverSender::sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, std::string payload)
 {
     std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> message
             = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
@@ -227,29 +285,51 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessag
     std::lock_guard<std::mutex> lock(m_data_guard);
     if (m_zmqSocket)
     {
-        std::string sentinelStr = uxas::common::SentinelSerialBuffer::createSentinelizedString(message->getString());
+        // each framing is created at most once, when first needed by a peer
+        std::string lengthPrefixedStr;
+        std::string sentinelizedStr;
+        auto getFramedString = [&](bool isLengthPrefixed) -> const std::string&
+        {
+            if (isLengthPrefixed)
+            {
+                if (lengthPrefixedStr.empty())
+                {
+                    lengthPrefixedStr = uxas::common::LengthPrefixedSerialBuffer::createFramedString(message->getString(), m_isSendChecksumEnabled);
+                }
+                return (lengthPrefixedStr);
+            }
+            if (sentinelizedStr.empty())
+            {
+                sentinelizedStr = uxas::common::SentinelSerialBuffer::createSentinelizedString(message->getString());
+            }
+            return (sentinelizedStr);
+        };
 
         if(m_zeroMqSocketConfiguration.m_isServerBind)
         {
-            // send to every connected client
-            for(auto c : m_clients)
+            // send to every connected client (using the client's framing)
+            for(auto& c : m_clients)
             {
+                const std::string& framedStr = getFramedString(c->m_isSendLengthPrefixed);
                 // first part of message must be client identity
-                zmq_send(*m_zmqSocket, zframe_data(c), zframe_size(c), ZMQ_SNDMORE);
+                zmq_send(*m_zmqSocket, zframe_data(c->m_identity), zframe_size(c->m_identity), ZMQ_SNDMORE);
                 UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage BEFORE sending TCP stream single-part message");
-                zmq_send(*m_zmqSocket, sentinelStr.c_str(), sentinelStr.size(), 0);
+                zmq_send(*m_zmqSocket, framedStr.c_str(), framedStr.size(), 0);
                 UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage AFTER sending TCP stream single-part message");
             }
         }
         else
         {
+            // the server is the only peer of a client socket
+            const std::string& framedStr = getFramedString(m_clients.empty() ? m_isLengthPrefixedFramingConfigured : m_clients.front()->m_isSendLengthPrefixed);
+
             // force identity to server id according to http://api.zeromq.org/4-1:zmq-socket
             memset(serverid, 0, 256);
             m_zmqSocket->getsockopt(ZMQ_IDENTITY, serverid, &serveridsize);
 
             zmq_send(*m_zmqSocket, serverid, serveridsize, ZMQ_SNDMORE);
             UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage BEFORE sending TCP stream single-part message");
-            zmq_send(*m_zmqSocket, sentinelStr.c_str(), sentinelStr.size(), 0);
+            zmq_send(*m_zmqSocket, framedStr.c_str(), framedStr.size(), 0);
             UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage AFTER sending TCP stream single-part message");
         }
     }
@@ -17,6 +17,7 @@
 #include "ZeroMqReceiverBase.h"
 #include "AddressedAttributedMessage.h"
 #include "UxAS_SentinelSerialBuffer.h"
+#include "UxAS_LengthPrefixedSerialBuffer.h"
 
 namespace uxas
 {
@@ -31,6 +32,16 @@ namespace transport
  * <B><i>ZeroMqAddressedAttributedMessageTcpReceiverSender</i></B> receives 
  * and sends AddressedAttributedMessage data objects via a Zero MQ TCP transport
  * 
+ * \par Framing:
+ * Messages are framed with ASCII sentinels (<B><i>SentinelSerialBuffer</i></B>, 
+ * legacy peers) or with a binary length prefix (<B><i>LengthPrefixedSerialBuffer</i></B>). 
+ * The received framing is detected separately for each peer (ZMQ_STREAM 
+ * identity) from the first bytes of its stream. Messages sent to a peer are 
+ * length-prefixed if configured (see <B><i>setLengthPrefixedFraming</i></B>) 
+ * or once a length-prefixed frame is received from that peer; otherwise 
+ * sentinels are used, so legacy and length-prefixed peers can be connected 
+ * to the same server.
+ * 
  * \par Threading:
  * <B><i>ZeroMqAddressedAttributedMessageTcpReceiverSender</i></B> is not designed for multi-threaded use.  
  * Specifically, the following three methods could be unsafe 
@@ -67,19 +78,66 @@ public:
     getNextMessage();
     
     void
-    sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, const std::string& payload);
+    sendMessage(const std::string& address, const std::string& contentType, const std::string& descriptor, std::string payload);
     
     void
     sendAddressedAttributedMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> message);
 
+    /** \brief Configure sent message framing.
+     * 
+     * @param isLengthPrefixed if true, always send length-prefixed frames; 
+     * if false, send sentinel frames until the peer sends length-prefixed frames.
+     * @param isChecksumEnabled if true, length-prefixed frames include a CRC32C.
+     */
+    void
+    setLengthPrefixedFraming(bool isLengthPrefixed, bool isChecksumEnabled);
+
 private:
 
-    uxas::common::SentinelSerialBuffer m_receiveTcpDataBuffer;
+    /** \brief Stream framing state of a connected peer (ZMQ_STREAM identity) */
+    struct TcpPeer
+    {
+        ~TcpPeer() { zframe_destroy(&m_identity); };
+
+        /** \brief Identity frame (owned) */
+        zframe_t* m_identity{nullptr};
+
+        uxas::common::SentinelSerialBuffer m_receiveTcpDataBuffer;
+        uxas::common::LengthPrefixedSerialBuffer m_receiveLengthPrefixedDataBuffer;
+
+        /** \brief Received framing is undetermined until the first stream bytes arrive */
+        bool m_isReceiveFramingDetected{false};
+        bool m_isReceiveLengthPrefixed{false};
+        /** \brief Stream bytes received before the framing is detected */
+        std::string m_undetectedTcpData;
+
+        /** \brief Length-prefixed sending configured or negotiated with the peer */
+        bool m_isSendLengthPrefixed{false};
+    };
+
+    /** \brief Peer having identity <b>identityFrame</b> (nullptr if not connected) */
+    TcpPeer*
+    findPeer(zframe_t* identityFrame);
+
+    /** \brief Add a peer taking ownership of <b>identityFrame</b> */
+    TcpPeer&
+    addPeer(zframe_t* identityFrame);
+
+    /** \brief Extract complete messages from stream data received from <b>peer</b> into <B><i>m_recvdMsgs</i></B> */
+    void
+    processReceivedTcpData(TcpPeer& peer, const char* data, size_t size);
+
+    void
+    addReceivedMessage(std::string delimitedString);
+
+    /** \brief Length-prefixed sending configured (see <B><i>setLengthPrefixedFraming</i></B>) */
+    bool m_isLengthPrefixedFramingConfigured{false};
+    bool m_isSendChecksumEnabled{false};
     std::deque< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > m_recvdMsgs;
     std::string m_sourceGroup;
     
     // for return sending for zeromq tcp sockets
-    std::vector< zframe_t* > m_clients;
+    std::vector< std::unique_ptr<TcpPeer> > m_clients;
     
     // guard for accessing m_clients to carefully manage memory of zframes
     std::mutex m_data_guard;
@@ -10,6 +10,7 @@
 #include "ZeroMqFabric.h"
 
 #include "stdUniquePtr.h"
+#include "UxAS_ConfigurationManager.h"
 #include "UxAS_Log.h"
 
 #include <chrono>
@@ -31,7 +32,8 @@ ZeroMqFabric::getInstance()
     if (!ZeroMqFabric::s_instance)
     {
         s_instance.reset(new ZeroMqFabric);
-        s_instance->m_zmqContext = uxas::stduxas::make_unique<zmq::context_t>(1);
+        s_instance->m_zmqContext = uxas::stduxas::make_unique<zmq::context_t>(uxas::common::ConfigurationManager::getZeroMqIoThreadCount());
+        UXAS_LOG_INFORM("ZeroMqFabric::getInstance created ZMQ context with ", uxas::common::ConfigurationManager::getZeroMqIoThreadCount(), " I/O thread(s)");
     }
 
     return *s_instance;
@@ -76,6 +78,44 @@ ZeroMqFabric::createSocket(ZeroMqSocketConfiguration& socketConfiguration)
     }
     
     UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket new ZMQ socket successfully created with type ", socketConfiguration.m_zmqSocketType);
+
+    // socket options must be set before bind/connect to apply to the new connections
+    UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting RCV high-water mark for socket to ", socketConfiguration.m_receiveHighWaterMark);
+    zmqSocket->setsockopt(ZMQ_RCVHWM, &socketConfiguration.m_receiveHighWaterMark, sizeof (socketConfiguration.m_receiveHighWaterMark));
+    UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting SEND high-water mark for socket to ", socketConfiguration.m_sendHighWaterMark);
+    zmqSocket->setsockopt(ZMQ_SNDHWM, &socketConfiguration.m_sendHighWaterMark, sizeof (socketConfiguration.m_sendHighWaterMark));
+    if (socketConfiguration.m_receiveBufferSize >= 0)
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting RCV buffer size for socket to ", socketConfiguration.m_receiveBufferSize);
+        zmqSocket->setsockopt(ZMQ_RCVBUF, &socketConfiguration.m_receiveBufferSize, sizeof (socketConfiguration.m_receiveBufferSize));
+    }
+    if (socketConfiguration.m_sendBufferSize >= 0)
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting SEND buffer size for socket to ", socketConfiguration.m_sendBufferSize);
+        zmqSocket->setsockopt(ZMQ_SNDBUF, &socketConfiguration.m_sendBufferSize, sizeof (socketConfiguration.m_sendBufferSize));
+    }
+    if (socketConfiguration.m_tcpKeepAlive >= 0)
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting TCP keep-alive for socket to ", socketConfiguration.m_tcpKeepAlive);
+        zmqSocket->setsockopt(ZMQ_TCP_KEEPALIVE, &socketConfiguration.m_tcpKeepAlive, sizeof (socketConfiguration.m_tcpKeepAlive));
+    }
+    if (socketConfiguration.m_tcpKeepAliveIdle >= 0)
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting TCP keep-alive idle for socket to ", socketConfiguration.m_tcpKeepAliveIdle);
+        zmqSocket->setsockopt(ZMQ_TCP_KEEPALIVE_IDLE, &socketConfiguration.m_tcpKeepAliveIdle, sizeof (socketConfiguration.m_tcpKeepAliveIdle));
+    }
+    if (socketConfiguration.m_affinity > 0)
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting affinity for socket to ", socketConfiguration.m_affinity);
+        zmqSocket->setsockopt(ZMQ_AFFINITY, &socketConfiguration.m_affinity, sizeof (socketConfiguration.m_affinity));
+    }
+    if (socketConfiguration.m_isImmediate)
+    {
+        int32_t isImmediate{1};
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting immediate for socket");
+        zmqSocket->setsockopt(ZMQ_IMMEDIATE, &isImmediate, sizeof (isImmediate));
+    }
+
     if (socketConfiguration.m_isServerBind)
     {
         UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket BINDING socket to ", socketConfiguration.m_socketAddress.c_str());
@@ -86,14 +126,25 @@ ZeroMqFabric::createSocket(ZeroMqSocketConfiguration& socketConfiguration)
         UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket CONNECTING socket to ", socketConfiguration.m_socketAddress.c_str());
         zmqSocket->connect(socketConfiguration.m_socketAddress.c_str());
     }
-    UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting RCV high-water mark for socket to ", socketConfiguration.m_receiveHighWaterMark);
-    zmqSocket->setsockopt(ZMQ_RCVHWM, &socketConfiguration.m_receiveHighWaterMark, sizeof (socketConfiguration.m_receiveHighWaterMark));
-    UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting SEND high-water mark for socket to ", socketConfiguration.m_sendHighWaterMark);
-    zmqSocket->setsockopt(ZMQ_SNDHWM, &socketConfiguration.m_sendHighWaterMark, sizeof (socketConfiguration.m_sendHighWaterMark));
     UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket method END");
     return (zmqSocket);
 };
 
+ZeroMqSocketConfiguration
+ZeroMqFabric::getDefaultSocketTuning()
+{
+    ZeroMqSocketConfiguration tuning;
+    tuning.m_receiveHighWaterMark = uxas::common::ConfigurationManager::getZeroMqHighWaterMark();
+    tuning.m_sendHighWaterMark = uxas::common::ConfigurationManager::getZeroMqHighWaterMark();
+    tuning.m_receiveBufferSize = uxas::common::ConfigurationManager::getZeroMqReceiveBufferSize();
+    tuning.m_sendBufferSize = uxas::common::ConfigurationManager::getZeroMqSendBufferSize();
+    tuning.m_tcpKeepAlive = uxas::common::ConfigurationManager::getZeroMqTcpKeepAlive();
+    tuning.m_tcpKeepAliveIdle = uxas::common::ConfigurationManager::getZeroMqTcpKeepAliveIdle();
+    tuning.m_affinity = uxas::common::ConfigurationManager::getZeroMqAffinity();
+    tuning.m_isImmediate = uxas::common::ConfigurationManager::getIsZeroMqImmediate();
+    return (tuning);
+};
+
 }; //namespace transport
 }; //namespace communications
 }; //namespace uxas
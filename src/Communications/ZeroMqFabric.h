@@ -42,6 +42,14 @@ public:
     std::unique_ptr<zmq::socket_t>
     createSocket(ZeroMqSocketConfiguration& socketConfiguration);
 
+    /** \brief Socket tuning options configured for the UxAS entity 
+     * (see ConfigurationManager).
+     * 
+     * @return configuration having only socket tuning options set.
+     */
+    static ZeroMqSocketConfiguration
+    getDefaultSocketTuning();
+
 private:
 
     /** \brief Public, direct construction not permitted (singleton pattern) */
@@ -58,6 +58,28 @@ ZeroMqReceiverBase::initialize(uint32_t entityId, uint32_t serviceId, SocketConf
     }
 };
 
+bool
+ZeroMqReceiverBase::addConnection(const std::string& socketAddress)
+{
+    if (!m_zmqSocket || m_zeroMqSocketConfiguration.m_isServerBind)
+    {
+        UXAS_LOG_ERROR("ZeroMqReceiverBase::addConnection cannot connect to ", socketAddress, " since socket is not an initialized client socket");
+        return (false);
+    }
+
+    try
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqReceiverBase::addConnection CONNECTING socket to ", socketAddress);
+        m_zmqSocket->connect(socketAddress.c_str());
+    }
+    catch (std::exception& ex)
+    {
+        UXAS_LOG_ERROR("ZeroMqReceiverBase::addConnection, connect socket EXCEPTION: ", ex.what());
+        return (false);
+    }
+    return (true);
+};
+
 bool
 ZeroMqReceiverBase::addSubscriptionAddressToSocket(const std::string& address)
 {
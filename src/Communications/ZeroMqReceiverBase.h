@@ -66,6 +66,15 @@ public:
 
     void
     initialize(uint32_t entityId, uint32_t serviceId, SocketConfiguration& zeroMqSocketConfiguration);
+
+    /** \brief Connect the (client) socket to an additional address, e.g., 
+     * to receive from every shard of the <b>LMCP</b> network server.
+     * 
+     * @param socketAddress address to connect to.
+     * @return true if connected.
+     */
+    bool
+    addConnection(const std::string& socketAddress);
     
     bool
     addSubscriptionAddressToSocket(const std::string& address) override;
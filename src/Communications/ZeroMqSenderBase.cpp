@@ -59,6 +59,17 @@ ZeroMqSenderBase::initialize(const std::string& sourceGroup, uint32_t entityId,
     }
 };
 
+bool
+ZeroMqSenderBase::sendFrame(zmq::message_t& frame, bool isMoreFrames)
+{
+    if (!m_zmqSocket)
+    {
+        UXAS_LOG_ERROR("ZeroMqSenderBase::sendFrame failed since socket has not been initialized");
+        return (false);
+    }
+    return (m_zmqSocket->send(frame, (isMoreFrames ? ZMQ_SNDMORE : 0)));
+};
+
 }; //namespace transport
 }; //namespace communications
 }; //namespace uxas
@@ -53,6 +53,16 @@ public:
 
     void
     initialize(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, SocketConfiguration& zeroMqSocketConfiguration);
+
+    /** \brief Send a Zero MQ frame as-is (e.g., forwarding a received frame). 
+     * Frame content is transferred to the socket without copying.
+     * 
+     * @param frame frame to be sent (empty after sending).
+     * @param isMoreFrames true if more frames of the same message follow.
+     * @return true if the frame was sent.
+     */
+    bool
+    sendFrame(zmq::message_t& frame, bool isMoreFrames);
     
 protected:
 
@@ -42,10 +42,37 @@ public:
     m_zmqSocketType(zmqSocketType), m_isServerBind(isServerBind),
     m_receiveHighWaterMark(receiveHighWaterMark), m_sendHighWaterMark(sendHighWaterMark) { };
 
+    /** \brief Copy socket tuning options (high water marks, kernel buffer 
+     * sizes, TCP keep-alive, affinity and immediate) from <b>tuning</b>. */
+    void
+    setTuning(const ZeroMqSocketConfiguration& tuning)
+    {
+        m_receiveHighWaterMark = tuning.m_receiveHighWaterMark;
+        m_sendHighWaterMark = tuning.m_sendHighWaterMark;
+        m_receiveBufferSize = tuning.m_receiveBufferSize;
+        m_sendBufferSize = tuning.m_sendBufferSize;
+        m_tcpKeepAlive = tuning.m_tcpKeepAlive;
+        m_tcpKeepAliveIdle = tuning.m_tcpKeepAliveIdle;
+        m_affinity = tuning.m_affinity;
+        m_isImmediate = tuning.m_isImmediate;
+    };
+
     int32_t m_zmqSocketType;
     bool m_isServerBind{false};
     int32_t m_receiveHighWaterMark{0};
     int32_t m_sendHighWaterMark{0};
+    /** \brief kernel receive buffer size in bytes (-1 implies operating system default) */
+    int32_t m_receiveBufferSize{-1};
+    /** \brief kernel send buffer size in bytes (-1 implies operating system default) */
+    int32_t m_sendBufferSize{-1};
+    /** \brief TCP keep-alive (1 enables, 0 disables, -1 implies operating system default) */
+    int32_t m_tcpKeepAlive{-1};
+    /** \brief TCP keep-alive idle duration in seconds (-1 implies operating system default) */
+    int32_t m_tcpKeepAliveIdle{-1};
+    /** \brief I/O thread affinity bit mask of new connections (0 implies any I/O thread) */
+    uint64_t m_affinity{0};
+    /** \brief true implies messages are only queued to completed connections */
+    bool m_isImmediate{false};
 
 };
 
@@ -10,6 +10,7 @@
 #ifndef UXAS_COMMON_STRING_CONSTANT_H
 #define UXAS_COMMON_STRING_CONSTANT_H
 
+#include <cstdint>
 #include <string>
 
 namespace uxas
@@ -35,7 +36,12 @@ public:
     static const std::string& FilterType() { static std::string s_string("FilterType"); return(s_string); };
     static const std::string& GapTime_ms() { static std::string s_string("GapTime_ms"); return(s_string); };
     static const std::string& isDataTimestamp() { static std::string s_string("isDataTimestamp"); return(s_string); };
+    static const std::string& isLmcpNetworkServerForwarder() { static std::string s_string("isLmcpNetworkServerForwarder"); return(s_string); };
     static const std::string& isLoggingThreadId() { static std::string s_string("isLoggingThreadId"); return(s_string); };
+    static const std::string& isSharedLmcpObjectFanOut() { static std::string s_string("isSharedLmcpObjectFanOut"); return(s_string); };
+    static const std::string& isZeroMqBlockingReceive() { static std::string s_string("isZeroMqBlockingReceive"); return(s_string); };
+    static const std::string& isZeroMqImmediate() { static std::string s_string("isZeroMqImmediate"); return(s_string); };
+    static const std::string& LmcpNetworkServerShardCount() { static std::string s_string("LmcpNetworkServerShardCount"); return(s_string); };
     static const std::string& LogFileMessageCountLimit() { static std::string s_string("LogFileMessageCountLimit"); return(s_string); };
     static const std::string& MainFileLoggerSeverityLevel() { static std::string s_string("MainFileLoggerSeverityLevel"); return(s_string); };
     static const std::string& MessageGroup() { static std::string s_string("MessageGroup"); return(s_string); };
@@ -58,14 +64,25 @@ public:
     static const std::string& SerialTimeout_ms() { static std::string s_string("SerialTimeout_ms"); return(s_string); };
     static const std::string& Server() { static std::string s_string("Server"); return(s_string); };
     static const std::string& Service() { static std::string s_string("Service"); return(s_string); };
+    static const std::string& SharedMemoryName() { static std::string s_string("SharedMemoryName"); return(s_string); };
+    static const std::string& SharedMemorySize() { static std::string s_string("SharedMemorySize"); return(s_string); };
     static const std::string& StartDelay_ms() { static std::string s_string("StartDelay_ms"); return(s_string); };
     static const std::string& SubscribeToExternalMessage() { static std::string s_string("SubscribeToExternalMessage"); return(s_string); };
     static const std::string& SubscribeToMessage() { static std::string s_string("SubscribeToMessage"); return(s_string); };
     static const std::string& TcpAddress() { static std::string s_string("TcpAddress"); return(s_string); };
+    static const std::string& TcpFraming() { static std::string s_string("TcpFraming"); return(s_string); };
+    static const std::string& TcpFramingChecksum() { static std::string s_string("TcpFramingChecksum"); return(s_string); };
     static const std::string& TransformReceivedMessage() { static std::string s_string("TransformReceivedMessage"); return(s_string); };
     static const std::string& Type() { static std::string s_string("Type"); return(s_string); };
     static const std::string& UAV() { static std::string s_string("UAV"); return(s_string); };
     static const std::string& UxAS() { static std::string s_string("UxAS"); return(s_string); };
+    static const std::string& ZeroMqAffinity() { static std::string s_string("ZeroMqAffinity"); return(s_string); };
+    static const std::string& ZeroMqHighWaterMark() { static std::string s_string("ZeroMqHighWaterMark"); return(s_string); };
+    static const std::string& ZeroMqIoThreadCount() { static std::string s_string("ZeroMqIoThreadCount"); return(s_string); };
+    static const std::string& ZeroMqReceiveBufferSize() { static std::string s_string("ZeroMqReceiveBufferSize"); return(s_string); };
+    static const std::string& ZeroMqSendBufferSize() { static std::string s_string("ZeroMqSendBufferSize"); return(s_string); };
+    static const std::string& ZeroMqTcpKeepAlive() { static std::string s_string("ZeroMqTcpKeepAlive"); return(s_string); };
+    static const std::string& ZeroMqTcpKeepAliveIdle() { static std::string s_string("ZeroMqTcpKeepAliveIdle"); return(s_string); };
 
 };
 
@@ -98,6 +115,9 @@ public:
     static const std::string& strGetInProc_ThreadControl(){static std::string strString("inproc://thread_control");return(strString);};
     static const std::string& strGetInProc_FromMessageHub(){static std::string strString("inproc://from_message_hub");return(strString);};
     static const std::string& strGetInProc_ToMessageHub(){static std::string strString("inproc://to_message_hub");return(strString);};
+    // LMCP network server shard addresses (shard 0 uses the un-sharded address)
+    static std::string strGetInProc_FromMessageHub(uint32_t shardIndex){return(shardIndex == 0 ? strGetInProc_FromMessageHub() : strGetInProc_FromMessageHub() + "_" + std::to_string(shardIndex));};
+    static std::string strGetInProc_ToMessageHub(uint32_t shardIndex){return(shardIndex == 0 ? strGetInProc_ToMessageHub() : strGetInProc_ToMessageHub() + "_" + std::to_string(shardIndex));};
     static const std::string& strGetInProc_ConfigurationHub(){static std::string strString("inproc://configuration_hub");return(strString);};
     static const std::string& strGetInProc_ManagerThreadControl(){static std::string strString("inproc://manager_thread_control");return(strString);};
 
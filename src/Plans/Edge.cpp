@@ -36,7 +36,7 @@ std::ostream &operator << (std::ostream &os,const CEdge& edgeRhs)
 
 #define SAME_SIGNS(a,b) ((a==0)?(1):(a/fabs(a))) == ((b==0)?(1):(b/fabs(b)))
 
-    bool CEdge::bFindIntersection(const CPosition& posPointA1, const CPosition& posPointA2, const CPosition& posPointB1, const CPosition& posPointB2, CPosition& posIntersectionPoint)
+    bool CEdge::bFindIntersection(const CPosition& posPointA1, const CPosition& posPointA2, const CPosition& posPointB1, const CPosition& posPointB2, CPosition& posIntersectionPoint) const
     {
         bool bReturn(false); //i.e. no intersection
         //check for intersection of segments
@@ -161,7 +161,7 @@ std::ostream &operator << (std::ostream &os,const CEdge& edgeRhs)
     
     
     bool CEdge::bIntersection(const V_POSITION_t& cVertexContainer, const CPosition& posThatB1, const CPosition& posThatB2,
-                                        const n_Const::PlanCost_t& i32IndexA,const n_Const::PlanCost_t& i32IndexB,CPosition& posIntersectionPoint)
+                                        const n_Const::PlanCost_t& i32IndexA,const n_Const::PlanCost_t& i32IndexB,CPosition& posIntersectionPoint) const
     {
         bool bReturn(false);    //i.e. no intersection
         //check for intersection of segments
@@ -186,7 +186,7 @@ std::ostream &operator << (std::ostream &os,const CEdge& edgeRhs)
         return(bReturn);
     };
 
-    bool CEdge::bIntersection(const V_POSITION_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint)
+    bool CEdge::bIntersection(const V_POSITION_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint) const
     {
         bool bReturn(false);    //i.e. no intersection
         //check for intersection of segments
@@ -212,7 +212,7 @@ std::ostream &operator << (std::ostream &os,const CEdge& edgeRhs)
         return(bReturn);
     };
 
-    bool CEdge::bIntersection(const V_POSITON_ID_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint)
+    bool CEdge::bIntersection(const V_POSITON_ID_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint) const
     {
         bool bReturn(false);    //i.e. no intersection
         //check for intersection of segments
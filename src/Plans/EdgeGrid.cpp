@@ -0,0 +1,254 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+// EdgeGrid.cpp: implementation of the CEdgeGrid class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "EdgeGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// bounding boxes are expanded by this much so round off in the intersection test can not be missed
+#define EDGE_GRID_TOLERANCE_M (1.0e-6)
+// upper limit on the number of rows/columns in the grid
+#define EDGE_GRID_CELLS_MAXIMUM (1024)
+
+namespace n_FrameworkLib
+{
+
+    CEdgeGrid::CEdgeGrid()
+    : m_bValid(false),
+    m_szNumberEdges(0),
+    m_dMinEast_m(0.0),
+    m_dMaxEast_m(0.0),
+    m_dMinNorth_m(0.0),
+    m_dMaxNorth_m(0.0),
+    m_dCellSizeEast_m(1.0),
+    m_dCellSizeNorth_m(1.0),
+    m_szNumberColumns(1),
+    m_szNumberRows(1)
+    {
+    }
+
+    void CEdgeGrid::Clear()
+    {
+        m_bValid = false;
+        m_szNumberEdges = 0;
+        m_veEdges.clear();
+        m_vdMinEast_m.clear();
+        m_vdMaxEast_m.clear();
+        m_vdMinNorth_m.clear();
+        m_vdMaxNorth_m.clear();
+        m_vui8MultipleCells.clear();
+        m_vszCellBegin.clear();
+        m_vui32CellEdges.clear();
+        m_szNumberColumns = 1;
+        m_szNumberRows = 1;
+    }
+
+    void CEdgeGrid::Initialize(const V_POSITION_t& vposVertexContainer, const CPolygon::V_POLYGON_t& vplygnPolygons)
+    {
+        Clear();
+
+        m_dMinEast_m = (std::numeric_limits<double>::max)();
+        m_dMaxEast_m = -(std::numeric_limits<double>::max)();
+        m_dMinNorth_m = (std::numeric_limits<double>::max)();
+        m_dMaxNorth_m = -(std::numeric_limits<double>::max)();
+        for (auto itPolygon = vplygnPolygons.begin(); itPolygon != vplygnPolygons.end(); itPolygon++)
+        {
+            for (auto itEdge = itPolygon->veGetPolygonEdges().begin(); itEdge != itPolygon->veGetPolygonEdges().end(); itEdge++)
+            {
+                const CPosition& posFirst(vposVertexContainer[static_cast<size_t>(itEdge->first)]);
+                const CPosition& posSecond(vposVertexContainer[static_cast<size_t>(itEdge->second)]);
+                m_veEdges.push_back(*itEdge);
+                m_vdMinEast_m.push_back((std::min)(posFirst.m_east_m, posSecond.m_east_m) - EDGE_GRID_TOLERANCE_M);
+                m_vdMaxEast_m.push_back((std::max)(posFirst.m_east_m, posSecond.m_east_m) + EDGE_GRID_TOLERANCE_M);
+                m_vdMinNorth_m.push_back((std::min)(posFirst.m_north_m, posSecond.m_north_m) - EDGE_GRID_TOLERANCE_M);
+                m_vdMaxNorth_m.push_back((std::max)(posFirst.m_north_m, posSecond.m_north_m) + EDGE_GRID_TOLERANCE_M);
+                m_dMinEast_m = (std::min)(m_dMinEast_m, m_vdMinEast_m.back());
+                m_dMaxEast_m = (std::max)(m_dMaxEast_m, m_vdMaxEast_m.back());
+                m_dMinNorth_m = (std::min)(m_dMinNorth_m, m_vdMinNorth_m.back());
+                m_dMaxNorth_m = (std::max)(m_dMaxNorth_m, m_vdMaxNorth_m.back());
+            }
+        }
+        m_szNumberEdges = m_veEdges.size();
+        m_vui8MultipleCells.assign(m_szNumberEdges, 0);
+
+        if (m_szNumberEdges > 0)
+        {
+            // about one edge per cell
+            size_t szCellsPerSide = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(m_szNumberEdges))));
+            szCellsPerSide = (std::max)(static_cast<size_t>(1), (std::min)(szCellsPerSide, static_cast<size_t>(EDGE_GRID_CELLS_MAXIMUM)));
+            m_szNumberColumns = szCellsPerSide;
+            m_szNumberRows = szCellsPerSide;
+            m_dCellSizeEast_m = (std::max)((m_dMaxEast_m - m_dMinEast_m) / static_cast<double>(m_szNumberColumns), EDGE_GRID_TOLERANCE_M);
+            m_dCellSizeNorth_m = (std::max)((m_dMaxNorth_m - m_dMinNorth_m) / static_cast<double>(m_szNumberRows), EDGE_GRID_TOLERANCE_M);
+        }
+
+        // count the edges in each cell, then fill in the cells
+        m_vszCellBegin.assign(m_szNumberColumns * m_szNumberRows + 1, 0);
+        for (size_t szEdge = 0; szEdge < m_szNumberEdges; szEdge++)
+        {
+            size_t szColumn0(szGetColumn(m_vdMinEast_m[szEdge]));
+            size_t szColumn1(szGetColumn(m_vdMaxEast_m[szEdge]));
+            size_t szRow0(szGetRow(m_vdMinNorth_m[szEdge]));
+            size_t szRow1(szGetRow(m_vdMaxNorth_m[szEdge]));
+            m_vui8MultipleCells[szEdge] = ((szColumn1 > szColumn0) || (szRow1 > szRow0)) ? (1) : (0);
+            for (size_t szRow = szRow0; szRow <= szRow1; szRow++)
+            {
+                for (size_t szColumn = szColumn0; szColumn <= szColumn1; szColumn++)
+                {
+                    m_vszCellBegin[szRow * m_szNumberColumns + szColumn + 1]++;
+                }
+            }
+        }
+        for (size_t szCell = 0; szCell < (m_szNumberColumns * m_szNumberRows); szCell++)
+        {
+            m_vszCellBegin[szCell + 1] += m_vszCellBegin[szCell];
+        }
+        m_vui32CellEdges.resize(m_vszCellBegin.back());
+        std::vector<size_t> vszCellNext(m_vszCellBegin.begin(), m_vszCellBegin.end() - 1);
+        for (size_t szEdge = 0; szEdge < m_szNumberEdges; szEdge++)
+        {
+            size_t szColumn0(szGetColumn(m_vdMinEast_m[szEdge]));
+            size_t szColumn1(szGetColumn(m_vdMaxEast_m[szEdge]));
+            size_t szRow0(szGetRow(m_vdMinNorth_m[szEdge]));
+            size_t szRow1(szGetRow(m_vdMaxNorth_m[szEdge]));
+            for (size_t szRow = szRow0; szRow <= szRow1; szRow++)
+            {
+                for (size_t szColumn = szColumn0; szColumn <= szColumn1; szColumn++)
+                {
+                    m_vui32CellEdges[vszCellNext[szRow * m_szNumberColumns + szColumn]++] = static_cast<uint32_t>(szEdge);
+                }
+            }
+        }
+
+        m_bValid = true;
+    }
+
+    size_t CEdgeGrid::szGetColumn(const double& dEast_m) const
+    {
+        double dColumn = std::floor((dEast_m - m_dMinEast_m) / m_dCellSizeEast_m);
+        if (!(dColumn > 0.0))
+        {
+            return (0);
+        }
+        if (dColumn >= static_cast<double>(m_szNumberColumns))
+        {
+            return (m_szNumberColumns - 1);
+        }
+        return (static_cast<size_t>(dColumn));
+    }
+
+    size_t CEdgeGrid::szGetRow(const double& dNorth_m) const
+    {
+        double dRow = std::floor((dNorth_m - m_dMinNorth_m) / m_dCellSizeNorth_m);
+        if (!(dRow > 0.0))
+        {
+            return (0);
+        }
+        if (dRow >= static_cast<double>(m_szNumberRows))
+        {
+            return (m_szNumberRows - 1);
+        }
+        return (static_cast<size_t>(dRow));
+    }
+
+    bool CEdgeGrid::bFindIntersection(const V_POSITION_t& vposVertexContainer, const CEdge& eThat) const
+    {
+        return (bFindIntersection(vposVertexContainer, vposVertexContainer[static_cast<size_t>(eThat.first)], vposVertexContainer[static_cast<size_t>(eThat.second)],
+                                  eThat.first, eThat.second));
+    }
+
+    bool CEdgeGrid::bFindIntersection(const V_POSITION_t& vposVertexContainer, const CPosition& posPositionA, const CPosition& posPositionB,
+                                      const n_Const::PlanCost_t& i32IndexA, const n_Const::PlanCost_t& i32IndexB) const
+    {
+        if (m_szNumberEdges == 0)
+        {
+            return (false);
+        }
+
+        double dMinEast_m = (std::min)(posPositionA.m_east_m, posPositionB.m_east_m);
+        double dMaxEast_m = (std::max)(posPositionA.m_east_m, posPositionB.m_east_m);
+        double dMinNorth_m = (std::min)(posPositionA.m_north_m, posPositionB.m_north_m);
+        double dMaxNorth_m = (std::max)(posPositionA.m_north_m, posPositionB.m_north_m);
+        if ((dMaxEast_m < m_dMinEast_m) || (dMinEast_m > m_dMaxEast_m) || (dMaxNorth_m < m_dMinNorth_m) || (dMinNorth_m > m_dMaxNorth_m))
+        {
+            return (false);
+        }
+
+        // edges listed in more than one cell are only checked once
+        std::vector<uint32_t> vui32CheckedEdges;
+
+        // walk the columns that the segment spans, checking the rows that the segment covers in each column
+        double dDeltaEast_m = posPositionB.m_east_m - posPositionA.m_east_m;
+        double dDeltaNorth_m = posPositionB.m_north_m - posPositionA.m_north_m;
+        size_t szColumn0(szGetColumn(dMinEast_m));
+        size_t szColumn1(szGetColumn(dMaxEast_m));
+        for (size_t szColumn = szColumn0; szColumn <= szColumn1; szColumn++)
+        {
+            double dRowMinNorth_m = dMinNorth_m;
+            double dRowMaxNorth_m = dMaxNorth_m;
+            if ((szColumn0 != szColumn1) && (dDeltaEast_m != 0.0))
+            {
+                double dColumnMinEast_m = (szColumn == szColumn0) ? (dMinEast_m) : (m_dMinEast_m + static_cast<double>(szColumn) * m_dCellSizeEast_m);
+                double dColumnMaxEast_m = (szColumn == szColumn1) ? (dMaxEast_m) : (m_dMinEast_m + static_cast<double>(szColumn + 1) * m_dCellSizeEast_m);
+                double dNorth0_m = posPositionA.m_north_m + (dColumnMinEast_m - posPositionA.m_east_m) * dDeltaNorth_m / dDeltaEast_m;
+                double dNorth1_m = posPositionA.m_north_m + (dColumnMaxEast_m - posPositionA.m_east_m) * dDeltaNorth_m / dDeltaEast_m;
+                dRowMinNorth_m = (std::max)(dMinNorth_m, (std::min)(dNorth0_m, dNorth1_m) - EDGE_GRID_TOLERANCE_M);
+                dRowMaxNorth_m = (std::min)(dMaxNorth_m, (std::max)(dNorth0_m, dNorth1_m) + EDGE_GRID_TOLERANCE_M);
+            }
+            size_t szRow0(szGetRow(dRowMinNorth_m));
+            size_t szRow1(szGetRow(dRowMaxNorth_m));
+            for (size_t szRow = szRow0; szRow <= szRow1; szRow++)
+            {
+                if (bCheckCell(szRow * m_szNumberColumns + szColumn, vposVertexContainer, posPositionA, posPositionB, i32IndexA, i32IndexB,
+                               dMinEast_m, dMaxEast_m, dMinNorth_m, dMaxNorth_m, vui32CheckedEdges))
+                {
+                    return (true);
+                }
+            }
+        }
+        return (false);
+    }
+
+    bool CEdgeGrid::bCheckCell(const size_t& szCell, const V_POSITION_t& vposVertexContainer, const CPosition& posPositionA, const CPosition& posPositionB,
+                               const n_Const::PlanCost_t& i32IndexA, const n_Const::PlanCost_t& i32IndexB,
+                               const double& dMinEast_m, const double& dMaxEast_m, const double& dMinNorth_m, const double& dMaxNorth_m,
+                               std::vector<uint32_t>& vui32CheckedEdges) const
+    {
+        for (size_t szIndex = m_vszCellBegin[szCell]; szIndex < m_vszCellBegin[szCell + 1]; szIndex++)
+        {
+            uint32_t ui32Edge = m_vui32CellEdges[szIndex];
+            if ((m_vdMaxEast_m[ui32Edge] < dMinEast_m) || (m_vdMinEast_m[ui32Edge] > dMaxEast_m) ||
+                (m_vdMaxNorth_m[ui32Edge] < dMinNorth_m) || (m_vdMinNorth_m[ui32Edge] > dMaxNorth_m))
+            {
+                continue;
+            }
+            if (m_vui8MultipleCells[ui32Edge])
+            {
+                if (std::find(vui32CheckedEdges.begin(), vui32CheckedEdges.end(), ui32Edge) != vui32CheckedEdges.end())
+                {
+                    continue;
+                }
+                vui32CheckedEdges.push_back(ui32Edge);
+            }
+            CPosition posIntersectionPoint; // not the shared default, so queries can run at the same time
+            if (m_veEdges[ui32Edge].bIntersection(vposVertexContainer, posPositionA, posPositionB, i32IndexA, i32IndexB, posIntersectionPoint))
+            {
+                return (true);
+            }
+        }
+        return (false);
+    }
+
+}       //namespace n_FrameworkLib
@@ -0,0 +1,101 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+//
+//    THIS SOFTWARE AND ANY ACCOMPANYING DOCUMENTATION IS RELEASED "AS IS." THE
+//    U.S.GOVERNMENT MAKES NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, CONCERNING
+//    THIS SOFTWARE AND ANY ACCOMPANYING DOCUMENTATION, INCLUDING, WITHOUT LIMITATION,
+//    ANY WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT
+//    WILL THE U.S. GOVERNMENT BE LIABLE FOR ANY DAMAGES, INCLUDING ANY LOST PROFITS,
+//    LOST SAVINGS OR OTHER INCIDENTAL OR CONSEQUENTIAL DAMAGES ARISING OUT OF THE USE,
+//    OR INABILITY TO USE, THIS SOFTWARE OR ANY ACCOMPANYING DOCUMENTATION, EVEN IF
+//    INFORMED IN ADVANCE OF THE POSSIBILITY OF SUCH DAMAGES.
+//
+// EdgeGrid.h: interface for the CEdgeGrid class.
+//
+//    A uniform grid over polygon edges. Each cell lists the edges whose bounding
+//    boxes overlap it, so a segment intersection test only checks the edges in the
+//    cells that the segment passes through. The edge bounding boxes are stored as
+//    separate arrays (structure of arrays) so the rejection tests run over
+//    contiguous memory.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(EDGE_GRID_H__INCLUDED_)
+#define EDGE_GRID_H__INCLUDED_
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+#include "Edge.h"
+#include "Polygon.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace n_FrameworkLib
+{
+
+class CEdgeGrid
+{
+public:    //constructors/destructors
+    CEdgeGrid();
+
+public:    //methods/functions
+    // builds the grid from the edges of all of the polygons
+    void Initialize(const V_POSITION_t& vposVertexContainer, const CPolygon::V_POLYGON_t& vplygnPolygons);
+    void Clear();
+
+    // returns true if the segment from posPositionA to posPositionB intersects a polygon edge.
+    // edges that share the vertex index i32IndexA or i32IndexB are not checked (same as CEdge::bIntersection)
+    bool bFindIntersection(const V_POSITION_t& vposVertexContainer, const CPosition& posPositionA, const CPosition& posPositionB,
+                           const n_Const::PlanCost_t& i32IndexA = -1, const n_Const::PlanCost_t& i32IndexB = -1) const;
+    bool bFindIntersection(const V_POSITION_t& vposVertexContainer, const CEdge& eThat) const;
+
+protected:
+    bool bCheckCell(const size_t& szCell, const V_POSITION_t& vposVertexContainer, const CPosition& posPositionA, const CPosition& posPositionB,
+                    const n_Const::PlanCost_t& i32IndexA, const n_Const::PlanCost_t& i32IndexB,
+                    const double& dMinEast_m, const double& dMaxEast_m, const double& dMinNorth_m, const double& dMaxNorth_m,
+                    std::vector<uint32_t>& vui32CheckedEdges) const;
+    size_t szGetColumn(const double& dEast_m) const;
+    size_t szGetRow(const double& dNorth_m) const;
+
+public:    //accessors
+    const bool& bGetValid() const {return(m_bValid);};
+    const size_t& szGetNumberEdges() const {return(m_szNumberEdges);};
+
+protected:    //storage
+    bool m_bValid;
+    size_t m_szNumberEdges;
+
+    // edges, and their bounding boxes, stored as separate arrays
+    CEdge::V_EDGE_t m_veEdges;
+    std::vector<double> m_vdMinEast_m;
+    std::vector<double> m_vdMaxEast_m;
+    std::vector<double> m_vdMinNorth_m;
+    std::vector<double> m_vdMaxNorth_m;
+    std::vector<uint8_t> m_vui8MultipleCells;   // edge is listed in more than one cell
+
+    // grid, m_vszCellBegin[c] to m_vszCellBegin[c+1] index the edges in m_vui32CellEdges for cell c (row major)
+    double m_dMinEast_m;
+    double m_dMaxEast_m;
+    double m_dMinNorth_m;
+    double m_dMaxNorth_m;
+    double m_dCellSizeEast_m;
+    double m_dCellSizeNorth_m;
+    size_t m_szNumberColumns;
+    size_t m_szNumberRows;
+    std::vector<size_t> m_vszCellBegin;
+    std::vector<uint32_t> m_vui32CellEdges;
+};
+
+}       //namespace n_FrameworkLib
+
+#endif // !defined(EDGE_GRID_H__INCLUDED_)
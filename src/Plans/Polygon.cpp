@@ -35,6 +35,7 @@
 #include <math.h>
 //#include "GlobalDefines.h"
 #include "CGrid.h"
+#include "EdgeGrid.h"
 
 using namespace std;
 
@@ -367,7 +368,7 @@ void CPolygon::FindPolygonBoundingBox(V_POSITION_t& vposVertexContainer,stringst
         return(errReturn);
     };
 
-CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible)
+CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pedggrdPolygonEdges)
     {
         enError errReturn(errNoError);
 
@@ -400,17 +401,24 @@ CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContaine
                 {
                     bool bIntersectionFound(false);
                     CEdge edgeNew(*itVertexThis,*itVertexThat);
-                    for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
-                        itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
-                        itIntPolygon++)
+                    if((pedggrdPolygonEdges != nullptr) && pedggrdPolygonEdges->bGetValid())
                     {
-                        V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
-                        if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,edgeNew))
+                        bIntersectionFound = pedggrdPolygonEdges->bFindIntersection(vposVertexContainer,edgeNew);
+                    }
+                    else
+                    {
+                        for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
+                            itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
+                            itIntPolygon++)
                         {
-                            bIntersectionFound = true;
-                            break;
-                        }
-                    }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                            V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
+                            if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,edgeNew))
+                            {
+                                bIntersectionFound = true;
+                                break;
+                            }
+                        }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                    }
                     if(!bIntersectionFound)
                     {
                         edgeNew.iGetLength() = static_cast<int>(vposVertexContainer[*itVertexThis].relativeDistance2D_m(vposVertexContainer[*itVertexThat]));
@@ -424,7 +432,7 @@ CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContaine
         return(errReturn);
     };
 
-CPolygon::enError CPolygon::errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible)
+CPolygon::enError CPolygon::errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pedggrdPolygonEdges)
     {
         enError errReturn(errNoError);
 
@@ -456,17 +464,24 @@ CPolygon::enError CPolygon::errAddExtraVisibleEdges(V_POSITION_t& vposVertexCont
                 if(bGoodEdge)
                 {
                     bool bIntersectionFound(false);
-                    for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
-                        itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
-                        itIntPolygon++)
+                    if((pedggrdPolygonEdges != nullptr) && pedggrdPolygonEdges->bGetValid())
                     {
-                        V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
-                        if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,*itEdge))
+                        bIntersectionFound = pedggrdPolygonEdges->bFindIntersection(vposVertexContainer,*itEdge);
+                    }
+                    else
+                    {
+                        for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
+                            itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
+                            itIntPolygon++)
                         {
-                            bIntersectionFound = true;
-                            break;
-                        }
-                    }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                            V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
+                            if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,*itEdge))
+                            {
+                                bIntersectionFound = true;
+                                break;
+                            }
+                        }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                    }
                     if(!bIntersectionFound)
                     {
                         itEdge->iGetLength() = static_cast<int>(vposVertexContainer[static_cast<unsigned int>(itEdge->first)].relativeDistance2D_m(vposVertexContainer[static_cast<unsigned int>(itEdge->second)]));
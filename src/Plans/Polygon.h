@@ -70,6 +70,7 @@ namespace n_FrameworkLib
 {
 
 class CBoundary;
+class CEdgeGrid;
 typedef std::shared_ptr<CBoundary> PTR_BOUNDARY_t;
 typedef std::map<uint64_t,PTR_BOUNDARY_t> M_UI64_PTR_BOUNDARY_t;    
 
@@ -594,10 +595,11 @@ public:    //methods/functions
     bool bCheckForIntersection(V_POSITION_t& vposVertexContainer,const CEdge& eThatEdge)
     {
         bool bIntersectionFound(false);
+        CPosition posIntersectionPoint; // not the shared default, so checks can run at the same time
 
         for(V_EDGE_IT_t itEdge=veGetPolygonEdges().begin();itEdge!=veGetPolygonEdges().end();itEdge++)
         {
-            if(itEdge->bIntersection(vposVertexContainer,eThatEdge))
+            if(itEdge->bIntersection(vposVertexContainer,eThatEdge,posIntersectionPoint))
             {
                 bIntersectionFound = true;
                 break;
@@ -621,8 +623,9 @@ public:    //methods/functions
 
     enError errCheckForConcavity(V_POSITION_t& vposVerticies);
     enError errFindSelfVisibleEdges(V_POSITION_t& vposVertexContainer);
-    enError errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible);
-    enError errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible);
+    //if pedggrdPolygonEdges is given, it is used to check for intersections with all of the polygon edges
+    enError errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pedggrdPolygonEdges=nullptr);
+    enError errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pedggrdPolygonEdges=nullptr);
 
 
 
@@ -25,6 +25,8 @@
 //    4. Add extra vertices, e.g. vehicles/objectives => vposidVerticiesCurrent.push_back(CPosition())
 //    5. Buld current visibility graph, i.e. find visible edges for each of the new vertices =>  enError errBuildVisibilityGraphCurrent(void)
 //
+//    Keep-out polygons that do not overlap the existing polygons can be added to an initialized graph => enError errAddKeepOutPolygonBase(...)
+//
 //////////////////////////////////////////////////////////////////////
 
 
@@ -39,6 +41,14 @@
 
 #include <pugixml.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <queue>
+#include <system_error>
+#include <thread>
+#include <tuple>
+
 
 namespace n_FrameworkLib
 {
@@ -58,7 +68,15 @@ namespace n_FrameworkLib
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
 
     CVisibilityGraph::CVisibilityGraph()
-    : m_pedglstvecGraph(0),
+    : m_szNumberVerticesBase(0),
+    m_bVertexParentBaseCompact(false),
+    m_bCompactVertexParentBase(true),
+    m_szNumberThreadsBase(0),
+    m_bShortestPathTreesBase(false),
+    m_bLazyShortestPathsBase(false),
+    m_szShortestPathTreeCacheSizeBase(64),
+    m_dHeuristicScaleBase(1.0),
+    m_pedglstvecGraph(0),
     m_ptypeType(CPathInformation::ptypeEqualLength),
     m_iLengthSegmentMinimum(1)
     {
@@ -210,54 +228,10 @@ namespace n_FrameworkLib
         //clear out any old edges
         veGetEdgesVisibleBase().clear();
         //add all of the visible edges that we already know about
-        stringstream sstrErrorMessage;
         for (V_POLYGON_IT_t itPolygon = vplygnGetPolygons().begin(); itPolygon != vplygnGetPolygons().end(); itPolygon++)
         {
-            if (itPolygon->plytypGetPolygonType().bGetKeepIn())
-            {
-                // add all of the keep-in zone edges
-                for (V_EDGE_IT_t itEdge = itPolygon->veGetPolygonEdges().begin(); itEdge != itPolygon->veGetPolygonEdges().end(); itEdge++)
-                {
-                    veGetEdgesVisibleBase().push_back(*itEdge);
-                }
-            }
-            else //if(itPolygon->plytypGetPolygonType().bGetKeepInZone())
-            {
-                for (V_EDGE_IT_t itEdge = itPolygon->veGetPolygonEdges().begin(); itEdge != itPolygon->veGetPolygonEdges().end(); itEdge++)
-                {
-                    bool bGoodEdge(true);
-                    double dX0 = vposGetVerticiesBase()[itEdge->first].m_north_m;
-                    double dY0 = vposGetVerticiesBase()[itEdge->first].m_east_m;
-                    double dZ0 = vposGetVerticiesBase()[itEdge->first].m_altitude_m;
-                    double dX1 = vposGetVerticiesBase()[itEdge->second].m_north_m;
-                    double dY1 = vposGetVerticiesBase()[itEdge->second].m_east_m;
-                    double dZ1 = vposGetVerticiesBase()[itEdge->second].m_altitude_m;
-                    double dMid_X = (dX1 - dX0) / 2.0 + dX0;
-                    double dMid_Y = (dY1 - dY0) / 2.0 + dY0;
-                    double dMid_Z = (dZ1 - dZ0) / 2.0 + dZ0;
-                    for (V_POLYGON_IT_t itPolygonCheck = vplygnGetPolygons().begin(); itPolygonCheck != vplygnGetPolygons().end(); itPolygonCheck++)
-                    {
-                        if (itPolygonCheck->plytypGetPolygonType().bGetKeepIn())
-                        {
-                            // check to make sure that the current edge does not overlap a keep-in boundary
-                            // check start, end, and middle points to see if they are all in or out of the boundary
-                            bool bOneIn = itPolygonCheck->InPolygon(dX0, dY0, dZ0, vposGetVerticiesBase(), sstrErrorMessage);
-                            bool bTwoIn = itPolygonCheck->InPolygon(dX1, dY1, dZ1, vposGetVerticiesBase(), sstrErrorMessage);
-                            bool bThreeIn = itPolygonCheck->InPolygon(dMid_X, dMid_Y, dMid_Z, vposGetVerticiesBase(), sstrErrorMessage);
-                            if ((bOneIn != bTwoIn) || (bOneIn != bThreeIn))
-                            {
-                                bGoodEdge = false;
-                                break;
-                            }
-                        }
-                    }
-                    if (bGoodEdge)
-                    {
-                        veGetEdgesVisibleBase().push_back(*itEdge);
-                    }
-                }
-            } //if(itPolygon->plytypGetPolygonType().bGetKeepInZone())
-        } //for(V_POLYGON_IT_t itPolygon=vplygnGetPolygons().begin();itPolygon!=vplygnGetPolygons().end();itPolygon++)
+            errAddPolygonEdgesVisibleBase(itPolygon);
+        }
 
 #ifdef STEVETEST
         // find all the visible edges on non-convex polygons (these may cross other polygons, so need to check them for intersections)
@@ -285,7 +259,7 @@ namespace n_FrameworkLib
             {
                 for (V_POLYGON_IT_t itPolygons2 = (itPolygons1 + 1); itPolygons2 != vplygnGetPolygons().end(); itPolygons2++)
                 {
-                    itPolygons1->errFindVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase());
+                    itPolygons1->errFindVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase(), &m_edggrdPolygonEdgesBase);
                 }
             }
         }
@@ -301,7 +275,7 @@ namespace n_FrameworkLib
                 {
                     if (itPolygons2 != itPolygons1)
                     {
-                        itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase());
+                        itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase(), &m_edggrdPolygonEdgesBase);
                     }
                 }
             }
@@ -309,12 +283,228 @@ namespace n_FrameworkLib
             itPolygons1 = vplygnGetPolygons().end() - 1;
             for (V_POLYGON_IT_t itPolygons2 = vplygnGetPolygons().begin(); itPolygons2 != (vplygnGetPolygons().end() - 1); itPolygons2++)
             {
-                itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase());
+                itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase(), &m_edggrdPolygonEdgesBase);
             }
         }
         else if (!vplygnGetPolygons().empty()) //if(vplygnGetPolygons().size() > 1)
         {
-            vplygnGetPolygons().begin()->errAddExtraVisibleEdges(vposGetVerticiesBase(), vplygnGetPolygons().begin(), veGetEdgesVisibleBase());
+            vplygnGetPolygons().begin()->errAddExtraVisibleEdges(vposGetVerticiesBase(), vplygnGetPolygons().begin(), veGetEdgesVisibleBase(), &m_edggrdPolygonEdgesBase);
+        }
+        PRINT_DEBUG("*DEBUG*")
+        return (errReturn);
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    CVisibilityGraph::enError CVisibilityGraph::errAddPolygonEdgesVisibleBase(const V_POLYGON_IT_t& itPolygon)
+    {
+        enError errReturn(errNoError);
+
+        stringstream sstrErrorMessage;
+        if (itPolygon->plytypGetPolygonType().bGetKeepIn())
+        {
+            // add all of the keep-in zone edges
+            for (V_EDGE_IT_t itEdge = itPolygon->veGetPolygonEdges().begin(); itEdge != itPolygon->veGetPolygonEdges().end(); itEdge++)
+            {
+                veGetEdgesVisibleBase().push_back(*itEdge);
+            }
+        }
+        else //if(itPolygon->plytypGetPolygonType().bGetKeepInZone())
+        {
+            for (V_EDGE_IT_t itEdge = itPolygon->veGetPolygonEdges().begin(); itEdge != itPolygon->veGetPolygonEdges().end(); itEdge++)
+            {
+                bool bGoodEdge(true);
+                double dX0 = vposGetVerticiesBase()[itEdge->first].m_north_m;
+                double dY0 = vposGetVerticiesBase()[itEdge->first].m_east_m;
+                double dZ0 = vposGetVerticiesBase()[itEdge->first].m_altitude_m;
+                double dX1 = vposGetVerticiesBase()[itEdge->second].m_north_m;
+                double dY1 = vposGetVerticiesBase()[itEdge->second].m_east_m;
+                double dZ1 = vposGetVerticiesBase()[itEdge->second].m_altitude_m;
+                double dMid_X = (dX1 - dX0) / 2.0 + dX0;
+                double dMid_Y = (dY1 - dY0) / 2.0 + dY0;
+                double dMid_Z = (dZ1 - dZ0) / 2.0 + dZ0;
+                for (V_POLYGON_IT_t itPolygonCheck = vplygnGetPolygons().begin(); itPolygonCheck != vplygnGetPolygons().end(); itPolygonCheck++)
+                {
+                    if (itPolygonCheck->plytypGetPolygonType().bGetKeepIn())
+                    {
+                        // check to make sure that the current edge does not overlap a keep-in boundary
+                        // check start, end, and middle points to see if they are all in or out of the boundary
+                        bool bOneIn = itPolygonCheck->InPolygon(dX0, dY0, dZ0, vposGetVerticiesBase(), sstrErrorMessage);
+                        bool bTwoIn = itPolygonCheck->InPolygon(dX1, dY1, dZ1, vposGetVerticiesBase(), sstrErrorMessage);
+                        bool bThreeIn = itPolygonCheck->InPolygon(dMid_X, dMid_Y, dMid_Z, vposGetVerticiesBase(), sstrErrorMessage);
+                        if ((bOneIn != bTwoIn) || (bOneIn != bThreeIn))
+                        {
+                            bGoodEdge = false;
+                            break;
+                        }
+                    }
+                }
+                if (bGoodEdge)
+                {
+                    veGetEdgesVisibleBase().push_back(*itEdge);
+                }
+            }
+        } //if(itPolygon->plytypGetPolygonType().bGetKeepInZone())
+        return (errReturn);
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    CVisibilityGraph::enError CVisibilityGraph::errAddKeepOutPolygonBase(const int& iUniqueID, V_POSITION_IT_t itBegin, V_POSITION_IT_t itEnd, const double& dPolygonExpansionDistance)
+    {
+        // adds a keep-out polygon to a graph that has been built and initialized:
+        //    1) expand the new polygon, the same way as errExpandAndMergePolygons
+        //    2) if it overlaps an existing polygon it would need to be merged, return errPolygonMerging without changing the graph
+        //    3) remove the visible edges that cross the new polygon and add the visible edges to the new vertices
+        //    4) update the shortest paths, only searching again from sources whose shortest path tree used a removed edge
+        enError errReturn(errNoError);
+        PRINT_DEBUG("*DEBUG* iUniqueID[" << iUniqueID << "]")
+
+        if (!pedglstvecGetGraph() || (m_szNumberVerticesBase != vposGetVerticiesBase().size()))
+        {
+            return (errDistancesBase);
+        }
+
+        std::vector< VisiLibity::Point > polygonVertices;
+        for (V_POSITION_IT_t itVertex = itBegin; itVertex != itEnd; itVertex++)
+            polygonVertices.push_back(VisiLibity::Point(itVertex->m_east_m, itVertex->m_north_m));
+        VisiLibity::Polygon poly(polygonVertices);
+
+        // remove excess points
+        poly.eliminate_redundant_vertices(1.0);
+
+        double epsilon(1e-8);
+        // ensure that the polygon is simple
+        if (!poly.is_simple(epsilon))
+            return (errPolygonCreation);
+
+        // ensure that the polygon is properly oriented
+        if (poly.area() < 0)
+            poly.reverse();
+
+        std::vector< VisiLibity::Polygon > expandList(1, poly);
+        std::vector< double > expandValues(1, (dPolygonExpansionDistance < 0.0) ? (0.0) : (dPolygonExpansionDistance)); // don't let it shrink!
+        std::vector< VisiLibity::Polygon > expandedPolygons;
+        if (!VisiLibity::Polygon::offset_polygons(expandList, expandedPolygons, expandValues, 1e-8))
+            return (errPolygonMerging);
+
+        std::vector< VisiLibity::Polygon > addPolygons;
+        for (size_t k = 0; k < expandedPolygons.size(); k++)
+        {
+            expandedPolygons[k].eliminate_redundant_vertices(1.0);
+            if (fabs(expandedPolygons[k].area()) > 1.0)
+            {
+                addPolygons.push_back(expandedPolygons[k]);
+            }
+        }
+        if (addPolygons.empty())
+        {
+            // too small, a full build would drop it as well
+            return (errReturn);
+        }
+        else if (addPolygons.size() > 1)
+        {
+            return (errPolygonMerging);
+        }
+
+        // add the vertices, they are removed if the polygon can not be added
+        const size_t szNumberVerticesOld(vposGetVerticiesBase().size());
+        CPolygon cPolygon(static_cast<int> (vplygnGetPolygons().size()) + 1);
+        cPolygon.plytypGetPolygonType().bGetKeepIn() = false;
+        for (unsigned int n = 0; n < addPolygons.front().n(); n++)
+        {
+            cPolygon.viGetVerticies().push_back(static_cast<int> (vposGetVerticiesBase().size()));
+            vposGetVerticiesBase().push_back(CPosition(addPolygons.front()[n].y(), addPolygons.front()[n].x()));
+        }
+        cPolygon.errFinalizePolygon(vposGetVerticiesBase());
+
+        // the new polygon can not cross, contain, or be inside of another polygon
+        bool bOverlap(false);
+        stringstream sstrErrorMessage;
+        for (V_EDGE_IT_t itEdge = cPolygon.veGetPolygonEdges().begin(); !bOverlap && (itEdge != cPolygon.veGetPolygonEdges().end()); itEdge++)
+        {
+            bOverlap = bFindIntersection(vposGetVerticiesBase(), vplygnGetPolygons(),
+                    vposGetVerticiesBase()[static_cast<size_t> (itEdge->first)], vposGetVerticiesBase()[static_cast<size_t> (itEdge->second)]);
+        }
+        for (size_t szVertex = 0; !bOverlap && (szVertex < szNumberVerticesOld); szVertex++)
+        {
+            bOverlap = cPolygon.InPolygon(vposGetVerticiesBase()[szVertex].m_north_m, vposGetVerticiesBase()[szVertex].m_east_m, 0.0, vposGetVerticiesBase(), sstrErrorMessage);
+        }
+        const CPosition& posVertexNew(vposGetVerticiesBase()[szNumberVerticesOld]);
+        for (V_POLYGON_IT_t itPolygon = vplygnGetPolygons().begin(); !bOverlap && (itPolygon != vplygnGetPolygons().end()); itPolygon++)
+        {
+            if (!itPolygon->plytypGetPolygonType().bGetKeepIn())
+            {
+                bOverlap = itPolygon->InPolygon(posVertexNew.m_north_m, posVertexNew.m_east_m, 0.0, vposGetVerticiesBase(), sstrErrorMessage);
+            }
+        }
+        if (bOverlap)
+        {
+            PRINT_DEBUG("*DEBUG* polygon overlaps an existing polygon, iUniqueID[" << iUniqueID << "]")
+            vposGetVerticiesBase().resize(szNumberVerticesOld);
+            return (errPolygonMerging);
+        }
+
+        vplygnGetPolygons().push_back(cPolygon);
+        V_POLYGON_IT_t itPolygonNew = vplygnGetPolygons().end() - 1;
+
+        // the stored polygon iterators are not valid after the push_back
+        for (V_POLYGON_IT_t itPolygon = vplygnGetPolygons().begin(); itPolygon != vplygnGetPolygons().end(); itPolygon++)
+        {
+            V_POLYGON_IT_t itPolygonBegin = vplygnGetPolygons().begin();
+            V_POLYGON_IT_t itPolygonEnd = vplygnGetPolygons().end();
+            itPolygon->mmapiitGetSortedDistancesToOtherPolygons().clear();
+            itPolygon->errCalculateDistanceToOtherPolygons(itPolygonBegin, itPolygonEnd);
+        }
+        m_edggrdPolygonEdgesBase.Initialize(vposGetVerticiesBase(), vplygnGetPolygons());
+
+        // remove the visible edges that cross the new polygon
+        double dMinNorth_m((std::numeric_limits<double>::max)());
+        double dMaxNorth_m(-(std::numeric_limits<double>::max)());
+        double dMinEast_m((std::numeric_limits<double>::max)());
+        double dMaxEast_m(-(std::numeric_limits<double>::max)());
+        for (size_t szVertex = szNumberVerticesOld; szVertex < vposGetVerticiesBase().size(); szVertex++)
+        {
+            dMinNorth_m = (std::min)(dMinNorth_m, vposGetVerticiesBase()[szVertex].m_north_m);
+            dMaxNorth_m = (std::max)(dMaxNorth_m, vposGetVerticiesBase()[szVertex].m_north_m);
+            dMinEast_m = (std::min)(dMinEast_m, vposGetVerticiesBase()[szVertex].m_east_m);
+            dMaxEast_m = (std::max)(dMaxEast_m, vposGetVerticiesBase()[szVertex].m_east_m);
+        }
+        V_EDGE_t veEdgesVisible;
+        V_EDGE_t veEdgesRemoved;
+        veEdgesVisible.reserve(veGetEdgesVisibleBase().size());
+        for (V_EDGE_IT_t itEdge = veGetEdgesVisibleBase().begin(); itEdge != veGetEdgesVisibleBase().end(); itEdge++)
+        {
+            const CPosition& posFirst(vposGetVerticiesBase()[static_cast<size_t> (itEdge->first)]);
+            const CPosition& posSecond(vposGetVerticiesBase()[static_cast<size_t> (itEdge->second)]);
+            bool bOutsideBox = ((std::max)(posFirst.m_north_m, posSecond.m_north_m) < dMinNorth_m) || ((std::min)(posFirst.m_north_m, posSecond.m_north_m) > dMaxNorth_m) ||
+                    ((std::max)(posFirst.m_east_m, posSecond.m_east_m) < dMinEast_m) || ((std::min)(posFirst.m_east_m, posSecond.m_east_m) > dMaxEast_m);
+            if (!bOutsideBox && itPolygonNew->bCheckForIntersection(vposGetVerticiesBase(), *itEdge))
+            {
+                veEdgesRemoved.push_back(*itEdge);
+            }
+            else
+            {
+                veEdgesVisible.push_back(*itEdge);
+            }
+        }
+        veGetEdgesVisibleBase().swap(veEdgesVisible);
+        PRINT_DEBUG("*DEBUG* veEdgesRemoved.size()[" << veEdgesRemoved.size() << "]")
+
+        // add the new polygon's edges and the visible edges to its vertices, the same way as errBuildVisibilityGraph
+        errAddPolygonEdgesVisibleBase(itPolygonNew);
+        for (V_POLYGON_IT_t itPolygon = vplygnGetPolygons().begin(); itPolygon != itPolygonNew; itPolygon++)
+        {
+            itPolygon->errFindVisibleEdges(vposGetVerticiesBase(), itPolygonNew, veGetEdgesVisibleBase(), &m_edggrdPolygonEdgesBase);
+        }
+        itPolygonNew->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygonNew, veGetEdgesVisibleBase(), &m_edggrdPolygonEdgesBase);
+
+        errReturn = errBuildGraphBase();
+        if ((errReturn == errNoError) && !m_bShortestPathTreesBase)
+        {
+            errReturn = errInitializeShortestPathMatricesBase(szNumberVerticesOld, veEdgesRemoved);
         }
         PRINT_DEBUG("*DEBUG*")
         return (errReturn);
@@ -550,6 +740,32 @@ namespace n_FrameworkLib
         enError errReturn(errNoError);
         PRINT_DEBUG("*DEBUG*")
 
+        errReturn = errBuildGraphBase();
+
+        m_bShortestPathTreesBase = bGetLazyShortestPathsBase();
+        if (m_bShortestPathTreesBase)
+        {
+            //single source shortest path trees are computed when they are needed, see ptrGetShortestPathTreeBase
+            std::vector<int32_t>().swap(m_viVertexDistancesBase);
+            V_VERTEX_DESCRIPTOR_t().swap(m_vvtxVertexParentBase);
+            std::vector<uint16_t>().swap(m_vui16VertexParentBase);
+            m_bVertexParentBaseCompact = false;
+        }
+        else if (errReturn == errNoError)
+        {
+            errReturn = errInitializeShortestPathMatricesBase();
+        }
+        PRINT_DEBUG("*DEBUG*")
+        return (errReturn);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    CVisibilityGraph::enError CVisibilityGraph::errBuildGraphBase()
+    {
+        enError errReturn(errNoError);
+
         //TODO:: is there a better way to do this?
         std::vector<int32_t> viEdgeLengths;
         for (CEdge::V_EDGE_CONST_IT_t itEdge = veGetEdgesVisibleBase().begin(); itEdge != veGetEdgesVisibleBase().end(); itEdge++)
@@ -558,45 +774,544 @@ namespace n_FrameworkLib
         }
 
         PRINT_DEBUG("*DEBUG*")
+        if (pedglstvecGetGraph())
+        {
+            delete pedglstvecGetGraph();
+        }
         pedglstvecGetGraph() = new GRAPH_LIST_VEC_t(veGetEdgesVisibleBase().begin(),
                 veGetEdgesVisibleBase().end(),
                 viEdgeLengths.begin(),
                 vposGetVerticiesBase().size());
 
         PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << num_vertices(edglstvecGetGraph()) << "]")
+        m_szNumberVerticesBase = num_vertices(edglstvecGetGraph());
 
-        //reintialize the vertex parents
-        vvvtxGetVertexParentBase().clear();
-        V_VERTEX_DESCRIPTOR_t vvtxTemp(num_vertices(edglstvecGetGraph()));
-        vvvtxGetVertexParentBase().resize(num_vertices(edglstvecGetGraph()), vvtxTemp);
+        //edge lengths are truncated distances, so scale the euclidean distances down until they never exceed an edge length
+        m_dHeuristicScaleBase = 1.0;
+        for (CEdge::V_EDGE_CONST_IT_t itEdge = veGetEdgesVisibleBase().begin(); itEdge != veGetEdgesVisibleBase().end(); itEdge++)
+        {
+            double dDistance_m = vposGetVerticiesBase()[static_cast<size_t> (itEdge->first)].relativeDistance2D_m(vposGetVerticiesBase()[static_cast<size_t> (itEdge->second)]);
+            if (dDistance_m > 0.0)
+            {
+                m_dHeuristicScaleBase = (std::min)(m_dHeuristicScaleBase, (std::max)(0.0, static_cast<double> (itEdge->iGetLength()) / dDistance_m));
+            }
+        }
 
-        PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << num_vertices(edglstvecGetGraph()) << "]")
-        //reintialize the distance matrix
-        vviGetVertexDistancesBase().clear();
-        std::vector<int32_t> viTemp(num_vertices(edglstvecGetGraph()), 0);
-        vviGetVertexDistancesBase().resize(num_vertices(edglstvecGetGraph()), viTemp);
+        {
+            std::lock_guard<std::mutex> lock(m_mutexShortestPathTreesBase);
+            m_lszShortestPathTreeSourcesBase.clear();
+            m_umszptrShortestPathTreesBase.clear();
+        }
+        return (errReturn);
+    }
 
-        PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << num_vertices(edglstvecGetGraph()) << "]")
-        for (size_t szCountVerticies = 0; szCountVerticies < num_vertices(edglstvecGetGraph()); szCountVerticies++)
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    CVisibilityGraph::enError CVisibilityGraph::errInitializeShortestPathMatricesBase(const size_t& szNumberVerticesOld, const V_EDGE_t& veEdgesRemoved)
+    {
+        enError errReturn(errNoError);
+
+        const GRAPH_LIST_VEC_t& edglstvecGraph(edglstvecGetGraph());
+        boost::property_map<GRAPH_LIST_VEC_t, boost::edge_weight_t>::const_type weightmap = get(boost::edge_weight, edglstvecGraph);
+        const size_t szNumberVertices(m_szNumberVerticesBase);
+
+        // when vertices and edges were added to, or edges removed from, a graph whose matrices were already built, each row is
+        // repaired from the old row instead of searching the whole graph again
+        std::vector<int32_t> viVertexDistancesOld;
+        V_VERTEX_DESCRIPTOR_t vvtxVertexParentOld;
+        std::vector<uint16_t> vui16VertexParentOld;
+        const bool bVertexParentOldCompact(m_bVertexParentBaseCompact);
+        size_t szNumberRowsOld(0);
+        if ((szNumberVerticesOld > 0) && (szNumberVerticesOld <= szNumberVertices) &&
+                (m_viVertexDistancesBase.size() == (szNumberVerticesOld * szNumberVerticesOld)))
+        {
+            viVertexDistancesOld.swap(m_viVertexDistancesBase);
+            vvtxVertexParentOld.swap(m_vvtxVertexParentBase);
+            vui16VertexParentOld.swap(m_vui16VertexParentBase);
+            szNumberRowsOld = szNumberVerticesOld;
+        }
+
+        //reintialize the row-major distance and parent matrices
+        m_viVertexDistancesBase.assign(szNumberVertices * szNumberVertices, 0);
+        m_bVertexParentBaseCompact = bGetCompactVertexParentBase() &&
+                (szNumberVertices <= (static_cast<size_t> ((std::numeric_limits<uint16_t>::max)()) + 1));
+        if (m_bVertexParentBaseCompact)
+        {
+            V_VERTEX_DESCRIPTOR_t().swap(m_vvtxVertexParentBase);
+            m_vui16VertexParentBase.assign(szNumberVertices * szNumberVertices, 0);
+        }
+        else
+        {
+            std::vector<uint16_t>().swap(m_vui16VertexParentBase);
+            m_vvtxVertexParentBase.assign(szNumberVertices * szNumberVertices, 0);
+        }
+
+        // each worker takes the next source vertex and writes its search results directly into that row of the matrices
+        std::atomic<size_t> szNextSource(0);
+        auto searchSources = [&]()
+        {
+            V_VERTEX_DESCRIPTOR_t vtxParents((m_bVertexParentBaseCompact) ? (szNumberVertices) : (0));
+            for (size_t szSource = szNextSource++; szSource < szNumberVertices; szSource = szNextSource++)
+            {
+                const size_t szRow(szSource * szNumberVertices);
+                vertex_descriptor* pvtxParents((m_bVertexParentBaseCompact) ? (&vtxParents[0]) : (&m_vvtxVertexParentBase[szRow]));
+                if (szSource < szNumberRowsOld)
+                {
+                    // start from the old row
+                    int32_t* piDistances(&m_viVertexDistancesBase[szRow]);
+                    const size_t szRowOld(szSource * szNumberRowsOld);
+                    for (size_t szCountVerticies = 0; szCountVerticies < szNumberVertices; szCountVerticies++)
+                    {
+                        if (szCountVerticies < szNumberRowsOld)
+                        {
+                            piDistances[szCountVerticies] = viVertexDistancesOld[szRowOld + szCountVerticies];
+                            pvtxParents[szCountVerticies] = (bVertexParentOldCompact) ? (vui16VertexParentOld[szRowOld + szCountVerticies]) : (vvtxVertexParentOld[szRowOld + szCountVerticies]);
+                        }
+                        else
+                        {
+                            piDistances[szCountVerticies] = (std::numeric_limits<int32_t>::max)();
+                            pvtxParents[szCountVerticies] = szCountVerticies;
+                        }
+                    }
+
+                    // the vertices below a removed edge in the old shortest path tree lost their paths
+                    enum enVertexState {stateUnknown, stateKept, stateLost};
+                    std::vector<uint8_t> vui8States(szNumberVertices, stateUnknown);
+                    for (auto itEdge = veEdgesRemoved.begin(); itEdge != veEdgesRemoved.end(); itEdge++)
+                    {
+                        const size_t szFirst(static_cast<size_t> (itEdge->first));
+                        const size_t szSecond(static_cast<size_t> (itEdge->second));
+                        if ((szFirst < szNumberRowsOld) && (szSecond < szNumberRowsOld))
+                        {
+                            if (pvtxParents[szSecond] == szFirst)
+                            {
+                                vui8States[szSecond] = stateLost;
+                            }
+                            else if (pvtxParents[szFirst] == szSecond)
+                            {
+                                vui8States[szFirst] = stateLost;
+                            }
+                        }
+                    }
+                    std::vector<size_t> vszPath;
+                    for (size_t szVertex = 0; szVertex < szNumberVertices; szVertex++)
+                    {
+                        size_t szAncestor(szVertex);
+                        while (vui8States[szAncestor] == stateUnknown)
+                        {
+                            if ((szAncestor == szSource) || (szAncestor >= szNumberRowsOld) || (pvtxParents[szAncestor] == szAncestor))
+                            {
+                                // the source, new vertices, and unreached vertices
+                                vui8States[szAncestor] = (szAncestor >= szNumberRowsOld) ? (stateLost) : (stateKept);
+                                break;
+                            }
+                            vszPath.push_back(szAncestor);
+                            szAncestor = pvtxParents[szAncestor];
+                        }
+                        for (auto itPath = vszPath.begin(); itPath != vszPath.end(); itPath++)
+                        {
+                            vui8States[*itPath] = vui8States[szAncestor];
+                        }
+                        vszPath.clear();
+                    }
+
+                    // seed the lost and new vertices from their kept neighbors, then search from them. The search also updates
+                    // any kept vertices that are closer through the new vertices.
+                    typedef std::pair<int64_t, size_t> PAIR_DISTANCE_VERTEX_t;
+                    std::priority_queue<PAIR_DISTANCE_VERTEX_t, std::vector<PAIR_DISTANCE_VERTEX_t>, std::greater<PAIR_DISTANCE_VERTEX_t> > pqOpen;
+                    boost::graph_traits<GRAPH_LIST_VEC_t>::out_edge_iterator itEdge, itEdgeEnd;
+                    for (size_t szVertex = 0; szVertex < szNumberVertices; szVertex++)
+                    {
+                        if (vui8States[szVertex] == stateLost)
+                        {
+                            piDistances[szVertex] = (std::numeric_limits<int32_t>::max)();
+                            pvtxParents[szVertex] = szVertex;
+                        }
+                    }
+                    for (size_t szVertex = 0; szVertex < szNumberVertices; szVertex++)
+                    {
+                        if (vui8States[szVertex] == stateLost)
+                        {
+                            for (boost::tie(itEdge, itEdgeEnd) = out_edges(szVertex, edglstvecGraph); itEdge != itEdgeEnd; ++itEdge)
+                            {
+                                size_t szNeighbor(target(*itEdge, edglstvecGraph));
+                                if ((vui8States[szNeighbor] == stateKept) && (piDistances[szNeighbor] != (std::numeric_limits<int32_t>::max)()))
+                                {
+                                    int64_t i64Distance = static_cast<int64_t> (piDistances[szNeighbor]) + get(weightmap, *itEdge);
+                                    if (i64Distance < piDistances[szVertex])
+                                    {
+                                        piDistances[szVertex] = static_cast<int32_t> (i64Distance);
+                                        pvtxParents[szVertex] = szNeighbor;
+                                    }
+                                }
+                            }
+                            if (piDistances[szVertex] != (std::numeric_limits<int32_t>::max)())
+                            {
+                                pqOpen.push(PAIR_DISTANCE_VERTEX_t(piDistances[szVertex], szVertex));
+                            }
+                        }
+                    }
+                    while (!pqOpen.empty())
+                    {
+                        PAIR_DISTANCE_VERTEX_t pairDistanceVertex = pqOpen.top();
+                        pqOpen.pop();
+                        const size_t szVertex(pairDistanceVertex.second);
+                        if (pairDistanceVertex.first > piDistances[szVertex])
+                        {
+                            continue;
+                        }
+                        for (boost::tie(itEdge, itEdgeEnd) = out_edges(szVertex, edglstvecGraph); itEdge != itEdgeEnd; ++itEdge)
+                        {
+                            size_t szTarget(target(*itEdge, edglstvecGraph));
+                            int64_t i64Distance = pairDistanceVertex.first + get(weightmap, *itEdge);
+                            if (i64Distance < piDistances[szTarget])
+                            {
+                                piDistances[szTarget] = static_cast<int32_t> (i64Distance);
+                                pvtxParents[szTarget] = szVertex;
+                                pqOpen.push(PAIR_DISTANCE_VERTEX_t(i64Distance, szTarget));
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    boost::dijkstra_shortest_paths(edglstvecGraph, vertex(szSource, edglstvecGraph),
+                            boost::predecessor_map(pvtxParents).distance_map(&m_viVertexDistancesBase[szRow]));
+                }
+                if (m_bVertexParentBaseCompact)
+                {
+                    for (size_t szCountVerticies = 0; szCountVerticies < szNumberVertices; szCountVerticies++)
+                    {
+                        m_vui16VertexParentBase[szRow + szCountVerticies] = static_cast<uint16_t> (vtxParents[szCountVerticies]);
+                    }
+                }
+            }
+        };
+
+        size_t szNumberThreads(szGetNumberThreadsBase());
+        if (szNumberThreads == 0)
         {
-            V_VERTEX_DESCRIPTOR_t vtxParents(num_vertices(edglstvecGetGraph()));
-            std::vector<int32_t> viDistances(num_vertices(edglstvecGetGraph()));
+            szNumberThreads = std::thread::hardware_concurrency();
+        }
+        szNumberThreads = (std::max)(static_cast<size_t> (1), (std::min)(szNumberThreads, szNumberVertices));
 
-            vertex_descriptor vtxCurrent = vertex(szCountVerticies, edglstvecGetGraph());
-            boost::dijkstra_shortest_paths(edglstvecGetGraph(), vtxCurrent, boost::predecessor_map(&vtxParents[0]).distance_map(&viDistances[0]));
+        PRINT_DEBUG("*DEBUG* szNumberThreads[" << szNumberThreads << "]")
+        std::vector<std::thread> vthrdWorkers;
+        for (size_t szCountThreads = 1; szCountThreads < szNumberThreads; szCountThreads++)
+        {
+            try
+            {
+                vthrdWorkers.push_back(std::thread(searchSources));
+            }
+            catch (const std::system_error&)
+            {
+                // could not start another thread, the remaining sources are searched by the running threads
+                break;
+            }
+        }
+        searchSources();
+        for (auto itWorker = vthrdWorkers.begin(); itWorker != vthrdWorkers.end(); itWorker++)
+        {
+            itWorker->join();
+        }
+        return (errReturn);
+    }
 
-            vvvtxGetVertexParentBase()[szCountVerticies] = vtxParents;
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
 
-            //TODO:: need to calculate the a vector of the distance matrix using distances and parents
-            for (size_t szCountVerticies2 = 0; szCountVerticies2 < num_vertices(edglstvecGetGraph()); szCountVerticies2++)
+    CVisibilityGraph::PTR_SHORTEST_PATH_TREE_t CVisibilityGraph::ptrGetShortestPathTreeBase(const size_t& szSource) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutexShortestPathTreesBase);
+            auto itTree = m_umszptrShortestPathTreesBase.find(szSource);
+            if (itTree != m_umszptrShortestPathTreesBase.end())
             {
-                vviGetVertexDistancesBase()[szCountVerticies][szCountVerticies2] = viDistances[szCountVerticies2];
-            } //for(int szCountVerticies2=0;szCountVerticies2<num_vertices(edglstvecGetGraph());szCountVerticies2++)
-        } //for(int szCountVerticies=0;szCountVerticies<num_vertices(edglstvecGetGraph());szCountVerticies++)
-        PRINT_DEBUG("*DEBUG*")
+                //move the source to the front of the least recently used list
+                m_lszShortestPathTreeSourcesBase.splice(m_lszShortestPathTreeSourcesBase.begin(), m_lszShortestPathTreeSourcesBase, itTree->second.first);
+                return (itTree->second.second);
+            }
+        }
+
+        //search outside of the lock so other sources can be searched at the same time
+        auto ptrShortestPathTree = std::make_shared<stShortestPathTree>();
+        ptrShortestPathTree->viDistances.resize(m_szNumberVerticesBase);
+        ptrShortestPathTree->vvtxParents.resize(m_szNumberVerticesBase);
+        boost::dijkstra_shortest_paths(edglstvecGetGraph(), vertex(szSource, edglstvecGetGraph()),
+                boost::predecessor_map(&ptrShortestPathTree->vvtxParents[0]).distance_map(&ptrShortestPathTree->viDistances[0]));
+
+        std::lock_guard<std::mutex> lock(m_mutexShortestPathTreesBase);
+        auto itTree = m_umszptrShortestPathTreesBase.find(szSource);
+        if (itTree != m_umszptrShortestPathTreesBase.end())
+        {
+            //another thread added this source while searching
+            m_lszShortestPathTreeSourcesBase.splice(m_lszShortestPathTreeSourcesBase.begin(), m_lszShortestPathTreeSourcesBase, itTree->second.first);
+            return (itTree->second.second);
+        }
+        m_lszShortestPathTreeSourcesBase.push_front(szSource);
+        m_umszptrShortestPathTreesBase[szSource] = std::make_pair(m_lszShortestPathTreeSourcesBase.begin(), PTR_SHORTEST_PATH_TREE_t(ptrShortestPathTree));
+        while (m_lszShortestPathTreeSourcesBase.size() > (std::max)(static_cast<size_t> (1), szGetShortestPathTreeCacheSizeBase()))
+        {
+            m_umszptrShortestPathTreesBase.erase(m_lszShortestPathTreeSourcesBase.back());
+            m_lszShortestPathTreeSourcesBase.pop_back();
+        }
+        return (ptrShortestPathTree);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    CVisibilityGraph::enError CVisibilityGraph::errAddPathVerticesBase(const size_t& szFrom, const size_t& szTo, D_POSITION_t& dposPath) const
+    {
+        // adds the base vertices on the shortest path from szFrom up to, but not including, szTo to the front of the path.
+        // with lazy shortest paths the tree of the source is fetched once for the whole path
+        enError errReturn(errNoError);
+        PTR_SHORTEST_PATH_TREE_t ptrShortestPathTree;
+        if (m_bShortestPathTreesBase)
+        {
+            ptrShortestPathTree = ptrGetShortestPathTreeBase(szFrom);
+        }
+        auto vtxGetParent = [&](const size_t& szVertex)
+        {
+            return ((ptrShortestPathTree) ? (ptrShortestPathTree->vvtxParents[szVertex]) : (vtxGetVertexParentBase(szFrom, szVertex)));
+        };
+
+        int iSanityCheck(static_cast<int> (szGetNumberVerticesBase()));
+        vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (szFrom);
+        vertex_descriptor vtxCurrent = vtxGetParent(szTo);
+        while (vtxCurrent != vtxBegin)
+        {
+            if (iSanityCheck >= 0)
+            {
+                dposPath.push_front(vposGetVerticiesBase()[vtxCurrent]);
+                vtxCurrent = vtxGetParent(vtxCurrent);
+            }
+            else
+            {
+                //error: did not find beginning of path
+                errReturn = errPathConstruction;
+                break;
+            }
+
+            iSanityCheck--;
+        }
+        dposPath.push_front(vposGetVerticiesBase()[vtxBegin]);
         return (errReturn);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    bool CVisibilityGraph::bFindShortestPathBaseAStar(const M_INT_PATHINFORMATION_t& mipthDistanceMapStart, const M_INT_PATHINFORMATION_t& mipthDistanceMapEnd,
+            const CPosition& posPositionEnd, CPathInformation& pthiPathInformationMin) const
+    {
+        // one search from all of the base vertices visible from the start, ending at the base vertices visible from the end.
+        // the heuristic is the scaled euclidean distance to the end, less one meter for the truncated length of the last edge,
+        // which never over estimates the remaining length. With truncated edge lengths it is not guaranteed to be consistent,
+        // so vertices are reopened when a shorter path to them is found, and the search ends once no open vertex can lead to
+        // a path shorter than the shortest one found
+        bool isFound(false);
+        const GRAPH_LIST_VEC_t& edglstvecGraph(edglstvecGetGraph());
+        boost::property_map<GRAPH_LIST_VEC_t, boost::edge_weight_t>::const_type weightmap = get(boost::edge_weight, edglstvecGraph);
+
+        std::vector<int64_t> vi64Costs(m_szNumberVerticesBase, (std::numeric_limits<int64_t>::max)());
+        std::vector<size_t> vszSources(m_szNumberVerticesBase, 0);
+        std::vector<const CPathInformation*> vpthiEnd(m_szNumberVerticesBase, nullptr);
+        std::vector<const CPathInformation*> vpthiStart(m_szNumberVerticesBase, nullptr);
+
+        auto dHeuristic = [&](const size_t& szVertex)
+        {
+            return ((std::max)(0.0, m_dHeuristicScaleBase * posPositionEnd.relativeDistance2D_m(vposGetVerticiesBase()[szVertex]) - 1.0));
+        };
+
+        // estimated length, length from the start, vertex
+        typedef std::tuple<double, int64_t, size_t> TUPLE_COST_VERTEX_t;
+        std::priority_queue<TUPLE_COST_VERTEX_t, std::vector<TUPLE_COST_VERTEX_t>, std::greater<TUPLE_COST_VERTEX_t> > pqOpen;
+        for (auto itPathInfoStart = mipthDistanceMapStart.begin(); itPathInfoStart != mipthDistanceMapStart.end(); itPathInfoStart++)
+        {
+            int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
+            if ((itPathInfoStart->second.iGetIndexBaseBegin() == -1) && (iStartToBaseIndex >= 0) && (itPathInfoStart->second.iGetLength() >= 0) &&
+                    (itPathInfoStart->second.iGetLength() < vi64Costs[iStartToBaseIndex]))
+            {
+                vi64Costs[iStartToBaseIndex] = itPathInfoStart->second.iGetLength();
+                vszSources[iStartToBaseIndex] = static_cast<size_t> (iStartToBaseIndex);
+                vpthiStart[iStartToBaseIndex] = &itPathInfoStart->second;
+                pqOpen.push(TUPLE_COST_VERTEX_t(static_cast<double> (vi64Costs[iStartToBaseIndex]) + dHeuristic(iStartToBaseIndex), vi64Costs[iStartToBaseIndex], iStartToBaseIndex));
+            }
+        }
+        for (auto itPathInfoEnd = mipthDistanceMapEnd.begin(); itPathInfoEnd != mipthDistanceMapEnd.end(); itPathInfoEnd++)
+        {
+            int iBaseToObjectiveIndex(itPathInfoEnd->second.iGetIndexBaseBegin());
+            if ((iBaseToObjectiveIndex >= 0) &&
+                    ((vpthiEnd[iBaseToObjectiveIndex] == nullptr) || (itPathInfoEnd->second.iGetLength() < vpthiEnd[iBaseToObjectiveIndex]->iGetLength())))
+            {
+                vpthiEnd[iBaseToObjectiveIndex] = &itPathInfoEnd->second;
+            }
+        }
+
+        int64_t i64MinimumDistance((std::numeric_limits<int64_t>::max)());
+        while (!pqOpen.empty())
+        {
+            TUPLE_COST_VERTEX_t tupleCostVertex = pqOpen.top();
+            pqOpen.pop();
+            if (std::get<0>(tupleCostVertex) >= static_cast<double> (i64MinimumDistance))
+            {
+                break;
+            }
+            size_t szVertex(std::get<2>(tupleCostVertex));
+            if (std::get<1>(tupleCostVertex) > vi64Costs[szVertex])
+            {
+                //a shorter path to this vertex was found after this entry was added
+                continue;
+            }
+
+            if (vpthiEnd[szVertex] != nullptr)
+            {
+                int64_t i64DistanceCandidate = vi64Costs[szVertex] + vpthiEnd[szVertex]->iGetLength();
+                if (i64DistanceCandidate < i64MinimumDistance)
+                {
+                    i64MinimumDistance = i64DistanceCandidate;
+                    pthiPathInformationMin.iGetIndexBaseBegin() = static_cast<int> (vszSources[szVertex]);
+                    pthiPathInformationMin.iGetIndexBaseEnd() = static_cast<int> (szVertex);
+                    pthiPathInformationMin.iGetLength() = static_cast<int> (i64DistanceCandidate);
+                    pthiPathInformationMin.posGetStart() = vpthiStart[vszSources[szVertex]]->posGetStart();
+                    pthiPathInformationMin.posGetEnd() = vpthiEnd[szVertex]->posGetEnd();
+                    isFound = true;
+                }
+            }
+
+            boost::graph_traits<GRAPH_LIST_VEC_t>::out_edge_iterator itEdge, itEdgeEnd;
+            for (boost::tie(itEdge, itEdgeEnd) = out_edges(szVertex, edglstvecGraph); itEdge != itEdgeEnd; ++itEdge)
+            {
+                size_t szTarget(target(*itEdge, edglstvecGraph));
+                int64_t i64Cost = vi64Costs[szVertex] + get(weightmap, *itEdge);
+                if (i64Cost < vi64Costs[szTarget])
+                {
+                    vi64Costs[szTarget] = i64Cost;
+                    vszSources[szTarget] = vszSources[szVertex];
+                    pqOpen.push(TUPLE_COST_VERTEX_t(static_cast<double> (i64Cost) + dHeuristic(szTarget), i64Cost, szTarget));
+                }
+            }
+        }
+        return (isFound);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    void CVisibilityGraph::FindDistancesToVerticesBase(const M_INT_PATHINFORMATION_t& mipthDistanceMapStart,
+            std::vector<int64_t>& vi64Distances, std::vector<int>& viSources) const
+    {
+        // shortest distance from the start, through one of the base vertices visible from the start, to every base vertex.
+        // viSources is the visible base vertex that the path to each base vertex enters the graph at
+        vi64Distances.assign(m_szNumberVerticesBase, (std::numeric_limits<int64_t>::max)());
+        viSources.assign(m_szNumberVerticesBase, -1);
+
+        if (m_bShortestPathTreesBase)
+        {
+            // one search from all of the visible base vertices
+            const GRAPH_LIST_VEC_t& edglstvecGraph(edglstvecGetGraph());
+            boost::property_map<GRAPH_LIST_VEC_t, boost::edge_weight_t>::const_type weightmap = get(boost::edge_weight, edglstvecGraph);
+            std::vector<bool> vbClosed(m_szNumberVerticesBase, false);
+
+            typedef std::pair<int64_t, size_t> PAIR_DISTANCE_VERTEX_t;
+            std::priority_queue<PAIR_DISTANCE_VERTEX_t, std::vector<PAIR_DISTANCE_VERTEX_t>, std::greater<PAIR_DISTANCE_VERTEX_t> > pqOpen;
+            for (auto itPathInfoStart = mipthDistanceMapStart.begin(); itPathInfoStart != mipthDistanceMapStart.end(); itPathInfoStart++)
+            {
+                int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
+                if ((itPathInfoStart->second.iGetIndexBaseBegin() == -1) && (iStartToBaseIndex >= 0) && (itPathInfoStart->second.iGetLength() >= 0) &&
+                        (itPathInfoStart->second.iGetLength() < vi64Distances[iStartToBaseIndex]))
+                {
+                    vi64Distances[iStartToBaseIndex] = itPathInfoStart->second.iGetLength();
+                    viSources[iStartToBaseIndex] = iStartToBaseIndex;
+                    pqOpen.push(PAIR_DISTANCE_VERTEX_t(vi64Distances[iStartToBaseIndex], iStartToBaseIndex));
+                }
+            }
+            while (!pqOpen.empty())
+            {
+                size_t szVertex(pqOpen.top().second);
+                pqOpen.pop();
+                if (vbClosed[szVertex])
+                {
+                    continue;
+                }
+                vbClosed[szVertex] = true;
+
+                boost::graph_traits<GRAPH_LIST_VEC_t>::out_edge_iterator itEdge, itEdgeEnd;
+                for (boost::tie(itEdge, itEdgeEnd) = out_edges(szVertex, edglstvecGraph); itEdge != itEdgeEnd; ++itEdge)
+                {
+                    size_t szTarget(target(*itEdge, edglstvecGraph));
+                    int64_t i64Distance = vi64Distances[szVertex] + get(weightmap, *itEdge);
+                    if (!vbClosed[szTarget] && (i64Distance < vi64Distances[szTarget]))
+                    {
+                        vi64Distances[szTarget] = i64Distance;
+                        viSources[szTarget] = viSources[szVertex];
+                        pqOpen.push(PAIR_DISTANCE_VERTEX_t(i64Distance, szTarget));
+                    }
+                }
+            }
+        }
+        else
+        {
+            // combine the rows of the shortest path matrix for the visible base vertices
+            for (auto itPathInfoStart = mipthDistanceMapStart.begin(); itPathInfoStart != mipthDistanceMapStart.end(); itPathInfoStart++)
+            {
+                int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
+                if ((itPathInfoStart->second.iGetIndexBaseBegin() == -1) && (iStartToBaseIndex >= 0) && (itPathInfoStart->second.iGetLength() >= 0))
+                {
+                    const int32_t* piDistances(&m_viVertexDistancesBase[static_cast<size_t> (iStartToBaseIndex) * m_szNumberVerticesBase]);
+                    for (size_t szVertex = 0; szVertex < m_szNumberVerticesBase; szVertex++)
+                    {
+                        if (piDistances[szVertex] == (std::numeric_limits<int32_t>::max)())
+                        {
+                            continue; // not reachable
+                        }
+                        int64_t i64Distance = static_cast<int64_t> (itPathInfoStart->second.iGetLength()) + piDistances[szVertex];
+                        if (i64Distance < vi64Distances[szVertex])
+                        {
+                            vi64Distances[szVertex] = i64Distance;
+                            viSources[szVertex] = iStartToBaseIndex;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
+    void CVisibilityGraph::FindVisibleVerticesBase(const CPosition& posPosition, const bool& bIsStart, M_INT_PATHINFORMATION_t& mipthDistanceMap)
+    {
+        //check the position with all base vertices to find visible edges, from the position if it is a start, otherwise to the position
+        for (V_POLYGON_IT_t itPolygons1 = vplygnGetPolygons().begin(); itPolygons1 != (vplygnGetPolygons().end()); itPolygons1++)
+        {
+            for (CEdge::V_EDGE_IT_t itEdge1 = itPolygons1->veGetPolygonEdges().begin(); itEdge1 != itPolygons1->veGetPolygonEdges().end(); itEdge1++)
+            {
+                // check to see if there is already a path
+                int iVertexID = static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET;
+                if (mipthDistanceMap.find(iVertexID) == mipthDistanceMap.end())
+                {
+                    //    create line segments using the position and the vertices
+                    //    for each line segment check all polygon edges for intersections
+                    const CPosition& posVertex(vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)]);
+                    bool bIntersects = (bIsStart) ?
+                            (bFindIntersection(vposGetVerticiesBase(), vplygnGetPolygons(), posPosition, posVertex, -1, static_cast<unsigned int> (itEdge1->first))) :
+                            (bFindIntersection(vposGetVerticiesBase(), vplygnGetPolygons(), posVertex, posPosition, static_cast<unsigned int> (itEdge1->first), -1));
+                    if (!bIntersects)
+                    {
+                        CPathInformation& pthiVisible(mipthDistanceMap[iVertexID]);
+                        pthiVisible.iGetIndexBaseBegin() = (bIsStart) ? (-1) : (static_cast<int> (itEdge1->first));
+                        pthiVisible.iGetIndexBaseEnd() = (bIsStart) ? (static_cast<int> (itEdge1->first)) : (-1);
+                        pthiVisible.iGetLength() = static_cast<int> (posPosition.relativeDistance2D_m(posVertex));
+                        pthiVisible.posGetStart() = (bIsStart) ? (posPosition) : (posVertex);
+                        pthiVisible.posGetEnd() = (bIsStart) ? (posVertex) : (posPosition);
+                    }
+                } //if (mipthDistanceMap.find(iVertexID) == mipthDistanceMap.end())
+            } //for(CEdge::V_EDGE_IT_t itEdge1=itPolygons->veGetPolygonEdges().begin();itEdge1!=itPolygons->veGetPolygonEdges().end();itEdge1++)
+        } //for(V_POLYGON_IT_t itPolygons1=vplygnGetPolygons().begin();itPolygons1!=(vplygnGetPolygons().end());itPolygons1++)
+    }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
@@ -604,12 +1319,19 @@ namespace n_FrameworkLib
     bool CVisibilityGraph::bFindIntersection(const V_POSITION_t&vposVerticiesBase, V_POLYGON_t& vPolygons, const CPosition& posPositionA, const CPosition& posPositionB,
             const int32_t& i32IndexA, const int32_t& i32IndexB)
     {
+        if ((&vPolygons == &vplygnGetPolygons()) && m_edggrdPolygonEdgesBase.bGetValid())
+        {
+            //only check the polygon edges near the segment
+            return (m_edggrdPolygonEdgesBase.bFindIntersection(vposVerticiesBase, posPositionA, posPositionB, i32IndexA, i32IndexB));
+        }
+
         bool bIntersects(false);
+        CPosition posIntersectionPoint; // not the shared default, so queries can run at the same time
         for (auto itPolygons = vPolygons.begin(); itPolygons != vPolygons.end(); itPolygons++)
         {
             for (auto itEdge = itPolygons->veGetPolygonEdges().begin(); itEdge != itPolygons->veGetPolygonEdges().end(); itEdge++)
             {
-                if (itEdge->bIntersection(vposVerticiesBase, posPositionA, posPositionB, i32IndexA, i32IndexB))
+                if (itEdge->bIntersection(vposVerticiesBase, posPositionA, posPositionB, i32IndexA, i32IndexB, posIntersectionPoint))
                 {
                     bIntersects = true;
                     break;
@@ -692,26 +1414,8 @@ namespace n_FrameworkLib
             CPathInformation pthShortestPath = (*ptr_mipthDistanceMapStart)[i32IdEnd];
             if (pthShortestPath.iGetIndexBaseBegin() >= 0)
             {
-                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()].size()));
-                vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (pthShortestPath.iGetIndexBaseBegin());
-                vertex_descriptor vtxCurrent = vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()][pthShortestPath.iGetIndexBaseEnd()];
-                while (vtxCurrent != vtxBegin)
-                {
-                    if (iSanityCheck >= 0)
-                    {
-                        ptr_dqposShortestPath->push_front(vposGetVerticiesBase()[vtxCurrent]);
-                        vtxCurrent = vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()][vtxCurrent];
-                    }
-                    else
-                    {
-                        //error: did not find beginning of path
-                        errReturn = errPathConstruction;
-                        break;
-                    }
-
-                    iSanityCheck--;
-                }
-                ptr_dqposShortestPath->push_front(vposGetVerticiesBase()[vtxBegin]);
+                errReturn = errAddPathVerticesBase(static_cast<size_t> (pthShortestPath.iGetIndexBaseBegin()), static_cast<size_t> (pthShortestPath.iGetIndexBaseEnd()),
+                        *ptr_dqposShortestPath);
             } //if(pthShortestPath.iGetIndexBaseBegin() >= 0)
         }
         return (errReturn);
@@ -750,57 +1454,12 @@ namespace n_FrameworkLib
                 //////////////////////////////////////////////////////////////////////////////////////////
                 // Check for visible edges from the Start Position to all base vertices
                 //////////////////////////////////////////////////////////////////////////////////////////
-
-                CEdge edgeClosest;
-
-                //check start position with all base vertices to find visible edges
-                for (V_POLYGON_IT_t itPolygons1 = vplygnGetPolygons().begin(); itPolygons1 != (vplygnGetPolygons().end()); itPolygons1++)
-                {
-                    for (CEdge::V_EDGE_IT_t itEdge1 = itPolygons1->veGetPolygonEdges().begin(); itEdge1 != itPolygons1->veGetPolygonEdges().end(); itEdge1++)
-                    {
-                        // check to see if there is already a path
-                        if (ptr_mipthDistanceMapStart->find(static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET) == ptr_mipthDistanceMapStart->end())
-                        {
-                            // no existing path, see if one exists
-                            //    create line segments using vertices from current and existing
-                            //    for each line segment check all polygon edges for intersections
-                            if (!bFindIntersection(vposGetVerticiesBase(), vplygnGetPolygons(), posPositionStart, vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)], -1, static_cast<unsigned int> (itEdge1->first)))
-                            {
-                                int iVertexID = static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET;
-                                (*ptr_mipthDistanceMapStart)[iVertexID].iGetIndexBaseBegin() = -1;
-                                (*ptr_mipthDistanceMapStart)[iVertexID].iGetIndexBaseEnd() = static_cast<int> (itEdge1->first);
-                                (*ptr_mipthDistanceMapStart)[iVertexID].iGetLength() = static_cast<int> (posPositionStart.relativeDistance2D_m(vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)]));
-                                (*ptr_mipthDistanceMapStart)[iVertexID].posGetStart() = posPositionStart;
-                                (*ptr_mipthDistanceMapStart)[iVertexID].posGetEnd() = vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)];
-                            }
-                        } //if (ptr_mipthDistanceMapStart->find(static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET;) == ptr_mipthDistanceMapStart->end())
-                    } //for(CEdge::V_EDGE_IT_t itEdge1=itPolygons->veGetPolygonEdges().begin();itEdge1!=itPolygons->veGetPolygonEdges().end();itEdge1++)
-                } //for(V_POLYGON_IT_t itPolygons1=vplygnGetPolygons().begin();itPolygons1!=(vplygnGetPolygons().end());itPolygons1++)
+                FindVisibleVerticesBase(posPositionStart, true, *ptr_mipthDistanceMapStart);
 
                 //////////////////////////////////////////////////////////////////////////////////////////
                 // Check for visible edges from all base vertices to the End Position
                 //////////////////////////////////////////////////////////////////////////////////////////
-                for (V_POLYGON_IT_t itPolygons1 = vplygnGetPolygons().begin(); itPolygons1 != (vplygnGetPolygons().end()); itPolygons1++)
-                {
-                    for (CEdge::V_EDGE_IT_t itEdge1 = itPolygons1->veGetPolygonEdges().begin(); itEdge1 != itPolygons1->veGetPolygonEdges().end(); itEdge1++)
-                    {
-                        // check to see if there is already a path
-                        if (ptr_mipthDistanceMapEnd->find(static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET) == ptr_mipthDistanceMapEnd->end())
-                        {
-                            //    create line segments using vertices and the End Position
-                            //    for each line segment check all polygon edges for intersections
-                            if (!bFindIntersection(vposGetVerticiesBase(), vplygnGetPolygons(), vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)], posPositionEnd, static_cast<unsigned int> (itEdge1->first), -1))
-                            {
-                                int iVertexID = static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET;
-                                (*ptr_mipthDistanceMapEnd)[iVertexID].iGetIndexBaseBegin() = static_cast<int> (itEdge1->first);
-                                (*ptr_mipthDistanceMapEnd)[iVertexID].iGetIndexBaseEnd() = -1;
-                                (*ptr_mipthDistanceMapEnd)[iVertexID].iGetLength() = static_cast<int> (posPositionEnd.relativeDistance2D_m(vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)]));
-                                (*ptr_mipthDistanceMapEnd)[iVertexID].posGetStart() = vposGetVerticiesBase()[static_cast<unsigned int> (itEdge1->first)];
-                                (*ptr_mipthDistanceMapEnd)[iVertexID].posGetEnd() = posPositionEnd;
-                            }
-                        } //if (ptr_mipthDistanceMapEnd->find(static_cast<int> (itEdge1->first) + BASE_VISIBILITY_ID_OFFSET) == ptr_mipthDistanceMapEnd->end())
-                    } //for(CEdge::V_EDGE_IT_t itEdge1=itPolygons->veGetPolygonEdges().begin();itEdge1!=itPolygons->veGetPolygonEdges().end();itEdge1++)
-                } //for(V_POLYGON_IT_t itPolygons1=vplygnGetPolygons().begin();itPolygons1!=(vplygnGetPolygons().end());itPolygons1++)
+                FindVisibleVerticesBase(posPositionEnd, false, *ptr_mipthDistanceMapEnd);
             } //if (!bInstersectionFound)
         } //if(ptr_mipthDistanceMapStart->find(iIdEnd) == ptr_mipthDistanceMapStart->end())  
 
@@ -816,43 +1475,50 @@ namespace n_FrameworkLib
             double dMinimumDistance((std::numeric_limits<double>::max)()); //set to big number
             CPathInformation pthiPathInformationMin; // save the min path parameters here
 
-            for (auto itPathInfoStart = ptr_mipthDistanceMapStart->begin(); itPathInfoStart != ptr_mipthDistanceMapStart->end(); itPathInfoStart++)
+            if (m_bShortestPathTreesBase)
+            {
+                bFindShortestPathBaseAStar(*ptr_mipthDistanceMapStart, *ptr_mipthDistanceMapEnd, posPositionEnd, pthiPathInformationMin);
+            }
+            else
             {
-                if (itPathInfoStart->second.iGetIndexBaseBegin() == -1) //
+                for (auto itPathInfoStart = ptr_mipthDistanceMapStart->begin(); itPathInfoStart != ptr_mipthDistanceMapStart->end(); itPathInfoStart++)
                 {
-                    //Start Point to Base vertices
-                    int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
-                    //int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseBegin());
-                    if ((iStartToBaseIndex >= 0)&&(itPathInfoStart->second.iGetLength() >= 0))
+                    if (itPathInfoStart->second.iGetIndexBaseBegin() == -1) //
                     {
-                        // there is a visible edge between the Start Point and this base vertex
-                        //Base vertices to End Point
-                        for (auto itPathInfoEnd = ptr_mipthDistanceMapEnd->begin();
-                                itPathInfoEnd != ptr_mipthDistanceMapEnd->end(); itPathInfoEnd++)
+                        //Start Point to Base vertices
+                        int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
+                        //int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseBegin());
+                        if ((iStartToBaseIndex >= 0)&&(itPathInfoStart->second.iGetLength() >= 0))
                         {
-                            int iBaseToObjectiveIndex(itPathInfoEnd->second.iGetIndexBaseBegin());
-                            if (iBaseToObjectiveIndex >= 0)
+                            // there is a visible edge between the Start Point and this base vertex
+                            //Base vertices to End Point
+                            for (auto itPathInfoEnd = ptr_mipthDistanceMapEnd->begin();
+                                    itPathInfoEnd != ptr_mipthDistanceMapEnd->end(); itPathInfoEnd++)
                             {
-                                // there is a connection between the objective and this base vertex
-                                double dDistanceCandidate =
-                                        static_cast<double> (itPathInfoStart->second.iGetLength()) +
-                                        static_cast<double> (vviGetVertexDistancesBase()[iStartToBaseIndex][iBaseToObjectiveIndex]) +
-                                        static_cast<double> (itPathInfoEnd->second.iGetLength());
-
-                                if (dDistanceCandidate < dMinimumDistance)
+                                int iBaseToObjectiveIndex(itPathInfoEnd->second.iGetIndexBaseBegin());
+                                if (iBaseToObjectiveIndex >= 0)
                                 {
-                                    dMinimumDistance = dDistanceCandidate;
-                                    pthiPathInformationMin.iGetIndexBaseBegin() = iStartToBaseIndex;
-                                    pthiPathInformationMin.iGetIndexBaseEnd() = iBaseToObjectiveIndex;
-                                    pthiPathInformationMin.iGetLength() = static_cast<int> (dDistanceCandidate);
-                                    pthiPathInformationMin.posGetStart() = itPathInfoStart->second.posGetStart();
-                                    pthiPathInformationMin.posGetEnd() = itPathInfoEnd->second.posGetEnd();
+                                    // there is a connection between the objective and this base vertex
+                                    double dDistanceCandidate =
+                                            static_cast<double> (itPathInfoStart->second.iGetLength()) +
+                                            static_cast<double> (iGetVertexDistanceBase(iStartToBaseIndex, iBaseToObjectiveIndex)) +
+                                            static_cast<double> (itPathInfoEnd->second.iGetLength());
+
+                                    if (dDistanceCandidate < dMinimumDistance)
+                                    {
+                                        dMinimumDistance = dDistanceCandidate;
+                                        pthiPathInformationMin.iGetIndexBaseBegin() = iStartToBaseIndex;
+                                        pthiPathInformationMin.iGetIndexBaseEnd() = iBaseToObjectiveIndex;
+                                        pthiPathInformationMin.iGetLength() = static_cast<int> (dDistanceCandidate);
+                                        pthiPathInformationMin.posGetStart() = itPathInfoStart->second.posGetStart();
+                                        pthiPathInformationMin.posGetEnd() = itPathInfoEnd->second.posGetEnd();
+                                    }
                                 }
-                            }
-                        } //for(size_t szIndexVertexBaseEnd=0;szIndexVertexBaseEnd<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseEnd++)
-                    } //if(vviVisibleDistances[iIndexInMatrixVehicle][szIndexVertexBaseStart]>0)
-                } //for(size_t szIndexVertexBaseStart=0;szIndexVertexBaseStart<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseStart++)
-            } //if(itPathInfoStart->second.iGetIndexBaseBegin() == -1)    //
+                            } //for(size_t szIndexVertexBaseEnd=0;szIndexVertexBaseEnd<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseEnd++)
+                        } //if(vviVisibleDistances[iIndexInMatrixVehicle][szIndexVertexBaseStart]>0)
+                    } //for(size_t szIndexVertexBaseStart=0;szIndexVertexBaseStart<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseStart++)
+                } //if(itPathInfoStart->second.iGetIndexBaseBegin() == -1)    //
+            }
             (*ptr_mipthDistanceMapStart)[iIdEnd] = pthiPathInformationMin;
         } //if (ptr_mipthDistanceMapStart->find(iIdEnd) == ptr_mipthDistanceMapStart->end())
         return (errReturn);
@@ -877,26 +1543,8 @@ namespace n_FrameworkLib
             CPathInformation pthShortestPath = (*ptr_mipthDistanceMapStart)[i32IdEnd];
             if (pthShortestPath.iGetIndexBaseBegin() >= 0)
             {
-                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()].size()));
-                vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (pthShortestPath.iGetIndexBaseBegin());
-                vertex_descriptor vtxCurrent = vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()][pthShortestPath.iGetIndexBaseEnd()];
-                while (vtxCurrent != vtxBegin)
-                {
-                    if (iSanityCheck >= 0)
-                    {
-                        ptr_dqposShortestPath->push_front(vposGetVerticiesBase()[vtxCurrent]);
-                        vtxCurrent = vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()][vtxCurrent];
-                    }
-                    else
-                    {
-                        //error: did not find beginning of path
-                        errReturn = errPathConstruction;
-                        break;
-                    }
-
-                    iSanityCheck--;
-                }
-                ptr_dqposShortestPath->push_front(vposGetVerticiesBase()[vtxBegin]);
+                errReturn = errAddPathVerticesBase(static_cast<size_t> (pthShortestPath.iGetIndexBaseBegin()), static_cast<size_t> (pthShortestPath.iGetIndexBaseEnd()),
+                        *ptr_dqposShortestPath);
             } //if(pthShortestPath.iGetIndexBaseBegin() >= 0)
         }
 
@@ -1028,42 +1676,49 @@ namespace n_FrameworkLib
             double dMinimumDistance((std::numeric_limits<double>::max)()); //set to big number
             CPathInformation pthiPathInformationMin; // save the min path parameters here
 
-            for (auto itPathInfoStart = ptr_mipthDistanceMapStart->begin(); itPathInfoStart != ptr_mipthDistanceMapStart->end(); itPathInfoStart++)
+            if (m_bShortestPathTreesBase)
+            {
+                bFindShortestPathBaseAStar(*ptr_mipthDistanceMapStart, *ptr_mipthDistanceMapEnd, posPositionEnd, pthiPathInformationMin);
+            }
+            else
             {
-                if (itPathInfoStart->second.iGetIndexBaseBegin() == -1) //
+                for (auto itPathInfoStart = ptr_mipthDistanceMapStart->begin(); itPathInfoStart != ptr_mipthDistanceMapStart->end(); itPathInfoStart++)
                 {
-                    //Start Point to Base vertices
-                    int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
-                    //int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseBegin());
-                    if ((iStartToBaseIndex >= 0)&&(itPathInfoStart->second.iGetLength() >= 0))
+                    if (itPathInfoStart->second.iGetIndexBaseBegin() == -1) //
                     {
-                        // there is a visible edge between the Start Point and this base vertex
-                        //Base vertices to End Point
-                        for (auto itPathInfoEnd = ptr_mipthDistanceMapEnd->begin(); itPathInfoEnd != ptr_mipthDistanceMapEnd->end(); itPathInfoEnd++)
+                        //Start Point to Base vertices
+                        int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseEnd());
+                        //int iStartToBaseIndex(itPathInfoStart->second.iGetIndexBaseBegin());
+                        if ((iStartToBaseIndex >= 0)&&(itPathInfoStart->second.iGetLength() >= 0))
                         {
-                            int iBaseToObjectiveIndex(itPathInfoEnd->second.iGetIndexBaseBegin());
-                            if (iBaseToObjectiveIndex >= 0)
+                            // there is a visible edge between the Start Point and this base vertex
+                            //Base vertices to End Point
+                            for (auto itPathInfoEnd = ptr_mipthDistanceMapEnd->begin(); itPathInfoEnd != ptr_mipthDistanceMapEnd->end(); itPathInfoEnd++)
                             {
-                                // there is a connection between the objective and this base vertex
-                                double dDistanceCandidate =
-                                        static_cast<double> (itPathInfoStart->second.iGetLength()) +
-                                        static_cast<double> (vviGetVertexDistancesBase()[iStartToBaseIndex][iBaseToObjectiveIndex]) +
-                                        static_cast<double> (itPathInfoEnd->second.iGetLength());
-
-                                if (dDistanceCandidate < dMinimumDistance)
+                                int iBaseToObjectiveIndex(itPathInfoEnd->second.iGetIndexBaseBegin());
+                                if (iBaseToObjectiveIndex >= 0)
                                 {
-                                    dMinimumDistance = dDistanceCandidate;
-                                    pthiPathInformationMin.iGetIndexBaseBegin() = iStartToBaseIndex;
-                                    pthiPathInformationMin.iGetIndexBaseEnd() = iBaseToObjectiveIndex;
-                                    pthiPathInformationMin.iGetLength() = static_cast<int> (dDistanceCandidate);
-                                    pthiPathInformationMin.posGetStart() = itPathInfoStart->second.posGetStart();
-                                    pthiPathInformationMin.posGetEnd() = itPathInfoEnd->second.posGetEnd();
+                                    // there is a connection between the objective and this base vertex
+                                    double dDistanceCandidate =
+                                            static_cast<double> (itPathInfoStart->second.iGetLength()) +
+                                            static_cast<double> (iGetVertexDistanceBase(iStartToBaseIndex, iBaseToObjectiveIndex)) +
+                                            static_cast<double> (itPathInfoEnd->second.iGetLength());
+
+                                    if (dDistanceCandidate < dMinimumDistance)
+                                    {
+                                        dMinimumDistance = dDistanceCandidate;
+                                        pthiPathInformationMin.iGetIndexBaseBegin() = iStartToBaseIndex;
+                                        pthiPathInformationMin.iGetIndexBaseEnd() = iBaseToObjectiveIndex;
+                                        pthiPathInformationMin.iGetLength() = static_cast<int> (dDistanceCandidate);
+                                        pthiPathInformationMin.posGetStart() = itPathInfoStart->second.posGetStart();
+                                        pthiPathInformationMin.posGetEnd() = itPathInfoEnd->second.posGetEnd();
+                                    }
                                 }
-                            }
-                        } //for(size_t szIndexVertexBaseEnd=0;szIndexVertexBaseEnd<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseEnd++)
-                    } //if(vviVisibleDistances[iIndexInMatrixVehicle][szIndexVertexBaseStart]>0)
-                } //for(size_t szIndexVertexBaseStart=0;szIndexVertexBaseStart<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseStart++)
-            } //if(itPathInfoStart->second.iGetIndexBaseBegin() == -1)    //
+                            } //for(size_t szIndexVertexBaseEnd=0;szIndexVertexBaseEnd<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseEnd++)
+                        } //if(vviVisibleDistances[iIndexInMatrixVehicle][szIndexVertexBaseStart]>0)
+                    } //for(size_t szIndexVertexBaseStart=0;szIndexVertexBaseStart<vviGetVertexDistancesBase()[szVehicleIndex].size();szIndexVertexBaseStart++)
+                } //if(itPathInfoStart->second.iGetIndexBaseBegin() == -1)    //
+            }
             (*ptr_mipthDistanceMapStart)[iIdEnd] = pthiPathInformationMin;
         } //if(ptr_mipthDistanceMapStart->find(iIdEnd) == ptr_mipthDistanceMapStart->end())  
         return (errReturn);
@@ -1086,6 +1741,97 @@ namespace n_FrameworkLib
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
 
+    bool CVisibilityGraph::isFindPaths(std::vector<std::shared_ptr<n_FrameworkLib::CPathInformation> >& vpathInformation)
+    {
+        // same paths as isFindPath for each element, but each unique start and end position is connected to the base graph once
+        // and one search from each unique start finds its distances to all of the base vertices for all of its paths
+        bool isSuccessful(true);
+
+        typedef std::pair<double, double> PAIR_NORTH_EAST_t;
+        std::map<PAIR_NORTH_EAST_t, size_t> mapStartIndices;
+        std::map<PAIR_NORTH_EAST_t, size_t> mapEndIndices;
+        std::vector<std::vector<size_t> > vvszPathsFromStart;
+        std::vector<size_t> vszEndIndices(vpathInformation.size(), 0);
+        for (size_t szPath = 0; szPath < vpathInformation.size(); szPath++)
+        {
+            const CPosition& posStart(vpathInformation[szPath]->posGetStart());
+            auto itStart = mapStartIndices.insert(std::make_pair(PAIR_NORTH_EAST_t(posStart.m_north_m, posStart.m_east_m), vvszPathsFromStart.size())).first;
+            if (itStart->second == vvszPathsFromStart.size())
+            {
+                vvszPathsFromStart.push_back(std::vector<size_t>());
+            }
+            vvszPathsFromStart[itStart->second].push_back(szPath);
+
+            const CPosition& posEnd(vpathInformation[szPath]->posGetEnd());
+            vszEndIndices[szPath] = mapEndIndices.insert(std::make_pair(PAIR_NORTH_EAST_t(posEnd.m_north_m, posEnd.m_east_m), mapEndIndices.size())).first->second;
+        }
+
+        std::vector<PTR_M_INT_PATHINFORMATION_t> vptr_mipthDistanceMapEnd(mapEndIndices.size());
+        std::vector<int64_t> vi64Distances;
+        std::vector<int> viSources;
+        for (auto itPathsFromStart = vvszPathsFromStart.begin(); itPathsFromStart != vvszPathsFromStart.end(); itPathsFromStart++)
+        {
+            CPosition posPositionStart(vpathInformation[itPathsFromStart->front()]->posGetStart());
+            bool isDistancesFound(false);
+            for (auto itPath = itPathsFromStart->begin(); itPath != itPathsFromStart->end(); itPath++)
+            {
+                std::shared_ptr<CPathInformation>& pathInformation(vpathInformation[*itPath]);
+                CPosition posPositionEnd(pathInformation->posGetEnd());
+                if (!bFindIntersection(vposGetVerticiesBase(), vplygnGetPolygons(), posPositionStart, posPositionEnd))
+                {
+                    // direct path
+                    pathInformation->iGetIndexBaseBegin() = -1;
+                    pathInformation->iGetIndexBaseEnd() = -1;
+                    pathInformation->iGetLength() = static_cast<int> (posPositionStart.relativeDistance2D_m(posPositionEnd));
+                    pathInformation->posGetStart() = posPositionStart;
+                    pathInformation->posGetEnd() = posPositionEnd;
+                    continue;
+                }
+
+                if (!isDistancesFound)
+                {
+                    M_INT_PATHINFORMATION_t mipthDistanceMapStart;
+                    FindVisibleVerticesBase(posPositionStart, true, mipthDistanceMapStart);
+                    FindDistancesToVerticesBase(mipthDistanceMapStart, vi64Distances, viSources);
+                    isDistancesFound = true;
+                }
+                PTR_M_INT_PATHINFORMATION_t& ptr_mipthDistanceMapEnd(vptr_mipthDistanceMapEnd[vszEndIndices[*itPath]]);
+                if (!ptr_mipthDistanceMapEnd)
+                {
+                    ptr_mipthDistanceMapEnd.reset(new M_INT_PATHINFORMATION_t);
+                    FindVisibleVerticesBase(posPositionEnd, false, *ptr_mipthDistanceMapEnd);
+                }
+
+                // Start to base + base to base + base to End
+                int64_t i64MinimumDistance((std::numeric_limits<int64_t>::max)());
+                CPathInformation pthiPathInformationMin; // save the min path parameters here
+                for (auto itPathInfoEnd = ptr_mipthDistanceMapEnd->begin(); itPathInfoEnd != ptr_mipthDistanceMapEnd->end(); itPathInfoEnd++)
+                {
+                    int iBaseToObjectiveIndex(itPathInfoEnd->second.iGetIndexBaseBegin());
+                    if ((iBaseToObjectiveIndex >= 0) && (viSources[iBaseToObjectiveIndex] >= 0))
+                    {
+                        int64_t i64DistanceCandidate = vi64Distances[iBaseToObjectiveIndex] + itPathInfoEnd->second.iGetLength();
+                        if (i64DistanceCandidate < i64MinimumDistance)
+                        {
+                            i64MinimumDistance = i64DistanceCandidate;
+                            pthiPathInformationMin.iGetIndexBaseBegin() = viSources[iBaseToObjectiveIndex];
+                            pthiPathInformationMin.iGetIndexBaseEnd() = iBaseToObjectiveIndex;
+                            pthiPathInformationMin.iGetLength() = static_cast<int> (i64DistanceCandidate);
+                            pthiPathInformationMin.posGetStart() = posPositionStart;
+                            pthiPathInformationMin.posGetEnd() = itPathInfoEnd->second.posGetEnd();
+                        }
+                    }
+                }
+                (*pathInformation) = pthiPathInformationMin;
+            } //for (auto itPath = itPathsFromStart->begin(); itPath != itPathsFromStart->end(); itPath++)
+        } //for (auto itPathsFromStart = vvszPathsFromStart.begin(); itPathsFromStart != vvszPathsFromStart.end(); itPathsFromStart++)
+
+        return (isSuccessful);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
+
 #ifdef STEVETEST
     CVisibilityGraph::enError CVisibilityGraph::errAddVehicleObjectives(const int& iVehicleID, const CPosition& posVehiclePosition,
             M_PTR_I_OBJECTIVE_PARAMETERS_BASE_t& m_ptr_i_opGetObjectivesParameters,
@@ -1436,26 +2182,11 @@ namespace n_FrameworkLib
                 posLastVertexBeforeObjective = vposGetVerticiesBase()[static_cast<vertex_descriptor> (pthifPath.iGetIndexBaseEnd())];
                 dposPathPositions.push_front(vposGetVerticiesBase()[static_cast<vertex_descriptor> (pthifPath.iGetIndexBaseEnd())]);
 
-                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase()[pthifPath.iGetIndexBaseBegin()].size()));
-                vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (pthifPath.iGetIndexBaseBegin());
-                vertex_descriptor vtxCurrent = vvvtxGetVertexParentBase()[pthifPath.iGetIndexBaseBegin()][pthifPath.iGetIndexBaseEnd()];
-                while (vtxCurrent != vtxBegin)
+                errReturn = errAddPathVerticesBase(static_cast<size_t> (pthifPath.iGetIndexBaseBegin()), static_cast<size_t> (pthifPath.iGetIndexBaseEnd()), dposPathPositions);
+                if (errReturn != errNoError)
                 {
-                    if (iSanityCheck >= 0)
-                    {
-                        dposPathPositions.push_front(vposGetVerticiesBase()[vtxCurrent]);
-                        vtxCurrent = vvvtxGetVertexParentBase()[pthifPath.iGetIndexBaseBegin()][vtxCurrent];
-                    }
-                    else
-                    {
-                        //error: did not find beginning of path
-                        errReturn = errPathConstruction;
-                        return (errReturn);
-                    }
-
-                    iSanityCheck--;
+                    return (errReturn);
                 }
-                dposPathPositions.push_front(vposGetVerticiesBase()[vtxBegin]);
             }
             //dposPathPositions.push_front(pthifPath.posGetStart());
 
@@ -29,6 +29,7 @@
 
 
 #include "Polygon.h"
+#include "EdgeGrid.h"
 
 #include "VehicleBase.h"
 #include "PlanningParameters.h"
@@ -52,6 +53,9 @@ using std::ostream;
 using std::complex;
 
 #include <memory>       //std::shared_ptr
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace n_FrameworkLib
 {
@@ -97,6 +101,16 @@ namespace n_FrameworkLib
 
         typedef complex<double> COMPLEX_D_t;
 
+        //single source shortest paths, computed on demand when the graph is initialized with lazy shortest paths
+        struct stShortestPathTree
+        {
+            std::vector<int32_t> viDistances; //viDistances[v] => shortest distance from the source to v
+            V_VERTEX_DESCRIPTOR_t vvtxParents; //vvtxParents[v] => index of the parent vertex of v on the shortest path from the source
+        };
+        typedef std::shared_ptr<const stShortestPathTree> PTR_SHORTEST_PATH_TREE_t;
+        typedef std::list<size_t> L_SHORTEST_PATH_TREE_SOURCE_t;
+        typedef std::unordered_map<size_t, std::pair<L_SHORTEST_PATH_TREE_SOURCE_t::iterator, PTR_SHORTEST_PATH_TREE_t> > UM_SZ_SHORTEST_PATH_TREE_t;
+
         typedef std::shared_ptr<uxas::messages::route::GraphRegion> PTR_GRAPH_REGION_t;
         typedef std::map<uint32_t, PTR_GRAPH_REGION_t> M_UI32_PTR_GRAPH_REGION_t;
         typedef std::map<uint32_t, PTR_GRAPH_REGION_t>::iterator M_UI32_PTR_GRAPH_REGION_IT_t;
@@ -131,14 +145,31 @@ namespace n_FrameworkLib
         void operator=(const CVisibilityGraph& rhs) {
             vposGetVerticiesBase() = rhs.vposGetVerticiesBase();
             vplygnGetPolygons() = rhs.vplygnGetPolygons();
+            m_edggrdPolygonEdgesBase = rhs.m_edggrdPolygonEdgesBase;
             veGetEdgesVisibleBase() = rhs.veGetEdgesVisibleBase();
-            vviGetVertexDistancesBase() = rhs.vviGetVertexDistancesBase();
-            vvvtxGetVertexParentBase() = rhs.vvvtxGetVertexParentBase();
+            m_szNumberVerticesBase = rhs.m_szNumberVerticesBase;
+            m_viVertexDistancesBase = rhs.m_viVertexDistancesBase;
+            m_vvtxVertexParentBase = rhs.m_vvtxVertexParentBase;
+            m_vui16VertexParentBase = rhs.m_vui16VertexParentBase;
+            m_bVertexParentBaseCompact = rhs.m_bVertexParentBaseCompact;
+            m_bShortestPathTreesBase = rhs.m_bShortestPathTreesBase;
+            m_dHeuristicScaleBase = rhs.m_dHeuristicScaleBase;
+            bGetCompactVertexParentBase() = rhs.bGetCompactVertexParentBase();
+            szGetNumberThreadsBase() = rhs.szGetNumberThreadsBase();
+            bGetLazyShortestPathsBase() = rhs.bGetLazyShortestPathsBase();
+            szGetShortestPathTreeCacheSizeBase() = rhs.szGetShortestPathTreeCacheSizeBase();
+            {
+                std::lock_guard<std::mutex> lock(m_mutexShortestPathTreesBase);
+                m_lszShortestPathTreeSourcesBase.clear();
+                m_umszptrShortestPathTreesBase.clear();
+            }
             if (pedglstvecGetGraph()) {
                 delete pedglstvecGetGraph();
             }
             pedglstvecGetGraph() = new GRAPH_LIST_VEC_t();
-            edglstvecGetGraph() = edglstvecGetGraph();
+            if (rhs.m_pedglstvecGraph) {
+                edglstvecGetGraph() = rhs.edglstvecGetGraph();
+            }
             ptypeGetType() = rhs.ptypeGetType();
             iGetLengthSegmentMinimum() = rhs.iGetLengthSegmentMinimum();
         };
@@ -151,6 +182,7 @@ namespace n_FrameworkLib
         
 
         bool isFindPath(std::shared_ptr<CPathInformation>& pathInformation);
+        bool isFindPaths(std::vector<std::shared_ptr<CPathInformation> >& vpathInformation);
 #ifdef STEVETEST
         enError errAddVehicleObjectives(const int& iVehicleID, const CPosition& posVehiclePosition, M_PTR_I_OBJECTIVE_PARAMETERS_BASE_t& ptr_miopObjectives,
                 PTR_M_INT_PTR_M_INT_PATHINFORMATION_t& mipmipthDistanceBasedOnLineSegments, const bool& bPlanToClosestEdge = false);
@@ -166,6 +198,7 @@ namespace n_FrameworkLib
 
         
         enError errInitializeGraphBase();
+        enError errAddKeepOutPolygonBase(const int& iUniqueID, V_POSITION_IT_t itBegin, V_POSITION_IT_t itEnd, const double& dPolygonExpansionDistance = 0.0);
         bool bBoundaryViolationExists(const V_WAYPOINT_t& vWaypoints, stringstream& sstrErrorMessage);
 
         enError errSmoothPath(D_POSITION_t& dposPath, const double& dTurnRadius_m,
@@ -197,6 +230,14 @@ namespace n_FrameworkLib
                 PTR_M_INT_PATHINFORMATION_t& ptr_mipthDistanceMapStart,
                 PTR_M_INT_PATHINFORMATION_t& ptr_mipthDistanceMapEnd);
 
+        PTR_SHORTEST_PATH_TREE_t ptrGetShortestPathTreeBase(const size_t& szSource)const;
+        enError errAddPathVerticesBase(const size_t& szFrom, const size_t& szTo, D_POSITION_t& dposPath)const;
+        bool bFindShortestPathBaseAStar(const M_INT_PATHINFORMATION_t& mipthDistanceMapStart, const M_INT_PATHINFORMATION_t& mipthDistanceMapEnd,
+                const CPosition& posPositionEnd, CPathInformation& pthiPathInformationMin)const;
+        void FindDistancesToVerticesBase(const M_INT_PATHINFORMATION_t& mipthDistanceMapStart,
+                std::vector<int64_t>& vi64Distances, std::vector<int>& viSources)const;
+        void FindVisibleVerticesBase(const CPosition& posPosition, const bool& bIsStart, M_INT_PATHINFORMATION_t& mipthDistanceMap);
+
         bool bFindIntersection(const V_POSITION_t&vposVerticiesBase, V_POLYGON_t& vPolygons, const CPosition& posPositionA, const CPosition& posPositionB,
                 const int32_t& i32IndexA = -1, const int32_t& i32IndexB = -1);
     public: //inline methods/functions
@@ -215,6 +256,9 @@ namespace n_FrameworkLib
         enError errAddPolygon(const int& iUniqueID, V_POSITION_IT_t itBegin, V_POSITION_IT_t itEnd, bool bKeepInZone = true, double dPolygonExpansionDistance = 0.0) {
             enError errReturn(errNoError);
 
+            // the polygon edges are changing, the grid is rebuilt in errFinalizePolygons
+            m_edggrdPolygonEdgesBase.Clear();
+
             // if there is a polygon with this ID, then delete it and insert this one
             bool bExistingID(false);
             for (V_POLYGON_IT_t itPolygon = vplygnGetPolygons().begin(); itPolygon != vplygnGetPolygons().end(); itPolygon++) {
@@ -278,6 +322,9 @@ namespace n_FrameworkLib
                 itPolygon->errFinalizePolygon(vposGetVerticiesBase());
             }
 
+            //index the final polygon edges for the intersection tests
+            m_edggrdPolygonEdgesBase.Initialize(vposGetVerticiesBase(), vplygnGetPolygons());
+
             return (errReturn);
         };
 
@@ -344,10 +391,10 @@ namespace n_FrameworkLib
             for (std::tie(vi, vend) = vertices(edglstvecGetGraph()); vi != vend; ++vi)
 #endif
             {
-                if (*vi == vvvtxGetVertexParentBase()[iIndexVertex][*vi]) {
+                if (*vi == vtxGetVertexParentBase(iIndexVertex, *vi)) {
                     continue;
                 }
-                dot_file << vvvtxGetVertexParentBase()[iIndexVertex][*vi] << " -> " << *vi << "[label=\"" << vviGetVertexDistancesBase()[iIndexVertex][*vi] << "\"";
+                dot_file << vtxGetVertexParentBase(iIndexVertex, *vi) << " -> " << *vi << "[label=\"" << iGetVertexDistanceBase(iIndexVertex, *vi) << "\"";
                 dot_file << ", color=\"black\"";
                 dot_file << "]";
                 dot_file << std::endl;
@@ -733,20 +780,62 @@ namespace n_FrameworkLib
             return (m_veEdgesVisibleBase);
         };
 
-        std::vector<std::vector<int32_t>>& vviGetVertexDistancesBase() {
-            return (m_vviVertexDistancesBase);
+        const size_t& szGetNumberVerticesBase()const {
+            return (m_szNumberVerticesBase);
+        };
+
+        //shortest distance from base vertex szFrom to base vertex szTo
+        int32_t iGetVertexDistanceBase(const size_t& szFrom, const size_t& szTo)const {
+            if (m_bShortestPathTreesBase) {
+                return (ptrGetShortestPathTreeBase(szFrom)->viDistances[szTo]);
+            }
+            return (m_viVertexDistancesBase[szFrom * m_szNumberVerticesBase + szTo]);
+        };
+
+        //parent of base vertex szTo on the shortest path from base vertex szFrom
+        vertex_descriptor vtxGetVertexParentBase(const size_t& szFrom, const size_t& szTo)const {
+            if (m_bShortestPathTreesBase) {
+                return (ptrGetShortestPathTreeBase(szFrom)->vvtxParents[szTo]);
+            }
+            return ((m_bVertexParentBaseCompact) ?
+                    (static_cast<vertex_descriptor> (m_vui16VertexParentBase[szFrom * m_szNumberVerticesBase + szTo])) :
+                    (m_vvtxVertexParentBase[szFrom * m_szNumberVerticesBase + szTo]));
+        };
+
+        bool& bGetCompactVertexParentBase() {
+            return (m_bCompactVertexParentBase);
+        };
+
+        const bool& bGetCompactVertexParentBase()const {
+            return (m_bCompactVertexParentBase);
+        };
+
+        size_t& szGetNumberThreadsBase() {
+            return (m_szNumberThreadsBase);
         };
 
-        const std::vector<std::vector<int32_t>>& vviGetVertexDistancesBase()const {
-            return (m_vviVertexDistancesBase);
+        const size_t& szGetNumberThreadsBase()const {
+            return (m_szNumberThreadsBase);
         };
 
-        V_V_VERTEX_DESCRIPTOR_t& vvvtxGetVertexParentBase() {
-            return (m_vvvtxVertexParentBase);
+        bool& bGetLazyShortestPathsBase() {
+            return (m_bLazyShortestPathsBase);
         };
 
-        const V_V_VERTEX_DESCRIPTOR_t& vvvtxGetVertexParentBase()const {
-            return (m_vvvtxVertexParentBase);
+        const bool& bGetLazyShortestPathsBase()const {
+            return (m_bLazyShortestPathsBase);
+        };
+
+        size_t& szGetShortestPathTreeCacheSizeBase() {
+            return (m_szShortestPathTreeCacheSizeBase);
+        };
+
+        const size_t& szGetShortestPathTreeCacheSizeBase()const {
+            return (m_szShortestPathTreeCacheSizeBase);
+        };
+
+        const CEdgeGrid& edggrdGetPolygonEdgesBase()const {
+            return (m_edggrdPolygonEdgesBase);
         };
 
         GRAPH_LIST_VEC_t& edglstvecGetGraph() {
@@ -777,16 +866,34 @@ namespace n_FrameworkLib
             return (m_iLengthSegmentMinimum);
         };
 
+    protected: //methods/functions
+        enError errAddPolygonEdgesVisibleBase(const V_POLYGON_IT_t& itPolygon);
+        enError errBuildGraphBase();
+        enError errInitializeShortestPathMatricesBase(const size_t& szNumberVerticesOld = 0, const V_EDGE_t& veEdgesRemoved = V_EDGE_t());
+
     protected: //storage
 
         //initial polygons
         V_POSITION_t m_vposVerticiesBase;
         V_POLYGON_t m_vplygnPolygons;
+        CEdgeGrid m_edggrdPolygonEdgesBase; //spatial index of the polygon edges, used for intersection tests
 
         //visibility graph storage
         V_EDGE_t m_veEdgesVisibleBase;
-        std::vector<std::vector<int32_t>> m_vviVertexDistancesBase; //m_viVertexDistances[u][v] => shortest distance from u to v
-        V_V_VERTEX_DESCRIPTOR_t m_vvvtxVertexParentBase; //m_viVertexParent[u][v] => index of the parent vertex of v on route to the shortest path ro u
+        size_t m_szNumberVerticesBase; //number of rows/columns in the all pairs shortest path matrices
+        std::vector<int32_t> m_viVertexDistancesBase; //row-major, m_viVertexDistancesBase[u*N + v] => shortest distance from u to v
+        V_VERTEX_DESCRIPTOR_t m_vvtxVertexParentBase; //row-major, m_vvtxVertexParentBase[u*N + v] => index of the parent vertex of v on route to the shortest path ro u
+        std::vector<uint16_t> m_vui16VertexParentBase; //compact form of m_vvtxVertexParentBase, used when the vertex indices fit in 16 bits
+        bool m_bVertexParentBaseCompact; //true if the parents are stored in m_vui16VertexParentBase
+        bool m_bCompactVertexParentBase; //use the compact parent encoding when the graph is small enough
+        size_t m_szNumberThreadsBase; //number of threads used to build the shortest path matrices, 0 => hardware concurrency
+        bool m_bShortestPathTreesBase; //true if shortest paths come from m_umszptrShortestPathTreesBase instead of the matrices
+        bool m_bLazyShortestPathsBase; //compute single source shortest path trees on demand instead of the all pairs matrices
+        size_t m_szShortestPathTreeCacheSizeBase; //maximum number of single source shortest path trees kept in the cache
+        double m_dHeuristicScaleBase; //scales euclidean distances so the A* heuristic never over estimates the (truncated) edge lengths
+        mutable std::mutex m_mutexShortestPathTreesBase;
+        mutable L_SHORTEST_PATH_TREE_SOURCE_t m_lszShortestPathTreeSourcesBase; //tree sources, most recently used first
+        mutable UM_SZ_SHORTEST_PATH_TREE_t m_umszptrShortestPathTreesBase; //source => (position in the source list, tree)
         GRAPH_LIST_VEC_t* m_pedglstvecGraph;
 
         // storage for generating waypoint paths
@@ -93,10 +93,10 @@ bool ServiceTemplate::terminate()
 
 bool ServiceTemplate::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    if (afrl::cmasi::isKeyValuePair(receivedLmcpMessage->m_object))
+    if (afrl::cmasi::isKeyValuePair(receivedLmcpMessage->getObject().get()))
     {
         //receive message
-        auto keyValuePairIn = std::static_pointer_cast<afrl::cmasi::KeyValuePair> (receivedLmcpMessage->m_object);
+        auto keyValuePairIn = std::static_pointer_cast<afrl::cmasi::KeyValuePair> (receivedLmcpMessage->getObject());
         std::cout << "*** RECEIVED:: Service[" << s_typeName() << "] Received a KeyValuePair with the Key[" << keyValuePairIn->getKey() << "] and Value[" << keyValuePairIn->getValue() << "] *** " << std::endl;
         
         // send out response
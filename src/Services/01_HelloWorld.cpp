@@ -101,10 +101,10 @@ bool HelloWorld::terminate()
 
 bool HelloWorld::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    if (afrl::cmasi::isKeyValuePair(receivedLmcpMessage->m_object))
+    if (afrl::cmasi::isKeyValuePair(receivedLmcpMessage->getObject().get()))
     {
         //receive message
-        auto keyValuePairIn = std::static_pointer_cast<afrl::cmasi::KeyValuePair> (receivedLmcpMessage->m_object);
+        auto keyValuePairIn = std::static_pointer_cast<afrl::cmasi::KeyValuePair> (receivedLmcpMessage->getObject());
         std::cout << "*** RECEIVED:: Received Id[" << m_serviceId << "] Sent Id[" << keyValuePairIn->getKey() << "] Message[" << keyValuePairIn->getValue() << "] *** " << std::endl;
     }
     return false;
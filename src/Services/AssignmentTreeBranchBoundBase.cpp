@@ -19,9 +19,11 @@
 
 #include "TimeUtilities.h"
 #include "Constants/Constant_Strings.h"
+#include "Constants/UxAS_String.h"
 
 #include "afrl/cmasi/ServiceStatus.h"
 #include "uxas/messages/task/TaskAssignmentSummary.h"
+#include "uxas/messages/task/IntermediateTaskAssignmentSummary.h"
 #ifdef AFRL_INTERNAL_ENABLED
 #include "uxas/project/pisr/PSIR_AssignmentType.h"
 #endif
@@ -35,6 +37,8 @@
 #include <cstdint>      //int64_t
 #include <memory>       // make_unique
 #include <set>       // set
+#include <algorithm>  // std::lexicographical_compare, std::count_if
+#include <thread>
 
 
 #define STRING_COMPONENT_NAME "AssignmentTreeBB"
@@ -46,6 +50,14 @@
 
 #define STRING_XML_NUMBER_NODES_MAXIMUM "NumberNodesMaximum"
 #define STRING_XML_COST_FUNCTION "CostFunction"
+#define STRING_XML_NUMBER_SEARCH_THREADS "NumberSearchThreads"
+#define STRING_XML_NUMBER_ASSIGNMENT_THREADS "NumberAssignmentThreads"
+#define STRING_XML_ASSIGNMENT_QUEUE_SIZE "AssignmentQueueSize"
+#define STRING_XML_TIME_BUDGET_MS "TimeBudget_ms"
+#define STRING_XML_SEND_INTERMEDIATE_ASSIGNMENTS "SendIntermediateAssignments"
+#define STRING_XML_LOWER_BOUND "LowerBound"
+#define STRING_XML_REFINEMENT_TIME_MS "RefinementTime_ms"
+#define STRING_XML_INCREMENTAL_ASSIGNMENT "IncrementalAssignment"
 
 #define COUT_INFO_MSG(MESSAGE) std::cout << MESSAGE << std::endl;std::cout.flush();
 #define COUT_FILE_LINE_MSG(MESSAGE) std::cout << "<>AssignmentTreeBB:" << __FILE__ << ":" << __LINE__ << ":" << MESSAGE << std::endl;std::cout.flush();
@@ -58,23 +70,26 @@ namespace service
 {
 
 
-bool c_Node_Base::m_isFinalAssignmentCalculated = false;
-#ifdef AFRL_INTERNAL_ENABLED
-uxas::project::pisr::AssignmentType::AssignmentType c_Node_Base::m_assignmentType{uxas::project::pisr::AssignmentType::MinMaxTime};
-#endif
-
 AssignmentTreeBranchBoundBase::AssignmentTreeBranchBoundBase(const std::string& serviceType, const std::string& workDirectoryName)
 : ServiceBase(serviceType, workDirectoryName) { };
 
-AssignmentTreeBranchBoundBase::~AssignmentTreeBranchBoundBase() { };
+AssignmentTreeBranchBoundBase::~AssignmentTreeBranchBoundBase()
+{
+    terminateAssignmentProcessing();
+};
 
 bool AssignmentTreeBranchBoundBase::start()
 {
+    for (uint32_t threadIndex = 0; threadIndex < m_numberAssignmentThreads; threadIndex++)
+    {
+        m_assignmentThreads.push_back(std::thread(&AssignmentTreeBranchBoundBase::executeAssignmentProcessing, this));
+    }
     return (isStartAssignment());
 }
 
 bool AssignmentTreeBranchBoundBase::terminate()
 {
+    terminateAssignmentProcessing();
     return (isTerminateAssignment());
 }
 
@@ -113,6 +128,63 @@ AssignmentTreeBranchBoundBase::configure(const pugi::xml_node& ndComponent)
         }
     }
 
+    if (!ndComponent.attribute(STRING_XML_LOWER_BOUND).empty())
+    {
+        std::string lowerBoundString = ndComponent.attribute(STRING_XML_LOWER_BOUND).value();
+        if (lowerBoundString == "MinimumIncoming")
+        {
+            m_lowerBoundType = c_AssignmentLowerBound::LowerBoundType::MINIMUM_INCOMING;
+        }
+        else if (lowerBoundString == "LoadBalance")
+        {
+            m_lowerBoundType = c_AssignmentLowerBound::LowerBoundType::LOAD_BALANCE;
+        }
+        else
+        {
+            m_lowerBoundType = c_AssignmentLowerBound::LowerBoundType::NONE;
+        }
+    }
+
+    if (!ndComponent.attribute(STRING_XML_NUMBER_SEARCH_THREADS).empty())
+    {
+        m_numberSearchThreads = ndComponent.attribute(STRING_XML_NUMBER_SEARCH_THREADS).as_uint();
+    }
+    if (m_numberSearchThreads == 0)
+    {
+        m_numberSearchThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    UXAS_LOG_INFORM(s_typeName(), "::configure searching the assignment tree with [", m_numberSearchThreads, "] thread(s)");
+
+    if (!ndComponent.attribute(STRING_XML_TIME_BUDGET_MS).empty())
+    {
+        m_timeBudget_ms = std::max(static_cast<int64_t>(0), static_cast<int64_t>(ndComponent.attribute(STRING_XML_TIME_BUDGET_MS).as_int64()));
+    }
+    if (!ndComponent.attribute(STRING_XML_SEND_INTERMEDIATE_ASSIGNMENTS).empty())
+    {
+        m_isSendingIntermediateAssignments = ndComponent.attribute(STRING_XML_SEND_INTERMEDIATE_ASSIGNMENTS).as_bool();
+    }
+    if (!ndComponent.attribute(STRING_XML_REFINEMENT_TIME_MS).empty())
+    {
+        m_refinementTime_ms = std::max(static_cast<int64_t>(0), static_cast<int64_t>(ndComponent.attribute(STRING_XML_REFINEMENT_TIME_MS).as_int64()));
+    }
+    if (!ndComponent.attribute(STRING_XML_INCREMENTAL_ASSIGNMENT).empty())
+    {
+        m_isIncrementalAssignment = ndComponent.attribute(STRING_XML_INCREMENTAL_ASSIGNMENT).as_bool();
+    }
+    UXAS_LOG_INFORM(s_typeName(), "::configure time budget [", m_timeBudget_ms, "] ms, sending intermediate assignments [", m_isSendingIntermediateAssignments,
+                    "], refinement time [", m_refinementTime_ms, "] ms, incremental assignment [", m_isIncrementalAssignment, "]");
+
+    if (!ndComponent.attribute(STRING_XML_NUMBER_ASSIGNMENT_THREADS).empty())
+    {
+        m_numberAssignmentThreads = std::max(1u, ndComponent.attribute(STRING_XML_NUMBER_ASSIGNMENT_THREADS).as_uint());
+    }
+    if (!ndComponent.attribute(STRING_XML_ASSIGNMENT_QUEUE_SIZE).empty())
+    {
+        m_assignmentQueueSizeMaximum = ndComponent.attribute(STRING_XML_ASSIGNMENT_QUEUE_SIZE).as_uint();
+    }
+    UXAS_LOG_INFORM(s_typeName(), "::configure processing up to [", m_numberAssignmentThreads, "] request(s) concurrently with [",
+                    m_assignmentQueueSizeMaximum, "] queued");
+
     addSubscriptionAddress(uxas::messages::task::UniqueAutomationRequest::Subscription);
     addSubscriptionAddress(uxas::messages::task::TaskPlanOptions::Subscription);
     addSubscriptionAddress(uxas::messages::task::AssignmentCostMatrix::Subscription);
@@ -127,12 +199,12 @@ AssignmentTreeBranchBoundBase::configure(const pugi::xml_node& ndComponent)
 
 bool
 AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
     std::shared_ptr<AssigmentPrerequisites> assigmentPrerequisites;
-    if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->m_object.get()))
+    if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->getObject());
         if (m_idVsAssigmentPrerequisites.find(uniqueAutomationRequest->getRequestID()) == m_idVsAssigmentPrerequisites.end())
         {
             m_idVsAssigmentPrerequisites.insert(std::make_pair(uniqueAutomationRequest->getRequestID(), std::make_shared<AssigmentPrerequisites>()));
@@ -145,9 +217,9 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
             m_idVsAssigmentPrerequisites.erase(uniqueAutomationRequest->getRequestID());
         }
     }
-    else if (uxas::messages::task::isTaskPlanOptions(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isTaskPlanOptions(receivedLmcpMessage->getObject().get()))
     {
-        auto taskPlanOptions = std::static_pointer_cast<uxas::messages::task::TaskPlanOptions>(receivedLmcpMessage->m_object);
+        auto taskPlanOptions = std::static_pointer_cast<uxas::messages::task::TaskPlanOptions>(receivedLmcpMessage->getObject());
         if (m_idVsAssigmentPrerequisites.find(taskPlanOptions->getCorrespondingAutomationRequestID()) == m_idVsAssigmentPrerequisites.end())
         {
             m_idVsAssigmentPrerequisites.insert(std::make_pair(taskPlanOptions->getCorrespondingAutomationRequestID(), std::make_shared<AssigmentPrerequisites>()));
@@ -159,9 +231,9 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
             m_idVsAssigmentPrerequisites.erase(taskPlanOptions->getCorrespondingAutomationRequestID());
         }
     }
-    else if (uxas::messages::task::isAssignmentCostMatrix(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isAssignmentCostMatrix(receivedLmcpMessage->getObject().get()))
     {
-        auto assignmentCostMatrix = std::static_pointer_cast<uxas::messages::task::AssignmentCostMatrix>(receivedLmcpMessage->m_object);
+        auto assignmentCostMatrix = std::static_pointer_cast<uxas::messages::task::AssignmentCostMatrix>(receivedLmcpMessage->getObject());
         if (m_idVsAssigmentPrerequisites.find(assignmentCostMatrix->getCorrespondingAutomationRequestID()) == m_idVsAssigmentPrerequisites.end())
         {
             m_idVsAssigmentPrerequisites.insert(std::make_pair(assignmentCostMatrix->getCorrespondingAutomationRequestID(), std::make_shared<AssigmentPrerequisites>()));
@@ -174,10 +246,10 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
         }
     }
 #ifdef AFRL_INTERNAL_ENABLED
-    else if (uxas::project::pisr::isPSIR_AssignmentType(receivedLmcpMessage->m_object.get()))
+    else if (uxas::project::pisr::isPSIR_AssignmentType(receivedLmcpMessage->getObject().get()))
     {
         m_isUsingAssignmentTypes = true;
-        auto pisrAssignmentType = std::static_pointer_cast<uxas::project::pisr::PSIR_AssignmentType>(receivedLmcpMessage->m_object);
+        auto pisrAssignmentType = std::static_pointer_cast<uxas::project::pisr::PSIR_AssignmentType>(receivedLmcpMessage->getObject());
         if (m_idVsAssigmentPrerequisites.find(pisrAssignmentType->getAutomationRequestID()) == m_idVsAssigmentPrerequisites.end())
         {
             m_idVsAssigmentPrerequisites.insert(std::make_pair(pisrAssignmentType->getAutomationRequestID(), std::make_shared<AssigmentPrerequisites>()));
@@ -193,12 +265,11 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
 #endif
     else
     {
-        //CERR_FILE_LINE_MSG("WARNING::AssignmentTreeBranchBoundBase::ProcessMessage: MessageType [" << receivedLmcpMessage->m_object->getLmcpTypeName() << "] not processed.")
+        //CERR_FILE_LINE_MSG("WARNING::AssignmentTreeBranchBoundBase::ProcessMessage: MessageType [" << receivedLmcpMessage->getObject()->getLmcpTypeName() << "] not processed.")
     }
     if (assigmentPrerequisites)
     {
-        runCalculateAssignment(assigmentPrerequisites);
-        c_Node_Base::m_staticAssignmentParameters.reset(new c_StaticAssignmentParameters);
+        queueAssignment(assigmentPrerequisites);
     }
 
     processReceivedLmcpMessageAssignment(std::move(receivedLmcpMessage));
@@ -263,6 +334,141 @@ bool AssignmentTreeBranchBoundBase::AssigmentPrerequisites::isAssignmentReady(co
     return (isHavePrerequisites);
 }
 
+bool AssignmentTreeBranchBoundBase::AssigmentPrerequisites::isVehicleOverlap(const AssigmentPrerequisites& other) const
+{
+    const auto& vehicleIds = m_uniqueAutomationRequest->getOriginalRequest()->getEntityList();
+    const auto& otherVehicleIds = other.m_uniqueAutomationRequest->getOriginalRequest()->getEntityList();
+    if (vehicleIds.empty() || otherVehicleIds.empty())
+    {
+        return (true);
+    }
+    for (auto& vehicleId : vehicleIds)
+    {
+        if (std::find(otherVehicleIds.begin(), otherVehicleIds.end(), vehicleId) != otherVehicleIds.end())
+        {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void AssignmentTreeBranchBoundBase::queueAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites)
+{
+    assigmentPrerequisites->m_assignmentParameters = std::make_shared<c_StaticAssignmentParameters>();
+    int64_t requestId = assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID();
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentQueueMutex);
+        // the queued requests that this request supersedes make room for it
+        size_t supersededCount = static_cast<size_t>(std::count_if(m_assignmentQueue.begin(), m_assignmentQueue.end(),
+                [&assigmentPrerequisites](const std::shared_ptr<AssigmentPrerequisites>& queuedPrerequisites)
+                { return (queuedPrerequisites->isVehicleOverlap(*assigmentPrerequisites)); }));
+        if (m_assignmentQueue.size() - supersededCount < m_assignmentQueueSizeMaximum)
+        {
+            // a newer request for the same vehicles supersedes queued and running requests,
+            // which are cancelled only once the newer request is queued
+            m_assignmentQueue.push_back(assigmentPrerequisites);
+            for (auto itQueued = m_assignmentQueue.begin(); *itQueued != assigmentPrerequisites;)
+            {
+                if ((*itQueued)->isVehicleOverlap(*assigmentPrerequisites))
+                {
+                    cancelAssignment(*itQueued, requestId);
+                    itQueued = m_assignmentQueue.erase(itQueued);
+                }
+                else
+                {
+                    itQueued++;
+                }
+            }
+            for (auto& runningPrerequisites : m_runningAssignments)
+            {
+                if (!runningPrerequisites->m_assignmentParameters->m_isCancelled && runningPrerequisites->isVehicleOverlap(*assigmentPrerequisites))
+                {
+                    cancelAssignment(runningPrerequisites, requestId);
+                }
+            }
+            m_assignmentQueueCondition.notify_one();
+            return;
+        }
+    }
+    std::string errMsg = "assignment queue is full, request ID[" + std::to_string(requestId) + "] was not processed";
+    UXAS_LOG_WARN(s_typeName(), "::queueAssignment ", errMsg);
+    sendErrorMsg(errMsg);
+}
+
+void AssignmentTreeBranchBoundBase::cancelAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites, const int64_t& supersedingRequestId)
+{
+    assigmentPrerequisites->m_assignmentParameters->m_isCancelled = true;
+    int64_t requestId = assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID();
+    UXAS_LOG_INFORM(s_typeName(), "::cancelAssignment request ID[", requestId, "] superseded by request ID[", supersedingRequestId, "]");
+
+    auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
+    serviceStatus->setStatusType(afrl::cmasi::ServiceStatusType::Information);
+    auto keyValuePair = new afrl::cmasi::KeyValuePair;
+    keyValuePair->setKey(std::string("AssignmentCancelled"));
+    keyValuePair->setValue("request ID[" + std::to_string(requestId) + "] superseded by request ID[" + std::to_string(supersedingRequestId) + "]");
+    serviceStatus->getInfo().push_back(keyValuePair);
+    sendAssignmentBroadcastMessage(serviceStatus);
+}
+
+void AssignmentTreeBranchBoundBase::executeAssignmentProcessing()
+{
+    while (true)
+    {
+        std::shared_ptr<AssigmentPrerequisites> assigmentPrerequisites;
+        {
+            std::unique_lock<std::mutex> lock(m_assignmentQueueMutex);
+            m_assignmentQueueCondition.wait(lock, [this]() { return (m_isTerminateAssignmentProcessing || !m_assignmentQueue.empty()); });
+            if (m_isTerminateAssignmentProcessing)
+            {
+                break;
+            }
+            assigmentPrerequisites = m_assignmentQueue.front();
+            m_assignmentQueue.pop_front();
+            m_runningAssignments.push_back(assigmentPrerequisites);
+        }
+
+        try
+        {
+            runCalculateAssignment(assigmentPrerequisites);
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_ERROR(s_typeName(), "::executeAssignmentProcessing EXCEPTION: ", ex.what());
+        }
+
+        std::lock_guard<std::mutex> lock(m_assignmentQueueMutex);
+        m_runningAssignments.erase(std::find(m_runningAssignments.begin(), m_runningAssignments.end(), assigmentPrerequisites));
+    }
+}
+
+void AssignmentTreeBranchBoundBase::terminateAssignmentProcessing()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentQueueMutex);
+        m_isTerminateAssignmentProcessing = true;
+        m_assignmentQueue.clear();
+        for (auto& runningPrerequisites : m_runningAssignments)
+        {
+            runningPrerequisites->m_assignmentParameters->m_isCancelled = true;
+        }
+    }
+    m_assignmentQueueCondition.notify_all();
+    for (auto& assignmentThread : m_assignmentThreads)
+    {
+        if (assignmentThread.joinable())
+        {
+            assignmentThread.join();
+        }
+    }
+    m_assignmentThreads.clear();
+}
+
+void AssignmentTreeBranchBoundBase::sendAssignmentBroadcastMessage(const std::shared_ptr<avtas::lmcp::Object>& lmcpObject)
+{
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+    sendSharedLmcpObjectBroadcastMessage(lmcpObject);
+}
+
 void AssignmentTreeBranchBoundBase::sendErrorMsg(std::string& errStr)
 {
     auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
@@ -271,7 +477,7 @@ void AssignmentTreeBranchBoundBase::sendErrorMsg(std::string& errStr)
     keyValuePair->setKey(std::string("No UniqueAutomationResponse"));
     keyValuePair->setValue("AssignmentTree: " + errStr);
     serviceStatus->getInfo().push_back(keyValuePair);
-    sendSharedLmcpObjectBroadcastMessage(serviceStatus);
+    sendAssignmentBroadcastMessage(serviceStatus);
 }
 
 bool AssignmentTreeBranchBoundBase::isInitializeAlgebra(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites)
@@ -463,7 +669,7 @@ bool AssignmentTreeBranchBoundBase::isInitializeAlgebra(const std::shared_ptr<As
 
         if (!algebraString.empty())
         {
-            if (!c_Node_Base::m_staticAssignmentParameters->algebra.initAtomicObjectives(taskIds))
+            if (!assigmentPrerequisites->m_assignmentParameters->algebra.initAtomicObjectives(taskIds))
             {
                 //sstreamErrors << "Error:: error encountered while initializing algebra objectives.]\n";
                 //errReturn = static_cast<enReturnErrorAssignment> (errReturn | eassignFailed);
@@ -471,7 +677,7 @@ bool AssignmentTreeBranchBoundBase::isInitializeAlgebra(const std::shared_ptr<As
                 sendErrorMsg(errStr);
                 isSuccess = false;
             }
-            else if (!c_Node_Base::m_staticAssignmentParameters->algebra.initAlgebraString(algebraString))
+            else if (!assigmentPrerequisites->m_assignmentParameters->algebra.initAlgebraString(algebraString))
             {
                 //sstreamErrors << "Error:: error encountered while parsing the algebra string:\n [" << algebraString << "]\n";
                 //errReturn = static_cast<enReturnErrorAssignment> (errReturn | eassignFailed);
@@ -501,64 +707,113 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
     //construct the inputs for the assignment algorithm
     /////////////////////////////////////////////////////////
 
-    // re-initialize static storage/parameters
-    nodeAssignment->m_staticAssignmentParameters.reset(new c_StaticAssignmentParameters);
+    // the request's parameters and search state, shared by all of the nodes of the search tree
+    if (!assigmentPrerequisites->m_assignmentParameters)
+    {
+        assigmentPrerequisites->m_assignmentParameters = std::make_shared<c_StaticAssignmentParameters>();
+    }
+    nodeAssignment->m_staticAssignmentParameters = assigmentPrerequisites->m_assignmentParameters.get();
     nodeAssignment->m_staticAssignmentParameters->m_CostFunction = m_CostFunction;
     nodeAssignment->m_staticAssignmentParameters->m_numberNodesMaximum = m_numberNodesMaximum;
+    nodeAssignment->m_staticAssignmentParameters->m_numberSearchThreads = m_numberSearchThreads;
+    nodeAssignment->m_staticAssignmentParameters->m_timeBudget_ms = m_timeBudget_ms;
 #ifdef AFRL_INTERNAL_ENABLED
-    nodeAssignment->m_assignmentType = assigmentPrerequisites->m_assignmentType;
+    nodeAssignment->m_staticAssignmentParameters->m_assignmentType = assigmentPrerequisites->m_assignmentType;
 #endif
-    nodeAssignment->m_isFinalAssignmentCalculated = false;
 
     // ALGEBRA:: Initialization
     isError = !isInitializeAlgebra(assigmentPrerequisites);
 
     if (!isError)
     {
+        /////////////////////////////////////////////////////////
+        // compile the costs into the dense cost table
+        /////////////////////////////////////////////////////////
+        auto& costMatrix = assigmentPrerequisites->m_assignmentCostMatrix->getCostMatrix();
+        std::vector<int64_t> vehicleIds;
+        std::set<int64_t> uniqueVehicleIds;
+        for (auto itTaskOptionCost = costMatrix.begin(); itTaskOptionCost != costMatrix.end(); itTaskOptionCost++)
+        {
+            if (uniqueVehicleIds.insert((*itTaskOptionCost)->getVehicleID()).second)
+            {
+                vehicleIds.push_back((*itTaskOptionCost)->getVehicleID());
+            }
+        }
+        std::set<int64_t> uniqueTaskOptionIds;
         for (auto itOptions = assigmentPrerequisites->m_taskIdVsTaskPlanOptions.begin(); itOptions != assigmentPrerequisites->m_taskIdVsTaskPlanOptions.end(); itOptions++)
         {
             for (auto itOption = itOptions->second->getOptions().begin(); itOption != itOptions->second->getOptions().end(); itOption++)
             {
-                int64_t taskOptionId = c_TaskAssignmentState::getTaskAndOptionId((*itOption)->getTaskID(), (*itOption)->getOptionID());
-                if (nodeAssignment->m_staticAssignmentParameters->m_taskOptionIdVsInformation.find(taskOptionId) == nodeAssignment->m_staticAssignmentParameters->m_taskOptionIdVsInformation.end())
-                {
-                    nodeAssignment->m_staticAssignmentParameters->m_taskOptionIdVsInformation[taskOptionId] = std::unique_ptr<c_TaskInformationStatic>(new c_TaskInformationStatic());
-                }
+                uniqueTaskOptionIds.insert(c_TaskAssignmentState::getTaskAndOptionId((*itOption)->getTaskID(), (*itOption)->getOptionID()));
+            }
+        }
+        auto& costTable = nodeAssignment->m_staticAssignmentParameters->m_costTable;
+        costTable.initialize(vehicleIds, std::vector<int64_t>(uniqueTaskOptionIds.begin(), uniqueTaskOptionIds.end()));
+
+        for (auto itOptions = assigmentPrerequisites->m_taskIdVsTaskPlanOptions.begin(); itOptions != assigmentPrerequisites->m_taskIdVsTaskPlanOptions.end(); itOptions++)
+        {
+            for (auto itOption = itOptions->second->getOptions().begin(); itOption != itOptions->second->getOptions().end(); itOption++)
+            {
+                int32_t taskOptionIndex = costTable.getTaskOptionIndex(c_TaskAssignmentState::getTaskAndOptionId((*itOption)->getTaskID(), (*itOption)->getOptionID()));
                 for (auto itObjVehicle = (*itOption)->getEligibleEntities().begin(); itObjVehicle != (*itOption)->getEligibleEntities().end(); itObjVehicle++)
                 {
-                    nodeAssignment->m_staticAssignmentParameters->m_taskOptionIdVsInformation[taskOptionId]->m_VehicleIdVsTaskTravelTime[*itObjVehicle] = (*itOption)->getCost();
+                    int32_t vehicleIndex = costTable.getVehicleIndex(*itObjVehicle);
+                    if (vehicleIndex >= 0)
+                    {
+                        costTable.setTaskTime_ms(vehicleIndex, taskOptionIndex, (*itOption)->getCost());
+                    }
                 }
             }
         }
 
-        for (auto itTaskOptionCost = assigmentPrerequisites->m_assignmentCostMatrix->getCostMatrix().begin();
-                itTaskOptionCost != assigmentPrerequisites->m_assignmentCostMatrix->getCostMatrix().end();
-                itTaskOptionCost++)
+        for (auto itTaskOptionCost = costMatrix.begin(); itTaskOptionCost != costMatrix.end(); itTaskOptionCost++)
         {
             auto vehicleId = (*itTaskOptionCost)->getVehicleID();
             auto fromId = c_TaskAssignmentState::getTaskAndOptionId((*itTaskOptionCost)->getIntialTaskID(), (*itTaskOptionCost)->getIntialTaskOption());
-            fromId = (fromId == 0) ? (vehicleId) : (fromId);
             auto toId = c_TaskAssignmentState::getTaskAndOptionId((*itTaskOptionCost)->getDestinationTaskID(), (*itTaskOptionCost)->getDestinationTaskOption());
-            auto travelCost = (*itTaskOptionCost)->getTimeToGo();
-
-            // instantiate new vehicle assignment classes if necessary
-            if (nodeAssignment->m_vehicleIdVsAssignmentState.find(vehicleId) == nodeAssignment->m_vehicleIdVsAssignmentState.end())
+            int32_t vehicleIndex = costTable.getVehicleIndex(vehicleId);
+            int32_t fromLocationIndex = (fromId == 0) ? (0) : (c_AssignmentCostTable::getLocationIndex(costTable.getTaskOptionIndex(fromId)));
+            int32_t toTaskOptionIndex = costTable.getTaskOptionIndex(toId);
+            // costs of task options that were not requested are not needed
+            if ((fromLocationIndex >= 0) && (toTaskOptionIndex >= 0))
             {
-                nodeAssignment->m_vehicleIdVsAssignmentState[vehicleId] = std::unique_ptr<c_VehicleAssignmentState>(new c_VehicleAssignmentState(vehicleId));
+                costTable.setTravelTime_ms(vehicleIndex, fromLocationIndex, toTaskOptionIndex, (*itTaskOptionCost)->getTimeToGo());
             }
-            if (nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation.find(vehicleId) == nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation.end())
+        }
+
+        nodeAssignment->m_staticAssignmentParameters->initializeActionIndices();
+        nodeAssignment->m_staticAssignmentParameters->m_lowerBound.initialize(m_lowerBoundType, nodeAssignment->m_staticAssignmentParameters->algebra,
+                                                                          nodeAssignment->m_staticAssignmentParameters->m_actionIndexVsTaskOptionIndex, costTable);
+
+        // instantiate the vehicle assignment states
+        for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(vehicleIds.size()); vehicleIndex++)
+        {
+            std::unique_ptr<c_VehicleAssignmentState> vehicleAssignmentState(new c_VehicleAssignmentState(vehicleIds[vehicleIndex]));
+            vehicleAssignmentState->m_vehicleIndex = vehicleIndex;
+            nodeAssignment->m_vehicleIdVsAssignmentState[vehicleIds[vehicleIndex]] = std::move(vehicleAssignmentState);
+        }
+
+        //TODO:: need to calculate "m_maximumVehicleCost" for the c_VehicleCostsStatic's map
+
+        // the repaired previous assignment is the initial incumbent, so only better assignments are searched
+        if (m_isIncrementalAssignment)
+        {
+            std::unordered_map<int64_t, std::vector<int64_t> > vehicleIdVsPreviousTaskOptionIds;
             {
-                nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation[vehicleId] = std::unique_ptr<c_VehicleInformationStatic>(new c_VehicleInformationStatic(vehicleId));
+                std::lock_guard<std::mutex> lock(m_previousAssignmentMutex);
+                for (auto itPreviousAssignment = m_requestIdVsPreviousAssignment.begin(); itPreviousAssignment != m_requestIdVsPreviousAssignment.end(); itPreviousAssignment++)
+                {
+                    vehicleIdVsPreviousTaskOptionIds.insert(itPreviousAssignment->second.begin(), itPreviousAssignment->second.end());
+                }
             }
-            if (nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation[vehicleId]->m_FromIdVsToIdVsTravelTime.find(fromId) == nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation[vehicleId]->m_FromIdVsToIdVsTravelTime.end())
+            c_AssignmentRefinement assignmentRefinement(nodeAssignment->m_staticAssignmentParameters);
+            if (assignmentRefinement.isWarmStarted(vehicleIdVsPreviousTaskOptionIds))
             {
-                nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation[vehicleId]->m_FromIdVsToIdVsTravelTime[fromId] = std::unique_ptr<std::unordered_map<int64_t, int64_t >> (new std::unordered_map<int64_t, int64_t>);
+                UXAS_LOG_INFORM(s_typeName(), "::calculateAssignment request ID[", assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID(),
+                                "] warm started with cost[", nodeAssignment->m_staticAssignmentParameters->m_minimumAssignmentCostCandidate.load(), "]");
             }
-            nodeAssignment->m_staticAssignmentParameters->m_vehicleIdVsInformation[vehicleId]->m_FromIdVsToIdVsTravelTime[fromId]->operator[](toId) = travelCost;
         }
 
-        //TODO:: need to calculate "m_maximumVehicleCost" for the c_VehicleCostsStatic's map
-
 
         /////////////////////////////////////////////////////////
         /////////  RUN THE ASSIGNMENT ALGORITHM
@@ -568,9 +823,41 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
         //  Note: (1)load Objectives and vehicles (2) run allocation algorithm (3)  the function GetWaypoints_m or GetWaypoints_LatLong_rad to return the results
         /////////////////////////////////////////////////////////////////////////////////////////////////////////
         nodeAssignment->m_staticAssignmentParameters->m_assignmentStartTime_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
-        nodeAssignment->ExpandNode();
+        auto searchStartTime = std::chrono::steady_clock::now();
+        nodeAssignment->m_staticAssignmentParameters->m_searchDeadline = searchStartTime + std::chrono::milliseconds(m_timeBudget_ms);
+        c_BranchBoundSearch branchBoundSearch(nodeAssignment->m_staticAssignmentParameters->m_numberSearchThreads);
+        if (m_isSendingIntermediateAssignments)
+        {
+            branchBoundSearch.search(*nodeAssignment, [&](const int64_t& lowerBound) { sendIntermediateAssignment(assigmentPrerequisites, lowerBound); });
+        }
+        else
+        {
+            branchBoundSearch.search(*nodeAssignment);
+        }
+        nodeAssignment->m_staticAssignmentParameters->m_searchDuration = std::chrono::steady_clock::now() - searchStartTime;
         nodeAssignment->printStatus("INFO::FINAL:  ");
 
+        // the search was stopped before it was complete, try to improve its assignment
+        if ((m_refinementTime_ms > 0) &&
+                nodeAssignment->m_staticAssignmentParameters->m_isStopCondition &&
+                !nodeAssignment->m_staticAssignmentParameters->m_isCancelled &&
+                (nodeAssignment->m_staticAssignmentParameters->m_numberCompleteAssignments > 0))
+        {
+            c_AssignmentRefinement assignmentRefinement(nodeAssignment->m_staticAssignmentParameters);
+            if (assignmentRefinement.refine(std::chrono::steady_clock::now() + std::chrono::milliseconds(m_refinementTime_ms)))
+            {
+                nodeAssignment->printStatus("INFO::REFINED: ");
+            }
+        }
+
+        if (nodeAssignment->m_staticAssignmentParameters->m_isCancelled)
+        {
+            // superseded, the results are not sent
+            UXAS_LOG_INFORM(s_typeName(), "::calculateAssignment request ID[", assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID(), "] cancelled");
+            nodeAssignment.reset();
+            return;
+        }
+
         if (nodeAssignment->m_staticAssignmentParameters->m_numberCompleteAssignments <= 0)
         {
             auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
@@ -580,7 +867,7 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
             keyValuePair->setValue(std::string("Assignment not found: ") + nodeAssignment->m_staticAssignmentParameters->m_reasonsForNoAssignment.str());
             serviceStatus->getInfo().push_back(keyValuePair);
             keyValuePair = nullptr;
-            sendSharedLmcpObjectBroadcastMessage(serviceStatus);
+            sendAssignmentBroadcastMessage(serviceStatus);
             std::cout << "RoutesNotFound:: " << std::endl << nodeAssignment->m_staticAssignmentParameters->m_reasonsForNoAssignment.str() << std::endl << std::endl;
         }
         else
@@ -591,33 +878,50 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
             keyValuePair->setKey(std::string("AssignmentComplete"));
             serviceStatus->getInfo().push_back(keyValuePair);
             keyValuePair = nullptr;
-            sendSharedLmcpObjectBroadcastMessage(serviceStatus);
+            sendAssignmentBroadcastMessage(serviceStatus);
         }
 
 
         /////////////////////////////////////////////////////////
         /////////  Return the results
         /////////////////////////////////////////////////////////
-        if (!nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.empty())
+        if (nodeAssignment->m_staticAssignmentParameters->m_numberCompleteAssignments > 0)
         {
-            auto taskAssignmentSummary = std::make_shared<uxas::messages::task::TaskAssignmentSummary>();
-
-            taskAssignmentSummary->setOperatingRegion(assigmentPrerequisites->m_uniqueAutomationRequest->getOriginalRequest()->getOperatingRegion());
-            taskAssignmentSummary->setCorrespondingAutomationRequestID(assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID());
-
-            for (auto itVehicleAssignments = nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.begin();
-                    itVehicleAssignments != nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.end();
-                    itVehicleAssignments++)
+            sendTaskAssignmentSummary(assigmentPrerequisites);
+            if (m_isIncrementalAssignment)
             {
-                for (auto itTaskAssignment = itVehicleAssignments->second->m_taskAssignments.begin();
-                        itTaskAssignment != itVehicleAssignments->second->m_taskAssignments.end();
-                        itTaskAssignment++)
+                // the warm start of the vehicles' next assignment
+                const c_AssignmentCostTable& costTable = nodeAssignment->m_staticAssignmentParameters->m_costTable;
+                std::lock_guard<std::mutex> candidateLock(nodeAssignment->m_staticAssignmentParameters->m_candidateMutex);
+                std::unordered_map<int64_t, std::vector<int64_t> > vehicleIdVsTaskOptionIds;
+                for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(costTable.getNumberVehicles()); vehicleIndex++)
+                {
+                    vehicleIdVsTaskOptionIds[costTable.getVehicleId(vehicleIndex)] = std::vector<int64_t>();
+                }
+                auto& assignmentSteps = nodeAssignment->m_staticAssignmentParameters->m_candidateAssignmentSteps;
+                for (auto itAssignmentStep = assignmentSteps.begin(); itAssignmentStep != assignmentSteps.end(); itAssignmentStep++)
+                {
+                    vehicleIdVsTaskOptionIds[costTable.getVehicleId(itAssignmentStep->m_vehicleIndex)].push_back(costTable.getTaskOptionId(itAssignmentStep->m_taskOptionIndex));
+                }
+                // this request replaces the earlier assignments of its vehicles, requests without vehicles are forgotten
+                std::lock_guard<std::mutex> lock(m_previousAssignmentMutex);
+                for (auto itPreviousAssignment = m_requestIdVsPreviousAssignment.begin(); itPreviousAssignment != m_requestIdVsPreviousAssignment.end();)
                 {
-                    taskAssignmentSummary->getTaskList().push_back((*itTaskAssignment)->clone());
+                    for (auto itVehicle = vehicleIdVsTaskOptionIds.begin(); itVehicle != vehicleIdVsTaskOptionIds.end(); itVehicle++)
+                    {
+                        itPreviousAssignment->second.erase(itVehicle->first);
+                    }
+                    if (itPreviousAssignment->second.empty())
+                    {
+                        itPreviousAssignment = m_requestIdVsPreviousAssignment.erase(itPreviousAssignment);
+                    }
+                    else
+                    {
+                        itPreviousAssignment++;
+                    }
                 }
+                m_requestIdVsPreviousAssignment[assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID()] = std::move(vehicleIdVsTaskOptionIds);
             }
-            auto newMessage = std::static_pointer_cast<avtas::lmcp::Object>(taskAssignmentSummary);
-            sendSharedLmcpObjectBroadcastMessage(newMessage);
             UXAS_LOG_INFORM("ASSIGNMENT COMPLETE!");
         }
         else
@@ -631,299 +935,1125 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
     nodeAssignment.reset();
 } //void AssignmentTreeBranchBoundBase::CalculateAssignment()
 
-///////////////////////////////////////////////////////////////////////////////////////////////////
+void AssignmentTreeBranchBoundBase::sendTaskAssignmentSummary(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites)
+{
+    auto taskAssignmentSummary = std::make_shared<uxas::messages::task::TaskAssignmentSummary>();
 
-c_VehicleInformationStatic::c_VehicleInformationStatic(const int64_t & vehicleId)
-: m_vehicleId(vehicleId) { };
+    taskAssignmentSummary->setOperatingRegion(assigmentPrerequisites->m_uniqueAutomationRequest->getOriginalRequest()->getOperatingRegion());
+    taskAssignmentSummary->setCorrespondingAutomationRequestID(assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID());
+    assigmentPrerequisites->m_assignmentParameters->getCandidateTaskAssignments(taskAssignmentSummary->getTaskList());
+
+    auto newMessage = std::static_pointer_cast<avtas::lmcp::Object>(taskAssignmentSummary);
+    sendAssignmentBroadcastMessage(newMessage);
+}
+
+void AssignmentTreeBranchBoundBase::sendIntermediateAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites, const int64_t& lowerBound)
+{
+    auto taskAssignmentSummary = new uxas::messages::task::TaskAssignmentSummary;
+    taskAssignmentSummary->setOperatingRegion(assigmentPrerequisites->m_uniqueAutomationRequest->getOriginalRequest()->getOperatingRegion());
+    taskAssignmentSummary->setCorrespondingAutomationRequestID(assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID());
+    // the cost and the task assignments are of the same incumbent
+    int64_t cost = assigmentPrerequisites->m_assignmentParameters->getCandidateTaskAssignments(taskAssignmentSummary->getTaskList());
+    int64_t costLowerBound = std::min(lowerBound, cost);
+    double gap = (cost > 0) ? (static_cast<double>(cost - costLowerBound) / static_cast<double>(cost)) : (0.0);
+    UXAS_LOG_INFORM(s_typeName(), "::sendIntermediateAssignment request ID[", assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID(),
+                    "] cost[", cost, "] lower bound[", costLowerBound, "] gap[", gap, "]");
+
+    auto intermediateTaskAssignmentSummary = std::make_shared<uxas::messages::task::IntermediateTaskAssignmentSummary>();
+    intermediateTaskAssignmentSummary->setSummary(taskAssignmentSummary);
+    intermediateTaskAssignmentSummary->setCost(cost);
+    intermediateTaskAssignmentSummary->setLowerBound(costLowerBound);
+    intermediateTaskAssignmentSummary->setGap(gap);
+
+    auto newMessage = std::static_pointer_cast<avtas::lmcp::Object>(intermediateTaskAssignmentSummary);
+    sendAssignmentBroadcastMessage(newMessage);
+}
 
-int64_t c_VehicleInformationStatic::getTravelTime_ms(const int64_t& fromId, const int64_t & toId)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void c_StaticAssignmentParameters::initializeActionIndices()
 {
-    int64_t returnTravelTime_ms(-1); // LengthOfTime_ms not found
-    auto itToCost = m_FromIdVsToIdVsTravelTime.find(fromId);
-    if (itToCost != m_FromIdVsToIdVsTravelTime.end())
+    m_actionIndexVsTaskOptionIndex.assign(algebra.getNumberActionIndices(), -1);
+    m_taskOptionIndexVsActionIndex.assign(m_costTable.getNumberTaskOptions(), -1);
+    for (int actionIndex = 0; actionIndex < static_cast<int>(algebra.getNumberActionIndices()); actionIndex++)
     {
-        auto itTravelTime = itToCost->second->find(toId);
-        if (itTravelTime != itToCost->second->end())
+        int32_t taskOptionIndex = m_costTable.getTaskOptionIndex(algebra.getActionID(actionIndex));
+        m_actionIndexVsTaskOptionIndex[actionIndex] = taskOptionIndex;
+        if ((taskOptionIndex >= 0) && (m_taskOptionIndexVsActionIndex[taskOptionIndex] < 0))
         {
-            returnTravelTime_ms = itTravelTime->second;
+            m_taskOptionIndexVsActionIndex[taskOptionIndex] = actionIndex;
         }
     }
-    return (returnTravelTime_ms);
-};
-
-c_TaskInformationStatic::c_TaskInformationStatic() { }
+}
 
-int64_t c_TaskInformationStatic::getTravelTime_ms(const int64_t & VehicleId)
+bool c_StaticAssignmentParameters::isCandidateImprovement(const int64_t& nodeCost, const std::vector<uint32_t>& searchOrderKey)
 {
-    int64_t returnCost_ms(-1); // cost not found
-    auto itCost = m_VehicleIdVsTaskTravelTime.find(VehicleId);
-    if (itCost != m_VehicleIdVsTaskTravelTime.end())
+    int64_t candidateCost = m_minimumAssignmentCostCandidate;
+    if (nodeCost != candidateCost)
     {
-        returnCost_ms = itCost->second;
+        return (nodeCost < candidateCost);
     }
-    return (returnCost_ms);
-};
-
-c_VehicleAssignmentState::c_VehicleAssignmentState(const int64_t & vehicleId)
-: m_vehicleId(vehicleId) { };
-
-std::unique_ptr<c_VehicleAssignmentState> c_VehicleAssignmentState::clone()
-{
-    return (std::unique_ptr<c_VehicleAssignmentState>(new c_VehicleAssignmentState(*this)));
+    // equal cost: only descendants that precede the incumbent in depth-first order can replace it
+    std::lock_guard<std::mutex> lock(m_candidateMutex);
+    if (nodeCost != m_minimumAssignmentCostCandidate)
+    {
+        return (nodeCost < m_minimumAssignmentCostCandidate);
+    }
+    // (the key of a warm started incumbent is empty, it is kept for equal costs)
+    auto keyLength = std::min(searchOrderKey.size(), m_candidateSearchOrderKey.size());
+    auto itMismatch = std::mismatch(searchOrderKey.begin(), searchOrderKey.begin() + keyLength, m_candidateSearchOrderKey.begin());
+    return ((itMismatch.first != searchOrderKey.begin() + keyLength) && (*itMismatch.first < *itMismatch.second));
 }
 
-c_VehicleAssignmentState::c_VehicleAssignmentState(const c_VehicleAssignmentState & rhs)
+bool c_StaticAssignmentParameters::updateCandidate(const int64_t& nodeCost, const std::vector<uint32_t>& searchOrderKey,
+                                                   const std::vector<c_AssignmentStep>& assignmentSteps)
 {
-    m_vehicleId = rhs.m_vehicleId;
-    m_isAcceptingNewAssignments = rhs.m_isAcceptingNewAssignments;
-    m_travelTimeTotal_ms = rhs.m_travelTimeTotal_ms;
-    for (auto itAssignment = rhs.m_taskAssignments.begin(); itAssignment != rhs.m_taskAssignments.end(); itAssignment++)
+    std::lock_guard<std::mutex> lock(m_candidateMutex);
+    if ((nodeCost > m_minimumAssignmentCostCandidate) ||
+            ((nodeCost == m_minimumAssignmentCostCandidate) &&
+             !std::lexicographical_compare(searchOrderKey.begin(), searchOrderKey.end(), m_candidateSearchOrderKey.begin(), m_candidateSearchOrderKey.end())))
     {
-        m_taskAssignments.push_back(std::unique_ptr<uxas::messages::task::TaskAssignment>((*itAssignment)->clone()));
+        return (false);
     }
+    m_numberCompleteAssignments++;
+    m_numberSearchedAssignments++;
+    m_candidateSearchOrderKey = searchOrderKey;
+    m_candidateAssignmentSteps = assignmentSteps;
+    m_minimumAssignmentCostCandidate = nodeCost;
+    m_isCandidateUpdated = true;
+    setCandidateTime();
+    return (true);
 }
 
-c_TaskAssignmentState::c_TaskAssignmentState(const int64_t & taskOptionId)
-: m_taskOptionId(taskOptionId) { };
-
-std::unique_ptr<c_TaskAssignmentState> c_TaskAssignmentState::clone()
+void c_StaticAssignmentParameters::setCandidateTime()
 {
-    return (std::unique_ptr<c_TaskAssignmentState>(new c_TaskAssignmentState(*this)));
+    m_candidateTime_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
+    if (m_firstAssignmentTime_ms == 0)
+    {
+        m_firstAssignmentTime_ms = m_candidateTime_ms;
+    }
 }
 
-c_TaskAssignmentState::c_TaskAssignmentState(const c_TaskAssignmentState & rhs)
+int64_t c_StaticAssignmentParameters::getCandidateTaskAssignments(std::vector<uxas::messages::task::TaskAssignment*>& taskAssignments)
 {
-    m_taskOptionId = rhs.m_taskOptionId;
-    m_taskOptionId = rhs.m_taskOptionId;
+    std::lock_guard<std::mutex> lock(m_candidateMutex);
+    for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(m_costTable.getNumberVehicles()); vehicleIndex++)
+    {
+        for (auto itAssignmentStep = m_candidateAssignmentSteps.begin(); itAssignmentStep != m_candidateAssignmentSteps.end(); itAssignmentStep++)
+        {
+            if (itAssignmentStep->m_vehicleIndex == vehicleIndex)
+            {
+                int64_t taskOptionId = m_costTable.getTaskOptionId(itAssignmentStep->m_taskOptionIndex);
+                auto taskAssignment = new uxas::messages::task::TaskAssignment();
+                taskAssignment->setTaskID(c_TaskAssignmentState::getTaskID(taskOptionId));
+                taskAssignment->setOptionID(c_TaskAssignmentState::getOptionID(taskOptionId));
+                taskAssignment->setAssignedVehicle(m_costTable.getVehicleId(vehicleIndex));
+                taskAssignment->setTimeThreshold(itAssignmentStep->m_timeThreshold_ms);
+                taskAssignment->setTimeTaskCompleted(itAssignmentStep->m_travelTimeTotal_ms);
+                taskAssignments.push_back(taskAssignment);
+            }
+        }
+    }
+    return (m_minimumAssignmentCostCandidate);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<c_StaticAssignmentParameters> c_Node_Base::m_staticAssignmentParameters(new c_StaticAssignmentParameters);
-
-c_Node_Base::c_Node_Base() //this is used for the root node
-{
-    m_staticAssignmentParameters->m_numberNodesVisited++;
-    //CERR_FILE_LINE_MSG("m_staticAssignmentParameters->m_numberNodesAdded[" << m_staticAssignmentParameters->m_numberNodesAdded << "]")
-}
-
-c_Node_Base::~c_Node_Base()
-{
-    m_staticAssignmentParameters->m_numberNodesRemoved++;
-}
+c_AssignmentRefinement::c_AssignmentRefinement(c_StaticAssignmentParameters* staticAssignmentParameters)
+: m_staticAssignmentParameters(staticAssignmentParameters) { }
 
-std::unique_ptr<c_Node_Base> c_Node_Base::clone()
+bool c_AssignmentRefinement::refine(const std::chrono::steady_clock::time_point& deadline)
 {
-    return (std::unique_ptr<c_Node_Base>(new c_Node_Base(*this)));
-}
+    if (!isCostFunctionSupported())
+    {
+        return (false);
+    }
 
-//copy constructor
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    std::vector<c_AssignmentStep> assignmentSteps;
+    {
+        std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_candidateMutex);
+        assignmentSteps = m_staticAssignmentParameters->m_candidateAssignmentSteps;
+    }
+    std::vector< std::vector<int32_t> > vehicleTaskOptionIndices(costTable.getNumberVehicles());
+    for (auto itAssignmentStep = assignmentSteps.begin(); itAssignmentStep != assignmentSteps.end(); itAssignmentStep++)
+    {
+        vehicleTaskOptionIndices[itAssignmentStep->m_vehicleIndex].push_back(itAssignmentStep->m_taskOptionIndex);
+    }
+    m_numberTaskOptions = assignmentSteps.size();
+    initializeTaskOptionsOfTask();
 
-c_Node_Base::c_Node_Base(const c_Node_Base & rhs) //copy constructor
-: m_travelTimeTotal_ms(rhs.m_travelTimeTotal_ms),
-m_isPruneable(rhs.m_isPruneable),
-m_isLeafNode(rhs.m_isLeafNode)
-{
-    m_staticAssignmentParameters->m_numberNodesVisited++;
-    for (auto itVehicleAssignmentState = rhs.m_vehicleIdVsAssignmentState.begin();
-            itVehicleAssignmentState != rhs.m_vehicleIdVsAssignmentState.end();
-            itVehicleAssignmentState++)
+    int64_t cost(0);
+    int64_t travelTimeSum_ms(0);
+    if ((m_numberTaskOptions == 0) || !isEvaluated(vehicleTaskOptionIndices, cost, travelTimeSum_ms))
     {
-        m_vehicleIdVsAssignmentState[itVehicleAssignmentState->first] = itVehicleAssignmentState->second->clone();
+        return (false);
     }
-    for (auto itTaskAssignmentState = rhs.m_taskIdVsAssignmentState.begin();
-            itTaskAssignmentState != rhs.m_taskIdVsAssignmentState.end();
-            itTaskAssignmentState++)
+    int64_t initialCost(cost);
+    int64_t bestCost(cost);
+    std::vector<c_AssignmentStep> bestAssignmentSteps;
+
+    int64_t numberIterations(0);
+    int64_t numberMovesAccepted(0);
+    std::uniform_int_distribution<int32_t> moveDistribution(0, 3);
+    std::vector< std::vector<int32_t> > moveTaskOptionIndices;
+    while (!m_staticAssignmentParameters->m_isCancelled && (std::chrono::steady_clock::now() < deadline))
     {
-        m_taskIdVsAssignmentState[itTaskAssignmentState->first] = itTaskAssignmentState->second->clone();
+        numberIterations++;
+        moveTaskOptionIndices = vehicleTaskOptionIndices;
+        bool isMoved(false);
+        switch (moveDistribution(m_randomNumberGenerator))
+        {
+            default:
+            case 0:
+                isMoved = isRelocateMove(moveTaskOptionIndices);
+                break;
+            case 1:
+                isMoved = isSwapMove(moveTaskOptionIndices);
+                break;
+            case 2:
+                isMoved = isTwoOptMove(moveTaskOptionIndices);
+                break;
+            case 3:
+                isMoved = isRuinRecreateMove(moveTaskOptionIndices);
+                break;
+        }
+
+        // the algebra is only checked for moves that do not increase the cost
+        int64_t moveCost(0);
+        int64_t moveTravelTimeSum_ms(0);
+        if (isMoved && isEvaluated(moveTaskOptionIndices, moveCost, moveTravelTimeSum_ms) &&
+                ((moveCost < cost) || ((moveCost == cost) && (moveTravelTimeSum_ms <= travelTimeSum_ms))) &&
+                isOrdered(moveTaskOptionIndices, assignmentSteps))
+        {
+            numberMovesAccepted++;
+            vehicleTaskOptionIndices.swap(moveTaskOptionIndices);
+            cost = moveCost;
+            travelTimeSum_ms = moveTravelTimeSum_ms;
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAssignmentSteps = assignmentSteps;
+            }
+        }
     }
-    m_viObjectiveIDs_Assigned = rhs.m_viObjectiveIDs_Assigned;
-    // do not copy children !!!!!!!!
-};
+    UXAS_LOG_INFORM("INFO::REFINEMENT: cost[", initialCost, "] refined cost[", bestCost, "] iterations[", numberIterations,
+                    "] moves accepted[", numberMovesAccepted, "]");
 
-void c_Node_Base::printStatus(const std::string& Message)
-{
-    double timeSinceStart_s = static_cast<double> (uxas::common::utilities::c_TimeUtilities::getTimeNow_ms() -
-            m_staticAssignmentParameters->m_assignmentStartTime_ms) / 1000.0;
-    UXAS_LOG_INFORM(Message
-                  , "timeSinceStart_s[" , timeSinceStart_s
-                  , "] m_vehicleID[" , m_vehicleID
-                  , "] cost[" , m_staticAssignmentParameters->m_minimumAssignmentCostCandidate
-                  , "] numberNodesVisited[" , m_staticAssignmentParameters->m_numberNodesVisited
-                  , "] numberNodesRemoved[" , m_staticAssignmentParameters->m_numberNodesRemoved
-                  , "] Number Current Nodes[" , (m_staticAssignmentParameters->m_numberNodesVisited - m_staticAssignmentParameters->m_numberNodesRemoved)
-                  , "] numberNodesAdded[" , m_staticAssignmentParameters->m_numberNodesAdded
-                  , "] numberNodesPruned[" , m_staticAssignmentParameters->m_numberNodesPruned
-                  , "]" );
-    UXAS_LOG_INFORM_ASSIGNMENT("timeSinceStart_s[", timeSinceStart_s,
-                                  "] cost[", m_staticAssignmentParameters->m_minimumAssignmentCostCandidate,
-                                  "] numberNodesVisited[", m_staticAssignmentParameters->m_numberNodesVisited, "]");
+    if (bestCost >= initialCost)
+    {
+        return (false);
+    }
+    std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_candidateMutex);
+    m_staticAssignmentParameters->m_candidateAssignmentSteps = bestAssignmentSteps;
+    m_staticAssignmentParameters->m_minimumAssignmentCostCandidate = bestCost;
+    m_staticAssignmentParameters->m_isCandidateUpdated = true;
+    m_staticAssignmentParameters->setCandidateTime();
+    return (true);
 }
 
-void c_Node_Base::ExpandNode()
+bool c_AssignmentRefinement::isWarmStarted(const std::unordered_map<int64_t, std::vector<int64_t> >& vehicleIdVsPreviousTaskOptionIds)
 {
-    //////////////////////////////////////////////////////////////////////////////////
-    // check assignment viability and find lower bound on costs of child nodes
-    //////////////////////////////////////////////////////////////////////////////////
-    bool bTaskAvailable = false; //if there are no tasks to do then this is the final assignment node
-
-    // investigate child nodes
-    std::vector<int64_t> vectorOfNextObjectiveIDs;
-    m_staticAssignmentParameters->algebra.searchNext(m_viObjectiveIDs_Assigned, vectorOfNextObjectiveIDs);
-
-    for (auto itObjectiveID = vectorOfNextObjectiveIDs.begin(); itObjectiveID != vectorOfNextObjectiveIDs.end(); itObjectiveID++) // ALGEBRA:: New for loop
+    if (!isCostFunctionSupported())
     {
-        bTaskAvailable = true;
-
-        //TODO:: find the prerequsite task
-        int64_t prerequisiteTaskOptionId(-1);
-        //searchPred (const v_action_t &executedAtomicObjectives, int AtomicObjectiveIn)
+        return (false);
+    }
 
-        for (auto itVehicleAssignmentState = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end(); itVehicleAssignmentState++)
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    std::vector< std::vector<int32_t> > previousTaskOptionIndices(costTable.getNumberVehicles());
+    for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(costTable.getNumberVehicles()); vehicleIndex++)
+    {
+        auto itPreviousTaskOptionIds = vehicleIdVsPreviousTaskOptionIds.find(costTable.getVehicleId(vehicleIndex));
+        if (itPreviousTaskOptionIds != vehicleIdVsPreviousTaskOptionIds.end())
         {
-            NodeAssignment(itVehicleAssignmentState->second, *itObjectiveID, prerequisiteTaskOptionId);
-            if (!itVehicleAssignmentState->second->m_isAcceptingNewAssignments)
+            for (auto itTaskOptionId = itPreviousTaskOptionIds->second.begin(); itTaskOptionId != itPreviousTaskOptionIds->second.end(); itTaskOptionId++)
             {
-                UXAS_LOG_INFORM("Vehicle ID[" + std::to_string(itVehicleAssignmentState->first) + "] is finished!");
+                int32_t taskOptionIndex = costTable.getTaskOptionIndex(*itTaskOptionId);
+                if (taskOptionIndex >= 0)
+                {
+                    previousTaskOptionIndices[vehicleIndex].push_back(taskOptionIndex);
+                }
             }
         }
-    } //for(V_INT_IT_t itObjectiveID = vectorOfNextObjectiveIDs.begin(); itObjectiveID != vectorOfNextObjectiveIDs.end(); itObjectiveID++)
+    }
 
-    if (!m_staticAssignmentParameters->m_isStopCondition)
+    // replay the previous assignments in the order the algebra allows
+    std::vector<int32_t> locationIndices(costTable.getNumberVehicles(), 0);
+    std::vector<int64_t> vehicleTravelTimeTotals_ms(costTable.getNumberVehicles(), 0);
+    std::vector<int64_t> assignedTaskOptionIds;
+    std::vector<int64_t> nextTaskOptionIds;
+    std::vector<c_AssignmentStep> assignmentSteps;
+    std::vector<int32_t> addedTaskOptionIndices;
+    auto getTravelTimeTotal_ms = [&](const int32_t& vehicleIndex, const int32_t& taskOptionIndex) -> int64_t
     {
-        //if there are valid assignments and there are child nodes, then expand them 
-        //if (bTaskAvailable && bVehicleAvailable)
-        if (!m_costVsChildren.empty())
+        int64_t travelTime_ms = costTable.getTravelTime_ms(vehicleIndex, locationIndices[vehicleIndex], taskOptionIndex);
+        int64_t taskTime_ms = costTable.getTaskTime_ms(vehicleIndex, taskOptionIndex);
+        int64_t travelTimeTotal_ms = vehicleTravelTimeTotals_ms[vehicleIndex] + travelTime_ms + taskTime_ms;
+        int64_t maxVehicleTravelTime_ms = costTable.getMaximumTravelTime_ms(vehicleIndex);
+        return (((travelTime_ms < 0) || (taskTime_ms < 0) || ((maxVehicleTravelTime_ms >= 0) && (travelTimeTotal_ms >= maxVehicleTravelTime_ms))) ?
+                (-1) : (travelTimeTotal_ms));
+    };
+    while (assignmentSteps.size() < costTable.getNumberTaskOptions())
+    {
+        m_staticAssignmentParameters->algebra.searchNext(assignedTaskOptionIds, nextTaskOptionIds);
+        if (nextTaskOptionIds.empty())
         {
-            //////////////////////////////////////////////////////////////////////////////////
-            //expand the children
-            //////////////////////////////////////////////////////////////////////////////////
-#ifdef STEVETEST
-            std::cout << std::endl << "<>AssignmentTreeBB:m_costVsChildren [" << m_costVsChildren.size() << "] # Previous Assignments[" << m_viObjectiveIDs_Assigned.size() << "]";
-#endif  //#ifdef STEVETEST
-#ifdef STEVETEST
-            for (auto& itChild : m_costVsChildren)
-            {
-                std::cout << " (" << itChild.second->m_vehicleID << ", " << itChild.second->m_taskOptionID << ", " << itChild.first << ")";
-            }
-            std::cout << "]" << std::endl;
-            std::cout.flush();
-#endif  //#ifdef STEVETEST
+            break;
+        }
 
-            for (auto itChild = m_costVsChildren.begin(); itChild != m_costVsChildren.end(); itChild++)
+        // the vehicles' previous task options, if the algebra allows them, otherwise a new task option
+        c_AssignmentStep assignmentStep;
+        assignmentStep.m_travelTimeTotal_ms = INT64_MAX;
+        for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(previousTaskOptionIndices.size()); vehicleIndex++)
+        {
+            if (!previousTaskOptionIndices[vehicleIndex].empty() &&
+                    (std::find(nextTaskOptionIds.begin(), nextTaskOptionIds.end(), costTable.getTaskOptionId(previousTaskOptionIndices[vehicleIndex].front())) != nextTaskOptionIds.end()))
             {
-                // other children may have found lower costs or a stop condition
-                if ((itChild->second->m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate) && !m_staticAssignmentParameters->m_isStopCondition)
-                {
-#ifdef STEVETEST
-                    std::cout << "  #Prev[" << m_viObjectiveIDs_Assigned.size() << "](" << itChild->second->m_vehicleID << ", "
-                            << itChild->second->m_taskOptionID << ", " << itChild->first << ", " << itChild->second->m_nodeCost << ")";
-#endif  //#ifdef STEVETEST
-                    itChild->second->ExpandNode();
-                }
-                else
+                int64_t travelTimeTotal_ms = getTravelTimeTotal_ms(vehicleIndex, previousTaskOptionIndices[vehicleIndex].front());
+                if ((travelTimeTotal_ms >= 0) && (travelTimeTotal_ms < assignmentStep.m_travelTimeTotal_ms))
                 {
-                    itChild->second->m_isPruneable = true;
+                    assignmentStep.m_vehicleIndex = vehicleIndex;
+                    assignmentStep.m_taskOptionIndex = previousTaskOptionIndices[vehicleIndex].front();
+                    assignmentStep.m_travelTimeTotal_ms = travelTimeTotal_ms;
                 }
-            } //for(L_CHILD_IT_t itChild=lnodeitGe ......
-            PruneChildren();
+            }
         }
-        else //if(((bTaskAvailable)&&(bVehicleAvailable))
+        if (assignmentStep.m_vehicleIndex < 0)
         {
-            // have all of the tasks been accounted for?
-            if (!bTaskAvailable)
+            addedTaskOptionIndices.push_back(-1);
+            for (auto itTaskOptionId = nextTaskOptionIds.begin(); itTaskOptionId != nextTaskOptionIds.end(); itTaskOptionId++)
             {
-                // check to see if this leaf node is better than the candidate optimal
-                if (m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
+                int32_t taskOptionIndex = costTable.getTaskOptionIndex(*itTaskOptionId);
+                for (int32_t vehicleIndex = 0; (taskOptionIndex >= 0) && (vehicleIndex < static_cast<int32_t>(costTable.getNumberVehicles())); vehicleIndex++)
                 {
-                    ////////////////  NEW LEAF NODE  ///////////////////////////
-                    // this is the new minimum (feasible) leaf node
-                    m_isLeafNode = true;
-                    m_staticAssignmentParameters->m_numberCompleteAssignments++;
-                    m_staticAssignmentParameters->m_minimumAssignmentCostCandidate = m_nodeCost;
-                    m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.clear();
-                    for (auto itVehicleAssignment = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignment != m_vehicleIdVsAssignmentState.end(); itVehicleAssignment++)
+                    int64_t travelTimeTotal_ms = getTravelTimeTotal_ms(vehicleIndex, taskOptionIndex);
+                    if ((travelTimeTotal_ms >= 0) && (travelTimeTotal_ms < assignmentStep.m_travelTimeTotal_ms))
                     {
-                        m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState[itVehicleAssignment->first] = itVehicleAssignment->second->clone();
+                        assignmentStep.m_vehicleIndex = vehicleIndex;
+                        assignmentStep.m_taskOptionIndex = taskOptionIndex;
+                        assignmentStep.m_travelTimeTotal_ms = travelTimeTotal_ms;
                     }
-                    printStatus("INFO::NEW LEAF: ");
                 }
-                else //if (m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
-                {
-                    //COUT_INFO_MSG("(!bTaskAvailable)")
-                    // this is a node that is not optimal and needs to be pruned
-                    m_isLeafNode = true;
-                    m_isPruneable = true;
-                } //if (m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
             }
-            else //if(!bTaskAvailable)
-            {
-                //COUT_INFO_MSG("(bTaskAvailable && !bVehicleAvailable)")
-                // not all of the tasks were assigned!!!!!
-                //TODO:: let them know why this set of assignments didn't work???
-                // this is a node that is not optimal and needs to be pruned
-                m_isLeafNode = true;
-                m_isPruneable = true;
-            } //if(!bTaskAvailable)
-        } //if(((bTaskAvailable)&&(bVehicleAvailable)))
+        }
+        if (assignmentStep.m_vehicleIndex < 0)
+        {
+            return (false);
+        }
+        if (!addedTaskOptionIndices.empty() && (addedTaskOptionIndices.back() < 0))
+        {
+            addedTaskOptionIndices.back() = assignmentStep.m_taskOptionIndex;
+        }
+
+        for (auto itTaskOptionIndices = previousTaskOptionIndices.begin(); itTaskOptionIndices != previousTaskOptionIndices.end(); itTaskOptionIndices++)
+        {
+            itTaskOptionIndices->erase(std::remove(itTaskOptionIndices->begin(), itTaskOptionIndices->end(), assignmentStep.m_taskOptionIndex), itTaskOptionIndices->end());
+        }
+        locationIndices[assignmentStep.m_vehicleIndex] = c_AssignmentCostTable::getLocationIndex(assignmentStep.m_taskOptionIndex);
+        vehicleTravelTimeTotals_ms[assignmentStep.m_vehicleIndex] = assignmentStep.m_travelTimeTotal_ms;
+        assignedTaskOptionIds.push_back(costTable.getTaskOptionId(assignmentStep.m_taskOptionIndex));
+        assignmentSteps.push_back(assignmentStep);
+    }
+    m_staticAssignmentParameters->algebra.searchNext(assignedTaskOptionIds, nextTaskOptionIds);
+    if (assignmentSteps.empty() || !nextTaskOptionIds.empty())
+    {
+        return (false);
     }
 
-    if (m_staticAssignmentParameters->m_isStopCondition)
+    std::vector< std::vector<int32_t> > vehicleTaskOptionIndices(costTable.getNumberVehicles());
+    for (auto itAssignmentStep = assignmentSteps.begin(); itAssignmentStep != assignmentSteps.end(); itAssignmentStep++)
     {
-        // got a stop condition, time to get out
-        if (!m_isFinalAssignmentCalculated)
+        vehicleTaskOptionIndices[itAssignmentStep->m_vehicleIndex].push_back(itAssignmentStep->m_taskOptionIndex);
+    }
+    int64_t cost(0);
+    int64_t travelTimeSum_ms(0);
+    if (!isEvaluated(vehicleTaskOptionIndices, cost, travelTimeSum_ms))
+    {
+        return (false);
+    }
+
+    // the added task options were appended, move them to where they increase the cost the least
+    m_numberTaskOptions = assignmentSteps.size();
+    initializeTaskOptionsOfTask();
+    std::vector<c_AssignmentStep> insertedAssignmentSteps;
+    for (auto itTaskOptionIndex = addedTaskOptionIndices.begin(); itTaskOptionIndex != addedTaskOptionIndices.end(); itTaskOptionIndex++)
+    {
+        std::vector< std::vector<int32_t> > insertedTaskOptionIndices = vehicleTaskOptionIndices;
+        for (auto itTaskOptionIndices = insertedTaskOptionIndices.begin(); itTaskOptionIndices != insertedTaskOptionIndices.end(); itTaskOptionIndices++)
         {
-            //COUT_INFO_MSG("calculateFinalAssignment()!")
-            calculateFinalAssignment();
-            m_isFinalAssignmentCalculated = true;
+            itTaskOptionIndices->erase(std::remove(itTaskOptionIndices->begin(), itTaskOptionIndices->end(), *itTaskOptionIndex), itTaskOptionIndices->end());
         }
-        // dump the children
-        m_costVsChildren.clear();
+        m_taskOptionIndicesOfTask[*itTaskOptionIndex].assign(1, *itTaskOptionIndex);
+        int64_t insertedCost(0);
+        int64_t insertedTravelTimeSum_ms(0);
+        if (isInserted(insertedTaskOptionIndices, *itTaskOptionIndex) &&
+                isEvaluated(insertedTaskOptionIndices, insertedCost, insertedTravelTimeSum_ms) &&
+                ((insertedCost < cost) || ((insertedCost == cost) && (insertedTravelTimeSum_ms < travelTimeSum_ms))) &&
+                isOrdered(insertedTaskOptionIndices, insertedAssignmentSteps))
+        {
+            vehicleTaskOptionIndices.swap(insertedTaskOptionIndices);
+            assignmentSteps.swap(insertedAssignmentSteps);
+            cost = insertedCost;
+            travelTimeSum_ms = insertedTravelTimeSum_ms;
+        }
+    }
 
-    } //if(m_staticAssignmentParameters->m_isStopCondition)
-} //void CNode::ExpandNode(
+    // the empty search order key keeps the warm start for equal cost assignments
+    std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_candidateMutex);
+    m_staticAssignmentParameters->m_numberCompleteAssignments++;
+    m_staticAssignmentParameters->m_candidateSearchOrderKey.clear();
+    m_staticAssignmentParameters->m_candidateAssignmentSteps = assignmentSteps;
+    m_staticAssignmentParameters->m_minimumAssignmentCostCandidate = cost;
+    m_staticAssignmentParameters->m_isCandidateUpdated = true;
+    m_staticAssignmentParameters->setCandidateTime();
+    return (true);
+}
 
-void c_Node_Base::PruneChildren()
+void c_AssignmentRefinement::initializeTaskOptionsOfTask()
 {
-    bool isPruneParent(true); //if any of the nodes below this are not pruned then don't allow this one to be pruned
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    std::map<int64_t, std::vector<int32_t> > taskIdVsTaskOptionIndices;
+    for (int32_t taskOptionIndex = 0; taskOptionIndex < static_cast<int32_t>(costTable.getNumberTaskOptions()); taskOptionIndex++)
+    {
+        taskIdVsTaskOptionIndices[c_TaskAssignmentState::getTaskID(costTable.getTaskOptionId(taskOptionIndex))].push_back(taskOptionIndex);
+    }
+    m_taskOptionIndicesOfTask.resize(costTable.getNumberTaskOptions());
+    for (int32_t taskOptionIndex = 0; taskOptionIndex < static_cast<int32_t>(costTable.getNumberTaskOptions()); taskOptionIndex++)
+    {
+        m_taskOptionIndicesOfTask[taskOptionIndex] = taskIdVsTaskOptionIndices[c_TaskAssignmentState::getTaskID(costTable.getTaskOptionId(taskOptionIndex))];
+    }
+}
+
+bool c_AssignmentRefinement::isCostFunctionSupported() const
+{
+#ifdef AFRL_INTERNAL_ENABLED
+    return ((m_staticAssignmentParameters->m_assignmentType == uxas::project::pisr::AssignmentType::MinMaxTime) ||
+            (m_staticAssignmentParameters->m_assignmentType == uxas::project::pisr::AssignmentType::MinCumlativeTime));
+#else
+    return (true);
+#endif
+}
 
-    if (!m_costVsChildren.empty())
+int64_t c_AssignmentRefinement::getVehicleTravelTime_ms(const int32_t& vehicleIndex, const std::vector<int32_t>& taskOptionIndices) const
+{
+    // as calculated in c_Node_Base::NodeAssignment
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    int64_t maxVehicleTravelTime_ms = costTable.getMaximumTravelTime_ms(vehicleIndex);
+    int64_t travelTimeTotal_ms(0);
+    int32_t locationIndex(0);
+    for (auto itTaskOptionIndex = taskOptionIndices.begin(); itTaskOptionIndex != taskOptionIndices.end(); itTaskOptionIndex++)
     {
-        for (auto itChild = m_costVsChildren.begin(); itChild != m_costVsChildren.end(); itChild++)
+        int64_t travelTime_ms = costTable.getTravelTime_ms(vehicleIndex, locationIndex, *itTaskOptionIndex);
+        int64_t taskTime_ms = costTable.getTaskTime_ms(vehicleIndex, *itTaskOptionIndex);
+        if ((travelTime_ms < 0) || (taskTime_ms < 0))
+        {
+            return (-1);
+        }
+        travelTimeTotal_ms += travelTime_ms + taskTime_ms;
+        if ((maxVehicleTravelTime_ms >= 0) && (travelTimeTotal_ms >= maxVehicleTravelTime_ms))
         {
-            itChild->second->PruneChildren();
+            return (-1);
         }
-        while (1)
+        locationIndex = c_AssignmentCostTable::getLocationIndex(*itTaskOptionIndex);
+    }
+    return (travelTimeTotal_ms);
+}
+
+bool c_AssignmentRefinement::isEvaluated(const std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, int64_t& cost, int64_t& travelTimeSum_ms) const
+{
+    int64_t travelTimeMaximum_ms(0);
+    travelTimeSum_ms = 0;
+    for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(vehicleTaskOptionIndices.size()); vehicleIndex++)
+    {
+        int64_t travelTime_ms = getVehicleTravelTime_ms(vehicleIndex, vehicleTaskOptionIndices[vehicleIndex]);
+        if (travelTime_ms < 0)
         {
-            auto itChild = m_costVsChildren.begin();
-            for (; itChild != m_costVsChildren.end(); itChild++)
+            return (false);
+        }
+        travelTimeMaximum_ms = std::max(travelTimeMaximum_ms, travelTime_ms);
+        travelTimeSum_ms += travelTime_ms;
+    }
+    // as calculated in c_Node_Base::calculateAssignmentCostBase
+#ifdef AFRL_INTERNAL_ENABLED
+    cost = (m_staticAssignmentParameters->m_assignmentType == uxas::project::pisr::AssignmentType::MinCumlativeTime) ? (travelTimeSum_ms) : (travelTimeMaximum_ms);
+#else
+    // MINMAX
+    cost = travelTimeMaximum_ms;
+#endif
+    return (true);
+}
+
+bool c_AssignmentRefinement::isOrdered(const std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, std::vector<c_AssignmentStep>& assignmentSteps)
+{
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    std::vector<size_t> vehiclePositions(vehicleTaskOptionIndices.size(), 0);
+    std::vector<int64_t> vehicleTravelTimeTotals_ms(vehicleTaskOptionIndices.size(), 0);
+    const uxas::common::utilities::CAlgebra& algebra = m_staticAssignmentParameters->algebra;
+    std::vector<uint64_t> executedActionBits(algebra.getNumberBitsetWords(), 0);
+    std::vector<uint64_t> nextLeafBits;
+    std::vector<int> nextActionIndices;
+    std::vector<uint64_t> nextActionBits(algebra.getNumberBitsetWords(), 0);
+    assignmentSteps.clear();
+    while (assignmentSteps.size() < m_numberTaskOptions)
+    {
+        algebra.searchNext(executedActionBits, nextLeafBits, nextActionIndices);
+        std::fill(nextActionBits.begin(), nextActionBits.end(), 0);
+        for (auto itActionIndex = nextActionIndices.begin(); itActionIndex != nextActionIndices.end(); itActionIndex++)
+        {
+            uxas::common::utilities::CAlgebra::setBit(nextActionBits, *itActionIndex);
+        }
+
+        // of the vehicles' next task options that the algebra allows, assign the one completed first
+        c_AssignmentStep assignmentStep;
+        assignmentStep.m_travelTimeTotal_ms = INT64_MAX;
+        for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(vehicleTaskOptionIndices.size()); vehicleIndex++)
+        {
+            size_t position = vehiclePositions[vehicleIndex];
+            if (position >= vehicleTaskOptionIndices[vehicleIndex].size())
+            {
+                continue;
+            }
+            int32_t taskOptionIndex = vehicleTaskOptionIndices[vehicleIndex][position];
+            int32_t actionIndex = m_staticAssignmentParameters->m_taskOptionIndexVsActionIndex[taskOptionIndex];
+            if ((actionIndex < 0) || !uxas::common::utilities::CAlgebra::isBitSet(nextActionBits, actionIndex))
+            {
+                continue;
+            }
+            int32_t locationIndex = (position > 0) ? (c_AssignmentCostTable::getLocationIndex(vehicleTaskOptionIndices[vehicleIndex][position - 1])) : (0);
+            int64_t travelTimeTotal_ms = vehicleTravelTimeTotals_ms[vehicleIndex] + costTable.getTravelTime_ms(vehicleIndex, locationIndex, taskOptionIndex)
+                    + costTable.getTaskTime_ms(vehicleIndex, taskOptionIndex);
+            if (travelTimeTotal_ms < assignmentStep.m_travelTimeTotal_ms)
             {
-                if (itChild->second->m_isPruneable)
+                assignmentStep.m_vehicleIndex = vehicleIndex;
+                assignmentStep.m_taskOptionIndex = taskOptionIndex;
+                assignmentStep.m_travelTimeTotal_ms = travelTimeTotal_ms;
+            }
+        }
+        if (assignmentStep.m_vehicleIndex < 0)
+        {
+            return (false);
+        }
+        vehiclePositions[assignmentStep.m_vehicleIndex]++;
+        vehicleTravelTimeTotals_ms[assignmentStep.m_vehicleIndex] = assignmentStep.m_travelTimeTotal_ms;
+        uxas::common::utilities::CAlgebra::setBit(executedActionBits, m_staticAssignmentParameters->m_taskOptionIndexVsActionIndex[assignmentStep.m_taskOptionIndex]);
+        assignmentSteps.push_back(assignmentStep);
+    }
+
+    // all of the required task options have been assigned
+    algebra.searchNext(executedActionBits, nextLeafBits, nextActionIndices);
+    return (nextActionIndices.empty());
+}
+
+bool c_AssignmentRefinement::isRandomTaskOption(const std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, int32_t& vehicleIndex, int32_t& position)
+{
+    size_t numberTaskOptions(0);
+    for (auto itTaskOptionIndices = vehicleTaskOptionIndices.begin(); itTaskOptionIndices != vehicleTaskOptionIndices.end(); itTaskOptionIndices++)
+    {
+        numberTaskOptions += itTaskOptionIndices->size();
+    }
+    if (numberTaskOptions == 0)
+    {
+        return (false);
+    }
+    size_t taskOptionNumber = std::uniform_int_distribution<size_t>(0, numberTaskOptions - 1)(m_randomNumberGenerator);
+    for (vehicleIndex = 0; taskOptionNumber >= vehicleTaskOptionIndices[vehicleIndex].size(); vehicleIndex++)
+    {
+        taskOptionNumber -= vehicleTaskOptionIndices[vehicleIndex].size();
+    }
+    position = static_cast<int32_t>(taskOptionNumber);
+    return (true);
+}
+
+bool c_AssignmentRefinement::isRelocateMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices)
+{
+    int32_t fromVehicleIndex(-1);
+    int32_t fromPosition(-1);
+    if (!isRandomTaskOption(vehicleTaskOptionIndices, fromVehicleIndex, fromPosition))
+    {
+        return (false);
+    }
+    int32_t taskOptionIndex = vehicleTaskOptionIndices[fromVehicleIndex][fromPosition];
+    vehicleTaskOptionIndices[fromVehicleIndex].erase(vehicleTaskOptionIndices[fromVehicleIndex].begin() + fromPosition);
+
+    auto toVehicleIndex = std::uniform_int_distribution<size_t>(0, vehicleTaskOptionIndices.size() - 1)(m_randomNumberGenerator);
+    std::vector<int32_t>& toTaskOptionIndices = vehicleTaskOptionIndices[toVehicleIndex];
+    auto toPosition = std::uniform_int_distribution<size_t>(0, toTaskOptionIndices.size())(m_randomNumberGenerator);
+    toTaskOptionIndices.insert(toTaskOptionIndices.begin() + toPosition, taskOptionIndex);
+    return ((static_cast<int32_t>(toVehicleIndex) != fromVehicleIndex) || (static_cast<int32_t>(toPosition) != fromPosition));
+}
+
+bool c_AssignmentRefinement::isSwapMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices)
+{
+    int32_t vehicleIndex1(-1);
+    int32_t position1(-1);
+    int32_t vehicleIndex2(-1);
+    int32_t position2(-1);
+    if (!isRandomTaskOption(vehicleTaskOptionIndices, vehicleIndex1, position1) ||
+            !isRandomTaskOption(vehicleTaskOptionIndices, vehicleIndex2, position2) ||
+            ((vehicleIndex1 == vehicleIndex2) && (position1 == position2)))
+    {
+        return (false);
+    }
+    std::swap(vehicleTaskOptionIndices[vehicleIndex1][position1], vehicleTaskOptionIndices[vehicleIndex2][position2]);
+    return (true);
+}
+
+bool c_AssignmentRefinement::isTwoOptMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices)
+{
+    int32_t vehicleIndex(-1);
+    int32_t position1(-1);
+    int32_t position2(-1);
+    if (!isRandomTaskOption(vehicleTaskOptionIndices, vehicleIndex, position1))
+    {
+        return (false);
+    }
+    std::vector<int32_t>& taskOptionIndices = vehicleTaskOptionIndices[vehicleIndex];
+    position2 = std::uniform_int_distribution<int32_t>(0, static_cast<int32_t>(taskOptionIndices.size()) - 1)(m_randomNumberGenerator);
+    if (position1 == position2)
+    {
+        return (false);
+    }
+    // reverse the segment, i.e. replace the segment's incoming and outgoing legs
+    std::reverse(taskOptionIndices.begin() + std::min(position1, position2), taskOptionIndices.begin() + std::max(position1, position2) + 1);
+    return (true);
+}
+
+bool c_AssignmentRefinement::isRuinRecreateMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices)
+{
+    // ruin: remove up to a third of the task options
+    size_t numberRemoved = std::uniform_int_distribution<size_t>(1, std::max(static_cast<size_t>(1), m_numberTaskOptions / 3))(m_randomNumberGenerator);
+    std::vector<int32_t> removedTaskOptionIndices;
+    for (size_t removedNumber = 0; removedNumber < numberRemoved; removedNumber++)
+    {
+        int32_t vehicleIndex(-1);
+        int32_t position(-1);
+        if (!isRandomTaskOption(vehicleTaskOptionIndices, vehicleIndex, position))
+        {
+            break;
+        }
+        removedTaskOptionIndices.push_back(vehicleTaskOptionIndices[vehicleIndex][position]);
+        vehicleTaskOptionIndices[vehicleIndex].erase(vehicleTaskOptionIndices[vehicleIndex].begin() + position);
+    }
+
+    // recreate: insert an option of each task, in random order, where it increases the cost the least
+    std::shuffle(removedTaskOptionIndices.begin(), removedTaskOptionIndices.end(), m_randomNumberGenerator);
+    for (auto itTaskOptionIndex = removedTaskOptionIndices.begin(); itTaskOptionIndex != removedTaskOptionIndices.end(); itTaskOptionIndex++)
+    {
+        if (!isInserted(vehicleTaskOptionIndices, *itTaskOptionIndex))
+        {
+            return (false);
+        }
+    }
+    return (!removedTaskOptionIndices.empty());
+}
+
+bool c_AssignmentRefinement::isInserted(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, const int32_t& taskOptionIndex)
+{
+    int64_t bestCost(INT64_MAX);
+    int64_t bestTravelTimeSum_ms(INT64_MAX);
+    int32_t bestVehicleIndex(-1);
+    int32_t bestTaskOptionIndex(-1);
+    size_t bestPosition(0);
+    const std::vector<int32_t>& optionTaskOptionIndices = m_taskOptionIndicesOfTask[taskOptionIndex];
+    for (auto itOptionTaskOptionIndex = optionTaskOptionIndices.begin(); itOptionTaskOptionIndex != optionTaskOptionIndices.end(); itOptionTaskOptionIndex++)
+    {
+        for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(vehicleTaskOptionIndices.size()); vehicleIndex++)
+        {
+            std::vector<int32_t>& taskOptionIndices = vehicleTaskOptionIndices[vehicleIndex];
+            for (size_t position = 0; position <= taskOptionIndices.size(); position++)
+            {
+                taskOptionIndices.insert(taskOptionIndices.begin() + position, *itOptionTaskOptionIndex);
+                int64_t cost(0);
+                int64_t travelTimeSum_ms(0);
+                if (isEvaluated(vehicleTaskOptionIndices, cost, travelTimeSum_ms) &&
+                        ((cost < bestCost) || ((cost == bestCost) && (travelTimeSum_ms < bestTravelTimeSum_ms))))
                 {
-                    m_costVsChildren.erase(itChild);
-                    itChild = m_costVsChildren.begin();
-                    m_staticAssignmentParameters->m_numberNodesPruned++;
-                    break;
+                    bestCost = cost;
+                    bestTravelTimeSum_ms = travelTimeSum_ms;
+                    bestVehicleIndex = vehicleIndex;
+                    bestTaskOptionIndex = *itOptionTaskOptionIndex;
+                    bestPosition = position;
                 }
-                else
+                taskOptionIndices.erase(taskOptionIndices.begin() + position);
+            }
+        }
+    }
+    if (bestVehicleIndex < 0)
+    {
+        return (false);
+    }
+    vehicleTaskOptionIndices[bestVehicleIndex].insert(vehicleTaskOptionIndices[bestVehicleIndex].begin() + bestPosition, bestTaskOptionIndex);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void c_AssignmentLowerBound::initialize(const LowerBoundType& lowerBoundType, const uxas::common::utilities::CAlgebra& algebra,
+                                        const std::vector<int32_t>& actionIndexVsTaskOptionIndex, const c_AssignmentCostTable& costTable)
+{
+    m_lowerBoundType = lowerBoundType;
+    m_numberVehicles = costTable.getNumberVehicles();
+    m_numberTaskOptions = costTable.getNumberTaskOptions();
+    m_algebra = nullptr;
+    m_leafTaskOptionIndices.clear();
+    m_leafMinimumWork_ms.clear();
+    m_minimumVehicleWork_ms.assign(m_numberVehicles * m_numberTaskOptions, -1);
+    if ((m_lowerBoundType == LowerBoundType::NONE) || (algebra.getNumberCompiledNodes() == 0))
+    {
+        return;
+    }
+
+    // [task option] minimum work over the vehicles (-1 -> no vehicle can perform it)
+    std::vector<int64_t> minimumWork_ms(m_numberTaskOptions, -1);
+    for (int32_t taskOptionIndex = 0; taskOptionIndex < static_cast<int32_t>(m_numberTaskOptions); taskOptionIndex++)
+    {
+        for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(m_numberVehicles); vehicleIndex++)
+        {
+            // cheapest way to arrive (from the start or the end of another task option), as calculated in NodeAssignment
+            int64_t minimumTravelTime_ms(-1);
+            for (int32_t fromLocationIndex = 0; fromLocationIndex <= static_cast<int32_t>(m_numberTaskOptions); fromLocationIndex++)
+            {
+                int64_t travelTime_ms = costTable.getTravelTime_ms(vehicleIndex, fromLocationIndex, taskOptionIndex);
+                if ((fromLocationIndex != c_AssignmentCostTable::getLocationIndex(taskOptionIndex)) && (travelTime_ms >= 0) &&
+                        ((minimumTravelTime_ms < 0) || (travelTime_ms < minimumTravelTime_ms)))
+                {
+                    minimumTravelTime_ms = travelTime_ms;
+                }
+            }
+            if (minimumTravelTime_ms >= 0)
+            {
+                int64_t work_ms = std::max(static_cast<int64_t>(0), minimumTravelTime_ms + costTable.getTaskTime_ms(vehicleIndex, taskOptionIndex));
+                m_minimumVehicleWork_ms[vehicleIndex * m_numberTaskOptions + taskOptionIndex] = work_ms;
+                if ((minimumWork_ms[taskOptionIndex] < 0) || (work_ms < minimumWork_ms[taskOptionIndex]))
                 {
-                    isPruneParent = false;
+                    minimumWork_ms[taskOptionIndex] = work_ms;
                 }
+            }
+        }
+    }
+
+    // a task option may appear in several leaves (e.g. in required branches), it is only performed once
+    std::vector<int64_t> numberLeaves(m_numberTaskOptions, 0);
+    for (int leafNo = 0; leafNo < static_cast<int>(algebra.getNumberLeaves()); leafNo++)
+    {
+        int actionIndex = algebra.getLeafActionIndex(leafNo);
+        int32_t taskOptionIndex = (actionIndex < static_cast<int>(actionIndexVsTaskOptionIndex.size())) ? (actionIndexVsTaskOptionIndex[actionIndex]) : (-1);
+        m_leafTaskOptionIndices.push_back(taskOptionIndex);
+        if (taskOptionIndex >= 0)
+        {
+            numberLeaves[taskOptionIndex]++;
+        }
+    }
+    for (auto itTaskOptionIndex = m_leafTaskOptionIndices.begin(); itTaskOptionIndex != m_leafTaskOptionIndices.end(); itTaskOptionIndex++)
+    {
+        m_leafMinimumWork_ms.push_back(((*itTaskOptionIndex >= 0) && (minimumWork_ms[*itTaskOptionIndex] > 0)) ?
+                                       (minimumWork_ms[*itTaskOptionIndex] / numberLeaves[*itTaskOptionIndex]) : (0));
+    }
+    m_algebra = &algebra;
+}
+
+int64_t c_AssignmentLowerBound::getRemainingWork_ms(const int& compiledNodeNo, const std::vector<uint8_t>& isTaskOptionAssigned, bool& isStarted) const
+{
+    const uxas::common::utilities::compiledNode_t& compiledNode = m_algebra->getCompiledNode(compiledNodeNo);
+    if (compiledNode.numChildren == 0)
+    {
+        int32_t taskOptionIndex = (compiledNode.leafNo >= 0) ? (m_leafTaskOptionIndices[compiledNode.leafNo]) : (-1);
+        isStarted = (taskOptionIndex >= 0) && isTaskOptionAssigned[taskOptionIndex];
+        return (((taskOptionIndex >= 0) && !isStarted) ? (m_leafMinimumWork_ms[compiledNode.leafNo]) : (0));
+    }
+    isStarted = false;
+    int64_t remainingWork_ms(0);
+    if (compiledNode.operatorType == uxas::common::utilities::OP_ALTERNATIVE)
+    {
+        // only one branch is performed: the started one or, if none has been started, the cheapest one
+        int64_t minimumWork_ms(INT64_MAX);
+        int64_t minimumStartedWork_ms(INT64_MAX);
+        for (int childNo = 0; childNo < compiledNode.numChildren; childNo++)
+        {
+            bool isChildStarted(false);
+            int64_t work_ms = getRemainingWork_ms(m_algebra->getCompiledChildNo(compiledNode, childNo), isTaskOptionAssigned, isChildStarted);
+            minimumWork_ms = std::min(minimumWork_ms, work_ms);
+            if (isChildStarted)
+            {
+                isStarted = true;
+                minimumStartedWork_ms = std::min(minimumStartedWork_ms, work_ms);
+            }
+        }
+        remainingWork_ms = (isStarted) ? (minimumStartedWork_ms) : (minimumWork_ms);
+    }
+    else
+    {
+        for (int childNo = 0; childNo < compiledNode.numChildren; childNo++)
+        {
+            bool isChildStarted(false);
+            remainingWork_ms += getRemainingWork_ms(m_algebra->getCompiledChildNo(compiledNode, childNo), isTaskOptionAssigned, isChildStarted);
+            isStarted = isStarted || isChildStarted;
+        }
+    }
+    return (remainingWork_ms);
+}
 
+int64_t c_AssignmentLowerBound::getLatestCompletion_ms(const int& compiledNodeNo, const std::vector<int64_t>& vehicleTravelTimeTotals_ms,
+                                                       const std::vector<uint8_t>& isTaskOptionAssigned, bool& isStarted) const
+{
+    const uxas::common::utilities::compiledNode_t& compiledNode = m_algebra->getCompiledNode(compiledNodeNo);
+    if (compiledNode.numChildren == 0)
+    {
+        int32_t taskOptionIndex = (compiledNode.leafNo >= 0) ? (m_leafTaskOptionIndices[compiledNode.leafNo]) : (-1);
+        isStarted = (taskOptionIndex >= 0) && isTaskOptionAssigned[taskOptionIndex];
+        int64_t completion_ms(0);
+        if ((taskOptionIndex >= 0) && !isStarted)
+        {
+            // the earliest that any vehicle could complete the task option
+            int64_t earliestCompletion_ms(INT64_MAX);
+            for (size_t vehicleIndex = 0; vehicleIndex < m_numberVehicles; vehicleIndex++)
+            {
+                int64_t work_ms = m_minimumVehicleWork_ms[vehicleIndex * m_numberTaskOptions + taskOptionIndex];
+                if (work_ms >= 0)
+                {
+                    earliestCompletion_ms = std::min(earliestCompletion_ms, vehicleTravelTimeTotals_ms[vehicleIndex] + work_ms);
+                }
             }
-            if (itChild == m_costVsChildren.end())
+            completion_ms = (earliestCompletion_ms != INT64_MAX) ? (earliestCompletion_ms) : (0);
+        }
+        return (completion_ms);
+    }
+    isStarted = false;
+    int64_t latestCompletion_ms(0);
+    if (compiledNode.operatorType == uxas::common::utilities::OP_ALTERNATIVE)
+    {
+        int64_t minimumCompletion_ms(INT64_MAX);
+        int64_t minimumStartedCompletion_ms(INT64_MAX);
+        for (int childNo = 0; childNo < compiledNode.numChildren; childNo++)
+        {
+            bool isChildStarted(false);
+            int64_t completion_ms = getLatestCompletion_ms(m_algebra->getCompiledChildNo(compiledNode, childNo), vehicleTravelTimeTotals_ms, isTaskOptionAssigned, isChildStarted);
+            minimumCompletion_ms = std::min(minimumCompletion_ms, completion_ms);
+            if (isChildStarted)
             {
-                break;
+                isStarted = true;
+                minimumStartedCompletion_ms = std::min(minimumStartedCompletion_ms, completion_ms);
             }
-        } //while(1)
+        }
+        latestCompletion_ms = (isStarted) ? (minimumStartedCompletion_ms) : (minimumCompletion_ms);
+    }
+    else
+    {
+        for (int childNo = 0; childNo < compiledNode.numChildren; childNo++)
+        {
+            bool isChildStarted(false);
+            latestCompletion_ms = std::max(latestCompletion_ms, getLatestCompletion_ms(m_algebra->getCompiledChildNo(compiledNode, childNo), vehicleTravelTimeTotals_ms, isTaskOptionAssigned, isChildStarted));
+            isStarted = isStarted || isChildStarted;
+        }
+    }
+    return (latestCompletion_ms);
+}
+
+int64_t c_AssignmentLowerBound::getMinMaxLowerBound(const std::vector<int64_t>& vehicleTravelTimeTotals_ms, const std::vector<uint8_t>& isTaskOptionAssigned) const
+{
+    int64_t lowerBound(0);
+    int64_t travelTimeTotalSum_ms(0);
+    for (auto itTravelTimeTotal = vehicleTravelTimeTotals_ms.begin(); itTravelTimeTotal != vehicleTravelTimeTotals_ms.end(); itTravelTimeTotal++)
+    {
+        lowerBound = std::max(lowerBound, *itTravelTimeTotal);
+        travelTimeTotalSum_ms += *itTravelTimeTotal;
+    }
+    bool isStarted(false);
+    lowerBound = std::max(lowerBound, getLatestCompletion_ms(0, vehicleTravelTimeTotals_ms, isTaskOptionAssigned, isStarted));
+    if ((m_lowerBoundType == LowerBoundType::LOAD_BALANCE) && (m_numberVehicles > 0))
+    {
+        // the maximum is at least the average
+        int64_t numberVehicles = static_cast<int64_t>(m_numberVehicles);
+        int64_t workTotal_ms = travelTimeTotalSum_ms + getRemainingWork_ms(0, isTaskOptionAssigned, isStarted);
+        lowerBound = std::max(lowerBound, (workTotal_ms + numberVehicles - 1) / numberVehicles);
     }
-    else if ((m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate) && m_isLeafNode)
+    return (lowerBound);
+}
+
+int64_t c_AssignmentLowerBound::getCumulativeLowerBound(const std::vector<int64_t>& vehicleTravelTimeTotals_ms, const std::vector<uint8_t>& isTaskOptionAssigned) const
+{
+    int64_t lowerBound(0);
+    for (auto itTravelTimeTotal = vehicleTravelTimeTotals_ms.begin(); itTravelTimeTotal != vehicleTravelTimeTotals_ms.end(); itTravelTimeTotal++)
     {
-        isPruneParent = false;
+        lowerBound += *itTravelTimeTotal;
     }
-    m_isPruneable = isPruneParent;
+    bool isStarted(false);
+    return (lowerBound + getRemainingWork_ms(0, isTaskOptionAssigned, isStarted));
 }
 
-void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId, const int64_t & prerequisiteTaskOptionId)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+c_SearchNode* c_SearchNodeArena::allocate()
+{
+    c_SearchNode* searchNode(nullptr);
+    if (m_freeNodes)
+    {
+        searchNode = m_freeNodes;
+        m_freeNodes = searchNode->m_parent;
+    }
+    else
+    {
+        if (m_numberBlockNodesAllocated >= s_blockSize)
+        {
+            m_blocks.push_back(std::unique_ptr<c_SearchNode[]>(new c_SearchNode[s_blockSize]));
+            m_numberBlockNodesAllocated = 0;
+        }
+        searchNode = &m_blocks.back()[m_numberBlockNodesAllocated++];
+    }
+    searchNode->m_parent = nullptr;
+    searchNode->m_assignmentStep = c_AssignmentStep();
+    searchNode->m_nodeCost = 0;
+    searchNode->m_searchOrderRank = 0;
+    searchNode->m_referenceCount = 0;
+    return (searchNode);
+}
+
+void c_SearchNodeArena::release(c_SearchNode* searchNode)
+{
+    searchNode->m_parent = m_freeNodes;
+    m_freeNodes = searchNode;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void c_AssignmentCostTable::initialize(const std::vector<int64_t>& vehicleIds, const std::vector<int64_t>& taskOptionIds)
+{
+    m_vehicleIds = vehicleIds;
+    m_taskOptionIds = taskOptionIds;
+    m_vehicleIdVsIndex.clear();
+    m_taskOptionIdVsIndex.clear();
+    for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(m_vehicleIds.size()); vehicleIndex++)
+    {
+        m_vehicleIdVsIndex[m_vehicleIds[vehicleIndex]] = vehicleIndex;
+    }
+    for (int32_t taskOptionIndex = 0; taskOptionIndex < static_cast<int32_t>(m_taskOptionIds.size()); taskOptionIndex++)
+    {
+        m_taskOptionIdVsIndex[m_taskOptionIds[taskOptionIndex]] = taskOptionIndex;
+    }
+    m_travelTimes_ms.assign(m_vehicleIds.size() * (m_taskOptionIds.size() + 1) * m_taskOptionIds.size(), -1);
+    m_taskTimes_ms.assign(m_vehicleIds.size() * m_taskOptionIds.size(), -1);
+    m_maximumTravelTimes_ms.assign(m_vehicleIds.size(), -1);
+}
+
+int32_t c_AssignmentCostTable::getVehicleIndex(const int64_t& vehicleId) const
+{
+    auto itIndex = m_vehicleIdVsIndex.find(vehicleId);
+    return ((itIndex != m_vehicleIdVsIndex.end()) ? (itIndex->second) : (-1));
+}
+
+int32_t c_AssignmentCostTable::getTaskOptionIndex(const int64_t& taskOptionId) const
+{
+    auto itIndex = m_taskOptionIdVsIndex.find(taskOptionId);
+    return ((itIndex != m_taskOptionIdVsIndex.end()) ? (itIndex->second) : (-1));
+}
+
+c_VehicleAssignmentState::c_VehicleAssignmentState(const int64_t & vehicleId)
+: m_vehicleId(vehicleId) { };
+
+std::unique_ptr<c_VehicleAssignmentState> c_VehicleAssignmentState::clone()
+{
+    return (std::unique_ptr<c_VehicleAssignmentState>(new c_VehicleAssignmentState(*this)));
+}
+
+c_VehicleAssignmentState::c_VehicleAssignmentState(const c_VehicleAssignmentState & rhs)
+{
+    m_vehicleId = rhs.m_vehicleId;
+    m_vehicleIndex = rhs.m_vehicleIndex;
+    m_locationIndex = rhs.m_locationIndex;
+    m_isAcceptingNewAssignments = rhs.m_isAcceptingNewAssignments;
+    m_travelTimeTotal_ms = rhs.m_travelTimeTotal_ms;
+}
+
+c_TaskAssignmentState::c_TaskAssignmentState(const int64_t & taskOptionId)
+: m_taskOptionId(taskOptionId) { };
+
+std::unique_ptr<c_TaskAssignmentState> c_TaskAssignmentState::clone()
+{
+    return (std::unique_ptr<c_TaskAssignmentState>(new c_TaskAssignmentState(*this)));
+}
+
+c_TaskAssignmentState::c_TaskAssignmentState(const c_TaskAssignmentState & rhs)
+{
+    m_taskOptionId = rhs.m_taskOptionId;
+    m_taskOptionId = rhs.m_taskOptionId;
+}
+
+
+c_Node_Base::c_Node_Base() //this is used for the root node
+{
+    // the root node is not counted as a visited node
+}
+
+c_Node_Base::~c_Node_Base() { }
+
+std::unique_ptr<c_Node_Base> c_Node_Base::clone()
+{
+    return (std::unique_ptr<c_Node_Base>(new c_Node_Base(*this)));
+}
+
+//copy constructor
+
+c_Node_Base::c_Node_Base(const c_Node_Base & rhs) //copy constructor
+: m_staticAssignmentParameters(rhs.m_staticAssignmentParameters),
+m_travelTimeTotal_ms(rhs.m_travelTimeTotal_ms),
+m_isLeafNode(rhs.m_isLeafNode),
+m_searchOrderKey(rhs.m_searchOrderKey)
+{
+    for (auto itVehicleAssignmentState = rhs.m_vehicleIdVsAssignmentState.begin();
+            itVehicleAssignmentState != rhs.m_vehicleIdVsAssignmentState.end();
+            itVehicleAssignmentState++)
+    {
+        m_vehicleIdVsAssignmentState[itVehicleAssignmentState->first] = itVehicleAssignmentState->second->clone();
+    }
+    m_assignmentSteps = rhs.m_assignmentSteps;
+    m_viObjectiveIDs_Assigned = rhs.m_viObjectiveIDs_Assigned;
+    m_executedActionBits = rhs.m_executedActionBits;
+    // do not copy children !!!!!!!!
+};
+
+void c_Node_Base::loadNode(const c_SearchNode* searchNode)
+{
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    if (m_vehicleIndexVsAssignmentState.size() != costTable.getNumberVehicles())
+    {
+        m_vehicleIndexVsAssignmentState.assign(costTable.getNumberVehicles(), nullptr);
+        for (auto itVehicleAssignmentState = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end(); itVehicleAssignmentState++)
+        {
+            m_vehicleIndexVsAssignmentState[itVehicleAssignmentState->second->m_vehicleIndex] = itVehicleAssignmentState->second.get();
+        }
+    }
+
+    // collect the path from the node to the trunk
+    m_assignmentSteps.clear();
+    m_searchOrderKey.clear();
+    m_nodeCost = (searchNode) ? (searchNode->m_nodeCost) : (0);
+    for (const c_SearchNode* pathNode = searchNode; (pathNode != nullptr) && (pathNode->m_parent != nullptr); pathNode = pathNode->m_parent)
+    {
+        m_assignmentSteps.push_back(pathNode->m_assignmentStep);
+        m_searchOrderKey.push_back(pathNode->m_searchOrderRank);
+    }
+    std::reverse(m_assignmentSteps.begin(), m_assignmentSteps.end());
+    std::reverse(m_searchOrderKey.begin(), m_searchOrderKey.end());
+
+    // replay the assignment steps from the trunk
+    for (auto itVehicleAssignmentState = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end(); itVehicleAssignmentState++)
+    {
+        itVehicleAssignmentState->second->m_locationIndex = 0;
+        itVehicleAssignmentState->second->m_travelTimeTotal_ms = 0;
+    }
+    m_viObjectiveIDs_Assigned.clear();
+    m_executedActionBits.assign(m_staticAssignmentParameters->algebra.getNumberBitsetWords(), 0);
+    m_vehicleTravelTimeTotals_ms.assign(costTable.getNumberVehicles(), 0);
+    m_isTaskOptionAssigned.assign(costTable.getNumberTaskOptions(), 0);
+    m_vehicleID = 0;
+    m_taskOptionID = 0;
+    m_travelTimeTotal_ms = 0;
+    for (auto itAssignmentStep = m_assignmentSteps.begin(); itAssignmentStep != m_assignmentSteps.end(); itAssignmentStep++)
+    {
+        c_VehicleAssignmentState* vehicleAssignmentState = m_vehicleIndexVsAssignmentState[itAssignmentStep->m_vehicleIndex];
+        vehicleAssignmentState->m_locationIndex = c_AssignmentCostTable::getLocationIndex(itAssignmentStep->m_taskOptionIndex);
+        vehicleAssignmentState->m_travelTimeTotal_ms = itAssignmentStep->m_travelTimeTotal_ms;
+        m_viObjectiveIDs_Assigned.push_back(costTable.getTaskOptionId(itAssignmentStep->m_taskOptionIndex));
+        m_vehicleTravelTimeTotals_ms[itAssignmentStep->m_vehicleIndex] = itAssignmentStep->m_travelTimeTotal_ms;
+        m_isTaskOptionAssigned[itAssignmentStep->m_taskOptionIndex] = 1;
+        int32_t actionIndex = m_staticAssignmentParameters->m_taskOptionIndexVsActionIndex[itAssignmentStep->m_taskOptionIndex];
+        if (actionIndex >= 0)
+        {
+            uxas::common::utilities::CAlgebra::setBit(m_executedActionBits, actionIndex);
+        }
+        m_vehicleID = vehicleAssignmentState->m_vehicleId;
+        m_taskOptionID = m_viObjectiveIDs_Assigned.back();
+        m_travelTimeTotal_ms = itAssignmentStep->m_travelTimeTotal_ms;
+    }
+    m_isLeafNode = false;
+    m_children.clear();
+}
+
+void c_Node_Base::printStatus(const std::string& Message)
+{
+    double timeSinceStart_s = static_cast<double> (uxas::common::utilities::c_TimeUtilities::getTimeNow_ms() -
+            m_staticAssignmentParameters->m_assignmentStartTime_ms) / 1000.0;
+    UXAS_LOG_INFORM(Message
+                  , "timeSinceStart_s[" , timeSinceStart_s
+                  , "] m_vehicleID[" , m_vehicleID
+                  , "] cost[" , m_staticAssignmentParameters->m_minimumAssignmentCostCandidate.load()
+                  , "] numberNodesVisited[" , m_staticAssignmentParameters->m_numberNodesVisited.load()
+                  , "] numberNodesRemoved[" , m_staticAssignmentParameters->m_numberNodesRemoved.load()
+                  , "] Number Current Nodes[" , (m_staticAssignmentParameters->m_numberNodesVisited.load() - m_staticAssignmentParameters->m_numberNodesRemoved.load())
+                  , "] numberNodesAdded[" , m_staticAssignmentParameters->m_numberNodesAdded.load()
+                  , "] numberNodesPruned[" , m_staticAssignmentParameters->m_numberNodesPruned.load()
+                  , "]" );
+    UXAS_LOG_INFORM_ASSIGNMENT("timeSinceStart_s[", timeSinceStart_s,
+                                  "] cost[", m_staticAssignmentParameters->m_minimumAssignmentCostCandidate.load(),
+                                  "] numberNodesVisited[", m_staticAssignmentParameters->m_numberNodesVisited.load(), "]");
+}
+
+void c_Node_Base::ExpandNode()
+{
+    //////////////////////////////////////////////////////////////////////////////////
+    // check assignment viability and find lower bound on costs of child nodes
+    //////////////////////////////////////////////////////////////////////////////////
+    bool bTaskAvailable = false; //if there are no tasks to do then this is the final assignment node
+
+    // investigate child nodes (compiled algebra, over the assigned task options bitset)
+    const uxas::common::utilities::CAlgebra& algebra = m_staticAssignmentParameters->algebra;
+    algebra.searchNext(m_executedActionBits, m_nextLeafBits, m_nextActionIndices);
+
+    for (auto itActionIndex = m_nextActionIndices.begin(); itActionIndex != m_nextActionIndices.end(); itActionIndex++) // ALGEBRA:: New for loop
+    {
+        bTaskAvailable = true;
+
+        //TODO:: find the prerequsite task
+        int64_t prerequisiteTaskOptionId(-1);
+        //searchPred (const v_action_t &executedAtomicObjectives, int AtomicObjectiveIn)
+
+        int64_t objectiveID = algebra.getActionID(*itActionIndex);
+        int32_t taskOptionIndex = m_staticAssignmentParameters->m_actionIndexVsTaskOptionIndex[*itActionIndex];
+        for (auto itVehicleAssignmentState = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end(); itVehicleAssignmentState++)
+        {
+            NodeAssignment(itVehicleAssignmentState->second, objectiveID, taskOptionIndex, prerequisiteTaskOptionId);
+            if (!itVehicleAssignmentState->second->m_isAcceptingNewAssignments)
+            {
+                UXAS_LOG_INFORM("Vehicle ID[" + std::to_string(itVehicleAssignmentState->first) + "] is finished!");
+            }
+        }
+    } //for(auto itActionIndex = m_nextActionIndices.begin(); itActionIndex != m_nextActionIndices.end(); itActionIndex++)
+
+    if (!m_staticAssignmentParameters->m_isStopCondition && m_children.empty())
+    {
+        // the children, if any, are expanded by the c_BranchBoundSearch
+#ifdef STEVETEST
+        std::cout << std::endl << "<>AssignmentTreeBB:leaf # Previous Assignments[" << m_viObjectiveIDs_Assigned.size() << "]" << std::endl;
+#endif  //#ifdef STEVETEST
+        m_isLeafNode = true;
+        // have all of the tasks been accounted for? (if not, not all of the tasks were assigned)
+        if (!bTaskAvailable)
+        {
+            // check to see if this leaf node is better than the candidate optimal
+            if (m_staticAssignmentParameters->updateCandidate(m_nodeCost, m_searchOrderKey, m_assignmentSteps))
+            {
+                ////////////////  NEW LEAF NODE  ///////////////////////////
+                printStatus("INFO::NEW LEAF: ");
+            }
+        }
+    }
+
+    if (m_staticAssignmentParameters->m_isStopCondition)
+    {
+        // got a stop condition, time to get out
+        if (!m_staticAssignmentParameters->m_isFinalAssignmentCalculated.exchange(true))
+        {
+            //COUT_INFO_MSG("calculateFinalAssignment()!")
+            calculateFinalAssignment();
+        }
+        // dump the children
+        m_children.clear();
+
+    } //if(m_staticAssignmentParameters->m_isStopCondition)
+} //void CNode::ExpandNode(
+
+void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+                                 const int32_t& taskOptionIndex, const int64_t & prerequisiteTaskOptionId)
 {
     if (((m_staticAssignmentParameters->m_numberNodesVisited % 100000) == 0) && (m_staticAssignmentParameters->m_numberNodesVisited > 0))
     {
@@ -932,7 +2062,7 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
 
     if ((m_staticAssignmentParameters->m_numberNodesMaximum >= 0) &&
             (m_staticAssignmentParameters->m_numberNodesVisited >= m_staticAssignmentParameters->m_numberNodesMaximum) &&
-            (m_staticAssignmentParameters->m_numberCompleteAssignments > 0))
+            (m_staticAssignmentParameters->m_numberSearchedAssignments > 0))
     {
         m_staticAssignmentParameters->m_isStopCondition = true;
     }
@@ -944,21 +2074,24 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
     int64_t prerequisiteTime_ms(0);
     if (prerequisiteTaskOptionId > 0)
     {
-        auto itTaskAssignmentState = m_taskIdVsAssignmentState.find(prerequisiteTaskOptionId);
-        if (itTaskAssignmentState != m_taskIdVsAssignmentState.end())
+        int32_t prerequisiteTaskOptionIndex = m_staticAssignmentParameters->m_costTable.getTaskOptionIndex(prerequisiteTaskOptionId);
+        auto itAssignmentStep = std::find_if(m_assignmentSteps.begin(), m_assignmentSteps.end(),
+                                             [&](const c_AssignmentStep& assignmentStep) { return (assignmentStep.m_taskOptionIndex == prerequisiteTaskOptionIndex); });
+        if ((prerequisiteTaskOptionIndex >= 0) && (itAssignmentStep != m_assignmentSteps.end()))
         {
-            prerequisiteTime_ms = itTaskAssignmentState->second->m_taskCompletionTime_ms;
+            prerequisiteTime_ms = itAssignmentStep->m_travelTimeTotal_ms;
         }
         else
         {
 	UXAS_LOG_ERROR("ASSIGNMENT_ERROR:: required prerequisite TaskOptionId[", prerequisiteTaskOptionId, "] not found");
+            std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_reasonsForNoAssignmentMutex);
             m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_ERROR:: required prerequisite TaskOptionId[" << prerequisiteTaskOptionId << "] not found!" << std::endl;
             isError = true;
         }
     }
 
-    auto itVehicleInformation = m_staticAssignmentParameters->m_vehicleIdVsInformation.find(vehicleId);
-    auto itTaskOptionInformation = m_staticAssignmentParameters->m_taskOptionIdVsInformation.find(taskOptionId);
+    const c_AssignmentCostTable& costTable = m_staticAssignmentParameters->m_costTable;
+    int32_t vehicleIndex = vehicleAssignmentState->m_vehicleIndex;
 
     /* NOTE:: local travel time variables
      * taskTime_ms - the time required to perform the task
@@ -970,20 +2103,13 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
      *      to the end of the current task, including all task times.
      * */
     if (!isError &&
-            (itVehicleInformation != m_staticAssignmentParameters->m_vehicleIdVsInformation.end()) &&
-            (itTaskOptionInformation != m_staticAssignmentParameters->m_taskOptionIdVsInformation.end()) &&
+            (vehicleIndex >= 0) &&
+            (taskOptionIndex >= 0) &&
             (vehicleAssignmentState->m_isAcceptingNewAssignments))
     {
-        int64_t taskTime_ms = itTaskOptionInformation->second->getTravelTime_ms(vehicleId);
-        int64_t startingLocationId = vehicleId;
-        if (!vehicleAssignmentState->m_taskAssignments.empty())
-        {
-            auto lastTaskId = vehicleAssignmentState->m_taskAssignments.back()->getTaskID();
-            auto lastOptionId = vehicleAssignmentState->m_taskAssignments.back()->getOptionID();
-            startingLocationId = c_TaskAssignmentState::getTaskAndOptionId(lastTaskId, lastOptionId);
-        }
-        // increment from last task to this one
-        int64_t travelTime_ms = itVehicleInformation->second->getTravelTime_ms(startingLocationId, taskOptionId);
+        int64_t taskTime_ms = costTable.getTaskTime_ms(vehicleIndex, taskOptionIndex);
+        // increment from last task (or the vehicle's starting location) to this one
+        int64_t travelTime_ms = costTable.getTravelTime_ms(vehicleIndex, vehicleAssignmentState->m_locationIndex, taskOptionIndex);
         if (travelTime_ms >= 0)
         {
             // travel from starting location to beginning of this task
@@ -999,71 +2125,59 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
             int64_t travelTimeTotalToEnd_ms = taskTime_ms + travelTime_ms + vehicleAssignmentState->m_travelTimeTotal_ms;
 
             // check vehicle's max travel time parameter
-            int64_t maxVehicleTravelTime_ms = itVehicleInformation->second->m_maxVehicleTravelTime_ms;
+            int64_t maxVehicleTravelTime_ms = costTable.getMaximumTravelTime_ms(vehicleIndex);
 
             if ((maxVehicleTravelTime_ms < 0) || (travelTimeTotalToEnd_ms < maxVehicleTravelTime_ms))
             {
-                // create new child for cost calculation
-                auto newChild = std::unique_ptr<c_Node_Base>(clone());
+                m_staticAssignmentParameters->m_numberNodesVisited++;
                 // calculate assignment cost
                 int64_t nodeCost(INT64_MAX);
                 int64_t evaluationOrderCost(INT64_MAX);
-                newChild->calculateAssignmentCostBase(vehicleAssignmentState, taskOptionId,
-                                                      taskTime_ms, travelTime_ms,
-                                                      nodeCost, evaluationOrderCost);
-                if (nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
+                calculateAssignmentCostBase(vehicleAssignmentState, taskOptionId,
+                                            taskTime_ms, travelTime_ms,
+                                            nodeCost, evaluationOrderCost);
+                calculateLowerBoundBase(vehicleIndex, taskOptionIndex, travelTimeTotalToEnd_ms, nodeCost, evaluationOrderCost);
+                if (m_staticAssignmentParameters->isCandidateImprovement(nodeCost, m_searchOrderKey))
                 {
                     // add new child
-                    newChild->m_nodeCost = nodeCost;
-                    //COUT_INFO_MSG("nodeCost[" << nodeCost << "]")
-                    newChild->m_travelTimeTotal_ms = travelTimeTotalToEnd_ms;
-                    newChild->m_vehicleID = vehicleId;
-                    newChild->m_taskOptionID = taskOptionId;
-                    //tell the algebra function that we have accounted for this objective
-                    newChild->m_viObjectiveIDs_Assigned.push_back(taskOptionId);
-
-                    //////// update the task //////////
-                    if (newChild->m_taskIdVsAssignmentState.find(taskOptionId) == newChild->m_taskIdVsAssignmentState.end())
-                    {
-                        newChild->m_taskIdVsAssignmentState[taskOptionId] = std::unique_ptr<c_TaskAssignmentState>(new c_TaskAssignmentState(taskOptionId));
-                    }
-                    newChild->m_taskIdVsAssignmentState[taskOptionId]->m_taskCompletionTime_ms = travelTimeTotalToEnd_ms;
-                    //////// update the vehicle //////////
-                    newChild->m_vehicleIdVsAssignmentState[vehicleAssignmentState->m_vehicleId]->m_travelTimeTotal_ms = travelTimeTotalToEnd_ms;
-                    // add the assignment
-                    auto taskAssignment = std::unique_ptr<uxas::messages::task::TaskAssignment>(new uxas::messages::task::TaskAssignment());
-                    taskAssignment->setTaskID(c_TaskAssignmentState::getTaskID(taskOptionId));
-                    taskAssignment->setOptionID(c_TaskAssignmentState::getOptionID(taskOptionId));
-                    taskAssignment->setAssignedVehicle(vehicleId);
-                    taskAssignment->setTimeThreshold(prerequisiteTime_ms);
-                    taskAssignment->setTimeTaskCompleted(travelTimeTotalToEnd_ms);
-                    newChild->m_vehicleIdVsAssignmentState[vehicleAssignmentState->m_vehicleId]->m_taskAssignments.push_back(std::move(taskAssignment));
-                    m_costVsChildren.insert(std::pair<int64_t, std::unique_ptr<c_Node_Base> >(evaluationOrderCost, std::move(newChild)));
+                    c_ChildNode childNode;
+                    childNode.m_evaluationOrderCost = evaluationOrderCost;
+                    childNode.m_nodeCost = nodeCost;
+                    childNode.m_assignmentStep.m_vehicleIndex = vehicleIndex;
+                    childNode.m_assignmentStep.m_taskOptionIndex = taskOptionIndex;
+                    childNode.m_assignmentStep.m_timeThreshold_ms = prerequisiteTime_ms;
+                    childNode.m_assignmentStep.m_travelTimeTotal_ms = travelTimeTotalToEnd_ms;
+                    m_children.push_back(childNode);
                     m_staticAssignmentParameters->m_numberNodesAdded++;
                 }
                 else
                 {
-                    newChild.reset();
+                    m_staticAssignmentParameters->m_numberNodesRemoved++;
                 }
             }
             else
             {
+                std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_reasonsForNoAssignmentMutex);
                 m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_WARNING:: Vehicle[" << vehicleId << "] exceeded travel time[" << maxVehicleTravelTime_ms << "]!" << std::endl;
             }
         }
         else //if (travelTime_ms > 0)
         {
             //UXAS_LOG_WARN("ASSIGNMENT_WARNING:: No TravelTime_ms[", startingLocationId, ",", taskOptionId, "] found.");
+            std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_reasonsForNoAssignmentMutex);
+            int64_t startingLocationId = (vehicleAssignmentState->m_locationIndex > 0) ?
+                    (costTable.getTaskOptionId(vehicleAssignmentState->m_locationIndex - 1)) : (vehicleId);
             m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_WARNING:: No TravelTime_ms[" << startingLocationId << "," << taskOptionId << "] found.!" << std::endl;
         } //if (travelTime_ms > 0)
     }
     else //if ( !isError && (itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end()) &&  ... 
     {
-        if (itVehicleInformation == m_staticAssignmentParameters->m_vehicleIdVsInformation.end())
+        std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_reasonsForNoAssignmentMutex);
+        if (vehicleIndex < 0)
         {
             m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_ERROR:: could not find information for VehilceId[" << vehicleId << "]!" << std::endl;
         }
-        if (itTaskOptionInformation == m_staticAssignmentParameters->m_taskOptionIdVsInformation.end())
+        if (taskOptionIndex < 0)
         {
             m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_ERROR:: could not find information for TaskOptionId[" << taskOptionId << "]!" << std::endl;
         }
@@ -1078,7 +2192,7 @@ void c_Node_Base::calculateAssignmentCostBase(std::unique_ptr<c_VehicleAssignmen
     evaluationOrderCost = MAX_COST_MS;
 
 #ifdef AFRL_INTERNAL_ENABLED
-    switch (m_assignmentType)
+    switch (m_staticAssignmentParameters->m_assignmentType)
     {
         default:
 //COUT_FILE_LINE_MSG("")
@@ -1136,5 +2250,267 @@ void c_Node_Base::calculateAssignmentCostBase(std::unique_ptr<c_VehicleAssignmen
 #endif
 }
 
+void c_Node_Base::calculateLowerBoundBase(const int32_t& vehicleIndex, const int32_t& taskOptionIndex, const int64_t& travelTimeTotal_ms,
+                                          int64_t& nodeCost, int64_t& evaluationOrderCost)
+{
+    const c_AssignmentLowerBound& lowerBound = m_staticAssignmentParameters->m_lowerBound;
+    if (!lowerBound.isEnabled())
+    {
+        return;
+    }
+
+    // the state of the child
+    int64_t travelTimeTotalParent_ms = m_vehicleTravelTimeTotals_ms[vehicleIndex];
+    m_vehicleTravelTimeTotals_ms[vehicleIndex] = travelTimeTotal_ms;
+    m_isTaskOptionAssigned[taskOptionIndex] = 1;
+
+    int64_t costLowerBound(nodeCost);
+#ifdef AFRL_INTERNAL_ENABLED
+    switch (m_staticAssignmentParameters->m_assignmentType)
+    {
+        default:
+            // no lower bound for cost functions implemented by children classes
+            break;
+        case uxas::project::pisr::AssignmentType::MinMaxTime:
+            costLowerBound = lowerBound.getMinMaxLowerBound(m_vehicleTravelTimeTotals_ms, m_isTaskOptionAssigned);
+            break;
+        case uxas::project::pisr::AssignmentType::MinCumlativeTime:
+            costLowerBound = lowerBound.getCumulativeLowerBound(m_vehicleTravelTimeTotals_ms, m_isTaskOptionAssigned);
+            break;
+    }
+#else
+    // MINMAX
+    costLowerBound = lowerBound.getMinMaxLowerBound(m_vehicleTravelTimeTotals_ms, m_isTaskOptionAssigned);
+#endif
+
+    m_vehicleTravelTimeTotals_ms[vehicleIndex] = travelTimeTotalParent_ms;
+    m_isTaskOptionAssigned[taskOptionIndex] = 0;
+
+    if (costLowerBound > nodeCost)
+    {
+        // for the implemented cost functions, the evaluation order cost is the node cost
+        nodeCost = costLowerBound;
+        evaluationOrderCost = costLowerBound;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+c_BranchBoundSearch::c_BranchBoundSearch(const uint32_t& numberThreads)
+{
+    for (uint32_t threadIndex = 0; threadIndex < std::max(1u, numberThreads); threadIndex++)
+    {
+        m_nodeStacks.push_back(std::unique_ptr<c_NodeStack>(new c_NodeStack));
+        m_searchNodeArenas.push_back(std::unique_ptr<c_SearchNodeArena>(new c_SearchNodeArena));
+    }
+}
+
+void c_BranchBoundSearch::search(c_Node_Base& rootNode, const CandidateUpdateFunction& candidateUpdateFunction)
+{
+    m_staticAssignmentParameters = rootNode.m_staticAssignmentParameters;
+    for (uint32_t threadIndex = 0; threadIndex < m_nodeStacks.size(); threadIndex++)
+    {
+        m_nodes.push_back(rootNode.clone());
+    }
+
+    // the trunk is counted as visited by the caller
+    c_SearchNode* rootSearchNode = m_searchNodeArenas[0]->allocate();
+    rootSearchNode->m_referenceCount = 1;
+    m_numberPendingNodes = 1;
+    m_nodeStacks[0]->m_nodes.push_back(rootSearchNode);
+
+    // the calling thread is search thread 0
+    std::vector<std::thread> searchThreads;
+    for (uint32_t threadIndex = 1; threadIndex < m_nodeStacks.size(); threadIndex++)
+    {
+        searchThreads.push_back(std::thread(&c_BranchBoundSearch::executeSearch, this, threadIndex, CandidateUpdateFunction()));
+    }
+    executeSearch(0, candidateUpdateFunction);
+    for (auto& searchThread : searchThreads)
+    {
+        searchThread.join();
+    }
+}
+
+void c_BranchBoundSearch::executeSearch(const uint32_t& threadIndex, const CandidateUpdateFunction& candidateUpdateFunction)
+{
+    c_SearchNode* searchNode(nullptr);
+    // each thread checks the time budget, every 16 of its own expanded nodes
+    uint32_t numberNodesExpanded(0);
+    while (m_numberPendingNodes > 0)
+    {
+        if ((m_staticAssignmentParameters->m_timeBudget_ms > 0) &&
+                ((numberNodesExpanded % 16) == 0) &&
+                (m_staticAssignmentParameters->m_numberCompleteAssignments > 0) &&
+                (std::chrono::steady_clock::now() >= m_staticAssignmentParameters->m_searchDeadline))
+        {
+            // out of time, the incumbent is the assignment
+            m_staticAssignmentParameters->m_isStopCondition = true;
+        }
+        if (candidateUpdateFunction && !m_staticAssignmentParameters->isSearchStopped() &&
+                m_staticAssignmentParameters->m_isCandidateUpdated.exchange(false))
+        {
+            candidateUpdateFunction(getLowerBound());
+        }
+        // read before looking for nodes, so nodes pushed after the (failed) look end the wait
+        uint64_t workGeneration = m_workGeneration;
+        if (isPopNode(threadIndex, searchNode))
+        {
+            expandNode(threadIndex, searchNode);
+            releaseNode(threadIndex, searchNode);
+            numberNodesExpanded++;
+            m_nodeStacks[threadIndex]->m_expandingNodeCost = INT64_MAX;
+            // decrement after the children have been pushed, so zero implies the search is complete
+            if (--m_numberPendingNodes == 0)
+            {
+                notifyWorkAvailable();
+            }
+        }
+        else
+        {
+            // the nodes are being expanded by other threads - wait for them to push children
+            m_numberIdleThreads++;
+            {
+                std::unique_lock<std::mutex> lock(m_idleMutex);
+                auto isWorkAvailable = [this, workGeneration] { return (m_workGeneration != workGeneration || m_numberPendingNodes == 0); };
+                if (candidateUpdateFunction)
+                {
+                    // the calling thread also reports candidates found by the other threads
+                    m_workAvailable.wait_for(lock, std::chrono::milliseconds(10), isWorkAvailable);
+                }
+                else
+                {
+                    m_workAvailable.wait(lock, isWorkAvailable);
+                }
+            }
+            m_numberIdleThreads--;
+        }
+    }
+}
+
+void c_BranchBoundSearch::notifyWorkAvailable()
+{
+    m_workGeneration++;
+    if (m_numberIdleThreads > 0)
+    {
+        // lock, so a thread cannot miss the notification between checking for work and waiting
+        {
+            std::lock_guard<std::mutex> lock(m_idleMutex);
+        }
+        m_workAvailable.notify_all();
+    }
+}
+
+bool c_BranchBoundSearch::isPopNode(const uint32_t& threadIndex, c_SearchNode*& searchNode)
+{
+    {
+        // depth-first: take the most recently pushed (lowest evaluation order cost) node
+        c_NodeStack& nodeStack = *m_nodeStacks[threadIndex];
+        std::lock_guard<std::mutex> lock(nodeStack.m_mutex);
+        if (!nodeStack.m_nodes.empty())
+        {
+            searchNode = nodeStack.m_nodes.back();
+            nodeStack.m_nodes.pop_back();
+            // while the stack is locked, so the node is always accounted for in the lower bound
+            nodeStack.m_expandingNodeCost = searchNode->m_nodeCost;
+            return (true);
+        }
+    }
+    // steal the node closest to the trunk (largest remaining subtree) from another thread
+    for (uint32_t offset = 1; offset < m_nodeStacks.size(); offset++)
+    {
+        c_NodeStack& nodeStack = *m_nodeStacks[(threadIndex + offset) % m_nodeStacks.size()];
+        std::lock_guard<std::mutex> lock(nodeStack.m_mutex);
+        if (!nodeStack.m_nodes.empty())
+        {
+            searchNode = nodeStack.m_nodes.front();
+            nodeStack.m_nodes.pop_front();
+            m_nodeStacks[threadIndex]->m_expandingNodeCost = searchNode->m_nodeCost;
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void c_BranchBoundSearch::expandNode(const uint32_t& threadIndex, c_SearchNode* searchNode)
+{
+    // other threads may have found lower costs or a stop condition
+    if (!m_staticAssignmentParameters->isSearchStopped())
+    {
+        c_Node_Base& node = *m_nodes[threadIndex];
+        node.loadNode(searchNode);
+        if (m_staticAssignmentParameters->isCandidateImprovement(node.m_nodeCost, node.m_searchOrderKey))
+        {
+            node.ExpandNode();
+            pushChildren(threadIndex, searchNode, node);
+            return;
+        }
+    }
+    m_staticAssignmentParameters->m_numberNodesPruned++;
+}
+
+void c_BranchBoundSearch::pushChildren(const uint32_t& threadIndex, c_SearchNode* parentSearchNode, c_Node_Base& parentNode)
+{
+    if (parentNode.m_children.empty())
+    {
+        return;
+    }
+    // equal costs are expanded in the order they were found
+    std::stable_sort(parentNode.m_children.begin(), parentNode.m_children.end(),
+                     [](const c_Node_Base::c_ChildNode& lhs, const c_Node_Base::c_ChildNode& rhs) { return (lhs.m_evaluationOrderCost < rhs.m_evaluationOrderCost); });
+    // the children reference the parent, before the parent's own reference is released
+    parentSearchNode->m_referenceCount += static_cast<uint32_t>(parentNode.m_children.size());
+    m_numberPendingNodes += static_cast<int64_t>(parentNode.m_children.size());
+    {
+        // push in reverse order, so the lowest evaluation order cost child is expanded first
+        c_NodeStack& nodeStack = *m_nodeStacks[threadIndex];
+        std::lock_guard<std::mutex> lock(nodeStack.m_mutex);
+        uint32_t rank = static_cast<uint32_t>(parentNode.m_children.size());
+        for (auto itChild = parentNode.m_children.rbegin(); itChild != parentNode.m_children.rend(); itChild++)
+        {
+            c_SearchNode* childSearchNode = m_searchNodeArenas[threadIndex]->allocate();
+            childSearchNode->m_parent = parentSearchNode;
+            childSearchNode->m_assignmentStep = itChild->m_assignmentStep;
+            childSearchNode->m_nodeCost = itChild->m_nodeCost;
+            childSearchNode->m_searchOrderRank = --rank;
+            childSearchNode->m_referenceCount = 1;
+            nodeStack.m_nodes.push_back(childSearchNode);
+        }
+    }
+    parentNode.m_children.clear();
+    notifyWorkAvailable();
+}
+
+void c_BranchBoundSearch::releaseNode(const uint32_t& threadIndex, c_SearchNode* searchNode)
+{
+    while ((searchNode != nullptr) && (--searchNode->m_referenceCount == 0))
+    {
+        c_SearchNode* parentSearchNode = searchNode->m_parent;
+        m_searchNodeArenas[threadIndex]->release(searchNode);
+        m_staticAssignmentParameters->m_numberNodesRemoved++;
+        searchNode = parentSearchNode;
+    }
+}
+
+int64_t c_BranchBoundSearch::getLowerBound()
+{
+    // lock all of the stacks, so no node is moved while the costs are read
+    std::vector< std::unique_lock<std::mutex> > locks;
+    for (auto itNodeStack = m_nodeStacks.begin(); itNodeStack != m_nodeStacks.end(); itNodeStack++)
+    {
+        locks.push_back(std::unique_lock<std::mutex>((*itNodeStack)->m_mutex));
+    }
+    int64_t lowerBound = m_staticAssignmentParameters->m_minimumAssignmentCostCandidate;
+    for (auto itNodeStack = m_nodeStacks.begin(); itNodeStack != m_nodeStacks.end(); itNodeStack++)
+    {
+        lowerBound = std::min(lowerBound, (*itNodeStack)->m_expandingNodeCost.load());
+        for (auto itSearchNode = (*itNodeStack)->m_nodes.begin(); itSearchNode != (*itNodeStack)->m_nodes.end(); itSearchNode++)
+        {
+            lowerBound = std::min(lowerBound, (*itSearchNode)->m_nodeCost);
+        }
+    }
+    return (lowerBound);
+}
+
 }; //namespace service
 }; //namespace uxas
@@ -30,8 +30,18 @@
 #include "uxas/project/pisr/AssignmentType.h"
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint> // int64_t
+#include <deque>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #define MAX_COST_MS (INT64_MAX / 10000)
 
@@ -42,42 +52,69 @@ namespace service
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-class c_VehicleInformationStatic
+/*! \class c_AssignmentCostTable
+ *  \brief The travel and task times of one request, compiled once from the 
+ * AssignmentCostMatrix and TaskPlanOptions into dense per-vehicle arrays, indexed
+ * by compact vehicle and task option indices, so the search only does array loads.
+ * 
+ * Location index 0 is the starting location of a vehicle, location index 
+ * (task option index + 1) is the end of that task option (see getLocationIndex).
+ */
+class c_AssignmentCostTable
 {
 public:
-    c_VehicleInformationStatic(const int64_t& vehicleId);
-    virtual ~c_VehicleInformationStatic() { };
+    c_AssignmentCostTable() { };
+    virtual ~c_AssignmentCostTable() { };
 public:
-    int64_t getTravelTime_ms(const int64_t& fromId, const int64_t& toId);
-    /*! \brief  vehicle specific costs for shortest paths*/
-    std::unordered_map<int64_t, std::unique_ptr<std::unordered_map<int64_t, int64_t>>> m_FromIdVsToIdVsTravelTime;
-    /*! \brief  this is the maximum mission travel time (ms), -1 -> no maximum travel time*/
-    int64_t m_maxVehicleTravelTime_ms = {-1};
-protected:
-    /*! \brief  vehicle ID*/
-    int64_t m_vehicleId = {0};
-private:
-    /*! @name Private: No Copying*/
-    c_VehicleInformationStatic(const c_VehicleInformationStatic& rhs) = delete; //no copying
-    c_VehicleInformationStatic operator=(const c_VehicleInformationStatic&) = delete; //no copying
-};
-///////////////////////////////////////////////////////////////////////////////////////////////////
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
+    /*! \brief  allocates the tables (times not found are -1) and the ID to index lookups*/
+    void initialize(const std::vector<int64_t>& vehicleIds, const std::vector<int64_t>& taskOptionIds);
+    /*! \brief  returns the index of the vehicle, -1 -> not found*/
+    int32_t getVehicleIndex(const int64_t& vehicleId) const;
+    /*! \brief  returns the index of the task option, -1 -> not found*/
+    int32_t getTaskOptionIndex(const int64_t& taskOptionId) const;
+    int64_t getVehicleId(const int32_t& vehicleIndex) const { return (m_vehicleIds[vehicleIndex]); };
+    int64_t getTaskOptionId(const int32_t& taskOptionIndex) const { return (m_taskOptionIds[taskOptionIndex]); };
+    size_t getNumberVehicles() const { return (m_vehicleIds.size()); };
+    size_t getNumberTaskOptions() const { return (m_taskOptionIds.size()); };
+    static int32_t getLocationIndex(const int32_t& taskOptionIndex) { return (taskOptionIndex + 1); };
+
+    /*! \brief  travel time from the location to the beginning of the task option, -1 -> not found*/
+    int64_t getTravelTime_ms(const int32_t& vehicleIndex, const int32_t& fromLocationIndex, const int32_t& toTaskOptionIndex) const
+    {
+        return (m_travelTimes_ms[(static_cast<size_t>(vehicleIndex) * (m_taskOptionIds.size() + 1) + fromLocationIndex) * m_taskOptionIds.size() + toTaskOptionIndex]);
+    };
+    void setTravelTime_ms(const int32_t& vehicleIndex, const int32_t& fromLocationIndex, const int32_t& toTaskOptionIndex, const int64_t& travelTime_ms)
+    {
+        m_travelTimes_ms[(static_cast<size_t>(vehicleIndex) * (m_taskOptionIds.size() + 1) + fromLocationIndex) * m_taskOptionIds.size() + toTaskOptionIndex] = travelTime_ms;
+    };
+    /*! \brief  time required for the vehicle to perform the task option, -1 -> vehicle not eligible*/
+    int64_t getTaskTime_ms(const int32_t& vehicleIndex, const int32_t& taskOptionIndex) const
+    {
+        return (m_taskTimes_ms[static_cast<size_t>(vehicleIndex) * m_taskOptionIds.size() + taskOptionIndex]);
+    };
+    void setTaskTime_ms(const int32_t& vehicleIndex, const int32_t& taskOptionIndex, const int64_t& taskTime_ms)
+    {
+        m_taskTimes_ms[static_cast<size_t>(vehicleIndex) * m_taskOptionIds.size() + taskOptionIndex] = taskTime_ms;
+    };
+    /*! \brief  maximum mission travel time (ms) of the vehicle, -1 -> no maximum travel time*/
+    int64_t getMaximumTravelTime_ms(const int32_t& vehicleIndex) const { return (m_maximumTravelTimes_ms[vehicleIndex]); };
+    void setMaximumTravelTime_ms(const int32_t& vehicleIndex, const int64_t& maximumTravelTime_ms) { m_maximumTravelTimes_ms[vehicleIndex] = maximumTravelTime_ms; };
 
-class c_TaskInformationStatic
-{
-public:
-    c_TaskInformationStatic();
-    virtual ~c_TaskInformationStatic() { };
-public:
-    int64_t getTravelTime_ms(const int64_t& VehicleId);
-    /*! \brief  the task cost for each vehicle*/
-    std::unordered_map<int64_t, int64_t> m_VehicleIdVsTaskTravelTime;
+protected:
+    std::vector<int64_t> m_vehicleIds;
+    std::vector<int64_t> m_taskOptionIds;
+    std::unordered_map<int64_t, int32_t> m_vehicleIdVsIndex;
+    std::unordered_map<int64_t, int32_t> m_taskOptionIdVsIndex;
+    /*! \brief  [vehicle][from location][to task option]*/
+    std::vector<int64_t> m_travelTimes_ms;
+    /*! \brief  [vehicle][task option]*/
+    std::vector<int64_t> m_taskTimes_ms;
+    /*! \brief  [vehicle]*/
+    std::vector<int64_t> m_maximumTravelTimes_ms;
 private:
     /*! @name Private: No Copying*/
-    c_TaskInformationStatic(const c_TaskInformationStatic& rhs) = delete; //no copying
-    c_TaskInformationStatic operator=(const c_TaskInformationStatic&) = delete; //no copying
+    c_AssignmentCostTable(const c_AssignmentCostTable& rhs) = delete; //no copying
+    c_AssignmentCostTable operator=(const c_AssignmentCostTable&) = delete; //no copying
 };
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -92,19 +129,12 @@ public:
 
     std::unique_ptr<c_VehicleAssignmentState> clone();
 
-public:
-
-    int64_t getLastTaskId() {
-        int64_t lastTaskId(m_vehicleId); // if no assignments then the initial vehicle position is the last task
-        if (!m_taskAssignments.empty()) {
-            lastTaskId = m_taskAssignments.back()->getTaskID();
-        }
-        return (lastTaskId);
-    }
 public:
     int64_t m_vehicleId = {0};
-    /*! \brief  ordered list of task assignments for this vehicle*/
-    std::vector<std::unique_ptr<uxas::messages::task::TaskAssignment>> m_taskAssignments;
+    /*! \brief  index of this vehicle in the c_AssignmentCostTable*/
+    int32_t m_vehicleIndex = {-1};
+    /*! \brief  c_AssignmentCostTable location index of the end of the last assigned task (0 -> starting location)*/
+    int32_t m_locationIndex = {0};
     /*! \brief  only add new assignments if this flag is set. .e.g False if max range reached*/
     bool m_isAcceptingNewAssignments = true;
     /*! \brief  this is the sum of the travel times of the current assignments including
@@ -120,6 +150,151 @@ private:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*! \class c_AssignmentStep
+ *  \brief The assignment of one task option to a vehicle, i.e. the difference 
+ * between a node of the search tree and its parent.
+ */
+class c_AssignmentStep
+{
+public:
+    /*! \brief  c_AssignmentCostTable index of the vehicle*/
+    int32_t m_vehicleIndex = {-1};
+    /*! \brief  c_AssignmentCostTable index of the task option*/
+    int32_t m_taskOptionIndex = {-1};
+    /*! \brief  the task option is not started before this time (prerequisites)*/
+    int64_t m_timeThreshold_ms = {0};
+    /*! \brief  total travel time of the vehicle to the end of the task option*/
+    int64_t m_travelTimeTotal_ms = {0};
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*! \class c_SearchNode
+ *  \brief A node of the assignment search tree, stored as its parent and the 
+ * assignment step from the parent. The state of the node is reconstructed by 
+ * replaying the steps from the trunk (see c_Node_Base::loadNode). 
+ * 
+ * Nodes are reference counted: one reference while the node is waiting to be 
+ * expanded and one per child, so parents are kept as long as their descendants.
+ */
+class c_SearchNode
+{
+public:
+    /*! \brief  parent node (nullptr for the trunk). Next free node, while in the free list of a c_SearchNodeArena*/
+    c_SearchNode* m_parent = {nullptr};
+    c_AssignmentStep m_assignmentStep;
+    int64_t m_nodeCost = {0};
+    /*! \brief  rank of this node among its siblings (see c_Node_Base::m_searchOrderKey)*/
+    uint32_t m_searchOrderRank = {0};
+    std::atomic<uint32_t> m_referenceCount = {0};
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*! \class c_SearchNodeArena
+ *  \brief Allocates search nodes from blocks, reusing released nodes. The blocks
+ * are freed in bulk when the arena is destroyed, at the end of the search. 
+ * 
+ * Each search thread has its own arena; nodes may be released to a different 
+ * arena than the one they were allocated from.
+ */
+class c_SearchNodeArena
+{
+public:
+    c_SearchNodeArena() { };
+    virtual ~c_SearchNodeArena() { };
+public:
+    /*! \brief  returns a node with default values*/
+    c_SearchNode* allocate();
+    /*! \brief  returns the node to the free list*/
+    void release(c_SearchNode* searchNode);
+private:
+    /*! \brief  number of nodes per block*/
+    static const size_t s_blockSize = 4096;
+    std::vector< std::unique_ptr<c_SearchNode[]> > m_blocks;
+    /*! \brief  number of nodes of the last block that have been allocated*/
+    size_t m_numberBlockNodesAllocated = {s_blockSize};
+    c_SearchNode* m_freeNodes = {nullptr};
+private:
+    /*! @name Private: No Copying*/
+    c_SearchNodeArena(const c_SearchNodeArena& rhs) = delete; //no copying
+    c_SearchNodeArena& operator=(const c_SearchNodeArena&) = delete; //no copying
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*! \class c_AssignmentLowerBound
+ *  \brief Lower bounds on the cost of any complete assignment that extends a
+ * partial assignment, used to prune the search tree and to order the children.
+ * 
+ * The remaining work is evaluated over the compiled task relationship (algebra) 
+ * tree: all of the branches of sequential and parallel operators are required, only
+ * one of the branches of an alternative operator (the started one, if any). The work 
+ * of a task option is its cheapest incoming travel time plus task time, shared among
+ * the leaves of the task option, since one assignment can satisfy all of them.
+ *  - MINIMUM_INCOMING - the cost cannot be less than the cheapest completion time 
+ *    of any remaining task (MINMAX) or the sum of the remaining work (CUMULATIVE).
+ *  - LOAD_BALANCE - MINIMUM_INCOMING and, for MINMAX, the vehicles' travel times 
+ *    plus the remaining work, shared evenly among the vehicles.
+ */
+class c_AssignmentLowerBound
+{
+public:
+
+    enum class LowerBoundType
+    {
+        NONE,
+        MINIMUM_INCOMING,
+        LOAD_BALANCE
+    };
+public:
+    c_AssignmentLowerBound() { };
+    virtual ~c_AssignmentLowerBound() { };
+public:
+    /*! \brief  calculates the minimum work of each task option and algebra leaf. The algebra
+     * must outlive the lower bound.*/
+    void initialize(const LowerBoundType& lowerBoundType, const uxas::common::utilities::CAlgebra& algebra,
+                    const std::vector<int32_t>& actionIndexVsTaskOptionIndex, const c_AssignmentCostTable& costTable);
+    bool isEnabled() const { return ((m_lowerBoundType != LowerBoundType::NONE) && (m_algebra != nullptr)); };
+    /*! \brief  lower bound on the maximum of the vehicles' travel times*/
+    int64_t getMinMaxLowerBound(const std::vector<int64_t>& vehicleTravelTimeTotals_ms, const std::vector<uint8_t>& isTaskOptionAssigned) const;
+    /*! \brief  lower bound on the sum of the vehicles' travel times*/
+    int64_t getCumulativeLowerBound(const std::vector<int64_t>& vehicleTravelTimeTotals_ms, const std::vector<uint8_t>& isTaskOptionAssigned) const;
+
+private:
+    /*! \brief  minimum remaining work below the compiled algebra node (sum over required branches)*/
+    int64_t getRemainingWork_ms(const int& compiledNodeNo, const std::vector<uint8_t>& isTaskOptionAssigned, bool& isStarted) const;
+    /*! \brief  minimum completion time of the latest remaining task below the compiled algebra node*/
+    int64_t getLatestCompletion_ms(const int& compiledNodeNo, const std::vector<int64_t>& vehicleTravelTimeTotals_ms,
+                                   const std::vector<uint8_t>& isTaskOptionAssigned, bool& isStarted) const;
+
+    LowerBoundType m_lowerBoundType = {LowerBoundType::NONE};
+    size_t m_numberVehicles = {0};
+    size_t m_numberTaskOptions = {0};
+    /*! \brief  the compiled algebra tree (nullptr -> disabled)*/
+    const uxas::common::utilities::CAlgebra* m_algebra = {nullptr};
+    /*! \brief  [algebra leaf] task option (-1 -> not a requested task option)*/
+    std::vector<int32_t> m_leafTaskOptionIndices;
+    /*! \brief  [algebra leaf] minimum work of the task option, divided among its leaves*/
+    std::vector<int64_t> m_leafMinimumWork_ms;
+    /*! \brief  [vehicle][task option] minimum work (-1 -> vehicle cannot perform it)*/
+    std::vector<int64_t> m_minimumVehicleWork_ms;
+private:
+    /*! @name Private: No Copying*/
+    c_AssignmentLowerBound(const c_AssignmentLowerBound& rhs) = delete; //no copying
+    c_AssignmentLowerBound operator=(const c_AssignmentLowerBound&) = delete; //no copying
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*! \class c_StaticAssignmentParameters
+ *  \brief The inputs and shared search state of one assignment request. Each 
+ * request owns its own instance, so requests can be searched concurrently.
+ */
 class c_StaticAssignmentParameters
 {
 public:
@@ -136,28 +311,83 @@ public:
     virtual ~c_StaticAssignmentParameters() { };
 
 public:
-    std::unordered_map<int64_t, std::unique_ptr<c_VehicleInformationStatic>> m_vehicleIdVsInformation;
-    std::unordered_map<int64_t, std::unique_ptr<c_TaskInformationStatic>> m_taskOptionIdVsInformation;
-    int64_t m_minimumAssignmentCostCandidate = {INT64_MAX};
+    /*! \brief  travel and task times of the request*/
+    c_AssignmentCostTable m_costTable;
+    /*! \brief  lower bound on the cost of completing a partial assignment*/
+    c_AssignmentLowerBound m_lowerBound;
+    /*! \brief  cost of the best (incumbent) complete assignment, shared by all search threads for pruning*/
+    std::atomic<int64_t> m_minimumAssignmentCostCandidate = {INT64_MAX};
     int64_t m_minimumAssignmentTravelTimeCandidate_ms = {INT64_MAX};
-    int64_t m_numberNodesVisited = {0};
-    int64_t m_numberNodesAdded = {0};
-    int64_t m_numberNodesPruned = {0};
-    int64_t m_numberNodesRemoved = {0};
-    int64_t m_numberCompleteAssignments = {0};
+    std::atomic<int64_t> m_numberNodesVisited = {0};
+    std::atomic<int64_t> m_numberNodesAdded = {0};
+    std::atomic<int64_t> m_numberNodesPruned = {0};
+    std::atomic<int64_t> m_numberNodesRemoved = {0};
+    /*! \brief  number of incumbents, including a warm start*/
+    std::atomic<int64_t> m_numberCompleteAssignments = {0};
+    /*! \brief  number of incumbents found by the tree search (NumberNodesMaximum waits for one)*/
+    std::atomic<int64_t> m_numberSearchedAssignments = {0};
 
     uxas::common::utilities::CAlgebra algebra; // ALGEBRA:: Algebra class definition
+    /*! \brief  c_AssignmentCostTable task option index of each algebra action index (-1 -> not a requested task option)*/
+    std::vector<int32_t> m_actionIndexVsTaskOptionIndex;
+    /*! \brief  algebra action index of each c_AssignmentCostTable task option index (-1 -> not in the algebra)*/
+    std::vector<int32_t> m_taskOptionIndexVsActionIndex;
 
-    bool m_isStopCondition = {false};
+    std::atomic<bool> m_isStopCondition = {false};
 
     int64_t m_numberNodesMaximum = {0};  // default to best-first search
     CostFunction m_CostFunction = {CostFunction::MINMAX};
     int64_t m_assignmentStartTime_ms = {0};
+    /*! \brief  the search stops at m_searchDeadline once an assignment has been found (0 -> no time budget)*/
+    int64_t m_timeBudget_ms = {0};
+    std::chrono::steady_clock::time_point m_searchDeadline;
+    /*! \brief  duration of the tree search, without compiling the inputs or refining the assignment*/
+    std::chrono::steady_clock::duration m_searchDuration{0};
+    /*! \brief  number of threads used to search the assignment tree*/
+    uint32_t m_numberSearchThreads = {1};
+    /*! \brief  set if the request was superseded (or the service is terminating), the search is abandoned*/
+    std::atomic<bool> m_isCancelled = {false};
+    /*! \brief  this flag controls calling the calculateFinalAssignment function only once */
+    std::atomic<bool> m_isFinalAssignmentCalculated = {false};
+#ifdef AFRL_INTERNAL_ENABLED
+    /*! \brief  this is used to determine the type of cost calculation to call */
+    uxas::project::pisr::AssignmentType::AssignmentType m_assignmentType{uxas::project::pisr::AssignmentType::MinMaxTime};
+#endif
 
     std::stringstream m_reasonsForNoAssignment;
+    /*! \brief  guards m_reasonsForNoAssignment*/
+    std::mutex m_reasonsForNoAssignmentMutex;
     
-    /*! \brief  these are vehicle assignment parameters that do change during the assignment*/
-    std::unordered_map<int64_t, std::unique_ptr< c_VehicleAssignmentState> > m_candidateVehicleIdVsAssignmentState;
+    /*! \brief  assignment steps of the incumbent assignment, from the trunk to the leaf*/
+    std::vector<c_AssignmentStep> m_candidateAssignmentSteps;
+    /*! \brief  search order key of the incumbent assignment (see c_Node_Base::m_searchOrderKey)*/
+    std::vector<uint32_t> m_candidateSearchOrderKey;
+    /*! \brief  guards the incumbent assignment (candidate state and search order key)*/
+    std::mutex m_candidateMutex;
+    /*! \brief  set when the incumbent assignment is replaced, cleared when it is reported*/
+    std::atomic<bool> m_isCandidateUpdated = {false};
+    /*! \brief  times (c_TimeUtilities::getTimeNow_ms) the first and the incumbent assignments were found, 0 -> not found*/
+    int64_t m_firstAssignmentTime_ms = {0};
+    int64_t m_candidateTime_ms = {0};
+
+public:
+    /*! \brief  maps the algebra action indices to the cost table task option indices, 
+     * called once the algebra and the cost table have been initialized*/
+    void initializeActionIndices();
+    /*! \brief  true if the search should end, i.e. stop condition or cancellation*/
+    bool isSearchStopped() const { return (m_isStopCondition || m_isCancelled); };
+    /*! \brief  returns false if no descendant of a node with the given cost and 
+     * search order key can replace the incumbent assignment, i.e. the node can be pruned*/
+    bool isCandidateImprovement(const int64_t& nodeCost, const std::vector<uint32_t>& searchOrderKey);
+    /*! \brief  replaces the incumbent with the complete assignment if it has a lower cost 
+     * or, for equal costs, an earlier search order key (deterministic tie-breaking)*/
+    bool updateCandidate(const int64_t& nodeCost, const std::vector<uint32_t>& searchOrderKey,
+                         const std::vector<c_AssignmentStep>& assignmentSteps);
+    /*! \brief  records the time the incumbent was replaced (call with m_candidateMutex locked)*/
+    void setCandidateTime();
+    /*! \brief  creates the task assignments of the incumbent assignment, grouped by vehicle in task order, 
+     * and returns its cost (read under the same lock, so both are of the same incumbent)*/
+    int64_t getCandidateTaskAssignments(std::vector<uxas::messages::task::TaskAssignment*>& taskAssignments);
 
 private:
     /*! @name Private: No Copying*/
@@ -168,6 +398,71 @@ private:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*! \class c_AssignmentRefinement
+ *  \brief Local search improvement of the incumbent assignment of a search that 
+ * was stopped before it was complete (node limit or time budget).
+ * 
+ * The assignment is represented by the sequence of task options of each vehicle. 
+ * The moves are 2-opt (segment reversal) within a vehicle, relocate and swap 
+ * between vehicles, and ruin and recreate (removal of random task options and 
+ * cheapest reinsertion of any of the options of their tasks). Moves that do not increase the cost (ties are broken by
+ * the total travel time) are accepted if the assignments can be ordered as 
+ * the task relationships (algebra) require, i.e. if the search tree contains 
+ * the resulting assignment. The random number generator has a fixed seed, so the 
+ * refinement is repeatable for a given number of iterations.
+ */
+class c_AssignmentRefinement
+{
+public:
+    c_AssignmentRefinement(c_StaticAssignmentParameters* staticAssignmentParameters);
+    virtual ~c_AssignmentRefinement() { };
+public:
+    /*! \brief  improves the incumbent assignment until the deadline (or cancellation), 
+     * returns true if the incumbent was replaced*/
+    bool refine(const std::chrono::steady_clock::time_point& deadline);
+    /*! \brief  sets the incumbent assignment to the vehicles' previous task options (warm start), 
+     * repaired for the current vehicles and task options: task options that are no longer 
+     * requested are dropped, missing ones are added where they are completed first. 
+     * Returns false if the assignment could not be repaired.*/
+    bool isWarmStarted(const std::unordered_map<int64_t, std::vector<int64_t> >& vehicleIdVsPreviousTaskOptionIds);
+private:
+    /*! \brief  false if the cost function is implemented by a child class (cannot be evaluated)*/
+    bool isCostFunctionSupported() const;
+    /*! \brief  finds the options of the task of each task option (m_taskOptionIndicesOfTask)*/
+    void initializeTaskOptionsOfTask();
+    /*! \brief  travel time to the end of the last task option of the vehicle, -1 -> infeasible*/
+    int64_t getVehicleTravelTime_ms(const int32_t& vehicleIndex, const std::vector<int32_t>& taskOptionIndices) const;
+    /*! \brief  assignment cost and total travel time, returns false if any vehicle's sequence is infeasible*/
+    bool isEvaluated(const std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, int64_t& cost, int64_t& travelTimeSum_ms) const;
+    /*! \brief  orders the vehicles' task options as allowed by the algebra (earliest completion 
+     * first), returns false if the assignment does not satisfy the task relationships*/
+    bool isOrdered(const std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, std::vector<c_AssignmentStep>& assignmentSteps);
+    /*! \brief  selects a random task option, returns false if there are none*/
+    bool isRandomTaskOption(const std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, int32_t& vehicleIndex, int32_t& position);
+    bool isRelocateMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices);
+    bool isSwapMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices);
+    bool isTwoOptMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices);
+    bool isRuinRecreateMove(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices);
+    /*! \brief  inserts an option of the task option's task where it increases the cost the least, 
+     * returns false if there is no feasible insertion*/
+    bool isInserted(std::vector< std::vector<int32_t> >& vehicleTaskOptionIndices, const int32_t& taskOptionIndex);
+private:
+    static const uint32_t s_randomSeed = 5489;
+    c_StaticAssignmentParameters* m_staticAssignmentParameters{nullptr};
+    /*! \brief  number of task options in the assignment*/
+    size_t m_numberTaskOptions = {0};
+    /*! \brief  the options of the task of each task option, by c_AssignmentCostTable index*/
+    std::vector< std::vector<int32_t> > m_taskOptionIndicesOfTask;
+    std::mt19937 m_randomNumberGenerator{s_randomSeed};
+private:
+    /*! @name Private: No Copying*/
+    c_AssignmentRefinement(const c_AssignmentRefinement& rhs) = delete; //no copying
+    c_AssignmentRefinement& operator=(const c_AssignmentRefinement&) = delete; //no copying
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 class c_TaskAssignmentState
 {
 public:
@@ -208,6 +503,12 @@ private:
 ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////
 
+/*! \class c_Node_Base
+ *  \brief The state of the assignment at a search node, used to expand the node. 
+ * Each search thread loads the nodes it expands into its own c_Node_Base (a clone 
+ * of the trunk node); the expanded children are stored in m_children until they 
+ * are added to the tree as c_SearchNodes.
+ */
 class c_Node_Base
 {
 public: //constructors/destructors
@@ -218,42 +519,62 @@ public: //constructors/destructors
     c_Node_Base(const c_Node_Base& rhs);
     
 public: //member functions - prototypes
+    /*! \brief  adds the feasible children of this node to m_children or, 
+     * if there are none, evaluates this node as a leaf (complete assignment)*/
     virtual void ExpandNode();
-protected: //member functions - prototypes
+    /*! \brief  sets the state of this node to that of the search node, by 
+     * replaying the assignment steps from the trunk (nullptr -> trunk)*/
+    void loadNode(const c_SearchNode* searchNode);
     virtual std::unique_ptr<c_Node_Base> clone();
-    virtual void NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId, const int64_t& prerequisiteTaskOptionId);
+protected: //member functions - prototypes
+    virtual void NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+                                const int32_t& taskOptionIndex, const int64_t& prerequisiteTaskOptionId);
     virtual void calculateAssignmentCost(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
                                             const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                             int64_t& nodeCost, int64_t& evaluationOrderCost){};
     virtual void calculateFinalAssignment(){};                                        
 
 public: // member functions - prototypes
-    void PruneChildren();
     void printStatus(const std::string& Message);
 
 private:    // base member functions
     void calculateAssignmentCostBase(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
                                             const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                             int64_t& nodeCost, int64_t& evaluationOrderCost);
+    /*! \brief  raises the costs of the child to the lower bound on the cost of its completions*/
+    void calculateLowerBoundBase(const int32_t& vehicleIndex, const int32_t& taskOptionIndex, const int64_t& travelTimeTotal_ms,
+                                 int64_t& nodeCost, int64_t& evaluationOrderCost);
     
 public:
-    /*! \brief  these are assignment parameters that do not change during the assignment*/
-    static std::unique_ptr<c_StaticAssignmentParameters> m_staticAssignmentParameters;
-    /*! \brief  this flag controls calling the calculateFinalAssignment function only once */
-    static bool m_isFinalAssignmentCalculated;
+    /*! \brief  parameters and search state of the request this node belongs to 
+     * (owned by the request, set on the root node and copied to the children)*/
+    c_StaticAssignmentParameters* m_staticAssignmentParameters{nullptr};
     /*! \brief  these are vehicle assignment parameters that do change during the assignment*/
     std::unordered_map<int64_t, std::unique_ptr< c_VehicleAssignmentState> > m_vehicleIdVsAssignmentState; //available vehicle and their state for this node
-    /*! \brief  these are task assignment parameters that do change during the assignment*/
-    std::unordered_map<int64_t, std::unique_ptr< c_TaskAssignmentState> > m_taskIdVsAssignmentState; //tasks and their state for this node
-#ifdef AFRL_INTERNAL_ENABLED
-    /*! \brief  this is used to determine the type of cost calculation to call */
-    static uxas::project::pisr::AssignmentType::AssignmentType m_assignmentType;
-#endif
     
 protected: //member storage
-    /*! \brief map of children of this node, sorted by cost */
-    std::multimap<int64_t, std::unique_ptr<c_Node_Base> > m_costVsChildren;
+    class c_ChildNode
+    {
+    public:
+        int64_t m_evaluationOrderCost = {0};
+        int64_t m_nodeCost = {0};
+        c_AssignmentStep m_assignmentStep;
+    };
+    /*! \brief children of this node, in the order they were found (expanded in evaluation order cost order) */
+    std::vector<c_ChildNode> m_children;
+    /*! \brief  assignment steps from the trunk to this node*/
+    std::vector<c_AssignmentStep> m_assignmentSteps;
     std::vector<int64_t> m_viObjectiveIDs_Assigned;
+    /*! \brief  assigned task options, as a bitset over the algebra action indices*/
+    std::vector<uint64_t> m_executedActionBits;
+    /*! \brief  working storage of CAlgebra::searchNext, reused by the expansions of this node*/
+    std::vector<uint64_t> m_nextLeafBits;
+    std::vector<int> m_nextActionIndices;
+    /*! \brief  vehicle assignment states, by c_AssignmentCostTable vehicle index*/
+    std::vector<c_VehicleAssignmentState*> m_vehicleIndexVsAssignmentState;
+    /*! \brief  vehicle travel times and assigned task options, by c_AssignmentCostTable index (lower bounds)*/
+    std::vector<int64_t> m_vehicleTravelTimeTotals_ms;
+    std::vector<uint8_t> m_isTaskOptionAssigned;
 
     // added for information
     int64_t m_vehicleID{0};
@@ -263,15 +584,95 @@ protected: //member storage
      *  it's predecessors from the trunk to the current node*/
     int64_t m_travelTimeTotal_ms = {0};
     
-    bool m_isPruneable = {true}; //can this node be pruned
     bool m_isLeafNode = {false}; //is this a leaf node
 
     int64_t m_nodeCost{0};
     
+    /*! \brief  rank of this node and its predecessors among their siblings (in 
+     * evaluation order cost order), from the trunk to the current node. Lexicographic 
+     * order of the keys is the depth-first search order, independent of threading.*/
+    std::vector<uint32_t> m_searchOrderKey;
     
 private:
     /*! @name Private: No Copying*/
     c_Node_Base& operator=(const c_Node_Base&) = delete; //no copying
+
+    friend class c_BranchBoundSearch;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*! \class c_BranchBoundSearch
+ *  \brief Work-stealing, depth-first branch and bound search of the assignment tree.
+ * 
+ * The tree is stored as c_SearchNodes, allocated from per-thread arenas. A node 
+ * is released when it, and all of its descendants, have been expanded or pruned.
+ * 
+ * Each search thread expands nodes from the back of its own node stack (depth-first,
+ * lowest evaluation order cost first) and, when empty, steals nodes from the front 
+ * (closest to the trunk) of the other threads' stacks. The incumbent cost is shared 
+ * atomically for pruning. Ties are broken by search order key, so a completed search
+ * returns the same assignment as the single-threaded depth-first search.
+ */
+class c_BranchBoundSearch
+{
+public:
+    c_BranchBoundSearch(const uint32_t& numberThreads);
+    virtual ~c_BranchBoundSearch() { };
+
+public:
+    /*! \brief  called with a lower bound on the cost of the optimal assignment
+     * when the incumbent assignment has been replaced*/
+    typedef std::function<void(const int64_t& lowerBound)> CandidateUpdateFunction;
+    
+    /*! \brief  searches the tree below the root node. Returns when the search is
+     *  complete or a stop condition is reached. The candidate update function, if 
+     *  any, is called from the calling thread while the search continues.*/
+    void search(c_Node_Base& rootNode, const CandidateUpdateFunction& candidateUpdateFunction = CandidateUpdateFunction());
+
+private:
+    class c_NodeStack
+    {
+    public:
+        std::mutex m_mutex;
+        std::deque<c_SearchNode*> m_nodes;
+        /*! \brief  cost of the node being expanded by the stack's thread (INT64_MAX -> none)*/
+        std::atomic<int64_t> m_expandingNodeCost = {INT64_MAX};
+    };
+
+    void executeSearch(const uint32_t& threadIndex, const CandidateUpdateFunction& candidateUpdateFunction);
+    bool isPopNode(const uint32_t& threadIndex, c_SearchNode*& searchNode);
+    void expandNode(const uint32_t& threadIndex, c_SearchNode* searchNode);
+    void pushChildren(const uint32_t& threadIndex, c_SearchNode* parentSearchNode, c_Node_Base& parentNode);
+    /*! \brief  releases the reference to the node, releasing the node (and, in 
+     * turn, its ancestors) when it is no longer referenced*/
+    void releaseNode(const uint32_t& threadIndex, c_SearchNode* searchNode);
+    /*! \brief  returns the minimum cost of the nodes that have not been expanded. Node
+     * costs are lower bounds on the costs of their descendants, so this is a lower 
+     * bound on the optimal cost.*/
+    int64_t getLowerBound();
+
+    std::vector< std::unique_ptr<c_NodeStack> > m_nodeStacks;
+    /*! \brief  state of the node being expanded, per thread*/
+    std::vector< std::unique_ptr<c_Node_Base> > m_nodes;
+    std::vector< std::unique_ptr<c_SearchNodeArena> > m_searchNodeArenas;
+    c_StaticAssignmentParameters* m_staticAssignmentParameters{nullptr};
+    /*! \brief  number of nodes pushed but not yet expanded (or discarded)*/
+    std::atomic<int64_t> m_numberPendingNodes = {0};
+    /*! \brief  threads without nodes to expand wait on m_workAvailable until nodes 
+     * are pushed (m_workGeneration changes) or the search is complete*/
+    std::mutex m_idleMutex;
+    std::condition_variable m_workAvailable;
+    std::atomic<uint64_t> m_workGeneration = {0};
+    std::atomic<uint32_t> m_numberIdleThreads = {0};
+
+private:
+    /*! \brief  wakes idle threads (if any) after nodes are pushed or the search completes*/
+    void notifyWorkAvailable();
+
+    /*! @name Private: No Copying*/
+    c_BranchBoundSearch(const c_BranchBoundSearch& rhs) = delete; //no copying
+    c_BranchBoundSearch& operator=(const c_BranchBoundSearch&) = delete; //no copying
 };
 
 
@@ -316,8 +717,6 @@ private:
     /** brief Copy assignment operation not permitted */
     void operator=(AssignmentTreeBranchBoundBase const&) = delete;
 
-    bool configure(const pugi::xml_node& serviceXmlNode) override;
-
     bool start() override;
 
     bool terminate() override;
@@ -325,6 +724,9 @@ private:
     bool processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
 
 protected: //virtual
+    /** brief reads the service options (also used by drivers that run the assignment without the network) */
+    bool configure(const pugi::xml_node& serviceXmlNode) override;
+
     class AssigmentPrerequisites
     {
     public:
@@ -339,7 +741,12 @@ protected: //virtual
         };
         uxas::project::pisr::AssignmentType::AssignmentType m_assignmentType;
 #endif
+        /** brief true if the vehicles of this request and the other request overlap
+         * (an empty entity list implies all vehicles) */
+        bool isVehicleOverlap(const AssigmentPrerequisites& other) const;
     public:
+        /** brief parameters and search state of the assignment, created when the request is queued */
+        std::shared_ptr<c_StaticAssignmentParameters> m_assignmentParameters;
         std::shared_ptr<uxas::messages::task::UniqueAutomationRequest> m_uniqueAutomationRequest;
         std::shared_ptr<uxas::messages::task::AssignmentCostMatrix> m_assignmentCostMatrix;
         std::unordered_map<int64_t, std::shared_ptr < uxas::messages::task::TaskPlanOptions>> m_taskIdVsTaskPlanOptions;
@@ -365,6 +772,25 @@ protected: //virtual
     /** brief starts the branch and bound assignment. */
     virtual void calculateAssignment(std::unique_ptr<c_Node_Base> nodeAssignment,const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites);
     void sendErrorMsg(std::string& errStr);
+    /** brief broadcasts a message; safe to call from the assignment threads. Drivers that 
+     * run the assignment without the network override this to receive the results. */
+    virtual void sendAssignmentBroadcastMessage(const std::shared_ptr<avtas::lmcp::Object>& lmcpObject);
+    /** brief broadcasts the incumbent assignment of the request as a TaskAssignmentSummary. */
+    void sendTaskAssignmentSummary(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites);
+    /** brief broadcasts an improved, intermediate assignment with its cost and gap to the lower 
+     * bound as an IntermediateTaskAssignmentSummary, which is not taken as the request's response. */
+    void sendIntermediateAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites, const int64_t& lowerBound);
+
+private:
+    /** brief queues a ready request for the assignment threads, cancelling 
+     * queued or running requests for the same vehicles. */
+    void queueAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites);
+    /** brief reports a superseded request and cancels its search. */
+    void cancelAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites, const int64_t& supersedingRequestId);
+    /** brief assignment thread: runs queued requests until terminated. */
+    void executeAssignmentProcessing();
+    /** brief cancels all requests and joins the assignment threads. */
+    void terminateAssignmentProcessing();
 
 
 protected:
@@ -374,7 +800,37 @@ protected:
     std::unordered_map<int64_t,std::shared_ptr<AssigmentPrerequisites> > m_idVsAssigmentPrerequisites;
     int64_t m_numberNodesMaximum = {0}; // default to best-first search
     c_StaticAssignmentParameters::CostFunction m_CostFunction = {c_StaticAssignmentParameters::CostFunction::MINMAX};
+    c_AssignmentLowerBound::LowerBoundType m_lowerBoundType = {c_AssignmentLowerBound::LowerBoundType::NONE};
+    /*! \brief  number of threads used to search the assignment tree (0 -> one per hardware thread)*/
+    uint32_t m_numberSearchThreads = {1};
+    /*! \brief  time allowed to search for an assignment (0 -> no time budget)*/
+    int64_t m_timeBudget_ms = {0};
+    /*! \brief  if true, improved assignments are sent while the search continues*/
+    bool m_isSendingIntermediateAssignments = {false};
+    /*! \brief  time allowed to refine the assignment of a stopped search (0 -> no refinement)*/
+    int64_t m_refinementTime_ms = {0};
+    /*! \brief  if true, the search starts from the vehicles' previous assignment (warm start)*/
+    bool m_isIncrementalAssignment = {false};
+    /*! \brief  number of requests that are searched concurrently*/
+    uint32_t m_numberAssignmentThreads = {1};
+    /*! \brief  maximum number of ready requests waiting for an assignment thread*/
+    uint32_t m_assignmentQueueSizeMaximum = {16};
 
+private:
+    std::vector<std::thread> m_assignmentThreads;
+    /*! \brief  guards m_assignmentQueue, m_runningAssignments and m_isTerminateAssignmentProcessing*/
+    std::mutex m_assignmentQueueMutex;
+    std::condition_variable m_assignmentQueueCondition;
+    std::deque< std::shared_ptr<AssigmentPrerequisites> > m_assignmentQueue;
+    std::vector< std::shared_ptr<AssigmentPrerequisites> > m_runningAssignments;
+    bool m_isTerminateAssignmentProcessing{false};
+    /*! \brief  [request ID][vehicle ID] task options of the vehicles' last assignments, in order 
+     * (incremental assignment). A vehicle is only kept for the last request that assigned it.*/
+    std::map<int64_t, std::unordered_map<int64_t, std::vector<int64_t> > > m_requestIdVsPreviousAssignment;
+    /*! \brief  guards m_requestIdVsPreviousAssignment*/
+    std::mutex m_previousAssignmentMutex;
+    /*! \brief  serializes sending from the service and assignment threads*/
+    std::mutex m_sendMutex;
 };
 }; //namespace service
 }; //namespace uxas
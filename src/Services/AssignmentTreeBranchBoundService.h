@@ -52,11 +52,42 @@ private:
  *\brief This service calculates assignments of vehicles to tasks based on cost inputs. 
  * 
  * Configuration String: 
- *  <Service Type="AssignmentTreeBranchBoundService" NumberNodesMaximum="0",CostFunction="MINMAX" />
+ *  <Service Type="AssignmentTreeBranchBoundService" NumberNodesMaximum="0",CostFunction="MINMAX" NumberSearchThreads="1"
+ *          NumberAssignmentThreads="1" AssignmentQueueSize="16" TimeBudget_ms="0" SendIntermediateAssignments="false"
+ *          LowerBound="None" RefinementTime_ms="0"
+ *          IncrementalAssignment="false" />
  * 
  * Options:
  *  - NumberNodesMaximum
  *  - CostFunction
+ *  - NumberSearchThreads - number of threads searching the assignment tree (0 - one per 
+ *    hardware thread). A completed search returns the same assignment for any number of threads.
+ *  - NumberAssignmentThreads - number of requests that are searched concurrently
+ *  - AssignmentQueueSize - maximum number of ready requests waiting to be searched (further 
+ *    requests are rejected). A request for any of the vehicles of a queued or running request
+ *    supersedes (cancels) it.
+ *  - TimeBudget_ms - once an assignment has been found, the search stops after this time 
+ *    and the best assignment found is returned (0 - no time budget)
+ *  - SendIntermediateAssignments - if true, each improved assignment is sent while the 
+ *    search continues as an IntermediateTaskAssignmentSummary, with its cost, a lower bound 
+ *    on the optimal cost and the relative gap. It is not taken as the request's response 
+ *    (PlanBuilderService builds a provisional plan from it); the final assignment is always 
+ *    sent as a TaskAssignmentSummary.
+ *  - LowerBound - bound on the cost of the unassigned tasks used to prune the search tree:
+ *    "None" (default), "MinimumIncoming" (each remaining task costs at least its cheapest 
+ *    arrival, respecting the process algebra) or "LoadBalance" (additionally, the maximum 
+ *    vehicle time is at least the average of the total remaining work)
+ *  - RefinementTime_ms - if the search is stopped (NumberNodesMaximum or TimeBudget_ms) 
+ *    before it is complete, its assignment is improved by local search (2-opt, relocate, 
+ *    swap and ruin and recreate moves that respect the task relationships) for this time 
+ *    before it is sent (0 - no refinement)
+ *  - IncrementalAssignment - if true, the vehicles' previous assignment, repaired for the 
+ *    requested tasks and vehicles, is the initial assignment of the search (warm start). 
+ *    Only better assignments are searched, so with TimeBudget_ms and RefinementTime_ms, 
+ *    small changes to a request are re-planned quickly. The warm start does not count as 
+ *    an assignment found by the search, so NumberNodesMaximum still waits for the search 
+ *    to find a (better) assignment. The previous assignment of a vehicle is the one of 
+ *    the last request that assigned it.
  * 
  * Subscribed Messages:
  *  - uxas::messages::task::UniqueAutomationRequest
@@ -135,12 +135,12 @@ AutomationDiagramDataService::initialize()
 
 bool
 AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
     std::stringstream sstrError;
     bool isMessageProcessed(false);
 
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
     if (entityState)
     {
         m_idVsLastEntityState[entityState->getID()] = entityState;
@@ -148,7 +148,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto uniqueAutomationRequest = std::dynamic_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        auto uniqueAutomationRequest = std::dynamic_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->getObject());
         if (uniqueAutomationRequest)
         {
             m_idVsAutomationRequest[uniqueAutomationRequest->getRequestID()] = uniqueAutomationRequest;
@@ -158,7 +158,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto abstractZone = std::dynamic_pointer_cast<afrl::cmasi::AbstractZone>(receivedLmcpMessage->m_object);
+        auto abstractZone = std::dynamic_pointer_cast<afrl::cmasi::AbstractZone>(receivedLmcpMessage->getObject());
         if (abstractZone)
         {
             m_idVsZone[abstractZone->getZoneID()] = abstractZone;
@@ -167,7 +167,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto task = std::dynamic_pointer_cast<afrl::cmasi::Task>(receivedLmcpMessage->m_object);
+        auto task = std::dynamic_pointer_cast<afrl::cmasi::Task>(receivedLmcpMessage->getObject());
         if (task)
         {
             m_idVsTask[task->getTaskID()] = task;
@@ -176,7 +176,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto operatingRegion = std::dynamic_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->m_object);
+        auto operatingRegion = std::dynamic_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->getObject());
         if (operatingRegion)
         {
             m_idVsOperatingRegion[operatingRegion->getID()] = operatingRegion;
@@ -185,7 +185,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto uniqueAutomationResponse = std::dynamic_pointer_cast<uxas::messages::task::UniqueAutomationResponse>(receivedLmcpMessage->m_object);
+        auto uniqueAutomationResponse = std::dynamic_pointer_cast<uxas::messages::task::UniqueAutomationResponse>(receivedLmcpMessage->getObject());
         if (uniqueAutomationResponse)
         {
             auto itassigmentTime_ms = m_idVsTimeAutomationRequest_ms.find(uniqueAutomationResponse->getResponseID());
@@ -200,7 +200,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto areaOfInterest = std::dynamic_pointer_cast<afrl::impact::AreaOfInterest>(receivedLmcpMessage->m_object);
+        auto areaOfInterest = std::dynamic_pointer_cast<afrl::impact::AreaOfInterest>(receivedLmcpMessage->getObject());
         if (areaOfInterest)
         {
             m_idVsAreaOfInterest[areaOfInterest->getAreaID()] = areaOfInterest;
@@ -209,7 +209,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto lineOfInterest = std::dynamic_pointer_cast<afrl::impact::LineOfInterest>(receivedLmcpMessage->m_object);
+        auto lineOfInterest = std::dynamic_pointer_cast<afrl::impact::LineOfInterest>(receivedLmcpMessage->getObject());
         if (lineOfInterest)
         {
             m_idVsLineOfInterest[lineOfInterest->getLineID()] = lineOfInterest;
@@ -218,7 +218,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     }
     if (!isMessageProcessed)
     {
-        auto pointOfInterest = std::dynamic_pointer_cast<afrl::impact::PointOfInterest>(receivedLmcpMessage->m_object);
+        auto pointOfInterest = std::dynamic_pointer_cast<afrl::impact::PointOfInterest>(receivedLmcpMessage->getObject());
         if (pointOfInterest)
         {
             m_idVsPointOfInterest[pointOfInterest->getPointID()] = pointOfInterest;
@@ -228,7 +228,7 @@ AutomationDiagramDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::c
     if (!isMessageProcessed)
     {
         //        UXAS_LOG_WARN("WARNING::AutomationDiagramDataService::ProcessMessage: MessageType [" 
-        //                , receivedLmcpMessage->m_object->getFullLmcpTypeName() 
+        //                , receivedLmcpMessage->getObject()->getFullLmcpTypeName() 
         //                , "] serviceId[" , m_serviceId
         //                , "] SourceEntityId[" , receivedLmcpMessage->m_attributes->getSourceEntityId()
         //                , "] SourceServiceId[" , receivedLmcpMessage->m_attributes->getSourceServiceId() 
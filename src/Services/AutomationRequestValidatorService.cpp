@@ -151,9 +151,9 @@ AutomationRequestValidatorService::configure(const pugi::xml_node & ndComponent)
 bool
 AutomationRequestValidatorService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    auto entityConfig = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
-    auto task = std::dynamic_pointer_cast<afrl::cmasi::Task>(receivedLmcpMessage->m_object);
+    auto entityConfig = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
+    auto task = std::dynamic_pointer_cast<afrl::cmasi::Task>(receivedLmcpMessage->getObject());
     if ( entityConfig )
     {
         m_availableConfigurationEntityIds.insert(entityConfig->getID());
@@ -167,68 +167,70 @@ AutomationRequestValidatorService::processReceivedLmcpMessage(std::unique_ptr<ux
         m_availableInitializedTasks.erase(task->getTaskID());
         m_availableTasks[task->getTaskID()] = task;
     }
-    else if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
     {
         // log any error messages in the assignment pipeline
-        auto sstatus = std::static_pointer_cast<afrl::cmasi::ServiceStatus>(receivedLmcpMessage->m_object);
+        auto sstatus = std::static_pointer_cast<afrl::cmasi::ServiceStatus>(receivedLmcpMessage->getObject());
         if(sstatus->getStatusType() == afrl::cmasi::ServiceStatusType::Error)
             for(auto kvp : sstatus->getInfo())
                 m_errorResponse->getOriginalResponse()->getInfo().push_back(kvp->clone());
     }
-    else if (afrl::cmasi::isRemoveTasks(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isRemoveTasks(receivedLmcpMessage->getObject().get()))
     {
-        auto removeTasks = std::static_pointer_cast<afrl::cmasi::RemoveTasks>(receivedLmcpMessage->m_object);
+        auto removeTasks = std::static_pointer_cast<afrl::cmasi::RemoveTasks>(receivedLmcpMessage->getObject());
         for (auto& taskId : removeTasks->getTaskList())
         {
             m_availableTasks.erase(taskId);
             m_availableInitializedTasks.erase(taskId);
         }
     }
-    else if (uxas::messages::task::isTaskInitialized(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isTaskInitialized(receivedLmcpMessage->getObject().get()))
     {
-        auto taskInitialized = std::static_pointer_cast<uxas::messages::task::TaskInitialized>(receivedLmcpMessage->m_object);
+        auto taskInitialized = std::static_pointer_cast<uxas::messages::task::TaskInitialized>(receivedLmcpMessage->getObject());
         m_availableInitializedTasks.insert(taskInitialized->getTaskID());
         checkTasksInitialized();
     }
-    else if (afrl::impact::isAreaOfInterest(receivedLmcpMessage->m_object.get()))
+    else if (afrl::impact::isAreaOfInterest(receivedLmcpMessage->getObject().get()))
     {
-        auto areaOfInterest = std::static_pointer_cast<afrl::impact::AreaOfInterest>(receivedLmcpMessage->m_object);
+        auto areaOfInterest = std::static_pointer_cast<afrl::impact::AreaOfInterest>(receivedLmcpMessage->getObject());
         m_availableAreaOfInterestIds.insert(areaOfInterest->getAreaID());
     }
-    else if (afrl::impact::isLineOfInterest(receivedLmcpMessage->m_object.get()))
+    else if (afrl::impact::isLineOfInterest(receivedLmcpMessage->getObject().get()))
     {
-        auto lineOfInterest = std::static_pointer_cast<afrl::impact::LineOfInterest>(receivedLmcpMessage->m_object);
+        auto lineOfInterest = std::static_pointer_cast<afrl::impact::LineOfInterest>(receivedLmcpMessage->getObject());
         m_availableLineOfInterestIds.insert(lineOfInterest->getLineID());
     }
-    else if (afrl::impact::isPointOfInterest(receivedLmcpMessage->m_object.get()))
+    else if (afrl::impact::isPointOfInterest(receivedLmcpMessage->getObject().get()))
     {
-        auto pointOfInterest = std::static_pointer_cast<afrl::impact::PointOfInterest>(receivedLmcpMessage->m_object);
+        auto pointOfInterest = std::static_pointer_cast<afrl::impact::PointOfInterest>(receivedLmcpMessage->getObject());
         m_availablePointOfInterestIds.insert(pointOfInterest->getPointID());
     }
-    else if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->getObject().get()))
     {
-        auto keepInZone = std::static_pointer_cast<afrl::cmasi::KeepInZone>(receivedLmcpMessage->m_object);
+        auto keepInZone = std::static_pointer_cast<afrl::cmasi::KeepInZone>(receivedLmcpMessage->getObject());
         m_availableKeepInZoneIds.insert(keepInZone->getZoneID());
     }
-    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->getObject().get()))
     {
-        auto keepOutZone = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->m_object);
+        auto keepOutZone = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->getObject());
         m_availableKeepOutZoneIds.insert(keepOutZone->getZoneID());
     }
-    else if (afrl::cmasi::isOperatingRegion(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isOperatingRegion(receivedLmcpMessage->getObject().get()))
     {
-        auto operatingRegion = std::static_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->m_object);
+        auto operatingRegion = std::static_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->getObject());
         m_availableOperatingRegions[operatingRegion->getID()] = operatingRegion;
     }
-    else if (afrl::cmasi::isAutomationRequest(receivedLmcpMessage->m_object) ||
-            afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->m_object) ||
-            uxas::messages::task::isTaskAutomationRequest(receivedLmcpMessage->m_object))
+    else if (afrl::cmasi::isAutomationRequest(receivedLmcpMessage->getObject().get()) ||
+            afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->getObject().get()) ||
+            uxas::messages::task::isTaskAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        HandleAutomationRequest(receivedLmcpMessage->m_object);
+        std::shared_ptr<avtas::lmcp::Object> autoRequest = receivedLmcpMessage->getObject();
+        HandleAutomationRequest(autoRequest);
     }
-    else if (uxas::messages::task::isUniqueAutomationResponse(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isUniqueAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        HandleAutomationResponse(receivedLmcpMessage->m_object);
+        std::shared_ptr<avtas::lmcp::Object> autoResponse = receivedLmcpMessage->getObject();
+        HandleAutomationResponse(autoResponse);
     }
     
     return false; // always false unless terminating
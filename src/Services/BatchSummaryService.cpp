@@ -89,36 +89,36 @@ bool
 }
 
 bool BatchSummaryService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
-    if (afrl::impact::isBatchSummaryRequest(receivedLmcpMessage->m_object.get()))
+    if (afrl::impact::isBatchSummaryRequest(receivedLmcpMessage->getObject().get()))
     {
-        HandleBatchSummaryRequest(std::static_pointer_cast<afrl::impact::BatchSummaryRequest>(receivedLmcpMessage->m_object));
+        HandleBatchSummaryRequest(std::static_pointer_cast<afrl::impact::BatchSummaryRequest>(receivedLmcpMessage->getObject()));
     }
-    else if (std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object))
+    else if (std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject()))
     {
-        auto config = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        auto config = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         int64_t id = config->getID();
         m_entityConfigs[id] = config;
 
-        if (afrl::impact::isRadioTowerConfiguration(receivedLmcpMessage->m_object.get()))
+        if (afrl::impact::isRadioTowerConfiguration(receivedLmcpMessage->getObject().get()))
         {
-            auto rconfig = std::static_pointer_cast<afrl::impact::RadioTowerConfiguration>(receivedLmcpMessage->m_object);
+            auto rconfig = std::static_pointer_cast<afrl::impact::RadioTowerConfiguration>(receivedLmcpMessage->getObject());
             int64_t id = rconfig->getID();
             m_towerLocations[id] = std::shared_ptr<afrl::cmasi::Location3D>(rconfig->getPosition()->clone());
             m_towerRanges[id] = std::make_pair(rconfig->getRange(), rconfig->getEnabled());
         }
     }
-    else if (std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object))
+    else if (std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject()))
     {
-        auto state = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        auto state = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
         int64_t id = state->getID();
         m_entityStates[id] = state;
 
-   if (afrl::impact::isRadioTowerState(receivedLmcpMessage->m_object.get()))
+   if (afrl::impact::isRadioTowerState(receivedLmcpMessage->getObject().get()))
    {
        m_towerLocations[id] = std::shared_ptr<afrl::cmasi::Location3D>(state->getLocation()->clone());
-       auto rs = std::static_pointer_cast<afrl::impact::RadioTowerState>(receivedLmcpMessage->m_object);
+       auto rs = std::static_pointer_cast<afrl::impact::RadioTowerState>(receivedLmcpMessage->getObject());
        if (m_towerRanges.find(id) != m_towerRanges.end())
        {
            m_towerRanges[id].second = rs->getEnabled();
@@ -126,15 +126,15 @@ bool BatchSummaryService::processReceivedLmcpMessage(std::unique_ptr<uxas::commu
    }
        }
 
-       else if (messages::task::isTaskAutomationResponse(receivedLmcpMessage->m_object))
+       else if (messages::task::isTaskAutomationResponse(receivedLmcpMessage->getObject().get()))
        {
 
-           HandleTaskAutomationResponse(std::static_pointer_cast<messages::task::TaskAutomationResponse>(receivedLmcpMessage->m_object));
+           HandleTaskAutomationResponse(std::static_pointer_cast<messages::task::TaskAutomationResponse>(receivedLmcpMessage->getObject()));
            //check if all have been received and send out the batchSumaryResponse.
        }
-       else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->m_object))
+       else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->getObject().get()))
        {
-           auto koz = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->m_object);
+           auto koz = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->getObject());
            auto poly = FromAbstractGeometry(koz->getBoundary());
 
            m_keepOutZones[koz->getZoneID()] = poly;
@@ -88,7 +88,7 @@ bool LoiterLeash::configure(const pugi::xml_node& ndComponent)
 
 bool LoiterLeash::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    std::shared_ptr<avtas::lmcp::Object> messageObject = receivedLmcpMessage->m_object;
+    std::shared_ptr<avtas::lmcp::Object> messageObject = receivedLmcpMessage->getObject();
     auto entityConfiguration = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(messageObject);
     auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(messageObject);
 
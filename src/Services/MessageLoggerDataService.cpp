@@ -156,7 +156,7 @@ MessageLoggerDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::commu
     
     if (m_databaseLogger)
     {
-        std::string XML = receivedLmcpMessage->m_object->toXML();
+        std::string XML = receivedLmcpMessage->getObject()->toXML();
         //uxas::common::XmlUtil::escapeXmlQuoteApostropheChars(XML);
         m_databaseLogger->outputTextToStream("NULL,'" +
                 std::to_string(uxas::common::Time::getInstance().getUtcTimeSinceEpoch_ms()) + "','" +
@@ -170,7 +170,7 @@ MessageLoggerDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::commu
     if (m_fileLogger)
     {
         m_fileLogger->outputTimeTextToStream(receivedLmcpMessage->m_attributes->getString());
-        m_fileLogger->outputTextToStream(receivedLmcpMessage->m_object->toXML());
+        m_fileLogger->outputTextToStream(receivedLmcpMessage->getObject()->toXML());
     }
     
     UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::processReceivedLmcpMessage AFTER logging received message");
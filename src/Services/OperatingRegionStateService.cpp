@@ -62,9 +62,9 @@ OperatingRegionStateService::processReceivedLmcpMessage(std::unique_ptr<uxas::co
 {
     bool addZone = false;
     bool removeZone = false;
-    if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->m_object.get()))
+    if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->getObject().get()))
     {
-        auto kzone = std::static_pointer_cast<afrl::cmasi::KeepInZone>(receivedLmcpMessage->m_object);
+        auto kzone = std::static_pointer_cast<afrl::cmasi::KeepInZone>(receivedLmcpMessage->getObject());
 
         addZone = true;
         for (auto z : m_region->getKeepInAreas())
@@ -97,9 +97,9 @@ OperatingRegionStateService::processReceivedLmcpMessage(std::unique_ptr<uxas::co
 
         }
     }
-    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->getObject().get()))
     {
-        auto kzone = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->m_object);
+        auto kzone = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->getObject());
 
         addZone = true;
         for (auto z : m_region->getKeepOutAreas())
@@ -133,14 +133,14 @@ OperatingRegionStateService::processReceivedLmcpMessage(std::unique_ptr<uxas::co
             IMPACT_INFORM("Removed Keep In Zone ", kzone->getZoneID(), " ", kzone->getLabel());
         }
     }
-    else if (afrl::impact::isWaterZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::impact::isWaterZone(receivedLmcpMessage->getObject().get()))
     {
-        auto wzone = std::static_pointer_cast<afrl::impact::WaterZone>(receivedLmcpMessage->m_object);
+        auto wzone = std::static_pointer_cast<afrl::impact::WaterZone>(receivedLmcpMessage->getObject());
         IMPACT_INFORM("Recieved Water Zone ", wzone->getZoneID(), " ", wzone->getLabel());
     }
-    else if (afrl::cmasi::isRemoveZones(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isRemoveZones(receivedLmcpMessage->getObject().get()))
     {
-        auto rzones = std::static_pointer_cast<afrl::cmasi::RemoveZones>(receivedLmcpMessage->m_object);
+        auto rzones = std::static_pointer_cast<afrl::cmasi::RemoveZones>(receivedLmcpMessage->getObject());
         removeZone = true; //assume
         for (auto z : rzones->getZoneList())
         {
@@ -159,11 +159,11 @@ OsmPlannerService::initialize()
 
 bool
 OsmPlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
-    if (uxas::messages::route::isRoutePlanRequest(receivedLmcpMessage->m_object))
+    if (uxas::messages::route::isRoutePlanRequest(receivedLmcpMessage->getObject().get()))
     {
-        std::shared_ptr<uxas::messages::route::RoutePlanRequest> request = std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>(receivedLmcpMessage->m_object);
+        std::shared_ptr<uxas::messages::route::RoutePlanRequest> request = std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>(receivedLmcpMessage->getObject());
         //assumes only ground vehicles
         if (m_entityConfigurations.find(request->getVehicleID()) != m_entityConfigurations.end())
         {
@@ -181,10 +181,10 @@ OsmPlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicatio
 
         }
     }
-    else if (uxas::messages::route::isRoadPointsRequest(receivedLmcpMessage->m_object))
+    else if (uxas::messages::route::isRoadPointsRequest(receivedLmcpMessage->getObject().get()))
     {
         std::shared_ptr<uxas::messages::route::RoadPointsRequest> request =
-                std::static_pointer_cast<uxas::messages::route::RoadPointsRequest>(receivedLmcpMessage->m_object);
+                std::static_pointer_cast<uxas::messages::route::RoadPointsRequest>(receivedLmcpMessage->getObject());
         auto roadPointsResponse = std::make_shared<uxas::messages::route::RoadPointsResponse>();
         if (isProcessRoadPointsRequest(request, roadPointsResponse))
         {
@@ -196,10 +196,10 @@ OsmPlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicatio
                                                    roadPointsResponse);
         }
     }
-    else if (uxas::messages::route::isEgressRouteRequest(receivedLmcpMessage->m_object))
+    else if (uxas::messages::route::isEgressRouteRequest(receivedLmcpMessage->getObject().get()))
     {
         auto egressResponse = std::make_shared<uxas::messages::route::EgressRouteResponse>();
-        if (bProcessEgressRequest(std::static_pointer_cast<uxas::messages::route::EgressRouteRequest>(receivedLmcpMessage->m_object), egressResponse))
+        if (bProcessEgressRequest(std::static_pointer_cast<uxas::messages::route::EgressRouteRequest>(receivedLmcpMessage->getObject()), egressResponse))
         {
             auto newResponse = std::static_pointer_cast<avtas::lmcp::Object>(egressResponse);
             sendSharedLmcpObjectLimitedCastMessage(
@@ -211,14 +211,14 @@ OsmPlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicatio
         }
     }
 
-    else if (afrl::vehicles::isGroundVehicleConfiguration(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isGroundVehicleConfiguration(receivedLmcpMessage->getObject().get()))
     {
-        auto config = std::static_pointer_cast<afrl::vehicles::GroundVehicleConfiguration>(receivedLmcpMessage->m_object);
+        auto config = std::static_pointer_cast<afrl::vehicles::GroundVehicleConfiguration>(receivedLmcpMessage->getObject());
         m_entityConfigurations[config->getID()] = config;
     }
     else
     {
-        UXAS_LOG_INFORM("WARNING::Unknown Message Type Encountered ptr_Object->getLmcpTypeName()[", receivedLmcpMessage->m_object->getFullLmcpTypeName(), "]");
+        UXAS_LOG_INFORM("WARNING::Unknown Message Type Encountered ptr_Object->getLmcpTypeName()[", receivedLmcpMessage->getObject()->getFullLmcpTypeName(), "]");
     }
     return (false); // always false implies never terminating service from here
 };
@@ -79,6 +79,7 @@ PlanBuilderService::configure(const pugi::xml_node& ndComponent)
 
     addSubscriptionAddress(uxas::messages::task::UniqueAutomationRequest::Subscription);
     addSubscriptionAddress(uxas::messages::task::TaskAssignmentSummary::Subscription);
+    addSubscriptionAddress(uxas::messages::task::IntermediateTaskAssignmentSummary::Subscription);
     addSubscriptionAddress(uxas::messages::task::TaskImplementationResponse::Subscription);
     addSubscriptionAddress(afrl::impact::ImpactAutomationRequest::Subscription);
     addSubscriptionAddress(afrl::impact::ImpactAutomationResponse::Subscription);
@@ -94,36 +95,41 @@ PlanBuilderService::configure(const pugi::xml_node& ndComponent)
 bool
 PlanBuilderService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
     if(entityState)
     {
         m_currentEntityStates[entityState->getID()] = entityState;
     }
-    else if (afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->m_object))
+    else if (afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        auto impactAutomationResponse = std::static_pointer_cast<afrl::impact::ImpactAutomationRequest>(receivedLmcpMessage->m_object);
+        auto impactAutomationResponse = std::static_pointer_cast<afrl::impact::ImpactAutomationRequest>(receivedLmcpMessage->getObject());
 
         for (auto override : impactAutomationResponse->getOverridePlanningConditions())
         {
             m_reqeustIDVsOverrides[impactAutomationResponse->getRequestID()].push_back(std::shared_ptr<afrl::impact::SpeedAltPair>(override->clone()));
         }
     }
-    else if (afrl::impact::isImpactAutomationResponse(receivedLmcpMessage->m_object))
+    else if (afrl::impact::isImpactAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto impactAutomationResponse = std::static_pointer_cast<afrl::impact::ImpactAutomationResponse>(receivedLmcpMessage->m_object);
+        auto impactAutomationResponse = std::static_pointer_cast<afrl::impact::ImpactAutomationResponse>(receivedLmcpMessage->getObject());
         m_reqeustIDVsOverrides.erase(impactAutomationResponse->getResponseID());
     }
-    else if(uxas::messages::task::isTaskAssignmentSummary(receivedLmcpMessage->m_object))
+    else if(uxas::messages::task::isTaskAssignmentSummary(receivedLmcpMessage->getObject().get()))
     {
-        processTaskAssignmentSummary(std::static_pointer_cast<uxas::messages::task::TaskAssignmentSummary>(receivedLmcpMessage->m_object));
+        processTaskAssignmentSummary(std::static_pointer_cast<uxas::messages::task::TaskAssignmentSummary>(receivedLmcpMessage->getObject()));
     }
-    else if(uxas::messages::task::isTaskImplementationResponse(receivedLmcpMessage->m_object))
+    else if(uxas::messages::task::isIntermediateTaskAssignmentSummary(receivedLmcpMessage->getObject().get()))
     {
-        processTaskImplementationResponse(std::static_pointer_cast<uxas::messages::task::TaskImplementationResponse>(receivedLmcpMessage->m_object));
+        auto intermediateTaskAssignmentSummary = std::static_pointer_cast<uxas::messages::task::IntermediateTaskAssignmentSummary>(receivedLmcpMessage->getObject());
+        processTaskAssignmentSummary(std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>(intermediateTaskAssignmentSummary->getSummary()->clone()), true);
     }
-    else if(uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->m_object))
+    else if(uxas::messages::task::isTaskImplementationResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        processTaskImplementationResponse(std::static_pointer_cast<uxas::messages::task::TaskImplementationResponse>(receivedLmcpMessage->getObject()));
+    }
+    else if(uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->getObject().get()))
+    {
+        auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->getObject());
         m_uniqueAutomationRequests[uniqueAutomationRequest->getRequestID()] = uniqueAutomationRequest;
         
         // re-initialize state maps (possibly halt completion of over-ridden automation request)
@@ -131,6 +137,7 @@ PlanBuilderService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicati
         m_projectedEntityStates[uniqueAutomationRequest->getRequestID()] = std::vector< std::shared_ptr<ProjectedState> >();
         m_remainingAssignments[uniqueAutomationRequest->getRequestID()] = std::deque< std::shared_ptr<uxas::messages::task::TaskAssignment> >();
         m_inProgressResponse[uniqueAutomationRequest->getRequestID()] = std::shared_ptr<uxas::messages::task::UniqueAutomationResponse>(nullptr);
+        m_isProvisionalPlanComplete.erase(uniqueAutomationRequest->getRequestID());
     }
     
     return (false); // always false implies never terminating service from here
@@ -147,7 +154,7 @@ void PlanBuilderService::sendError(std::string& errMsg)
     sendSharedLmcpObjectBroadcastMessage(serviceStatus);
 }
 
-void PlanBuilderService::processTaskAssignmentSummary(const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& taskAssignmentSummary)
+void PlanBuilderService::processTaskAssignmentSummary(const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& taskAssignmentSummary, bool isProvisional)
 {
     // validate that this summary corresponds to an existing unique automation request
     auto correspondingAutomationRequest = std::make_shared<uxas::messages::task::UniqueAutomationRequest>();
@@ -160,21 +167,30 @@ void PlanBuilderService::processTaskAssignmentSummary(const std::shared_ptr<uxas
     {
         std::string message = "ERROR::processTaskAssignmentSummary: Corresponding Unique Automation Request ID [";
         message += std::to_string(taskAssignmentSummary->getCorrespondingAutomationRequestID()) + "] not found!";
-        sendError(message);
+        if (!isProvisional)
+        {
+            sendError(message);
+        }
         return;
     }
 
     if (taskAssignmentSummary->getTaskList().empty())
     {
         std::string message = "No assignments found for request " + std::to_string(taskAssignmentSummary->getCorrespondingAutomationRequestID());
-        sendError(message);
+        if (!isProvisional)
+        {
+            sendError(message);
+        }
         return;
     }
     
     if (taskAssignmentSummary->getTaskList().empty())
     {
         std::string message = "No assignments found for request " + std::to_string(taskAssignmentSummary->getCorrespondingAutomationRequestID());
-        sendError(message);
+        if (!isProvisional)
+        {
+            sendError(message);
+        }
         return;
     }
     
@@ -186,11 +202,62 @@ void PlanBuilderService::processTaskAssignmentSummary(const std::shared_ptr<uxas
         {
             std::string message = "ERROR::processTaskAssignmentSummary: Corresponding Unique Automation Request included vehicle ID [";
             message += std::to_string(v) + "] which does not have a corresponding current state!";
-            sendError(message);
+            if (!isProvisional)
+            {
+                sendError(message);
+            }
             return;
         }
     }
     
+    // an intermediate assignment does not replace the plan of the final assignment, and the plan 
+    // of an assignment is not rebuilt: the final assignment makes the same provisional plan final
+    int64_t uniqueRequestID = taskAssignmentSummary->getCorrespondingAutomationRequestID();
+    auto itProvisional = m_isProvisionalPlanComplete.find(uniqueRequestID);
+    auto itSummary = m_assignmentSummaries.find(uniqueRequestID);
+    if ((itSummary != m_assignmentSummaries.end()) && itSummary->second)
+    {
+        if (isProvisional && (itProvisional == m_isProvisionalPlanComplete.end()))
+        {
+            return;
+        }
+        if ((itProvisional != m_isProvisionalPlanComplete.end()) && isSameAssignment(itSummary->second, taskAssignmentSummary))
+        {
+            if (!isProvisional)
+            {
+                bool isPlanComplete = itProvisional->second;
+                m_isProvisionalPlanComplete.erase(itProvisional);
+                if (isPlanComplete)
+                {
+                    sendUniqueAutomationResponse(uniqueRequestID);
+                }
+            }
+            return;
+        }
+    }
+    if (isProvisional)
+    {
+        m_isProvisionalPlanComplete[uniqueRequestID] = false;
+    }
+    else
+    {
+        m_isProvisionalPlanComplete.erase(uniqueRequestID);
+    }
+
+    // a newer summary for the same request replaces the plan in progress,
+    // so responses to task implementation requests of the previous summary are ignored
+    for (auto itExpected = m_expectedResponseID.begin(); itExpected != m_expectedResponseID.end();)
+    {
+        if (itExpected->second == taskAssignmentSummary->getCorrespondingAutomationRequestID())
+        {
+            itExpected = m_expectedResponseID.erase(itExpected);
+        }
+        else
+        {
+            itExpected++;
+        }
+    }
+
     // initialize state tracking maps with this corresponding request IDs
     m_assignmentSummaries[taskAssignmentSummary->getCorrespondingAutomationRequestID()] = taskAssignmentSummary;
     m_projectedEntityStates[taskAssignmentSummary->getCorrespondingAutomationRequestID()] = std::vector< std::shared_ptr<ProjectedState> >();
@@ -448,17 +515,14 @@ void PlanBuilderService::checkNextTaskImplementationRequest(int64_t uniqueReques
                         wp->setTurnType(m_turnType);
             }
 
-            sendSharedLmcpObjectBroadcastMessage(response);
-            m_inProgressResponse.erase(uniqueRequestID);
-            m_reqeustIDVsOverrides.erase(uniqueRequestID);
-
-            auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
-            serviceStatus->setStatusType(afrl::cmasi::ServiceStatusType::Information);
-            auto keyValuePair = new afrl::cmasi::KeyValuePair;
-            std::string message = "UniqueAutomationResponse[" + std::to_string(uniqueRequestID) + "] - sent";
-            keyValuePair->setKey(message);
-            serviceStatus->getInfo().push_back(keyValuePair);
-            sendSharedLmcpObjectBroadcastMessage(serviceStatus);
+            // a provisional plan is only sent if the final assignment is the same
+            auto itProvisional = m_isProvisionalPlanComplete.find(uniqueRequestID);
+            if (itProvisional != m_isProvisionalPlanComplete.end())
+            {
+                itProvisional->second = true;
+                return;
+            }
+            sendUniqueAutomationResponse(uniqueRequestID);
         }
         else
         {
@@ -467,6 +531,42 @@ void PlanBuilderService::checkNextTaskImplementationRequest(int64_t uniqueReques
     }
 }
 
+void PlanBuilderService::sendUniqueAutomationResponse(int64_t uniqueRequestID)
+{
+    sendSharedLmcpObjectBroadcastMessage(m_inProgressResponse[uniqueRequestID]);
+    // the request is complete, forget its state
+    m_uniqueAutomationRequests.erase(uniqueRequestID);
+    m_assignmentSummaries.erase(uniqueRequestID);
+    m_projectedEntityStates.erase(uniqueRequestID);
+    m_remainingAssignments.erase(uniqueRequestID);
+    m_inProgressResponse.erase(uniqueRequestID);
+    m_reqeustIDVsOverrides.erase(uniqueRequestID);
+
+    auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
+    serviceStatus->setStatusType(afrl::cmasi::ServiceStatusType::Information);
+    auto keyValuePair = new afrl::cmasi::KeyValuePair;
+    std::string message = "UniqueAutomationResponse[" + std::to_string(uniqueRequestID) + "] - sent";
+    keyValuePair->setKey(message);
+    serviceStatus->getInfo().push_back(keyValuePair);
+    sendSharedLmcpObjectBroadcastMessage(serviceStatus);
+}
+
+bool PlanBuilderService::isSameAssignment(const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& taskAssignmentSummary,
+                                          const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& otherTaskAssignmentSummary)
+{
+    auto& taskList = taskAssignmentSummary->getTaskList();
+    auto& otherTaskList = otherTaskAssignmentSummary->getTaskList();
+    return ((taskList.size() == otherTaskList.size()) &&
+            std::equal(taskList.begin(), taskList.end(), otherTaskList.begin(),
+                       [](uxas::messages::task::TaskAssignment* taskAssignment, uxas::messages::task::TaskAssignment* otherTaskAssignment)
+                       {
+                           return ((taskAssignment->getTaskID() == otherTaskAssignment->getTaskID()) &&
+                                   (taskAssignment->getOptionID() == otherTaskAssignment->getOptionID()) &&
+                                   (taskAssignment->getAssignedVehicle() == otherTaskAssignment->getAssignedVehicle()) &&
+                                   (taskAssignment->getTimeThreshold() == otherTaskAssignment->getTimeThreshold()));
+                       }));
+}
+
 void PlanBuilderService::AddLoitersToMissionCommands(std::shared_ptr<uxas::messages::task::UniqueAutomationResponse> response)
 {
     //check if a loiter already exists. Some tasks add them.
@@ -22,6 +22,7 @@
 #include "uxas/messages/task/UniqueAutomationRequest.h"
 #include "uxas/messages/task/UniqueAutomationResponse.h"
 #include "uxas/messages/task/TaskAssignmentSummary.h"
+#include "uxas/messages/task/IntermediateTaskAssignmentSummary.h"
 #include "uxas/messages/task/TaskAssignment.h"
 #include "uxas/messages/task/TaskImplementationRequest.h"
 #include "uxas/messages/task/TaskImplementationResponse.h"
@@ -52,6 +53,7 @@ namespace service
  * 
  * MESSAGES:
  * ==> TaskAssignmentSummary
+ * ==> IntermediateTaskAssignmentSummary (provisional plan, sent only if the final assignment is the same)
  * 
  * FOR EVERY TASK
  * <== TaskImplementationRequest
@@ -69,6 +71,7 @@ namespace service
  * Subscribed Messages:
  *  - uxas::messages::task::UniqueAutomationRequest
  *  - uxas::messages::task::TaskAssignmentSummary
+ *  - uxas::messages::task::IntermediateTaskAssignmentSummary
  *  - uxas::messages::task::TaskImplementationResponse
  *  - afrl::cmasi::AirVehicleState
  *  - afrl::vehicles::GroundVehicleState
@@ -131,12 +134,20 @@ private:
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
     
-    void processTaskAssignmentSummary(const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& taskAssignmentSummary);
+    /*! \brief  builds the plan of an assignment. The plan of an intermediate assignment (provisional) 
+     * is not sent: a newer assignment replaces it, unless it is the same assignment, and the final 
+     * assignment makes it final. */
+    void processTaskAssignmentSummary(const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& taskAssignmentSummary, bool isProvisional = false);
     void processTaskImplementationResponse(const std::shared_ptr<uxas::messages::task::TaskImplementationResponse>& taskImplementationResponse);
     void sendError(std::string& errMsg);
     
     bool sendNextTaskImplementationRequest(int64_t uniqueRequestID);
     void checkNextTaskImplementationRequest(int64_t uniqueRequestID);
+    /*! \brief  sends the completed response and forgets the request */
+    void sendUniqueAutomationResponse(int64_t uniqueRequestID);
+    /*! \brief  true if both summaries assign the same task options to the same vehicles, in the same order */
+    static bool isSameAssignment(const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& taskAssignmentSummary,
+                                 const std::shared_ptr<uxas::messages::task::TaskAssignmentSummary>& otherTaskAssignmentSummary);
     void AddLoitersToMissionCommands(std::shared_ptr<uxas::messages::task::UniqueAutomationResponse> response);
     /*! \brief  nested class for tracking projected state of an entity during the plan building process */
     class ProjectedState {
@@ -161,6 +172,10 @@ private:
     /*! \brief  task assignment summaries with key of corresponding unique automation request ID */
     std::unordered_map<int64_t, std::shared_ptr<uxas::messages::task::TaskAssignmentSummary> > m_assignmentSummaries;
     
+    /*! \brief  requests with a plan built from an intermediate assignment (provisional), mapped to 
+     *          true once the provisional plan is complete, with key of corresponding unique automation request ID */
+    std::unordered_map<int64_t, bool> m_isProvisionalPlanComplete;
+    
     /*! \brief  projected entity states with key of corresponding unique automation request ID */
     std::unordered_map< int64_t, std::vector< std::shared_ptr<ProjectedState> > > m_projectedEntityStates;
     
@@ -103,12 +103,12 @@ RouteAggregatorService::configure(const pugi::xml_node& ndComponent)
 
 bool
 RouteAggregatorService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
     // successful de-serialization of message
-    if (uxas::messages::route::isRoutePlanResponse(receivedLmcpMessage->m_object.get()))
+    if (uxas::messages::route::isRoutePlanResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto rplan = std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->m_object);
+        auto rplan = std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->getObject());
         m_routePlanResponses[rplan->getResponseID()] = rplan;
         for (auto p : rplan->getRouteResponses())
         {
@@ -116,57 +116,57 @@ RouteAggregatorService::processReceivedLmcpMessage(std::unique_ptr<uxas::communi
         }
         CheckAllRoutePlans();
     }
-    else if (uxas::messages::route::isRouteRequest(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::route::isRouteRequest(receivedLmcpMessage->getObject().get()))
     {
-        auto rreq = std::static_pointer_cast<uxas::messages::route::RouteRequest>(receivedLmcpMessage->m_object);
+        auto rreq = std::static_pointer_cast<uxas::messages::route::RouteRequest>(receivedLmcpMessage->getObject());
         HandleRouteRequest(rreq);
     }
-    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->m_object))
+    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->getObject()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
         m_airVehicles.insert(id);
     }
-    else if (afrl::vehicles::isGroundVehicleState(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isGroundVehicleState(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
         m_groundVehicles.insert(id);
     }
-    else if (afrl::vehicles::isSurfaceVehicleState(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isSurfaceVehicleState(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
         m_surfaceVehicles.insert(id);
     }
-    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(receivedLmcpMessage->m_object))
+    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(receivedLmcpMessage->getObject()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         m_airVehicles.insert(id);
     }
-    else if (afrl::vehicles::isGroundVehicleConfiguration(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isGroundVehicleConfiguration(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         m_groundVehicles.insert(id);
     }
-    else if (afrl::vehicles::isSurfaceVehicleConfiguration(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isSurfaceVehicleConfiguration(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         m_surfaceVehicles.insert(id);
     }
-    else if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        auto areq = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        auto areq = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->getObject());
         m_uniqueAutomationRequests[m_autoRequestId++] = areq;
         //ResetTaskOptions(areq); // clear m_taskOptions and wait for refresh from tasks
         CheckAllTaskOptionsReceived();
     }
-    else if (afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->m_object.get()))
+    else if (afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        auto sreq = std::static_pointer_cast<afrl::impact::ImpactAutomationRequest>(receivedLmcpMessage->m_object);
+        auto sreq = std::static_pointer_cast<afrl::impact::ImpactAutomationRequest>(receivedLmcpMessage->getObject());
         auto areq = std::shared_ptr<uxas::messages::task::UniqueAutomationRequest>();
         areq->setOriginalRequest(sreq->getTrialRequest()->clone());
         m_uniqueAutomationRequests[m_autoRequestId++] = areq;
@@ -174,9 +174,9 @@ RouteAggregatorService::processReceivedLmcpMessage(std::unique_ptr<uxas::communi
         //ResetTaskOptions(areq); // clear m_taskOptions and wait for refresh from tasks
         CheckAllTaskOptionsReceived();
     }
-    else if (uxas::messages::task::isTaskPlanOptions(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isTaskPlanOptions(receivedLmcpMessage->getObject().get()))
     {
-        auto taskOptions = std::static_pointer_cast<uxas::messages::task::TaskPlanOptions>(receivedLmcpMessage->m_object);
+        auto taskOptions = std::static_pointer_cast<uxas::messages::task::TaskPlanOptions>(receivedLmcpMessage->getObject());
         m_taskOptions[taskOptions->getTaskID()] = taskOptions;
         CheckAllTaskOptionsReceived();
     }
@@ -86,11 +86,11 @@ RoutePlannerService::configure(const pugi::xml_node& serviceXmlNode)
 
 bool
 RoutePlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
-    if (uxas::messages::route::isRoutePlanRequest(receivedLmcpMessage->m_object.get()))
+    if (uxas::messages::route::isRoutePlanRequest(receivedLmcpMessage->getObject().get()))
     {
-        std::shared_ptr<uxas::messages::route::RoutePlanRequest> request = std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>(receivedLmcpMessage->m_object);
+        std::shared_ptr<uxas::messages::route::RoutePlanRequest> request = std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>(receivedLmcpMessage->getObject());
         // only handle requests for air and surface vehicles
         if (m_airVehicles.find(request->getVehicleID()) != m_airVehicles.end() ||
                 m_surfaceVehicles.find(request->getVehicleID()) != m_surfaceVehicles.end())
@@ -106,83 +106,83 @@ RoutePlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicat
                     pResponse);
         }
     }
-    else if (afrl::cmasi::isEntityState(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isEntityState(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
         // no region update for generic entities
     }
-    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->m_object))
+    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->getObject()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
 
         // check for unknown vehicle
         if (m_airVehicles.find(id) == m_airVehicles.end())
         {
-            UpdateRegions(receivedLmcpMessage->m_object);
+            UpdateRegions(receivedLmcpMessage->getObject());
         }
         m_airVehicles.insert(id);
     }
-    else if (afrl::vehicles::isGroundVehicleState(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isGroundVehicleState(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
         m_groundVehicles.insert(id);
         // no region update for ground vehicles
     }
-    else if (afrl::vehicles::isSurfaceVehicleState(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isSurfaceVehicleState(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object)->getID();
-        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject())->getID();
+        m_entityStates[id] = std::static_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
 
         // check for unknown vehicle
         if (m_surfaceVehicles.find(id) == m_surfaceVehicles.end())
         {
-            UpdateRegions(receivedLmcpMessage->m_object);
+            UpdateRegions(receivedLmcpMessage->getObject());
         }
         m_surfaceVehicles.insert(id);
     }
-    else if (afrl::cmasi::isEntityConfiguration(receivedLmcpMessage->m_object))
+    else if (afrl::cmasi::isEntityConfiguration(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         // no region update for generic entities
     }
-    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(receivedLmcpMessage->m_object))
+    else if (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(receivedLmcpMessage->getObject()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
 
         // check for unknown vehicle
         if (m_airVehicles.find(id) == m_airVehicles.end())
         {
-            UpdateRegions(receivedLmcpMessage->m_object);
+            UpdateRegions(receivedLmcpMessage->getObject());
         }
         m_airVehicles.insert(id);
     }
-    else if (afrl::vehicles::isGroundVehicleConfiguration(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isGroundVehicleConfiguration(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         m_groundVehicles.insert(id);
         // no region updates for ground vehicles
     }
-    else if (afrl::vehicles::isSurfaceVehicleConfiguration(receivedLmcpMessage->m_object.get()))
+    else if (afrl::vehicles::isSurfaceVehicleConfiguration(receivedLmcpMessage->getObject().get()))
     {
-        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object)->getID();
+        int64_t id = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject())->getID();
 
         // check for unknown vehicle
         if (m_entityConfigurations.find(id) == m_entityConfigurations.end())
         {
-            UpdateRegions(receivedLmcpMessage->m_object); // force update for new surface vehicles with embedded keep-in water zone
+            UpdateRegions(receivedLmcpMessage->getObject()); // force update for new surface vehicles with embedded keep-in water zone
         }
-        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+        m_entityConfigurations[id] = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
         m_surfaceVehicles.insert(id);
     }
-    else if (afrl::impact::isWaterZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::impact::isWaterZone(receivedLmcpMessage->getObject().get()))
     {
-        auto wzone = std::static_pointer_cast<afrl::impact::WaterZone>(receivedLmcpMessage->m_object);
+        auto wzone = std::static_pointer_cast<afrl::impact::WaterZone>(receivedLmcpMessage->getObject());
         m_waterZones[wzone->getZoneID()] = wzone;
 
         // check all surface vehicle configurations with this zone referenced
@@ -198,37 +198,37 @@ RoutePlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicat
             }
         }
     }
-    else if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->getObject().get()))
     {
-        std::shared_ptr<afrl::cmasi::KeepInZone> kiZone = std::static_pointer_cast<afrl::cmasi::KeepInZone>(receivedLmcpMessage->m_object);
+        std::shared_ptr<afrl::cmasi::KeepInZone> kiZone = std::static_pointer_cast<afrl::cmasi::KeepInZone>(receivedLmcpMessage->getObject());
         int64_t id = kiZone->getZoneID();
         auto zone = m_keepInZones.find(id);
         if (zone != m_keepInZones.end())
         {
             if (!(zone->second->operator==(*kiZone)))
             {
-                UpdateRegions(receivedLmcpMessage->m_object); // an existing region was updated
+                UpdateRegions(receivedLmcpMessage->getObject()); // an existing region was updated
             }
         }
         m_keepInZones[id] = kiZone;
     }
-    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->getObject().get()))
     {
-        std::shared_ptr<afrl::cmasi::KeepOutZone> koZone = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->m_object);
+        std::shared_ptr<afrl::cmasi::KeepOutZone> koZone = std::static_pointer_cast<afrl::cmasi::KeepOutZone>(receivedLmcpMessage->getObject());
         int64_t id = koZone->getZoneID();
         auto zone = m_keepOutZones.find(id);
         if (zone != m_keepOutZones.end())
         {
             if (!(zone->second->operator==(*koZone)))
             {
-                UpdateRegions(receivedLmcpMessage->m_object);
+                UpdateRegions(receivedLmcpMessage->getObject());
             }
         }
         m_keepOutZones[id] = koZone;
     }
-    else if (afrl::cmasi::isOperatingRegion(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isOperatingRegion(receivedLmcpMessage->getObject().get()))
     {
-        std::shared_ptr<afrl::cmasi::OperatingRegion> region = std::static_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->m_object);
+        std::shared_ptr<afrl::cmasi::OperatingRegion> region = std::static_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->getObject());
         int64_t id = region->getID();
         auto r = m_operatingRegions.find(id);
         if (r != m_operatingRegions.end())
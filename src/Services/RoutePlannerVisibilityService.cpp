@@ -37,6 +37,7 @@
 #include "afrl/cmasi/EntityConfigurationDescendants.h"
 #include "afrl/cmasi/EntityState.h"
 #include "afrl/cmasi/EntityStateDescendants.h"
+#include "afrl/cmasi/KeyValuePair.h"
 
 #include "pugixml.hpp"
 
@@ -58,6 +59,9 @@
 #define STRING_XML_IS_ROUTE_AGGREGATOR "isRoutAggregator"
 #define STRING_XML_OSM_FILE_NAME "OsmFileName"
 #define STRING_XML_MINIMUM_WAYPOINT_SEPARATION_M "MinimumWaypointSeparation_m"
+#define STRING_XML_LAZY_SHORTEST_PATHS "LazyShortestPaths"
+#define STRING_XML_SHORTEST_PATH_TREE_CACHE_SIZE "ShortestPathTreeCacheSize"
+#define STRING_XML_NUMBER_ROUTE_PLAN_THREADS "NumberRoutePlanThreads"
 
 
 #define COUT_INFO_MSG(MESSAGE) std::cout << "<>RoutePlannerVisibility::" << MESSAGE << std::endl;std::cout.flush();
@@ -80,6 +84,7 @@ RoutePlannerVisibilityService::RoutePlannerVisibilityService()
 
 RoutePlannerVisibilityService::~RoutePlannerVisibilityService()
 {
+    terminateRoutePlanThreads();
 };
 
 bool
@@ -105,6 +110,25 @@ RoutePlannerVisibilityService::configure(const pugi::xml_node& ndComponent)
         m_isRoutAggregator = ndComponent.attribute(STRING_XML_IS_ROUTE_AGGREGATOR).as_bool();
     }
 
+    if (!ndComponent.attribute(STRING_XML_LAZY_SHORTEST_PATHS).empty())
+    {
+        m_isLazyShortestPaths = ndComponent.attribute(STRING_XML_LAZY_SHORTEST_PATHS).as_bool();
+    }
+
+    if (!ndComponent.attribute(STRING_XML_SHORTEST_PATH_TREE_CACHE_SIZE).empty())
+    {
+        m_shortestPathTreeCacheSize = ndComponent.attribute(STRING_XML_SHORTEST_PATH_TREE_CACHE_SIZE).as_uint();
+    }
+
+    if (!ndComponent.attribute(STRING_XML_NUMBER_ROUTE_PLAN_THREADS).empty())
+    {
+        m_numberRoutePlanThreads = ndComponent.attribute(STRING_XML_NUMBER_ROUTE_PLAN_THREADS).as_uint();
+    }
+    if (m_numberRoutePlanThreads == 0)
+    {
+        m_numberRoutePlanThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
     if (!ndComponent.attribute(STRING_XML_OSM_FILE_NAME).empty())
     {
         std::string osmFileName = ndComponent.attribute(STRING_XML_OSM_FILE_NAME).value();
@@ -113,6 +137,8 @@ RoutePlannerVisibilityService::configure(const pugi::xml_node& ndComponent)
         auto start = std::chrono::system_clock::now();
 
         m_osmBaseVisibilityGraph = std::make_shared<n_FrameworkLib::CVisibilityGraph>();
+        m_osmBaseVisibilityGraph->bGetLazyShortestPathsBase() = m_isLazyShortestPaths;
+        m_osmBaseVisibilityGraph->szGetShortestPathTreeCacheSizeBase() = m_shortestPathTreeCacheSize;
         auto errAddPolygon = m_osmBaseVisibilityGraph->errBuildVisibilityGraphWithOsm(osmFileName);
 #ifdef STEVETEST
         if (errAddPolygon == n_FrameworkLib::CVisibilityGraph::errNoError)
@@ -137,18 +163,37 @@ RoutePlannerVisibilityService::configure(const pugi::xml_node& ndComponent)
         m_minimumWaypointSeparation_m = ndComponent.attribute(STRING_XML_MINIMUM_WAYPOINT_SEPARATION_M).as_double();
     }
 
-    addSubscriptionAddress(afrl::cmasi::KeepOutZone::Subscription);
-    addSubscriptionAddress(afrl::cmasi::KeepInZone::Subscription);
-    addSubscriptionAddress(afrl::cmasi::OperatingRegion::Subscription);
+    on<afrl::cmasi::KeepOutZone>([this](const std::shared_ptr<afrl::cmasi::KeepOutZone>& keepOutZone, const uxas::communications::data::LmcpMessage&)
+    {
+        bProcessZone(keepOutZone, false);
+        return (false);
+    });
+    on<afrl::cmasi::KeepInZone>([this](const std::shared_ptr<afrl::cmasi::KeepInZone>& keepInZone, const uxas::communications::data::LmcpMessage&)
+    {
+        bProcessZone(keepInZone, true);
+        return (false);
+    });
+    on<afrl::cmasi::OperatingRegion>([this](const std::shared_ptr<afrl::cmasi::OperatingRegion>& operatingRegion, const uxas::communications::data::LmcpMessage&)
+    {
+        bProcessOperatingRegion(operatingRegion);
+        return (false);
+    });
 
     //ENTITY CONFIGURATIONS
-    addSubscriptionAddress(afrl::cmasi::EntityConfiguration::Subscription);
-    std::vector< std::string > childconfigs = afrl::cmasi::EntityConfigurationDescendants();
-    for(auto child : childconfigs)
-        addSubscriptionAddress(child);
+    onDescendants<afrl::cmasi::EntityConfiguration>(afrl::cmasi::EntityConfigurationDescendants(),
+        [this](const std::shared_ptr<afrl::cmasi::EntityConfiguration>& entityConfiguration, const uxas::communications::data::LmcpMessage&)
+    {
+        m_idVsEntityConfiguration[entityConfiguration->getID()] = entityConfiguration;
+        calculatePlannerParameters(entityConfiguration);
+        return (false);
+    });
     
     // service 'global' path planning requests (system assumes aircraft)
-    addSubscriptionAddress(uxas::messages::route::RoutePlanRequest::Subscription);
+    on<uxas::messages::route::RoutePlanRequest>([this](const std::shared_ptr<uxas::messages::route::RoutePlanRequest>& routePlanRequest, const uxas::communications::data::LmcpMessage& receivedLmcpMessage)
+    {
+        processRoutePlanRequest(routePlanRequest, receivedLmcpMessage);
+        return (false);
+    });
     
     // requests directed to an aircraft planner should also be handled
     addSubscriptionAddress(uxas::common::MessageGroup::AircraftPathPlanner());
@@ -156,11 +201,17 @@ RoutePlannerVisibilityService::configure(const pugi::xml_node& ndComponent)
     if (m_isRoutAggregator)
     {
          // ENTITY STATES
-        addSubscriptionAddress(afrl::cmasi::EntityState::Subscription);
-        std::vector< std::string > childstates = afrl::cmasi::EntityStateDescendants();
-        for(auto child : childstates)
-            addSubscriptionAddress(child);
-        addSubscriptionAddress(uxas::messages::route::RouteRequest::Subscription);
+        onDescendants<afrl::cmasi::EntityState>(afrl::cmasi::EntityStateDescendants(),
+            [this](const std::shared_ptr<afrl::cmasi::EntityState>& entityState, const uxas::communications::data::LmcpMessage&)
+        {
+            m_idVsEntityState[entityState->getID()] = entityState;
+            return (false);
+        });
+        on<uxas::messages::route::RouteRequest>([this](const std::shared_ptr<uxas::messages::route::RouteRequest>& routeRequest, const uxas::communications::data::LmcpMessage&)
+        {
+            bProcessRouteRequest(routeRequest);
+            return (false);
+        });
     }
 
     return (isSucceeded);
@@ -177,79 +228,274 @@ RoutePlannerVisibilityService::initialize()
     operatingRegion0->setID(0);
     bProcessOperatingRegion(operatingRegion0);
 
-
+    // RoutePlanRequests received together are planned by these threads and the service thread
+    for (uint32_t countThreads = 1; countThreads < m_numberRoutePlanThreads; countThreads++)
+    {
+        try
+        {
+            m_routePlanThreads.push_back(std::thread(&RoutePlannerVisibilityService::executeRoutePlanThread, this));
+        }
+        catch (const std::system_error&)
+        {
+            CERR_FILE_LINE_MSG("Warning:: started only [" << m_routePlanThreads.size() << "] of [" << (m_numberRoutePlanThreads - 1) << "] route plan threads.")
+            break;
+        }
+    }
 
     return (isSuccess);
 };
 
+bool
+RoutePlannerVisibilityService::terminate()
+{
+    terminateRoutePlanThreads();
+    return (true);
+};
+
 bool
 RoutePlannerVisibilityService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
 {
-    auto entityConfig = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
-    
-    if (entityConfig)
-    {
-        auto entityConfiguration = std::static_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
-        m_idVsEntityConfiguration[entityConfig->getID()] = entityConfig;
-        calculatePlannerParameters(entityConfig);
-    }
-    else if (entityState)
-    {
-        m_idVsEntityState[entityState->getID()] = entityState;
-    }
-    else if (afrl::cmasi::isKeepInZone(receivedLmcpMessage->m_object.get()))
+    // subscribed messages are handled by the handlers registered in configure
+    CERR_FILE_LINE_MSG("WARNING::Unknown Message Type Encountered receivedLmcpMessage->getObject()->getLmcpTypeName()[" << receivedLmcpMessage->getObject()->getLmcpTypeName() << "]")
+    return (false); // always false implies never terminating service from here
+}
+
+bool
+RoutePlannerVisibilityService::processReceivedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages)
+{
+    // consecutive route plan requests are planned together, all other messages are dispatched in the order they were received
+    std::vector<std::unique_ptr<uxas::communications::data::LmcpMessage> > routePlanRequestMessages;
+    while (!receivedLmcpMessages.empty())
     {
-        bProcessZone(std::static_pointer_cast<afrl::cmasi::AbstractZone>(receivedLmcpMessage->m_object), true);
+        auto receivedLmcpMessage = receivedLmcpMessages.pop_front();
+        if (uxas::messages::route::isRoutePlanRequest(receivedLmcpMessage->getObject().get()))
+        {
+            routePlanRequestMessages.push_back(std::move(receivedLmcpMessage));
+            continue;
+        }
+        processRoutePlanRequests(routePlanRequestMessages);
+        if (dispatchReceivedLmcpMessage(std::move(receivedLmcpMessage)))
+        {
+            receivedLmcpMessages.clear();
+            return (true);
+        }
     }
-    else if (afrl::cmasi::isKeepOutZone(receivedLmcpMessage->m_object.get()))
+    processRoutePlanRequests(routePlanRequestMessages);
+    return (false);
+}
+
+void
+RoutePlannerVisibilityService::processRoutePlanRequest(const std::shared_ptr<uxas::messages::route::RoutePlanRequest>& request,
+                                                       const uxas::communications::data::LmcpMessage& receivedLmcpMessage)
+{
+    if (isRoutePlanVehicle(request->getVehicleID()))
     {
-        bProcessZone(std::static_pointer_cast<afrl::cmasi::AbstractZone>(receivedLmcpMessage->m_object), false);
+        auto routePlanResponse = std::make_shared<uxas::messages::route::RoutePlanResponse>();
+        if (isRoutePlanRequestPlanned(request, routePlanResponse))
+        {
+            sendRoutePlanResponse(routePlanResponse, receivedLmcpMessage);
+        }
+        else
+        {
+           CERR_FILE_LINE_MSG("Error processing route plan request")
+        }
     }
-    else if (afrl::cmasi::isOperatingRegion(receivedLmcpMessage->m_object.get()))
+    else
     {
-        bProcessOperatingRegion(std::static_pointer_cast<afrl::cmasi::OperatingRegion>(receivedLmcpMessage->m_object));
+       CERR_FILE_LINE_MSG("No available air vehicle configurations")
     }
-    else if (uxas::messages::route::isRouteRequest(receivedLmcpMessage->m_object.get()))
+}
+
+void
+RoutePlannerVisibilityService::processRoutePlanRequests(std::vector<std::unique_ptr<uxas::communications::data::LmcpMessage> >& routePlanRequestMessages)
+{
+    if (routePlanRequestMessages.size() == 1)
     {
-        bProcessRouteRequest(std::static_pointer_cast<uxas::messages::route::RouteRequest>(receivedLmcpMessage->m_object));
+        processRoutePlanRequest(std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>(routePlanRequestMessages.front()->getObject()),
+                *routePlanRequestMessages.front());
     }
-    else if (uxas::messages::route::isRoutePlanRequest(receivedLmcpMessage->m_object.get()))
+    else if (routePlanRequestMessages.size() > 1)
     {
-        auto request = std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>(receivedLmcpMessage->m_object);
-        auto itEntityConfiguration = m_idVsEntityConfiguration.find(request->getVehicleID());
-        if (itEntityConfiguration != m_idVsEntityConfiguration.end() &&
-                (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(itEntityConfiguration->second) ||
-                std::dynamic_pointer_cast<afrl::vehicles::SurfaceVehicleConfiguration>(itEntityConfiguration->second)))
+        // the requests only read the visibility graphs and planner parameters, so they are planned on worker threads.
+        // the responses are sent from this thread, in the order the requests were received
+        std::vector<std::shared_ptr<uxas::messages::route::RoutePlanRequest> > requests;
+        std::vector<std::shared_ptr<uxas::messages::route::RoutePlanResponse> > routePlanResponses;
+        for (auto itMessage = routePlanRequestMessages.begin(); itMessage != routePlanRequestMessages.end(); itMessage++)
         {
-            auto routePlanResponse = std::make_shared<uxas::messages::route::RoutePlanResponse>();
-            if (bProcessRoutePlanRequest(request, routePlanResponse))
+            requests.push_back(std::static_pointer_cast<uxas::messages::route::RoutePlanRequest>((*itMessage)->getObject()));
+            if (isRoutePlanVehicle(requests.back()->getVehicleID()))
             {
-                auto message = std::static_pointer_cast<avtas::lmcp::Object>(routePlanResponse);
-                // always limited-cast route plan responses
-                sendSharedLmcpObjectLimitedCastMessage(
-                        getNetworkClientUnicastAddress(
-                            receivedLmcpMessage->m_attributes->getSourceEntityId(),
-                            receivedLmcpMessage->m_attributes->getSourceServiceId()
-                        ),
-                        message);
+                routePlanResponses.push_back(std::make_shared<uxas::messages::route::RoutePlanResponse>());
             }
             else
             {
-               CERR_FILE_LINE_MSG("Error processing route plan request")
+                routePlanResponses.push_back(nullptr);
+                CERR_FILE_LINE_MSG("No available air vehicle configurations")
             }
         }
-        else
+
+        // the first lat/long conversion sets the linearization point of the (static) unit conversions. It is made here, before the
+        // workers start, for the location that is converted first when the requests are planned in order
+        for (size_t request = 0; request < requests.size(); request++)
         {
-           CERR_FILE_LINE_MSG("No available air vehicle configurations")
+            if (routePlanResponses[request] && !requests[request]->getRouteRequests().empty() &&
+                    (m_idVsPlannerParameters.find(requests[request]->getVehicleID()) != m_idVsPlannerParameters.end()) &&
+                    (m_operatingIdVsBaseVisibilityGraph.find(requests[request]->getOperatingRegion()) != m_operatingIdVsBaseVisibilityGraph.end()))
+            {
+                uxas::common::utilities::CUnitConversions unitConversions;
+                afrl::cmasi::Location3D* startLocation = requests[request]->getRouteRequests().front()->getStartLocation();
+                double dNorth_m(0.0);
+                double dEast_m(0.0);
+                unitConversions.ConvertLatLong_degToNorthEast_m(startLocation->getLatitude(), startLocation->getLongitude(), dNorth_m, dEast_m);
+                break;
+            }
+        }
+
+        std::vector<uint8_t> isPlanned(requests.size(), 0);
+        std::function<void(size_t)> planRequest = [&](size_t request)
+        {
+            if (routePlanResponses[request])
+            {
+                isPlanned[request] = isRoutePlanRequestPlanned(requests[request], routePlanResponses[request]);
+            }
+        };
+        planOnRoutePlanThreads(requests.size(), planRequest);
+
+        for (size_t request = 0; request < requests.size(); request++)
+        {
+            if (!routePlanResponses[request])
+            {
+                continue;
+            }
+            if (isPlanned[request])
+            {
+                sendRoutePlanResponse(routePlanResponses[request], *routePlanRequestMessages[request]);
+            }
+            else
+            {
+                CERR_FILE_LINE_MSG("Error processing route plan request")
+            }
         }
     }
-    else
+    routePlanRequestMessages.clear();
+}
+
+bool
+RoutePlannerVisibilityService::isRoutePlanRequestPlanned(const std::shared_ptr<uxas::messages::route::RoutePlanRequest>& routePlanRequest,
+                                                         std::shared_ptr<uxas::messages::route::RoutePlanResponse>& routePlanResponse)
+{
+    try
     {
-        CERR_FILE_LINE_MSG("WARNING::Unknown Message Type Encountered receivedLmcpMessage->m_object->getLmcpTypeName()[" << receivedLmcpMessage->m_object->getLmcpTypeName() << "]")
+        return (bProcessRoutePlanRequest(routePlanRequest, routePlanResponse));
     }
-    return (false); // always false implies never terminating service from here
+    catch (std::exception& ex)
+    {
+        CERR_FILE_LINE_MSG("Error:: planning RoutePlanRequestId[" << routePlanRequest->getRequestID() << "] EXCEPTION: " << ex.what())
+        routePlanResponse = std::make_shared<uxas::messages::route::RoutePlanResponse>();
+        routePlanResponse->setResponseID(routePlanRequest->getRequestID());
+        routePlanResponse->setAssociatedTaskID(routePlanRequest->getAssociatedTaskID());
+        routePlanResponse->setOperatingRegion(routePlanRequest->getOperatingRegion());
+        routePlanResponse->setVehicleID(routePlanRequest->getVehicleID());
+        for (auto itRequest = routePlanRequest->getRouteRequests().begin(); itRequest != routePlanRequest->getRouteRequests().end(); itRequest++)
+        {
+            auto routePlan = new uxas::messages::route::RoutePlan;
+            routePlan->setRouteID((*itRequest)->getRouteID());
+            routePlan->setRouteCost(-1);
+            auto keyValuePair = new afrl::cmasi::KeyValuePair;
+            keyValuePair->setKey("RoutePlanError");
+            keyValuePair->setValue(ex.what());
+            routePlan->getRouteError().push_back(keyValuePair);
+            routePlanResponse->getRouteResponses().push_back(routePlan);
+        }
+        return (true);
+    }
+}
+
+void
+RoutePlannerVisibilityService::planOnRoutePlanThreads(const size_t& numberRequests, const std::function<void(size_t)>& planRequest)
+{
+    std::unique_lock<std::mutex> lock(m_routePlanMutex);
+    m_planRequest = &planRequest;
+    m_numberRequests = numberRequests;
+    m_nextRequest = 0;
+    m_numberRequestsPlanned = 0;
+    m_routePlanWorkAvailable.notify_all();
+    while (m_nextRequest < m_numberRequests)
+    {
+        size_t request = m_nextRequest++;
+        lock.unlock();
+        planRequest(request);
+        lock.lock();
+        m_numberRequestsPlanned++;
+    }
+    m_routePlanWorkDone.wait(lock, [this]() { return (m_numberRequestsPlanned == m_numberRequests); });
+    m_planRequest = nullptr;
+    m_numberRequests = 0;
+    m_nextRequest = 0;
+}
+
+void
+RoutePlannerVisibilityService::executeRoutePlanThread()
+{
+    std::unique_lock<std::mutex> lock(m_routePlanMutex);
+    while (true)
+    {
+        m_routePlanWorkAvailable.wait(lock, [this]() { return (m_isTerminateRoutePlanThreads || (m_nextRequest < m_numberRequests)); });
+        if (m_isTerminateRoutePlanThreads)
+        {
+            break;
+        }
+        size_t request = m_nextRequest++;
+        const std::function<void(size_t)>& planRequest = *m_planRequest;
+        lock.unlock();
+        planRequest(request);
+        lock.lock();
+        if (++m_numberRequestsPlanned == m_numberRequests)
+        {
+            m_routePlanWorkDone.notify_one();
+        }
+    }
+}
+
+void
+RoutePlannerVisibilityService::terminateRoutePlanThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_routePlanMutex);
+        m_isTerminateRoutePlanThreads = true;
+    }
+    m_routePlanWorkAvailable.notify_all();
+    for (auto& routePlanThread : m_routePlanThreads)
+    {
+        if (routePlanThread.joinable())
+        {
+            routePlanThread.join();
+        }
+    }
+    m_routePlanThreads.clear();
+}
+
+bool
+RoutePlannerVisibilityService::isRoutePlanVehicle(const int64_t& vehicleId)
+{
+    auto itEntityConfiguration = m_idVsEntityConfiguration.find(vehicleId);
+    return (itEntityConfiguration != m_idVsEntityConfiguration.end() &&
+            (std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(itEntityConfiguration->second) ||
+            std::dynamic_pointer_cast<afrl::vehicles::SurfaceVehicleConfiguration>(itEntityConfiguration->second)));
+}
+
+void
+RoutePlannerVisibilityService::sendRoutePlanResponse(const std::shared_ptr<uxas::messages::route::RoutePlanResponse>& routePlanResponse,
+                                                     const uxas::communications::data::LmcpMessage& receivedLmcpMessage)
+{
+    auto message = std::static_pointer_cast<avtas::lmcp::Object>(routePlanResponse);
+    // always limited-cast route plan responses
+    sendSharedLmcpObjectLimitedCastMessage(
+            getNetworkClientUnicastAddress(
+                receivedLmcpMessage.m_attributes->getSourceEntityId(),
+                receivedLmcpMessage.m_attributes->getSourceServiceId()
+            ),
+            message);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,7 +528,15 @@ bool RoutePlannerVisibilityService::bProcessOperatingRegion(const std::shared_pt
 
     //TODO:: add a unique directory to save the edges and plans built using this operating region
 
+    if (bUpdateOperatingRegion(operatingRegion))
+    {
+        return (isSuccess);
+    }
+
+    n_FrameworkLib::M_UI64_PTR_BOUNDARY_t idVsBoundary;
     auto baseVisibilityGraph = std::make_shared<n_FrameworkLib::CVisibilityGraph>();
+    baseVisibilityGraph->bGetLazyShortestPathsBase() = m_isLazyShortestPaths;
+    baseVisibilityGraph->szGetShortestPathTreeCacheSizeBase() = m_shortestPathTreeCacheSize;
 
     // check to make sure we have all of the areas for the operating region
     for (auto itArea = operatingRegion->getKeepInAreas().begin(); itArea != operatingRegion->getKeepInAreas().end(); itArea++)
@@ -296,6 +550,7 @@ bool RoutePlannerVisibilityService::bProcessOperatingRegion(const std::shared_pt
         }
         else
         {
+            idVsBoundary[itBoundary->first] = itBoundary->second;
             n_FrameworkLib::CVisibilityGraph::enError errPolygon(n_FrameworkLib::CVisibilityGraph::errNoError);
             if (!itBoundary->second->vposGetBoundaryPoints_m().empty())
             {
@@ -328,6 +583,7 @@ bool RoutePlannerVisibilityService::bProcessOperatingRegion(const std::shared_pt
             }
             else
             {
+                idVsBoundary[itBoundary->first] = itBoundary->second;
                 n_FrameworkLib::CVisibilityGraph::enError errPolygon(n_FrameworkLib::CVisibilityGraph::errNoError);
                 if (!itBoundary->second->vposGetBoundaryPoints_m().empty())
                 {
@@ -378,11 +634,91 @@ bool RoutePlannerVisibilityService::bProcessOperatingRegion(const std::shared_pt
     if (isSuccess)
     {
         m_operatingIdVsBaseVisibilityGraph[operatingRegion->getID()] = baseVisibilityGraph;
+        m_operatingIdVsBoundaries[operatingRegion->getID()] = idVsBoundary;
     }
 
     return (isSuccess);
 }
 
+bool RoutePlannerVisibilityService::bUpdateOperatingRegion(const std::shared_ptr<afrl::cmasi::OperatingRegion>& operatingRegion)
+{
+    // adds the new keep-out zones of an operating region to its existing visibility graph.
+    // returns false if the graph needs to be rebuilt, i.e. there is no graph for the region, a zone was removed,
+    // changed, or added as a keep-in zone, or a new zone overlaps the existing zones
+    auto itVisibilityGraph = m_operatingIdVsBaseVisibilityGraph.find(operatingRegion->getID());
+    auto itBoundaries = m_operatingIdVsBoundaries.find(operatingRegion->getID());
+    if ((itVisibilityGraph == m_operatingIdVsBaseVisibilityGraph.end()) || (itBoundaries == m_operatingIdVsBoundaries.end()))
+    {
+        return (false);
+    }
+
+    // zones are replaced, not modified, when they are received so unchanged zones have the same boundary
+    n_FrameworkLib::M_UI64_PTR_BOUNDARY_t idVsBoundary;
+    std::vector<n_FrameworkLib::PTR_BOUNDARY_t> vptrBoundaryNew;
+    for (auto itArea = operatingRegion->getKeepInAreas().begin(); itArea != operatingRegion->getKeepInAreas().end(); itArea++)
+    {
+        auto itBoundary = m_idVsBoundary.find(*itArea);
+        auto itBoundaryOld = itBoundaries->second.find(*itArea);
+        if ((itBoundary == m_idVsBoundary.end()) || (itBoundaryOld == itBoundaries->second.end()) || (itBoundaryOld->second != itBoundary->second))
+        {
+            return (false);
+        }
+        idVsBoundary[itBoundary->first] = itBoundary->second;
+    }
+    for (auto itArea = operatingRegion->getKeepOutAreas().begin(); itArea != operatingRegion->getKeepOutAreas().end(); itArea++)
+    {
+        auto itBoundary = m_idVsBoundary.find(*itArea);
+        if (itBoundary == m_idVsBoundary.end())
+        {
+            return (false);
+        }
+        auto itBoundaryOld = itBoundaries->second.find(*itArea);
+        if (itBoundaryOld == itBoundaries->second.end())
+        {
+            if (itBoundary->second->bGetKeepInZone())
+            {
+                return (false);
+            }
+            if (idVsBoundary.find(itBoundary->first) == idVsBoundary.end())
+            {
+                vptrBoundaryNew.push_back(itBoundary->second);
+            }
+        }
+        else if (itBoundaryOld->second != itBoundary->second)
+        {
+            return (false);
+        }
+        idVsBoundary[itBoundary->first] = itBoundary->second;
+    }
+    if ((idVsBoundary.size() - vptrBoundaryNew.size()) != itBoundaries->second.size())
+    {
+        // a zone was removed from the region
+        return (false);
+    }
+
+    for (auto itBoundary = vptrBoundaryNew.begin(); itBoundary != vptrBoundaryNew.end(); itBoundary++)
+    {
+        n_FrameworkLib::CVisibilityGraph::enError errPolygon(n_FrameworkLib::CVisibilityGraph::errNoError);
+        if (!(*itBoundary)->vposGetBoundaryPoints_m().empty())
+        {
+            errPolygon = itVisibilityGraph->second->errAddKeepOutPolygonBase((*itBoundary)->getZoneID(),
+                    (*itBoundary)->vposGetBoundaryPoints_m().begin(),
+                    (*itBoundary)->vposGetBoundaryPoints_m().end(),
+                    (*itBoundary)->getPadding()
+                    );
+        }
+        if (errPolygon != n_FrameworkLib::CVisibilityGraph::errNoError)
+        {
+            // the graph no longer matches the stored boundaries, so it will be rebuilt
+            m_operatingIdVsBoundaries.erase(itBoundaries);
+            return (false);
+        }
+    }
+    itBoundaries->second = idVsBoundary;
+
+    return (true);
+}
+
 bool RoutePlannerVisibilityService::bProcessRouteRequest(const std::shared_ptr<uxas::messages::route::RouteRequest>& routeRequest)
 {
     bool isSuccess(true);
@@ -420,29 +756,45 @@ bool RoutePlannerVisibilityService::bProcessRoutePlanRequest(const std::shared_p
         routePlanResponse->setOperatingRegion(routePlanRequest->getOperatingRegion());
         routePlanResponse->setVehicleID(routePlanRequest->getVehicleID());
 
-        // convert uav position and waypoint positions to lat,long
+        // convert uav position and waypoint positions from lat,long, once for each unique location
+        std::map<std::pair<double, double>, n_FrameworkLib::CPosition> latLongVsPosition;
+        auto getPosition = [&](afrl::cmasi::Location3D* location) -> const n_FrameworkLib::CPosition&
+        {
+            auto itPosition = latLongVsPosition.find(std::make_pair(location->getLatitude(), location->getLongitude()));
+            if (itPosition == latLongVsPosition.end())
+            {
+                double dNorth_m(0.0);
+                double dEast_m(0.0);
+                unitConversions.ConvertLatLong_degToNorthEast_m(location->getLatitude(), location->getLongitude(), dNorth_m, dEast_m);
+                itPosition = latLongVsPosition.insert(std::make_pair(std::make_pair(location->getLatitude(), location->getLongitude()),
+                        n_FrameworkLib::CPosition(dNorth_m, dEast_m))).first;
+            }
+            return (itPosition->second);
+        };
+
+        std::vector<std::shared_ptr<n_FrameworkLib::CPathInformation> > pathInformations;
         for (auto itRequest = routePlanRequest->getRouteRequests().begin();
                 itRequest != routePlanRequest->getRouteRequests().end();
                 itRequest++)
         {
             auto pathInformation = std::make_shared<n_FrameworkLib::CPathInformation>();
-            double dNorth_m(0.0);
-            double dEast_m(0.0);
-
-            unitConversions.ConvertLatLong_degToNorthEast_m((*itRequest)->getStartLocation()->getLatitude(),
-                    (*itRequest)->getStartLocation()->getLongitude(), dNorth_m, dEast_m);
-            pathInformation->posGetStart() = n_FrameworkLib::CPosition(dNorth_m, dEast_m);
-
-            unitConversions.ConvertLatLong_degToNorthEast_m((*itRequest)->getEndLocation()->getLatitude(),
-                    (*itRequest)->getEndLocation()->getLongitude(), dNorth_m, dEast_m);
-            pathInformation->posGetEnd() = n_FrameworkLib::CPosition(dNorth_m, dEast_m);
+            pathInformation->posGetStart() = getPosition((*itRequest)->getStartLocation());
+            pathInformation->posGetEnd() = getPosition((*itRequest)->getEndLocation());
+            pathInformations.push_back(pathInformation);
+        }
 
-            if (itOperatingVisibilityGraph->second->isFindPath(pathInformation))
+        // find all of the routes together so the locations are only connected to the visibility graph once
+        if (itOperatingVisibilityGraph->second->isFindPaths(pathInformations))
+        {
+            auto itPathInformation = pathInformations.begin();
+            for (auto itRequest = routePlanRequest->getRouteRequests().begin();
+                    itRequest != routePlanRequest->getRouteRequests().end();
+                    itRequest++, itPathInformation++)
             {
                 auto routePlan = std::make_shared<uxas::messages::route::RoutePlan>();
                 routePlan->setRouteID((*itRequest)->getRouteID());
                 double routeCost_ms = static_cast<int64_t> (((itPlannerParameters->second->nominalSpeed_mps > 0.0) ?
-                        (pathInformation->iGetLength() / itPlannerParameters->second->nominalSpeed_mps) : (0.0))*1000.0);
+                        ((*itPathInformation)->iGetLength() / itPlannerParameters->second->nominalSpeed_mps) : (0.0))*1000.0);
                 routePlan->setRouteCost(routeCost_ms);
                 if (!routePlanRequest->getIsCostOnlyRequest())
                 {
@@ -452,17 +804,17 @@ bool RoutePlannerVisibilityService::bProcessRoutePlanRequest(const std::shared_p
                         enpathType = n_FrameworkLib::CTrajectoryParameters::pathEuclidean;
                     }
                     
-                    isCalculateWaypoints(itOperatingVisibilityGraph->second, pathInformation, routePlanRequest->getVehicleID(),
+                    isCalculateWaypoints(itOperatingVisibilityGraph->second, *itPathInformation, routePlanRequest->getVehicleID(),
                             (*itRequest)->getStartHeading(), (*itRequest)->getEndHeading(),
                             routePlan->getWaypoints(),enpathType);
                 }
                 routePlanResponse->getRouteResponses().push_back(routePlan->clone());
             }
-            else
-            {
-                CERR_FILE_LINE_MSG("Error:: could not find route for RouteRequestId[" << (*itRequest)->getRouteID() << "].")
-                isSuccess = false;
-            }
+        }
+        else
+        {
+            CERR_FILE_LINE_MSG("Error:: could not find routes for RoutePlanRequestId[" << routePlanRequest->getRequestID() << "].")
+            isSuccess = false;
         }
     } //if(operatingVisibilityGraph == m_operatingIdVsBaseVisibilityGraph.end())
     return (isSuccess);
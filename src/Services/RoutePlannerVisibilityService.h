@@ -32,6 +32,10 @@
 
 #include "ServiceBase.h"
 
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace uxas
 {
@@ -42,20 +46,35 @@ namespace service
     \brief A component that constructs plans/costs to be used for assignments.
 
  * 1) Receive KeepInZones/KeepOutZones/Tasks/RoutePlanRequests
- * 2) Build/Maintain Base Visibility Graph (Euclidean) from KeepInZones/KeepOutZones
+ * 2) Build/Maintain Base Visibility Graph (Euclidean) from KeepInZones/KeepOutZones.
+ *    When an OperatingRegion is received again with only new KeepOutZones, the
+ *    zones are added to its existing graph instead of rebuilding it
  * 3) ???Construct, and send out, a RoutePlanResponse which includes minimum
  *    path lengths from each vehicle to each task and from each task to every other task.?????
+ *    The routes of a RoutePlanRequest are found together, so each unique start and
+ *    end location is connected to the visibility graph once. RoutePlanRequests
+ *    received together are planned on a pool of worker threads, started in
+ *    initialize. A RoutePlanRequest whose planning fails is answered with
+ *    negative route costs and the error in each route
  * 4) ???Construct, and send out, a ???Response which includes minimum waypoint paths
  *    paths for each plan request.?????
  * 
  * Configuration String: 
  *  <Service Type="RoutePlannerVisibilityService" TurnRadiusOffset_m="0.0" 
-  *                OsmFileName="" MinimumWaypointSeparation_m="50.0"/> 
+  *                OsmFileName="" MinimumWaypointSeparation_m="50.0"
+  *                LazyShortestPaths="false" ShortestPathTreeCacheSize="64"
+  *                NumberRoutePlanThreads="0"/> 
  * 
  * Options:
  *  - TurnRadiusOffset_m
  *  - OsmFileName
  *  - MinimumWaypointSeparation_m
+ *  - LazyShortestPaths - compute single source shortest path trees when they
+ *    are needed instead of all pairs shortest paths when a graph is built
+ *  - ShortestPathTreeCacheSize - maximum number of shortest path trees kept
+ *    for each graph when LazyShortestPaths is set
+ *  - NumberRoutePlanThreads - number of threads used to plan RoutePlanRequests
+ *    that are received together, 0 uses one thread per hardware thread
  *  - 
  *  - 
  * 
@@ -134,12 +153,15 @@ private:
     //bool
     //start() override;
 
-    //bool
-    //terminate() override;
+    bool
+    terminate() override;
 
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
 
+    bool
+    processReceivedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages) override;
+
 
 public:
 
@@ -154,8 +176,26 @@ public: //virtual
 public:
 
 protected:
+    void processRoutePlanRequest(const std::shared_ptr<uxas::messages::route::RoutePlanRequest>& request,
+            const uxas::communications::data::LmcpMessage& receivedLmcpMessage);
+    void processRoutePlanRequests(std::vector<std::unique_ptr<uxas::communications::data::LmcpMessage> >& routePlanRequestMessages);
+    /*! \brief  plans the request. If planning throws, the response reports the error in each of its routes (negative cost) and true is returned,
+     * so the request is still answered */
+    bool isRoutePlanRequestPlanned(const std::shared_ptr<uxas::messages::route::RoutePlanRequest>& routePlanRequest,
+            std::shared_ptr<uxas::messages::route::RoutePlanResponse>& routePlanResponse);
+    /*! \brief  calls planRequest for each request index, on the route plan threads and on this thread, and returns when all are planned.
+     * planRequest must not throw */
+    void planOnRoutePlanThreads(const size_t& numberRequests, const std::function<void(size_t)>& planRequest);
+    /*! \brief  route plan thread: plans the requests of the current batch until terminated */
+    void executeRoutePlanThread();
+    /*! \brief  stops and joins the route plan threads */
+    void terminateRoutePlanThreads();
+    bool isRoutePlanVehicle(const int64_t& vehicleId);
+    void sendRoutePlanResponse(const std::shared_ptr<uxas::messages::route::RoutePlanResponse>& routePlanResponse,
+            const uxas::communications::data::LmcpMessage& receivedLmcpMessage);
     bool bProcessZone(const std::shared_ptr<afrl::cmasi::AbstractZone>& abstractZone, const bool& isKeepIn);
     bool bProcessOperatingRegion(const std::shared_ptr<afrl::cmasi::OperatingRegion>& operatingRegion);
+    bool bUpdateOperatingRegion(const std::shared_ptr<afrl::cmasi::OperatingRegion>& operatingRegion);
     bool bProcessRouteRequest(const std::shared_ptr<uxas::messages::route::RouteRequest>& routeRequest);
     bool bProcessRoutePlanRequest(const std::shared_ptr<uxas::messages::route::RoutePlanRequest>& routePlanRequest,
             std::shared_ptr<uxas::messages::route::RoutePlanResponse>& routePlanResponse);
@@ -188,6 +228,8 @@ protected:
     n_FrameworkLib::M_UI64_PTR_BOUNDARY_t m_idVsBoundary;
     /*! \brief  storage for operating region visibility graphs */
     std::map<int64_t, n_FrameworkLib::PTR_VISIBILITYGRAPH_t> m_operatingIdVsBaseVisibilityGraph;
+    /*! \brief  storage for the keep-in/keep-out boundaries used to build each operating region visibility graph */
+    std::map<int64_t, n_FrameworkLib::M_UI64_PTR_BOUNDARY_t> m_operatingIdVsBoundaries;
     /*! \brief  storage for an openstreetmap based visibility graph */
     n_FrameworkLib::PTR_VISIBILITYGRAPH_t m_osmBaseVisibilityGraph;
 
@@ -202,7 +244,27 @@ protected:
 
     double m_minimumWaypointSeparation_m = 50; //TODO:: this need to be configurable
 
+    /*! \brief  when this is set to true, the visibility graphs compute shortest path trees on demand instead of all pairs shortest paths.*/
+    bool m_isLazyShortestPaths{false};
+
+    /*! \brief  maximum number of shortest path trees cached by each visibility graph when m_isLazyShortestPaths is set.*/
+    size_t m_shortestPathTreeCacheSize{64};
+    /*! \brief  number of threads used to plan RoutePlanRequests that are received together.*/
+    uint32_t m_numberRoutePlanThreads{0};
+
 private:
+    /*! \brief  route plan threads, started in initialize (the service thread is the other planning thread)*/
+    std::vector<std::thread> m_routePlanThreads;
+    /*! \brief  guards the batch of requests being planned and m_isTerminateRoutePlanThreads*/
+    std::mutex m_routePlanMutex;
+    std::condition_variable m_routePlanWorkAvailable;
+    std::condition_variable m_routePlanWorkDone;
+    /*! \brief  plans one request of the current batch*/
+    const std::function<void(size_t)>* m_planRequest{nullptr};
+    size_t m_numberRequests{0};
+    size_t m_nextRequest{0};
+    size_t m_numberRequestsPlanned{0};
+    bool m_isTerminateRoutePlanThreads{false};
 
 
 
@@ -101,10 +101,10 @@ SensorManagerService::initialize()
 
 bool
 SensorManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
     bool isMessageProcessed(false);
-    auto entityConfiguration = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+    auto entityConfiguration = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
     if (entityConfiguration)
     {
         m_idVsEntityConfiguration.insert(std::make_pair(entityConfiguration->getID(), entityConfiguration));
@@ -112,7 +112,7 @@ SensorManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
     }
     if (!isMessageProcessed)
     {
-        auto sensorFootprintRequests = std::dynamic_pointer_cast<uxas::messages::task::SensorFootprintRequests>(receivedLmcpMessage->m_object);
+        auto sensorFootprintRequests = std::dynamic_pointer_cast<uxas::messages::task::SensorFootprintRequests>(receivedLmcpMessage->getObject());
         if (sensorFootprintRequests)
         {
             ProcessSensorFootprintRequests(sensorFootprintRequests);
@@ -122,7 +122,7 @@ SensorManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
     }
     if (!isMessageProcessed)
     {
-        //CERR_FILE_LINE_MSG("WARNING::SensorManagerService::ProcessMessage: MessageType [" << receivedLmcpMessage->m_object->getFullLmcpTypeName() << "] not processed.")
+        //CERR_FILE_LINE_MSG("WARNING::SensorManagerService::ProcessMessage: MessageType [" << receivedLmcpMessage->getObject()->getFullLmcpTypeName() << "] not processed.")
     }
     return (false); // always false implies never terminating service from here
 };
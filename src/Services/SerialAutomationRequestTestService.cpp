@@ -89,24 +89,24 @@ SerialAutomationRequestTestService::initialize()
 
 bool
 SerialAutomationRequestTestService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
-        if (afrl::cmasi::isAutomationRequest(receivedLmcpMessage->m_object.get()) || afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->m_object.get()))
+        if (afrl::cmasi::isAutomationRequest(receivedLmcpMessage->getObject().get()) || afrl::impact::isImpactAutomationRequest(receivedLmcpMessage->getObject().get()))
         {
             if (m_waitingRequests.empty() && m_isAllClear)
             {
                 m_isAllClear = false;
-                sendSharedLmcpObjectLimitedCastMessage("UniqueAutomationRequest", receivedLmcpMessage->m_object);
+                sendSharedLmcpObjectLimitedCastMessage("UniqueAutomationRequest", receivedLmcpMessage->getObject());
 
                 // reset the timer
                 uxas::common::TimerManager::getInstance().startSingleShotTimer(m_responseTimerId, m_maxResponseTime_ms);
             }
             else
             {
-                m_waitingRequests.push_back(receivedLmcpMessage->m_object);
+                m_waitingRequests.push_back(receivedLmcpMessage->getObject());
             }
         }
-        else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->m_object.get()) || afrl::impact::isImpactAutomationResponse(receivedLmcpMessage->m_object.get()))
+        else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->getObject().get()) || afrl::impact::isImpactAutomationResponse(receivedLmcpMessage->getObject().get()))
         {
             OnResponseTimeout();
         }
@@ -152,5 +152,58 @@ ServiceBase::initializeAndStartService()
     return (isSuccess);
 };
 
+bool
+ServiceBase::dispatchReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
+{
+    if (receivedLmcpMessage->m_object && !(m_lmcpObjectHandlers.empty() && m_lmcpDescendantHandlers.empty()))
+    {
+        LmcpTypeKey typeKey(receivedLmcpMessage->m_object->getSeriesNameAsLong(), receivedLmcpMessage->m_object->getLmcpType());
+        auto itHandler = m_resolvedLmcpObjectHandlers.find(typeKey);
+        if (itHandler == m_resolvedLmcpObjectHandlers.end())
+        {
+            // first message of this type - exact type handler, then first matching descendant handler
+            LmcpMessageHandler handler;
+            auto itObjectHandler = m_lmcpObjectHandlers.find(typeKey);
+            if (itObjectHandler != m_lmcpObjectHandlers.end())
+            {
+                handler = itObjectHandler->second;
+            }
+            else
+            {
+                for (const auto& descendantHandler : m_lmcpDescendantHandlers)
+                {
+                    if (descendantHandler.first(receivedLmcpMessage->m_object.get()))
+                    {
+                        handler = descendantHandler.second;
+                        break;
+                    }
+                }
+            }
+            itHandler = m_resolvedLmcpObjectHandlers.emplace(typeKey, handler).first;
+        }
+
+        if (itHandler->second)
+        {
+            return (itHandler->second(*receivedLmcpMessage));
+        }
+    }
+
+    return (processReceivedLmcpMessage(std::move(receivedLmcpMessage)));
+};
+
+bool
+ServiceBase::processReceivedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages)
+{
+    while (!receivedLmcpMessages.empty())
+    {
+        if (dispatchReceivedLmcpMessage(receivedLmcpMessages.pop_front()))
+        {
+            receivedLmcpMessages.clear();
+            return (true);
+        }
+    }
+    return (false);
+};
+
 }; //namespace service
 }; //namespace uxas
@@ -11,9 +11,17 @@
 #define UXAS_SERVICE_SERVICE_BASE_H
 
 #include "LmcpObjectNetworkClientBase.h"
+#include "LmcpMessage.h"
 
 #include "UxAS_Log.h"
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace uxas
 {
 namespace service
@@ -110,6 +118,113 @@ protected:
         
     uxas::communications::LmcpObjectNetworkClientBase::ReceiveProcessingType m_receiveProcessingType{uxas::communications::LmcpObjectNetworkClientBase::ReceiveProcessingType::LMCP};
 
+    // <editor-fold defaultstate="collapsed" desc="Typed Message Dispatch">
+    /** \brief Handler of a received <b>LMCP</b> object of type <b>T</b> (the 
+     * received message provides the message attributes, e.g., source entity ID). 
+     * The object may be shared with other network clients and must not be modified.
+     * Returning true terminates the service (see <B><i>processReceivedLmcpMessage</i></B>). */
+    template <typename T>
+    using LmcpObjectHandler = std::function<bool(const std::shared_ptr<T>& lmcpObject, const uxas::communications::data::LmcpMessage& receivedLmcpMessage)>;
+
+    /** \brief Registers <b>handler</b> for received <b>LMCP</b> objects of 
+     * (exact) type <b>T</b> and subscribes to T::Subscription. Received objects 
+     * without a registered handler are passed to <B><i>processReceivedLmcpMessage</i></B>.
+     * 
+     * @param handler invoked for each received object of type <b>T</b>.
+     */
+    template <typename T>
+    void
+    on(LmcpObjectHandler<T> handler)
+    {
+        T prototype;
+        m_lmcpObjectHandlers[LmcpTypeKey(prototype.getSeriesNameAsLong(), prototype.getLmcpType())] = getLmcpMessageHandler<T>(std::move(handler));
+        m_resolvedLmcpObjectHandlers.clear();
+        addSubscriptionAddress(T::Subscription);
+    };
+
+    /** \brief Registers <b>handler</b> for received <b>LMCP</b> objects of 
+     * type <b>T</b> or any type derived from <b>T</b> and subscribes to 
+     * T::Subscription and <b>descendantSubscriptionAddresses</b> (e.g., 
+     * afrl::cmasi::EntityStateDescendants()). Handlers registered with 
+     * <B><i>on</i></B> take precedence.
+     * 
+     * @param descendantSubscriptionAddresses subscription addresses of types derived from <b>T</b>.
+     * @param handler invoked for each received object of type <b>T</b> (or derived type).
+     */
+    template <typename T>
+    void
+    onDescendants(const std::vector<std::string>& descendantSubscriptionAddresses, LmcpObjectHandler<T> handler)
+    {
+        m_lmcpDescendantHandlers.emplace_back(
+            [](const avtas::lmcp::Object* lmcpObject) { return (dynamic_cast<const T*>(lmcpObject) != nullptr); },
+            getLmcpMessageHandler<T>(std::move(handler)));
+        m_resolvedLmcpObjectHandlers.clear();
+        addSubscriptionAddress(T::Subscription);
+        for (const auto& descendantSubscriptionAddress : descendantSubscriptionAddresses)
+        {
+            addSubscriptionAddress(descendantSubscriptionAddress);
+        }
+    };
+
+    /** \brief Dispatches <b>receivedLmcpMessage</b> to the handler registered 
+     * for its type (see <B><i>on</i></B>) or, if none, to <B><i>processReceivedLmcpMessage</i></B>.
+     * 
+     * @param receivedLmcpMessage received <b>LMCP</b> message.
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    bool
+    dispatchReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage);
+
+    /** \brief Dispatches each received message (see <B><i>dispatchReceivedLmcpMessage</i></B>). */
+    bool
+    processReceivedLmcpMessages(uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages) override;
+
+private:
+
+    using LmcpMessageHandler = std::function<bool(const uxas::communications::data::LmcpMessage& receivedLmcpMessage)>;
+
+    /** \brief <b>LMCP</b> series ID and type ID of an <b>LMCP</b> object type */
+    struct LmcpTypeKey
+    {
+        LmcpTypeKey(int64_t seriesId, uint32_t typeId)
+        : m_seriesId(seriesId), m_typeId(typeId) { };
+
+        bool
+        operator==(const LmcpTypeKey& other) const { return (m_seriesId == other.m_seriesId && m_typeId == other.m_typeId); };
+
+        int64_t m_seriesId;
+        uint32_t m_typeId;
+    };
+
+    struct LmcpTypeKeyHash
+    {
+        size_t
+        operator()(const LmcpTypeKey& key) const { return (std::hash<int64_t>()(key.m_seriesId) ^ (std::hash<uint32_t>()(key.m_typeId) << 1)); };
+    };
+
+    template <typename T>
+    static
+    LmcpMessageHandler
+    getLmcpMessageHandler(LmcpObjectHandler<T> handler)
+    {
+        // the type key (or descendant test) guarantees the object is a T
+        return ([handler](const uxas::communications::data::LmcpMessage& receivedLmcpMessage)
+        {
+            return (handler(std::static_pointer_cast<T>(receivedLmcpMessage.getObject()), receivedLmcpMessage));
+        });
+    };
+
+    /** \brief Handlers registered with <B><i>on</i></B> */
+    std::unordered_map<LmcpTypeKey, LmcpMessageHandler, LmcpTypeKeyHash> m_lmcpObjectHandlers;
+
+    /** \brief Handlers registered with <B><i>onDescendants</i></B> (type test, handler) */
+    std::vector< std::pair< std::function<bool(const avtas::lmcp::Object*)>, LmcpMessageHandler > > m_lmcpDescendantHandlers;
+
+    /** \brief Handler resolved for each received type (empty implies 
+     * <B><i>processReceivedLmcpMessage</i></B>), so each type is resolved once */
+    std::unordered_map<LmcpTypeKey, LmcpMessageHandler, LmcpTypeKeyHash> m_resolvedLmcpObjectHandlers;
+    // </editor-fold>
+
     // <editor-fold defaultstate="collapsed" desc="Static Service Registry">    
 public:
 
@@ -157,7 +157,7 @@ ServiceManager::runUntil(uint32_t duration_s)
     UXAS_LOG_INFORM_ASSIGNMENT(s_typeName(),"****** All Services have been Terminated !!! ******");
 
     // terminate my client thread
-    m_isTerminateNetworkClient = true;
+    terminateNetworkClient();
     uint32_t checkBaseTerminateCount{0};
     while (!m_isBaseClassTerminationFinished && checkBaseTerminateCount++ < 20)
     {
@@ -484,9 +484,9 @@ bool
 ServiceManager::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
     bool isTerminateOnReturn{false};
-    if (uxas::messages::uxnative::isCreateNewService(receivedLmcpMessage->m_object.get()))
+    if (uxas::messages::uxnative::isCreateNewService(receivedLmcpMessage->getObject().get()))
     {
-        auto createNewService = std::static_pointer_cast<uxas::messages::uxnative::CreateNewService>(receivedLmcpMessage->m_object);
+        auto createNewService = std::static_pointer_cast<uxas::messages::uxnative::CreateNewService>(receivedLmcpMessage->getObject());
         std::string xmlConfig = createNewService->getXmlConfiguration() + "\n";
         uxas::common::StringUtil::ReplaceAll(xmlConfig, "&lt;", "<");
         uxas::common::StringUtil::ReplaceAll(xmlConfig, "&gt;", ">");
@@ -536,9 +536,9 @@ ServiceManager::processReceivedLmcpMessage(std::unique_ptr<uxas::communications:
             UXAS_LOG_ERROR(s_typeName(), "::processReceivedLmcpMessage failed to create service request via messaging");
         }
     }
-    else if (uxas::messages::uxnative::isKillService(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::uxnative::isKillService(receivedLmcpMessage->getObject().get()))
     {
-        auto killService = std::static_pointer_cast<uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object);
+        auto killService = std::static_pointer_cast<uxas::messages::uxnative::KillService>(receivedLmcpMessage->getObject());
 //        std::cout << std::endl << "******ServiceManager::processReceivedLmcpMessage::m_networkId[" 
 //                << m_networkId << "]  killService->getServiceID[" << killService->getServiceID() << "] !! ******" << std::endl << std::endl;
         if (killService->getServiceID() == m_networkId)
@@ -79,8 +79,8 @@ SimpleWaypointPlanManagerService::terminate()
 bool
 SimpleWaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
-    auto entityConfig = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
+    auto entityConfig = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
 
     if(entityState)
     {
@@ -90,9 +90,9 @@ SimpleWaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxa
     {
         m_configs[entityConfig->getID()] = entityConfig;
     }
-    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->m_object))
+    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto automationResponse = std::static_pointer_cast<afrl::cmasi::AutomationResponse> (receivedLmcpMessage->m_object);
+        auto automationResponse = std::static_pointer_cast<afrl::cmasi::AutomationResponse> (receivedLmcpMessage->getObject());
         for (auto mission : automationResponse->getMissionCommandList())
         {
             if (mission->getVehicleID() == m_vehicleID)
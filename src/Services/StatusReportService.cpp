@@ -137,7 +137,7 @@ bool StatusReportService::processReceivedLmcpMessage(std::unique_ptr<uxas::commu
     // lock during report update
     std::unique_lock<std::mutex> lock(m_mutex);
     
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState> (receivedLmcpMessage->m_object);
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState> (receivedLmcpMessage->getObject());
     if(entityState && m_vehicleId == entityState->getID())
     {
         m_report.setVehicleTime(entityState->getTime());
@@ -153,23 +153,23 @@ bool StatusReportService::processReceivedLmcpMessage(std::unique_ptr<uxas::commu
             uxas::common::TimerManager::getInstance().startPeriodicTimer(m_reportTimerId, m_reportPeriod_ms, m_reportPeriod_ms);
         }
     }
-    else if(uxas::messages::uxnative::isEntityJoin(receivedLmcpMessage->m_object))
+    else if(uxas::messages::uxnative::isEntityJoin(receivedLmcpMessage->getObject().get()))
     {
-        auto joinmsg = std::static_pointer_cast<uxas::messages::uxnative::EntityJoin>(receivedLmcpMessage->m_object);
+        auto joinmsg = std::static_pointer_cast<uxas::messages::uxnative::EntityJoin>(receivedLmcpMessage->getObject());
         m_connections.insert(joinmsg->getEntityID());
         m_report.getConnectedEntities().clear();
         m_report.getConnectedEntities().insert(m_report.getConnectedEntities().end(), m_connections.begin(), m_connections.end());
     }
-    else if(uxas::messages::uxnative::isEntityExit(receivedLmcpMessage->m_object))
+    else if(uxas::messages::uxnative::isEntityExit(receivedLmcpMessage->getObject().get()))
     {
-        auto exitmsg = std::static_pointer_cast<uxas::messages::uxnative::EntityExit>(receivedLmcpMessage->m_object);
+        auto exitmsg = std::static_pointer_cast<uxas::messages::uxnative::EntityExit>(receivedLmcpMessage->getObject());
         m_connections.erase(exitmsg->getEntityID());
         m_report.getConnectedEntities().clear();
         m_report.getConnectedEntities().insert(m_report.getConnectedEntities().end(), m_connections.begin(), m_connections.end());
     }
-    else if (uxas::messages::uxnative::isAutopilotKeepAlive(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::uxnative::isAutopilotKeepAlive(receivedLmcpMessage->getObject().get()))
     {
-        auto keepAlive = std::static_pointer_cast<uxas::messages::uxnative::AutopilotKeepAlive>(receivedLmcpMessage->m_object);
+        auto keepAlive = std::static_pointer_cast<uxas::messages::uxnative::AutopilotKeepAlive>(receivedLmcpMessage->getObject());
         m_report.setValidAuthorization(keepAlive->getAutopilotEnabled());
         m_report.setSpeedAuthorization(keepAlive->getSpeedAuthorized());
         m_report.setGimbalAuthorization(keepAlive->getGimbalEnabled());        
@@ -285,8 +285,8 @@ bool SteeringService::configure(const pugi::xml_node& ndComponent)
 
 bool SteeringService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    auto avconfig = std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(receivedLmcpMessage->m_object);
-    auto pState = std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->m_object);
+    auto avconfig = std::dynamic_pointer_cast<afrl::cmasi::AirVehicleConfiguration>(receivedLmcpMessage->getObject());
+    auto pState = std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->getObject());
     if(avconfig && avconfig->getID() == m_vehicleID)
     {
         // update loiter radius and lead-ahead distance based on configuration
@@ -303,9 +303,9 @@ bool SteeringService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             m_acceptanceDistance = m_acceptanceTimeToArrive_ms/1000.0*V;
         }
     }
-    else if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        const auto req = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        const auto req = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->getObject());
         if(!req->getSandBoxRequest() && req->getOriginalRequest())
         {
             m_requestToRegionMap[req->getRequestID()] = req->getOriginalRequest()->getOperatingRegion();
@@ -315,9 +315,9 @@ bool SteeringService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             m_requestToRegionMap.erase(req->getRequestID());
         }
     }
-    else if (uxas::messages::task::isUniqueAutomationResponse(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::task::isUniqueAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        const auto resp = std::static_pointer_cast<uxas::messages::task::UniqueAutomationResponse>(receivedLmcpMessage->m_object);
+        const auto resp = std::static_pointer_cast<uxas::messages::task::UniqueAutomationResponse>(receivedLmcpMessage->getObject());
         if(resp->getOriginalResponse())
         {
             const std::vector<afrl::cmasi::MissionCommand*> missionCommands = resp->getOriginalResponse()->getMissionCommandList();
@@ -344,9 +344,9 @@ bool SteeringService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             }
         }
     }
-    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        const auto pResponse = std::static_pointer_cast<afrl::cmasi::AutomationResponse>(receivedLmcpMessage->m_object);
+        const auto pResponse = std::static_pointer_cast<afrl::cmasi::AutomationResponse>(receivedLmcpMessage->getObject());
         const std::vector<afrl::cmasi::MissionCommand*> missionCommands = pResponse->getMissionCommandList();
 
         const auto it_mission = std::find_if(missionCommands.cbegin(), missionCommands.cend(),
@@ -359,9 +359,9 @@ bool SteeringService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             reset(*it_mission);
         }
     }
-    else if (afrl::cmasi::isMissionCommand(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isMissionCommand(receivedLmcpMessage->getObject().get()))
     {
-        const auto pMission = std::static_pointer_cast<afrl::cmasi::MissionCommand>(receivedLmcpMessage->m_object);
+        const auto pMission = std::static_pointer_cast<afrl::cmasi::MissionCommand>(receivedLmcpMessage->getObject());
 
         if (pMission->getVehicleID() == m_vehicleID)
         {
@@ -370,18 +370,18 @@ bool SteeringService::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             reset(pMission.get());
         }
     }
-    else if (uxas::messages::uxnative::isSpeedOverrideAction(receivedLmcpMessage->m_object.get()))
+    else if (uxas::messages::uxnative::isSpeedOverrideAction(receivedLmcpMessage->getObject().get()))
     {
-        auto speed_override = std::static_pointer_cast<uxas::messages::uxnative::SpeedOverrideAction>(receivedLmcpMessage->m_object);
+        auto speed_override = std::static_pointer_cast<uxas::messages::uxnative::SpeedOverrideAction>(receivedLmcpMessage->getObject());
         if(speed_override->getVehicleID() == m_vehicleID)
         {
             m_isSpeedOverridden = true;
             m_overrideSpeed = speed_override->getSpeed();
         }
     }
-    else if (afrl::cmasi::isVehicleActionCommand(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isVehicleActionCommand(receivedLmcpMessage->getObject().get()))
     {
-        auto vehicleActionCommand = std::static_pointer_cast<afrl::cmasi::VehicleActionCommand>(receivedLmcpMessage->m_object);
+        auto vehicleActionCommand = std::static_pointer_cast<afrl::cmasi::VehicleActionCommand>(receivedLmcpMessage->getObject());
         if(vehicleActionCommand->getVehicleID() == m_vehicleID)
         {
             for(auto action : vehicleActionCommand->getVehicleActionList())
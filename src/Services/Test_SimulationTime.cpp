@@ -66,7 +66,7 @@ bool
 Test_SimulationTime::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
     bool isFinished(false);
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
     if (entityState)
     {
         uxas::common::Time::getInstance().setDiscreteTime_ms(entityState->getTime());
@@ -181,10 +181,10 @@ WaypointPlanManagerService::terminate()
 bool
 WaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 {
-    //COUT_FILE_LINE_MSG("getLmcpTypeName()" << receivedLmcpMessage->m_object->getLmcpTypeName() << "]")
+    //COUT_FILE_LINE_MSG("getLmcpTypeName()" << receivedLmcpMessage->getObject()->getLmcpTypeName() << "]")
     std::shared_ptr<avtas::lmcp::Object> pMissionCommand_Out; // if a new mission command is generate it is saved in this variable
 
-    auto airVehicleState = std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->m_object);
+    auto airVehicleState = std::dynamic_pointer_cast<afrl::cmasi::AirVehicleState>(receivedLmcpMessage->getObject());
     if (airVehicleState)
     {
         if (airVehicleState->getID() == m_vehicleID)
@@ -207,9 +207,9 @@ WaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::com
             }
         }
     }
-    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->m_object.get()))
+    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto automationResponse = std::static_pointer_cast<afrl::cmasi::AutomationResponse> (receivedLmcpMessage->m_object);
+        auto automationResponse = std::static_pointer_cast<afrl::cmasi::AutomationResponse> (receivedLmcpMessage->getObject());
         for (auto mission : automationResponse->getMissionCommandList())
         {
             if (mission->getVehicleID() == m_vehicleID)
@@ -226,9 +226,9 @@ WaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::com
             }
         }
     }
-    else if (afrl::cmasi::isMissionCommand(receivedLmcpMessage->m_object))
+    else if (afrl::cmasi::isMissionCommand(receivedLmcpMessage->getObject().get()))
     {
-        auto ptr_MissionCommand = std::shared_ptr<afrl::cmasi::MissionCommand>((afrl::cmasi::MissionCommand*)receivedLmcpMessage->m_object->clone());
+        auto ptr_MissionCommand = std::shared_ptr<afrl::cmasi::MissionCommand>((afrl::cmasi::MissionCommand*)receivedLmcpMessage->getObject()->clone());
         if (ptr_MissionCommand->getVehicleID() == m_vehicleID)
         {
             //TODO:: initialize plan should intialize and get an std::string(n_Const::c_Constant_Strings::strGetPrepend_lmcp() + ":UXNATIVE:IncrementWaypoint")intial plan
@@ -247,14 +247,14 @@ WaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::com
         }
         //sendSharedLmcpObjectBroadcastMessage(ptr_odstObjectDestination->ptrGetObject());
     }
-    else if (receivedLmcpMessage->m_object->getLmcpTypeName() == "VehicleActionCommand")
+    else if (receivedLmcpMessage->getObject()->getLmcpTypeName() == "VehicleActionCommand")
     {
         //TODO:: send out to vehicle
     }
 #ifdef STEVETEST
-    else if (receivedLmcpMessage->m_object->getLmcpTypeName() == "IncrementWaypoint")
+    else if (receivedLmcpMessage->getObject()->getLmcpTypeName() == "IncrementWaypoint")
     {
-        uxas::messages::uxnative::IncrementWaypoint* incrementWaypoint = static_cast<uxas::messages::uxnative::IncrementWaypoint*> (receivedLmcpMessage->m_object.get());
+        uxas::messages::uxnative::IncrementWaypoint* incrementWaypoint = static_cast<uxas::messages::uxnative::IncrementWaypoint*> (receivedLmcpMessage->getObject().get());
 
         if (incrementWaypoint->getEntityID() == m_vehicleID)
         {
@@ -266,7 +266,7 @@ WaypointPlanManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::com
 #endif  //STEVETEST
     else
     {
-        //CERR_FILE_LINE_MSG("WARNING:: Unknown message encountered: [" << receivedLmcpMessage->m_object->getLmcpTypeName() << "]")
+        //CERR_FILE_LINE_MSG("WARNING:: Unknown message encountered: [" << receivedLmcpMessage->getObject()->getLmcpTypeName() << "]")
     }
     if (pMissionCommand_Out)
     {
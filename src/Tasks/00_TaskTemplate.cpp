@@ -128,7 +128,7 @@ bool TaskTemplate::processReceivedLmcpMessageTask(std::shared_ptr<avtas::lmcp::O
 //    if (afrl::cmasi::isKeyValuePair(receivedLmcpObject))
 //    {
 //        //receive message
-//        auto keyValuePairIn = std::static_pointer_cast<afrl::cmasi::KeyValuePair> (receivedLmcpMessage->m_object);
+//        auto keyValuePairIn = std::static_pointer_cast<afrl::cmasi::KeyValuePair> (receivedLmcpMessage->getObject());
 //        std::cout << "*** RECEIVED:: Service[" << s_typeName() << "] Received a KeyValuePair with the Key[" << keyValuePairIn->getKey() << "] and Value[" << keyValuePairIn->getValue() << "] *** " << std::endl;
 //        
 //        // send out response
@@ -108,7 +108,7 @@ BlockadeTaskService::configureTask(const pugi::xml_node& ndComponent)
 
 bool
 BlockadeTaskService::processReceivedLmcpMessageTask(std::shared_ptr<avtas::lmcp::Object>& receivedLmcpObject)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
     std::stringstream sstrError;
 
@@ -172,7 +172,7 @@ bool
 TaskManagerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 //example: if (afrl::cmasi::isServiceStatus(receivedLmcpObject))
 {
-    std::shared_ptr<avtas::lmcp::Object> messageObject = receivedLmcpMessage->m_object;
+    std::shared_ptr<avtas::lmcp::Object> messageObject = receivedLmcpMessage->getObject();
     std::stringstream sstrError;
 
     auto baseTask = std::dynamic_pointer_cast<afrl::cmasi::Task>(messageObject);
@@ -250,8 +250,8 @@ bool TaskServiceBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
 {
     bool isKillService = false;
 
-    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->m_object);
-    auto entityConfiguration = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->m_object);
+    auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(receivedLmcpMessage->getObject());
+    auto entityConfiguration = std::dynamic_pointer_cast<afrl::cmasi::EntityConfiguration>(receivedLmcpMessage->getObject());
 
     if (entityState)
     {
@@ -320,9 +320,9 @@ bool TaskServiceBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             }
         }
     }
-    else if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->m_object))
+    else if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->getObject().get()))
     {
-        auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->getObject());
         //COUT_FILE_LINE_MSG("uniqueAutomationRequest->getRequestID()[" << uniqueAutomationRequest->getRequestID() << "]")
         if (m_task && uniqueAutomationRequest)
         {
@@ -553,10 +553,10 @@ bool TaskServiceBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
         }
         //COUT_INFO_MSG("")
     }
-    else if (uxas::messages::task::isUniqueAutomationResponse(receivedLmcpMessage->m_object))
+    else if (uxas::messages::task::isUniqueAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
         // UniqueAutomationResponse(s) to determine which vehicles are assigned to this task 
-        auto uniqueAutomationResponse = std::static_pointer_cast<uxas::messages::task::UniqueAutomationResponse>(receivedLmcpMessage->m_object);
+        auto uniqueAutomationResponse = std::static_pointer_cast<uxas::messages::task::UniqueAutomationResponse>(receivedLmcpMessage->getObject());
 
         if (m_idVsUniqueAutomationRequest.find(uniqueAutomationResponse->getResponseID()) == m_idVsUniqueAutomationRequest.end())
         {
@@ -594,11 +594,11 @@ bool TaskServiceBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             m_idVsUniqueAutomationRequest.erase(uniqueAutomationResponse->getResponseID());
         }
     }
-    else if (uxas::messages::task::isTaskImplementationRequest(receivedLmcpMessage->m_object))
+    else if (uxas::messages::task::isTaskImplementationRequest(receivedLmcpMessage->getObject().get()))
     {
         if (m_task)
         {
-            auto taskImplementationRequest = std::static_pointer_cast<uxas::messages::task::TaskImplementationRequest>(receivedLmcpMessage->m_object);
+            auto taskImplementationRequest = std::static_pointer_cast<uxas::messages::task::TaskImplementationRequest>(receivedLmcpMessage->getObject());
             if (taskImplementationRequest->getTaskID() == m_task->getTaskID())
             {
                 auto itOption = m_optionIdVsTaskOptionClass.find(taskImplementationRequest->getOptionID());
@@ -616,9 +616,9 @@ bool TaskServiceBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             }
         } //if(m_pointSearchTask)
     }
-    else if (uxas::messages::route::isRoutePlanResponse(receivedLmcpMessage->m_object))
+    else if (uxas::messages::route::isRoutePlanResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto routePlanResponse = std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->m_object);
+        auto routePlanResponse = std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->getObject());
         if (routePlanResponse->getAssociatedTaskID() == m_task->getTaskID())
         {
             auto routeType = getRouteTypeFromRouteId(routePlanResponse->getResponseID());
@@ -636,21 +636,22 @@ bool TaskServiceBase::processReceivedLmcpMessage(std::unique_ptr<uxas::communica
             }
         }
     }
-    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->m_object))
+    else if (afrl::cmasi::isAutomationResponse(receivedLmcpMessage->getObject().get()))
     {
-        auto ares = std::static_pointer_cast<afrl::cmasi::AutomationResponse>(receivedLmcpMessage->m_object);
+        auto ares = std::static_pointer_cast<afrl::cmasi::AutomationResponse>(receivedLmcpMessage->getObject());
         for (auto v : ares->getMissionCommandList())
         {
             m_currentMissions[v->getVehicleID()] = std::shared_ptr<afrl::cmasi::MissionCommand>(v->clone());
         }
     }
-    else if (afrl::cmasi::isMissionCommand(receivedLmcpMessage->m_object))
+    else if (afrl::cmasi::isMissionCommand(receivedLmcpMessage->getObject().get()))
     {
-        auto mish = std::static_pointer_cast<afrl::cmasi::MissionCommand>(receivedLmcpMessage->m_object);
+        auto mish = std::static_pointer_cast<afrl::cmasi::MissionCommand>(receivedLmcpMessage->getObject());
         m_currentMissions[mish->getVehicleID()] = mish;
     }
 
-    isKillService = isKillService || processReceivedLmcpMessageTask(receivedLmcpMessage->m_object);
+    std::shared_ptr<avtas::lmcp::Object> receivedLmcpObject = receivedLmcpMessage->getObject();
+    isKillService = isKillService || processReceivedLmcpMessageTask(receivedLmcpObject);
 
     return (isKillService);
 };
@@ -76,9 +76,9 @@ TaskTrackerService::configure(const pugi::xml_node& serviceXmlNode)
 
 bool
 TaskTrackerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
-//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
+//example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->getObject().get()))
 {
-    std::shared_ptr<avtas::lmcp::Object> msg = receivedLmcpMessage->m_object;
+    std::shared_ptr<avtas::lmcp::Object> msg = receivedLmcpMessage->getObject();
     auto entityState = std::dynamic_pointer_cast<afrl::cmasi::EntityState>(msg);
     if (entityState)
     {
@@ -594,6 +594,11 @@ bool CAlgebra::initAtomicObjectives(const v_action_t &atomicObjectiveIDs)
 {
     // free all the data structures 
     this->actions.clear();
+    this->actionIndices.clear();
+    this->compiledNodes.clear();
+    this->compiledChildren.clear();
+    this->leafActionIndices.clear();
+    this->compiledActionIDs.clear();
     for (unsigned int i = 0; i < this->preds.size(); i++)
         this->preds[i].clear();
     this->preds.clear();
@@ -605,6 +610,9 @@ bool CAlgebra::initAtomicObjectives(const v_action_t &atomicObjectiveIDs)
     if (atomicObjectiveIDs.size() == 0)
         return false;
     this->actions = atomicObjectiveIDs;
+    this->compiledActionIDs = atomicObjectiveIDs;
+    for (unsigned int i = 0; i < this->actions.size(); i++)
+        this->actionIndices.insert(std::make_pair(this->actions[i], (int) i)); // first index, as findActionIndexviaActionID
     return true;
 }
 
@@ -612,6 +620,12 @@ bool CAlgebra::initAlgebraString(const std::string stringIn)
 {
     // Check the formula for syntax errors
     printf("\nAlgebraString:: %s\n\n", stringIn.c_str());
+    for (size_t i = this->actions.size(); i < this->compiledActionIDs.size(); i++)
+        this->actionIndices.erase(this->compiledActionIDs[i]);
+    this->compiledActionIDs.resize(this->actions.size());
+    this->compiledNodes.clear();
+    this->compiledChildren.clear();
+    this->leafActionIndices.clear();
     if (checkFormulaSyntax(stringIn) == false)
     {
         return false;
@@ -633,6 +647,9 @@ bool CAlgebra::initAlgebraString(const std::string stringIn)
 
     initPredsRec(this->parseTreeRoot);
 
+    // Flatten the parse tree for the compiled searchNext
+    compileTree(this->parseTreeRoot);
+
     //cout << "Predecessors::" << std::endl;
     //for (unsigned int i = 0; i < preds.size(); i++) {
     //  std::cout << "Action [" << actions[i] << "] preds:";
@@ -647,9 +664,171 @@ bool CAlgebra::initAlgebraString(const std::string stringIn)
 
 void CAlgebra::searchNext(const v_action_t &executedAtomicObjectives, v_action_t& nextAtomicObjectives)
 {
-    bool encounterExecuted;
-    nextAtomicObjectives = this->parseTreeRoot->nextActions(executedAtomicObjectives, encounterExecuted);
+    std::vector<uint64_t> executedActionBits(getNumberBitsetWords(), 0);
+    for (unsigned int i = 0; i < executedAtomicObjectives.size(); i++)
+    {
+        int actionIndex = getActionIndex(executedAtomicObjectives[i]);
+        if (actionIndex >= 0)
+            setBit(executedActionBits, actionIndex);
+    }
+    std::vector<uint64_t> nextLeafBits;
+    std::vector<int> nextActionIndices;
+    searchNext(executedActionBits, nextLeafBits, nextActionIndices);
+    nextAtomicObjectives.clear();
+    for (unsigned int i = 0; i < nextActionIndices.size(); i++)
+        nextAtomicObjectives.push_back(getActionID(nextActionIndices[i]));
+}
+
+int CAlgebra::getActionIndex(action_t actionID) const
+{
+    auto itActionIndex = this->actionIndices.find(actionID);
+    return (itActionIndex != this->actionIndices.end()) ? itActionIndex->second : -1;
+}
+
+int CAlgebra::compileTree(parseTreeNode *ptRoot)
+{
+    int compiledNodeNo = (int) this->compiledNodes.size();
+    compiledNode_t compiledNode;
+    compiledNode.operatorType = OP_UNDEFINED;
+    compiledNode.leafNo = -1;
+    compiledNode.firstChildNo = 0;
+    compiledNode.numChildren = 0;
+    compiledNode.firstLeafNo = (int) this->leafActionIndices.size();
+    compiledNode.numLeaves = 0;
+    this->compiledNodes.push_back(compiledNode);
+
+    if (ptRoot->getNodeType() == ND_ACTION)
+    {
+        action_t actionID = ((actionNode *) ptRoot)->getActionID();
+        int actionIndex = getActionIndex(actionID);
+        if (actionIndex < 0)
+        {
+            // not an atomic objective, but the parse tree search still treats it as an action
+            actionIndex = (int) this->compiledActionIDs.size();
+            this->compiledActionIDs.push_back(actionID);
+            this->actionIndices.insert(std::make_pair(actionID, actionIndex));
+        }
+        this->compiledNodes[compiledNodeNo].leafNo = (int) this->leafActionIndices.size();
+        this->leafActionIndices.push_back(actionIndex);
+    }
+    else if (ptRoot->getNodeType() == ND_OPERATOR)
+    {
+        // compile the children first, then store them contiguously
+        operatorNode *ptRootOpr = (operatorNode *) ptRoot;
+        std::vector <int> childNos;
+        for (int i = 0; i < ptRootOpr->getNumNodes(); i++)
+            childNos.push_back(compileTree(ptRootOpr->getNodePointer(i)));
+        this->compiledNodes[compiledNodeNo].operatorType = ptRootOpr->getOperatorType();
+        this->compiledNodes[compiledNodeNo].firstChildNo = (int) this->compiledChildren.size();
+        this->compiledNodes[compiledNodeNo].numChildren = (int) childNos.size();
+        this->compiledChildren.insert(this->compiledChildren.end(), childNos.begin(), childNos.end());
+    }
+    this->compiledNodes[compiledNodeNo].numLeaves = (int) this->leafActionIndices.size() - this->compiledNodes[compiledNodeNo].firstLeafNo;
+    return compiledNodeNo;
+}
+
+void CAlgebra::clearLeafBits(std::vector<uint64_t> &bits, int firstLeafNo, int numLeaves)
+{
+    int leafNo = firstLeafNo;
+    int endLeafNo = firstLeafNo + numLeaves;
+    while (leafNo < endLeafNo)
+    {
+        int bitNo = leafNo & 63;
+        int numBits = std::min(64 - bitNo, endLeafNo - leafNo);
+        uint64_t mask = (numBits == 64) ? ~uint64_t(0) : (((uint64_t(1) << numBits) - 1) << bitNo);
+        bits[leafNo >> 6] &= ~mask;
+        leafNo += numBits;
+    }
+}
+
+// Same as the nextActions of the parse tree nodes; the next actions are set in nextLeafBits
+// (which only changes within the node's leaves). Returns true if there are next actions.
+bool CAlgebra::searchNextCompiled(int compiledNodeNo, const std::vector<uint64_t> &executedActionBits, std::vector<uint64_t> &nextLeafBits, bool &encounterExecutedOut) const
+{
+    const compiledNode_t &compiledNode = this->compiledNodes[compiledNodeNo];
+    encounterExecutedOut = false;
+    if (compiledNode.leafNo >= 0)
+    {
+        if (isBitSet(executedActionBits, this->leafActionIndices[compiledNode.leafNo]))
+        {
+            encounterExecutedOut = true;
+            return false;
+        }
+        setBit(nextLeafBits, compiledNode.leafNo);
+        return true;
+    }
+
+    bool isNext = false;
+    switch (compiledNode.operatorType)
+    {
+        case OP_SEQUENTIAL:
+            encounterExecutedOut = true;
+            for (int i = 0; i < compiledNode.numChildren; i++)
+            {
+                bool encounterExecuted;
+                if (searchNextCompiled(this->compiledChildren[compiledNode.firstChildNo + i], executedActionBits, nextLeafBits, encounterExecuted))
+                {
+                    if (i == 0)
+                        encounterExecutedOut = encounterExecuted;
+                    return true;
+                }
+            }
+            return false;
+
+        case OP_ALTERNATIVE:
+            for (int i = 0; i < compiledNode.numChildren; i++)
+            {
+                bool encounterExecuted;
+                int childNo = this->compiledChildren[compiledNode.firstChildNo + i];
+                bool isChildNext = searchNextCompiled(childNo, executedActionBits, nextLeafBits, encounterExecuted);
+                if (encounterExecuted)
+                {
+                    // only the actions of this branch: drop those of the previous branches
+                    encounterExecutedOut = true;
+                    clearLeafBits(nextLeafBits, compiledNode.firstLeafNo, this->compiledNodes[childNo].firstLeafNo - compiledNode.firstLeafNo);
+                    return isChildNext;
+                }
+                isNext = isNext || isChildNext;
+            }
+            return isNext;
+
+        case OP_PARALLEL:
+            for (int i = 0; i < compiledNode.numChildren; i++)
+            {
+                bool encounterExecuted;
+                if (searchNextCompiled(this->compiledChildren[compiledNode.firstChildNo + i], executedActionBits, nextLeafBits, encounterExecuted))
+                    isNext = true;
+                if (encounterExecuted)
+                    encounterExecutedOut = true;
+            }
+            return isNext;
 
+        case OP_UNDEFINED:
+        default:
+            break;
+    }
+    return false;
+}
+
+void CAlgebra::searchNext(const std::vector<uint64_t> &executedActionBits, std::vector<uint64_t> &nextLeafBits, std::vector<int> &nextActionIndices) const
+{
+    nextActionIndices.clear();
+    if (this->compiledNodes.empty())
+        return;
+    nextLeafBits.assign((this->leafActionIndices.size() + 63) / 64, 0);
+    bool encounterExecuted;
+    if (!searchNextCompiled(0, executedActionBits, nextLeafBits, encounterExecuted))
+        return;
+    for (size_t wordNo = 0; wordNo < nextLeafBits.size(); wordNo++)
+    {
+        for (uint64_t word = nextLeafBits[wordNo]; word != 0; word &= word - 1)
+        {
+            int bitNo = 0;
+            while (((word >> bitNo) & 1) == 0)
+                bitNo++;
+            nextActionIndices.push_back(this->leafActionIndices[(wordNo << 6) + bitNo]);
+        }
+    }
 }
 
 v_action_t CAlgebra::searchPred(const v_action_t &executedAtomicObjectives, int AtomicObjectiveIn)
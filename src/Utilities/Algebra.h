@@ -9,6 +9,8 @@
 
 #include "AlgebraBase.h"
 
+#include <unordered_map>
+
 #ifndef ALGEBRA_H
 #define ALGEBRA_H
 
@@ -24,6 +26,17 @@ typedef int64_t action_t;
 typedef std::vector <int64_t> v_action_t;
 
 
+// node of the compiled (flattened) parse tree
+typedef struct _compiledNode_t {
+  operatorType_t operatorType;  // OP_UNDEFINED for action nodes
+  int leafNo;                   // action nodes: position of the action in parse tree order
+  int firstChildNo;             // operator nodes: first child in compiledChildren
+  int numChildren;
+  int firstLeafNo;              // the leaves of the node are [firstLeafNo, firstLeafNo + numLeaves)
+  int numLeaves;
+} compiledNode_t;
+
+
 // Algebra class
 class CAlgebra:public CAlgebraBase
 {
@@ -33,6 +46,37 @@ public:
     bool initAlgebraString(const std::string stringIn);
     void searchNext(const v_action_t &executedAtomicObjectives, v_action_t& nextAtomicObjectives);
     v_action_t searchPred(const v_action_t &executedAtomicObjectives, int atomicObjectiveIn);
+
+    // Compiled evaluation: the executed actions are a bitset indexed by action index 
+    // (the index in "actions", followed by any action IDs that appear only in the 
+    // algebra string). searchNext returns the same actions as the parse tree search, 
+    // as action indices in the same order, without allocating once the output 
+    // vectors have grown. nextLeafBits is working storage. Thread safe (const).
+    int getActionIndex (action_t actionID) const;
+    action_t getActionID (int actionIndex) const { return compiledActionIDs[actionIndex]; }
+    size_t getNumberActionIndices (void) const { return compiledActionIDs.size(); }
+    size_t getNumberBitsetWords (void) const { return ((compiledActionIDs.size() + 63) / 64); }
+    static void setBit (std::vector<uint64_t> &bits, int bitNo) { bits[bitNo >> 6] |= (uint64_t(1) << (bitNo & 63)); }
+    static bool isBitSet (const std::vector<uint64_t> &bits, int bitNo) { return ((bits[bitNo >> 6] >> (bitNo & 63)) & 1) != 0; }
+    void searchNext(const std::vector<uint64_t> &executedActionBits, std::vector<uint64_t> &nextLeafBits, std::vector<int> &nextActionIndices) const;
+
+    // Read only access to the compiled tree, e.g. to evaluate bounds over the relationships.
+    size_t getNumberCompiledNodes (void) const { return compiledNodes.size(); }
+    const compiledNode_t &getCompiledNode (int compiledNodeNo) const { return compiledNodes[compiledNodeNo]; }
+    int getCompiledChildNo (const compiledNode_t &compiledNode, int childNo) const { return compiledChildren[compiledNode.firstChildNo + childNo]; }
+    size_t getNumberLeaves (void) const { return leafActionIndices.size(); }
+    int getLeafActionIndex (int leafNo) const { return leafActionIndices[leafNo]; }
+
+private:
+    int compileTree (parseTreeNode *ptRoot);
+    bool searchNextCompiled (int compiledNodeNo, const std::vector<uint64_t> &executedActionBits, std::vector<uint64_t> &nextLeafBits, bool &encounterExecutedOut) const;
+    static void clearLeafBits (std::vector<uint64_t> &bits, int firstLeafNo, int numLeaves);
+
+    std::vector <compiledNode_t> compiledNodes;     // the root is the first node
+    std::vector <int> compiledChildren;
+    std::vector <int> leafActionIndices;            // action index of each leaf (parse tree order)
+    v_action_t compiledActionIDs;                   // action ID of each action index
+    std::unordered_map <action_t, int> actionIndices;
 };
 
 }; //namespace log
@@ -43,8 +43,20 @@ namespace common
 {
 
 bool ConfigurationManager::s_isZeroMqMultipartMessage{false};
+bool ConfigurationManager::s_isSharedLmcpObjectFanOut{false};
+bool ConfigurationManager::s_isZeroMqBlockingReceive{false};
+bool ConfigurationManager::s_isLmcpNetworkServerForwarder{false};
+uint32_t ConfigurationManager::s_lmcpNetworkServerShardCount{1};
 uint32_t ConfigurationManager::s_serialPortWaitTime_ms = 50;
 int32_t ConfigurationManager::s_zeroMqReceiveSocketPollWaitTime_ms = 100;
+uint32_t ConfigurationManager::s_zeroMqIoThreadCount{1};
+int32_t ConfigurationManager::s_zeroMqHighWaterMark{100000};
+int32_t ConfigurationManager::s_zeroMqSendBufferSize{-1};
+int32_t ConfigurationManager::s_zeroMqReceiveBufferSize{-1};
+int32_t ConfigurationManager::s_zeroMqTcpKeepAlive{-1};
+int32_t ConfigurationManager::s_zeroMqTcpKeepAliveIdle{-1};
+uint64_t ConfigurationManager::s_zeroMqAffinity{0};
+bool ConfigurationManager::s_isZeroMqImmediate{false};
 
 int64_t ConfigurationManager::s_entityStartTimeSinceEpoch_ms = 0;
 uint32_t ConfigurationManager::s_startDelay_ms = 0;
@@ -408,6 +420,142 @@ ConfigurationManager::setEntityValuesFromXmlNode(const pugi::xml_node& xmlNode)
         {
           UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isDataTimeStamp ", s_isDataTimestamp);
         }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::isSharedLmcpObjectFanOut().c_str()).empty())
+        {
+            s_isSharedLmcpObjectFanOut = entityInfoXmlNode.attribute(StringConstant::isSharedLmcpObjectFanOut().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting isSharedLmcpObjectFanOut ", s_isSharedLmcpObjectFanOut);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isSharedLmcpObjectFanOut ", s_isSharedLmcpObjectFanOut);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::isZeroMqBlockingReceive().c_str()).empty())
+        {
+            s_isZeroMqBlockingReceive = entityInfoXmlNode.attribute(StringConstant::isZeroMqBlockingReceive().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting isZeroMqBlockingReceive ", s_isZeroMqBlockingReceive);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isZeroMqBlockingReceive ", s_isZeroMqBlockingReceive);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::isLmcpNetworkServerForwarder().c_str()).empty())
+        {
+            s_isLmcpNetworkServerForwarder = entityInfoXmlNode.attribute(StringConstant::isLmcpNetworkServerForwarder().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting isLmcpNetworkServerForwarder ", s_isLmcpNetworkServerForwarder);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isLmcpNetworkServerForwarder ", s_isLmcpNetworkServerForwarder);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::LmcpNetworkServerShardCount().c_str()).empty())
+        {
+            uint32_t lmcpNetworkServerShardCount = entityInfoXmlNode.attribute(StringConstant::LmcpNetworkServerShardCount().c_str()).as_uint();
+            if (lmcpNetworkServerShardCount > 0)
+            {
+                s_lmcpNetworkServerShardCount = lmcpNetworkServerShardCount;
+                UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set LMCP network server shard count ", s_lmcpNetworkServerShardCount);
+            }
+            else
+            {
+                UXAS_LOG_WARN(s_typeName(), "::setEntityFromXmlNode ignoring invalid LMCP network server shard count ", lmcpNetworkServerShardCount);
+            }
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default LMCP network server shard count ", s_lmcpNetworkServerShardCount);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqIoThreadCount().c_str()).empty())
+        {
+            uint32_t zeroMqIoThreadCount = entityInfoXmlNode.attribute(StringConstant::ZeroMqIoThreadCount().c_str()).as_uint();
+            if (zeroMqIoThreadCount > 0)
+            {
+                s_zeroMqIoThreadCount = zeroMqIoThreadCount;
+                UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ I/O thread count ", s_zeroMqIoThreadCount);
+            }
+            else
+            {
+                UXAS_LOG_WARN(s_typeName(), "::setEntityFromXmlNode ignoring invalid Zero MQ I/O thread count ", zeroMqIoThreadCount);
+            }
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ I/O thread count ", s_zeroMqIoThreadCount);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqHighWaterMark().c_str()).empty())
+        {
+            s_zeroMqHighWaterMark = entityInfoXmlNode.attribute(StringConstant::ZeroMqHighWaterMark().c_str()).as_int();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ high water mark ", s_zeroMqHighWaterMark);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ high water mark ", s_zeroMqHighWaterMark);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqSendBufferSize().c_str()).empty())
+        {
+            s_zeroMqSendBufferSize = entityInfoXmlNode.attribute(StringConstant::ZeroMqSendBufferSize().c_str()).as_int();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ send buffer size ", s_zeroMqSendBufferSize);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ send buffer size ", s_zeroMqSendBufferSize);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqReceiveBufferSize().c_str()).empty())
+        {
+            s_zeroMqReceiveBufferSize = entityInfoXmlNode.attribute(StringConstant::ZeroMqReceiveBufferSize().c_str()).as_int();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ receive buffer size ", s_zeroMqReceiveBufferSize);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ receive buffer size ", s_zeroMqReceiveBufferSize);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqTcpKeepAlive().c_str()).empty())
+        {
+            s_zeroMqTcpKeepAlive = entityInfoXmlNode.attribute(StringConstant::ZeroMqTcpKeepAlive().c_str()).as_int();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ TCP keep-alive ", s_zeroMqTcpKeepAlive);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ TCP keep-alive ", s_zeroMqTcpKeepAlive);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqTcpKeepAliveIdle().c_str()).empty())
+        {
+            s_zeroMqTcpKeepAliveIdle = entityInfoXmlNode.attribute(StringConstant::ZeroMqTcpKeepAliveIdle().c_str()).as_int();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ TCP keep-alive idle ", s_zeroMqTcpKeepAliveIdle);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ TCP keep-alive idle ", s_zeroMqTcpKeepAliveIdle);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::ZeroMqAffinity().c_str()).empty())
+        {
+            s_zeroMqAffinity = entityInfoXmlNode.attribute(StringConstant::ZeroMqAffinity().c_str()).as_ullong();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set Zero MQ affinity ", s_zeroMqAffinity);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default Zero MQ affinity ", s_zeroMqAffinity);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::isZeroMqImmediate().c_str()).empty())
+        {
+            s_isZeroMqImmediate = entityInfoXmlNode.attribute(StringConstant::isZeroMqImmediate().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode set isZeroMqImmediate ", s_isZeroMqImmediate);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isZeroMqImmediate ", s_isZeroMqImmediate);
+        }
         uxas::common::log::LogManager::getInstance().m_isLoggingThreadId = s_isLoggingThreadId;
     }
 
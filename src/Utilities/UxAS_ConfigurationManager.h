@@ -148,6 +148,49 @@ public:
      */
     static const bool
     getIsZeroMqMultipartMessage() { return (s_isZeroMqMultipartMessage); };
+
+    /** \brief Shared in-process <b>LMCP</b> object fan-out boolean. When enabled, 
+     * the <b>LMCP</b> network server de-serializes each message once and shares 
+     * the same (const) <b>LMCP</b> object with every subscribed in-process 
+     * network client that processes de-serialized messages (each network 
+     * client receives its own clone).
+     * 
+     * @return true if using shared <b>LMCP</b> object fan-out; false if each 
+     * network client de-serializes received messages
+     */
+    static const bool
+    getIsSharedLmcpObjectFanOut() { return (s_isSharedLmcpObjectFanOut); };
+
+    /** \brief Zero MQ blocking receive boolean. When enabled, in-process 
+     * network clients and the <b>LMCP</b> network server block until a message 
+     * arrives or the receiver is interrupted (e.g., termination or subscription 
+     * change) instead of polling with a wait time-out.
+     * 
+     * @return true if using blocking receive; false if polling with 
+     * getZeroMqReceiveSocketPollWaitTime_ms time-out
+     */
+    static const bool
+    getIsZeroMqBlockingReceive() { return (s_isZeroMqBlockingReceive); };
+
+    /** \brief LMCP network server forwarder boolean. When enabled, the 
+     * <b>LMCP</b> network server forwards received Zero MQ frames to the 
+     * publish socket without converting them into message objects (not 
+     * applied if shared <b>LMCP</b> object fan-out is enabled).
+     * 
+     * @return true if forwarding raw frames; false if re-publishing message objects
+     */
+    static const bool
+    getIsLmcpNetworkServerForwarder() { return (s_isLmcpNetworkServerForwarder); };
+
+    /** \brief Count of <b>LMCP</b> network server threads (shards). Each 
+     * network client pushes all of its messages through the shard selected 
+     * by its service ID, so messages from one sender remain ordered; messages 
+     * from different senders can be re-ordered with respect to each other.
+     * 
+     * @return count of shards (minimum 1)
+     */
+    static const uint32_t
+    getLmcpNetworkServerShardCount() { return (s_lmcpNetworkServerShardCount); };
   
     /** \brief UxAS application run duration (units: seconds).
      * 
@@ -177,6 +220,64 @@ public:
     static const int32_t
     getZeroMqReceiveSocketPollWaitTime_ms() { return (s_zeroMqReceiveSocketPollWaitTime_ms); };
 
+    /** \brief Count of Zero MQ context I/O threads (applied when the Zero MQ 
+     * context is created).
+     * 
+     * @return count of I/O threads (minimum 1)
+     */
+    static const uint32_t
+    getZeroMqIoThreadCount() { return (s_zeroMqIoThreadCount); };
+
+    /** \brief Default Zero MQ send and receive high water mark (units: messages).
+     * 
+     * @return high water mark (0 implies no limit)
+     */
+    static const int32_t
+    getZeroMqHighWaterMark() { return (s_zeroMqHighWaterMark); };
+
+    /** \brief Default Zero MQ kernel send buffer size (units: bytes).
+     * 
+     * @return send buffer size (-1 implies operating system default)
+     */
+    static const int32_t
+    getZeroMqSendBufferSize() { return (s_zeroMqSendBufferSize); };
+
+    /** \brief Default Zero MQ kernel receive buffer size (units: bytes).
+     * 
+     * @return receive buffer size (-1 implies operating system default)
+     */
+    static const int32_t
+    getZeroMqReceiveBufferSize() { return (s_zeroMqReceiveBufferSize); };
+
+    /** \brief Default Zero MQ TCP keep-alive setting.
+     * 
+     * @return 1 enables, 0 disables, -1 implies operating system default
+     */
+    static const int32_t
+    getZeroMqTcpKeepAlive() { return (s_zeroMqTcpKeepAlive); };
+
+    /** \brief Default Zero MQ TCP keep-alive idle duration (units: seconds).
+     * 
+     * @return idle duration (-1 implies operating system default)
+     */
+    static const int32_t
+    getZeroMqTcpKeepAliveIdle() { return (s_zeroMqTcpKeepAliveIdle); };
+
+    /** \brief Default Zero MQ I/O thread affinity of new connections.
+     * 
+     * @return bit mask of I/O threads (0 implies any I/O thread)
+     */
+    static const uint64_t
+    getZeroMqAffinity() { return (s_zeroMqAffinity); };
+
+    /** \brief Default Zero MQ immediate boolean. When enabled, messages are 
+     * only queued to completed connections.
+     * 
+     * @return true if queuing to completed connections only
+     */
+    static const bool
+    getIsZeroMqImmediate() { return (s_isZeroMqImmediate); };
+
     /** \brief The <B><i>loadBaseXmlFile</i></B> method loads base configurations.
      * 
      * @param xmlFilePath location of XML file containing base configuration.
@@ -365,10 +466,22 @@ private:
     static bool s_isLoggingThreadId;
     static bool s_isDataTimestamp;
     static bool s_isZeroMqMultipartMessage;
+    static bool s_isSharedLmcpObjectFanOut;
+    static bool s_isZeroMqBlockingReceive;
+    static bool s_isLmcpNetworkServerForwarder;
+    static uint32_t s_lmcpNetworkServerShardCount;
     static uint32_t s_runDuration_s;
     static uint32_t s_serialPortWaitTime_ms;
     static uint32_t s_startDelay_ms;
     static int32_t s_zeroMqReceiveSocketPollWaitTime_ms;
+    static uint32_t s_zeroMqIoThreadCount;
+    static int32_t s_zeroMqHighWaterMark;
+    static int32_t s_zeroMqSendBufferSize;
+    static int32_t s_zeroMqReceiveBufferSize;
+    static int32_t s_zeroMqTcpKeepAlive;
+    static int32_t s_zeroMqTcpKeepAliveIdle;
+    static uint64_t s_zeroMqAffinity;
+    static bool s_isZeroMqImmediate;
 
     static std::string s_rootDataInDirectory;
     static std::string s_rootDataRefDirectory;
@@ -0,0 +1,220 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "UxAS_LengthPrefixedSerialBuffer.h"
+
+#include "UxAS_Log.h"
+
+#include <algorithm>
+#include <array>
+
+namespace uxas
+{
+namespace common
+{
+
+constexpr uint8_t LengthPrefixedSerialBuffer::s_frameVersion;
+constexpr uint8_t LengthPrefixedSerialBuffer::s_checksumFlag;
+constexpr size_t LengthPrefixedSerialBuffer::s_headerSize;
+constexpr size_t LengthPrefixedSerialBuffer::s_checksumSize;
+constexpr uint32_t LengthPrefixedSerialBuffer::s_maximumPayloadSize;
+
+namespace
+{
+
+void
+writeUint32(uint32_t value, char* bytes)
+{
+    bytes[0] = static_cast<char>((value >> 24) & 0xff);
+    bytes[1] = static_cast<char>((value >> 16) & 0xff);
+    bytes[2] = static_cast<char>((value >> 8) & 0xff);
+    bytes[3] = static_cast<char>(value & 0xff);
+};
+
+uint32_t
+readUint32(const char* bytes)
+{
+    const uint8_t* unsignedBytes = reinterpret_cast<const uint8_t*>(bytes);
+    return ((static_cast<uint32_t>(unsignedBytes[0]) << 24) | (static_cast<uint32_t>(unsignedBytes[1]) << 16)
+            | (static_cast<uint32_t>(unsignedBytes[2]) << 8) | static_cast<uint32_t>(unsignedBytes[3]));
+};
+
+/** \brief Slice-by-4 CRC32C tables (reflected Castagnoli polynomial 0x82F63B78) */
+const std::array< std::array<uint32_t, 256>, 4 >&
+getCrc32cTables()
+{
+    static const std::array< std::array<uint32_t, 256>, 4 > s_tables = []()
+    {
+        std::array< std::array<uint32_t, 256>, 4 > tables;
+        for (uint32_t byteValue = 0; byteValue < 256; byteValue++)
+        {
+            uint32_t crc = byteValue;
+            for (uint32_t bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0x82F63B78 : (crc >> 1);
+            }
+            tables[0][byteValue] = crc;
+        }
+        for (uint32_t byteValue = 0; byteValue < 256; byteValue++)
+        {
+            for (uint32_t slice = 1; slice < 4; slice++)
+            {
+                tables[slice][byteValue] = (tables[slice - 1][byteValue] >> 8) ^ tables[0][tables[slice - 1][byteValue] & 0xff];
+            }
+        }
+        return (tables);
+    }();
+    return (s_tables);
+};
+
+}; //namespace
+
+uint32_t
+LengthPrefixedSerialBuffer::calculateCrc32c(const char* data, size_t size)
+{
+    const auto& tables = getCrc32cTables();
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    uint32_t crc = 0xFFFFFFFF;
+    while (size >= 4)
+    {
+        crc ^= static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8)
+                | (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        crc = tables[3][crc & 0xff] ^ tables[2][(crc >> 8) & 0xff]
+                ^ tables[1][(crc >> 16) & 0xff] ^ tables[0][crc >> 24];
+        bytes += 4;
+        size -= 4;
+    }
+    while (size > 0)
+    {
+        crc = (crc >> 8) ^ tables[0][(crc ^ *bytes) & 0xff];
+        bytes++;
+        size--;
+    }
+    return (crc ^ 0xFFFFFFFF);
+};
+
+std::string
+LengthPrefixedSerialBuffer::createFramedString(const std::string& data, bool isChecksumEnabled)
+{
+    std::string framedString;
+    framedString.reserve(s_headerSize + data.size() + (isChecksumEnabled ? s_checksumSize : 0));
+    framedString.append(getFrameMagic());
+    framedString.push_back(static_cast<char>(s_frameVersion));
+    framedString.push_back(static_cast<char>(isChecksumEnabled ? s_checksumFlag : 0));
+    framedString.append(2, '\0');
+
+    char sizeBytes[4];
+    writeUint32(static_cast<uint32_t>(data.size()), sizeBytes);
+    framedString.append(sizeBytes, 4);
+    framedString.append(data);
+
+    if (isChecksumEnabled)
+    {
+        char checksumBytes[4];
+        writeUint32(calculateCrc32c(data.data(), data.size()), checksumBytes);
+        framedString.append(checksumBytes, 4);
+    }
+    return (framedString);
+};
+
+int32_t
+LengthPrefixedSerialBuffer::isFramedData(const char* data, size_t size)
+{
+    size_t compareSize = std::min(size, getFrameMagic().size());
+    if (getFrameMagic().compare(0, compareSize, data, compareSize) != 0)
+    {
+        return (0);
+    }
+    return (compareSize < getFrameMagic().size() ? -1 : 1);
+};
+
+void
+LengthPrefixedSerialBuffer::appendData(const char* data, size_t size)
+{
+    m_data.append(data, size);
+};
+
+bool
+LengthPrefixedSerialBuffer::getNextPayloadString(std::string& payload)
+{
+    const std::string& frameMagic = getFrameMagic();
+    while (m_data.size() - m_readPosition >= s_headerSize)
+    {
+        const char* header = m_data.data() + m_readPosition;
+        uint32_t payloadSize = readUint32(header + 8);
+        if (frameMagic.compare(0, frameMagic.size(), header, frameMagic.size()) != 0
+                || static_cast<uint8_t>(header[4]) != s_frameVersion
+                || payloadSize > s_maximumPayloadSize)
+        {
+            // re-synchronize on the next frame magic (keeping a possible partial magic at the end)
+            m_disregardedDataCount++;
+            size_t nextFramePosition = m_data.find(frameMagic, m_readPosition + 1);
+            if (nextFramePosition == std::string::npos)
+            {
+                nextFramePosition = std::max(m_readPosition + 1, m_data.size() - (frameMagic.size() - 1));
+            }
+            UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString disregarding ", nextFramePosition - m_readPosition, " bytes of invalid frame data");
+            m_readPosition = nextFramePosition;
+            continue;
+        }
+
+        bool isChecksumEnabled = (static_cast<uint8_t>(header[5]) & s_checksumFlag) != 0;
+        size_t frameSize = s_headerSize + payloadSize + (isChecksumEnabled ? s_checksumSize : 0);
+        if (m_data.size() - m_readPosition < frameSize)
+        {
+            // incomplete frame - reserve once for the remainder
+            compact();
+            m_data.reserve(frameSize);
+            return (false);
+        }
+
+        const char* payloadData = m_data.data() + m_readPosition + s_headerSize;
+        if (isChecksumEnabled)
+        {
+            uint32_t receivedChecksum = readUint32(payloadData + payloadSize);
+            uint32_t calculatedChecksum = calculateCrc32c(payloadData, payloadSize);
+            if (receivedChecksum != calculatedChecksum)
+            {
+                m_invalidDeserializeCount++;
+                UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString ignoring frame since calculated checksum=", calculatedChecksum, " does not equal received checksum=", receivedChecksum, "; m_invalidDeserializeCount=", m_invalidDeserializeCount);
+                m_readPosition += frameSize;
+                continue;
+            }
+        }
+
+        payload.assign(payloadData, payloadSize);
+        m_readPosition += frameSize;
+        m_validDeserializeCount++;
+        return (true);
+    }
+
+    compact();
+    return (false);
+};
+
+void
+LengthPrefixedSerialBuffer::clear()
+{
+    m_data.clear();
+    m_readPosition = 0;
+};
+
+void
+LengthPrefixedSerialBuffer::compact()
+{
+    // each byte is moved at most once (only partial frames remain after consumed data)
+    if (m_readPosition > 0)
+    {
+        m_data.erase(0, m_readPosition);
+        m_readPosition = 0;
+    }
+};
+
+}; //namespace common
+}; //namespace uxas
@@ -0,0 +1,138 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_COMMON_LENGTH_PREFIXED_SERIAL_BUFFER_H
+#define UXAS_COMMON_LENGTH_PREFIXED_SERIAL_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace uxas
+{
+namespace common
+{
+
+/** \class LengthPrefixedSerialBuffer
+ *
+ * \par Description:
+ * Binary framing of payloads sent over byte streams (alternative to the
+ * ASCII sentinel framing of <B><i>SentinelSerialBuffer</i></B>). Each frame is
+ * a fixed 12-byte header followed by the payload and an optional CRC32C:
+ * <ul style="padding-left:1em;margin-left:0">
+ * <li> 4 bytes - magic "UxLP" (see <B><i>isFramedData</i></B>)
+ * <li> 1 byte  - framing version
+ * <li> 1 byte  - flags (bit 0 set implies a CRC32C trailer)
+ * <li> 2 bytes - reserved (zero)
+ * <li> 4 bytes - payload size (big-endian)
+ * <li> payload
+ * <li> 4 bytes - CRC32C of payload (big-endian), if flagged
+ * </ul>
+ * Receiving is linear in the received data: payloads are located by the
+ * size field rather than by searching for markers.
+ *
+ * \par Threading:
+ * Multi-thread safety not implemented.
+ *
+ * \n
+ */
+class LengthPrefixedSerialBuffer
+{
+public:
+
+    static const std::string&
+    s_typeName() { static std::string s_string("LengthPrefixedSerialBuffer"); return (s_string); };
+
+    static const std::string&
+    getFrameMagic() { static std::string s_string("UxLP"); return(s_string); };
+
+    static constexpr uint8_t s_frameVersion{1};
+    static constexpr uint8_t s_checksumFlag{0x01};
+    static constexpr size_t s_headerSize{12};
+    static constexpr size_t s_checksumSize{4};
+    /** \brief Frames declaring larger payloads are treated as corrupt */
+    static constexpr uint32_t s_maximumPayloadSize{1024 * 1024 * 1024};
+
+    LengthPrefixedSerialBuffer() { };
+
+private:
+
+    /** \brief Copy construction not permitted */
+    LengthPrefixedSerialBuffer(LengthPrefixedSerialBuffer const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(LengthPrefixedSerialBuffer const&) = delete;
+
+public:
+
+    /** \brief CRC32C (Castagnoli polynomial) of <b>size</b> bytes.
+     *
+     * @param data bytes to check.
+     * @param size number of bytes.
+     * @return CRC32C.
+     */
+    static uint32_t
+    calculateCrc32c(const char* data, size_t size);
+
+    /** \brief Frame <b>data</b> (header, payload and optional CRC32C).
+     *
+     * @param data payload.
+     * @param isChecksumEnabled if true, a CRC32C trailer is appended.
+     * @return framed string.
+     */
+    static std::string
+    createFramedString(const std::string& data, bool isChecksumEnabled);
+
+    /** \brief Determine whether stream data begins with a length-prefixed frame.
+     *
+     * @param data first bytes received from a stream.
+     * @param size number of bytes.
+     * @return 1 if data begins with the frame magic; 0 if it does not; -1 if
+     * more data is needed to decide.
+     */
+    static int32_t
+    isFramedData(const char* data, size_t size);
+
+    /** \brief Append received stream data (any chunking). */
+    void
+    appendData(const char* data, size_t size);
+
+    /** \brief Extract the next complete payload. Corrupt data is discarded
+     * (the buffer re-synchronizes on the next frame magic).
+     *
+     * @param payload set to the next payload.
+     * @return true if a payload was extracted; false if more data is needed.
+     */
+    bool
+    getNextPayloadString(std::string& payload);
+
+    /** \brief Discard all buffered data. */
+    void
+    clear();
+
+    uint32_t m_validDeserializeCount{0};
+    uint32_t m_invalidDeserializeCount{0};
+    uint32_t m_disregardedDataCount{0};
+
+private:
+
+    /** \brief Discard consumed data from the front of the buffer. */
+    void
+    compact();
+
+    std::string m_data;
+    /** \brief Position of the first unconsumed byte of <B><i>m_data</i></B> */
+    size_t m_readPosition{0};
+
+};
+
+}; //namespace common
+}; //namespace uxas
+
+#endif /* UXAS_COMMON_LENGTH_PREFIXED_SERIAL_BUFFER_H */
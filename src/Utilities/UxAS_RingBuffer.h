@@ -0,0 +1,128 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_COMMON_RING_BUFFER_H
+#define UXAS_COMMON_RING_BUFFER_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace uxas
+{
+namespace common
+{
+
+/** \class RingBuffer
+ *
+ * \par Description:
+ * Fixed capacity first-in, first-out buffer. Storage is allocated once on
+ * construction and re-used, so elements can be repeatedly added and removed
+ * without allocating per element (e.g., batches of received messages).
+ *
+ * \par Threading:
+ * <B><i>RingBuffer</i></B> is not thread-safe.
+ *
+ * \n
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+
+    explicit
+    RingBuffer(uint32_t capacity)
+    : m_elements(capacity > 0 ? capacity : 1) { };
+
+    /** \brief Copy construction not permitted */
+    RingBuffer(RingBuffer const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(RingBuffer const&) = delete;
+
+    uint32_t
+    capacity() const { return (static_cast<uint32_t>(m_elements.size())); };
+
+    uint32_t
+    size() const { return (m_size); };
+
+    bool
+    empty() const { return (m_size == 0); };
+
+    bool
+    full() const { return (m_size == capacity()); };
+
+    /** \brief Add element to the back of the buffer.
+     *
+     * @param element element to be moved into the buffer.
+     * @return true if added; false if the buffer is full.
+     */
+    bool
+    push_back(T&& element)
+    {
+        if (full())
+        {
+            return (false);
+        }
+        m_elements[(m_front + m_size) % capacity()] = std::move(element);
+        m_size++;
+        return (true);
+    };
+
+    /** \brief Remove and return the element at the front of the buffer
+     * (the buffer must not be empty). */
+    T
+    pop_front()
+    {
+        T element = std::move(m_elements[m_front]);
+        m_elements[m_front] = T();
+        m_front = (m_front + 1) % capacity();
+        m_size--;
+        return (element);
+    };
+
+    /** \brief Remove and discard the element at the back of the buffer
+     * (the buffer must not be empty). */
+    void
+    pop_back()
+    {
+        m_elements[(m_front + m_size - 1) % capacity()] = T();
+        m_size--;
+    };
+
+    /** \brief Element access relative to the front of the buffer
+     * (<b>index</b> must be less than <B><i>size</i></B>). */
+    T&
+    operator[](uint32_t index) { return (m_elements[(m_front + index) % capacity()]); };
+
+    const T&
+    operator[](uint32_t index) const { return (m_elements[(m_front + index) % capacity()]); };
+
+    void
+    clear()
+    {
+        while (!empty())
+        {
+            pop_back();
+        }
+        m_front = 0;
+    };
+
+private:
+
+    std::vector<T> m_elements;
+    uint32_t m_front{0};
+    uint32_t m_size{0};
+
+};
+
+}; //namespace common
+}; //namespace uxas
+
+#endif /* UXAS_COMMON_RING_BUFFER_H */
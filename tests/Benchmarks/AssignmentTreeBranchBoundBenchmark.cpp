@@ -0,0 +1,650 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentTreeBranchBoundBenchmark.cpp
+ *
+ * Runs the AssignmentTreeBranchBoundService assignment on synthetic or saved
+ * requests, without the network, and reports its performance (nodes/s, time to
+ * the first and to the best assignment, peak memory and cost) as JSON for
+ * regression tracking. Each run is in its own child process (except on Windows),
+ * so its peak memory is not that of an earlier, larger run.
+ *
+ * Usage: AssignmentTreeBranchBoundBenchmark [options]
+ *  --scenario VxT[xO]    synthetic scenario with V vehicles, T tasks and O options per
+ *                        task (repeatable; default: a small suite)
+ *  --seed N              seed of the synthetic scenarios (default 1)
+ *  --relationships S     task relationships of the synthetic scenarios, e.g. "|(.(p1 p2) p3)"
+ *  --load FILE           LMCP XML message of a saved scenario (repeatable, all of the
+ *                        files form one scenario: UniqueAutomationRequest, TaskPlanOptions
+ *                        and AssignmentCostMatrix)
+ *  --save DIRECTORY      saves the messages of the synthetic scenarios, for --load
+ *  --service XML         service configuration (default: complete search,
+ *                        '<Service NumberNodesMaximum="-1"/>')
+ *  --repetitions N       runs of each scenario, the run with the median time is reported
+ *  --output FILE         JSON results (default AssignmentTreeBranchBoundBenchmark.json)
+ *  --log                 logs to the console
+ */
+
+#include "AssignmentTreeBranchBoundService.h"
+
+#include "TimeUtilities.h"
+#include "UxAS_LogManagerDefaultInitializer.h"
+
+#include "avtas/lmcp/LmcpXMLReader.h"
+#include "afrl/cmasi/ServiceStatus.h"
+#include "uxas/messages/task/UniqueAutomationRequest.h"
+#include "uxas/messages/task/TaskPlanOptions.h"
+#include "uxas/messages/task/AssignmentCostMatrix.h"
+#include "uxas/messages/task/TaskAssignmentSummary.h"
+
+#include "pugixml.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace uxas
+{
+namespace service
+{
+
+/*! \class AssignmentTreeBranchBoundBenchmark
+ *  \brief Runs the assignment of the AssignmentTreeBranchBoundService synchronously
+ * on the calling thread. The messages the service would send are counted, not sent.
+ */
+class AssignmentTreeBranchBoundBenchmark : public AssignmentTreeBranchBoundService
+{
+public:
+
+    class c_Result
+    {
+    public:
+        /*! \brief  cost of the assignment, -1 -> no assignment*/
+        int64_t m_cost{-1};
+        /*! \brief  true if the search was completed, i.e. the assignment is optimal*/
+        bool m_isOptimal{false};
+        int64_t m_numberNodesVisited{0};
+        double m_nodesPerSecond{0.0};
+        /*! \brief  times from receiving the request, -1 -> not found*/
+        double m_timeToFirstAssignment_ms{-1.0};
+        double m_timeToBestAssignment_ms{-1.0};
+        /*! \brief  tree search only (nodes/s), and from receiving the request to the result*/
+        double m_searchTime_ms{0.0};
+        double m_totalTime_ms{0.0};
+        /*! \brief  peak resident memory of the child process of the run, -1 -> not available (e.g. Windows)*/
+        int64_t m_peakMemory_kB{-1};
+        int64_t m_numberSummaries{0};
+        std::string m_errors;
+    };
+
+    AssignmentTreeBranchBoundBenchmark() { };
+
+    bool configureBenchmark(const std::string& serviceXml)
+    {
+        pugi::xml_document xmlDocument;
+        if (!xmlDocument.load(serviceXml.c_str()) || !xmlDocument.first_child())
+        {
+            return (false);
+        }
+        return (configure(xmlDocument.first_child()));
+    };
+
+    bool isAssignmentRun(const std::vector< std::shared_ptr<avtas::lmcp::Object> >& messages, c_Result& result)
+    {
+        auto assigmentPrerequisites = std::make_shared<AssigmentPrerequisites>();
+        for (auto itMessage = messages.begin(); itMessage != messages.end(); itMessage++)
+        {
+            if (uxas::messages::task::isUniqueAutomationRequest(itMessage->get()))
+            {
+                assigmentPrerequisites->m_uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(*itMessage);
+            }
+            else if (uxas::messages::task::isTaskPlanOptions(itMessage->get()))
+            {
+                auto taskPlanOptions = std::static_pointer_cast<uxas::messages::task::TaskPlanOptions>(*itMessage);
+                assigmentPrerequisites->m_taskIdVsTaskPlanOptions[taskPlanOptions->getTaskID()] = taskPlanOptions;
+            }
+            else if (uxas::messages::task::isAssignmentCostMatrix(itMessage->get()))
+            {
+                assigmentPrerequisites->m_assignmentCostMatrix = std::static_pointer_cast<uxas::messages::task::AssignmentCostMatrix>(*itMessage);
+            }
+        }
+        if (!assigmentPrerequisites->isAssignmentReady(false))
+        {
+            result.m_errors = "the request, its task plan options or its cost matrix are missing";
+            return (false);
+        }
+
+        m_result = c_Result();
+        int64_t startTime_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
+        auto startTime = std::chrono::steady_clock::now();
+        runCalculateAssignment(assigmentPrerequisites);
+        double totalTime_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        result = m_result;
+        const c_StaticAssignmentParameters& assignmentParameters = *assigmentPrerequisites->m_assignmentParameters;
+        if (assignmentParameters.m_numberCompleteAssignments > 0)
+        {
+            result.m_cost = assignmentParameters.m_minimumAssignmentCostCandidate;
+            result.m_isOptimal = !assignmentParameters.m_isStopCondition;
+            result.m_timeToFirstAssignment_ms = static_cast<double>(std::max(static_cast<int64_t>(0), assignmentParameters.m_firstAssignmentTime_ms - startTime_ms));
+            result.m_timeToBestAssignment_ms = static_cast<double>(std::max(static_cast<int64_t>(0), assignmentParameters.m_candidateTime_ms - startTime_ms));
+        }
+        result.m_numberNodesVisited = assignmentParameters.m_numberNodesVisited;
+        result.m_totalTime_ms = totalTime_ms;
+        result.m_searchTime_ms = std::chrono::duration<double, std::milli>(assignmentParameters.m_searchDuration).count();
+        result.m_nodesPerSecond = (result.m_searchTime_ms > 0.0) ? (1000.0 * static_cast<double>(result.m_numberNodesVisited) / result.m_searchTime_ms) : (0.0);
+        return (result.m_errors.empty());
+    };
+
+protected:
+
+    void sendAssignmentBroadcastMessage(const std::shared_ptr<avtas::lmcp::Object>& lmcpObject) override
+    {
+        if (uxas::messages::task::isTaskAssignmentSummary(lmcpObject.get()))
+        {
+            m_result.m_numberSummaries++;
+        }
+        else if (afrl::cmasi::isServiceStatus(lmcpObject.get()))
+        {
+            auto serviceStatus = std::static_pointer_cast<afrl::cmasi::ServiceStatus>(lmcpObject);
+            if (serviceStatus->getStatusType() == afrl::cmasi::ServiceStatusType::Error)
+            {
+                for (auto itKeyValuePair = serviceStatus->getInfo().begin(); itKeyValuePair != serviceStatus->getInfo().end(); itKeyValuePair++)
+                {
+                    m_result.m_errors += (m_result.m_errors.empty() ? "" : "; ") + (*itKeyValuePair)->getValue();
+                }
+            }
+        }
+    };
+
+private:
+    c_Result m_result;
+};
+
+}; //namespace service
+}; //namespace uxas
+
+namespace
+{
+
+class c_Scenario
+{
+public:
+    std::string m_name;
+    int32_t m_numberVehicles{0};
+    int32_t m_numberTasks{0};
+    int32_t m_numberOptions{1};
+    uint32_t m_seed{1};
+    std::string m_relationships;
+    /*! \brief  the messages of the request (generated or loaded)*/
+    std::vector< std::shared_ptr<avtas::lmcp::Object> > m_messages;
+};
+
+/*! \brief  vehicles and tasks at random locations in a 10 km square, traveling at 20 m/s,
+ * each task option takes 30 to 120 s and every vehicle is eligible for every task*/
+void generateScenario(c_Scenario& scenario)
+{
+    const int64_t requestId(1);
+    const int64_t firstVehicleId(100);
+    std::mt19937 randomNumberGenerator(scenario.m_seed);
+    std::uniform_real_distribution<double> positionDistribution(0.0, 10000.0);
+    std::uniform_int_distribution<int64_t> taskTimeDistribution(30000, 120000);
+    std::vector< std::pair<double, double> > vehiclePositions;
+    std::vector< std::pair<double, double> > taskOptionPositions;
+    for (int32_t vehicleIndex = 0; vehicleIndex < scenario.m_numberVehicles; vehicleIndex++)
+    {
+        vehiclePositions.push_back(std::make_pair(positionDistribution(randomNumberGenerator), positionDistribution(randomNumberGenerator)));
+    }
+    for (int32_t taskOptionIndex = 0; taskOptionIndex < scenario.m_numberTasks * scenario.m_numberOptions; taskOptionIndex++)
+    {
+        taskOptionPositions.push_back(std::make_pair(positionDistribution(randomNumberGenerator), positionDistribution(randomNumberGenerator)));
+    }
+    auto getTravelTime_ms = [](const std::pair<double, double>& from, const std::pair<double, double>& to) -> int64_t
+    {
+        return (static_cast<int64_t>(std::hypot(to.first - from.first, to.second - from.second) * 1000.0 / 20.0));
+    };
+
+    auto uniqueAutomationRequest = std::make_shared<uxas::messages::task::UniqueAutomationRequest>();
+    uniqueAutomationRequest->setRequestID(requestId);
+    for (int32_t vehicleIndex = 0; vehicleIndex < scenario.m_numberVehicles; vehicleIndex++)
+    {
+        uniqueAutomationRequest->getOriginalRequest()->getEntityList().push_back(firstVehicleId + vehicleIndex);
+    }
+    for (int32_t taskIndex = 0; taskIndex < scenario.m_numberTasks; taskIndex++)
+    {
+        uniqueAutomationRequest->getOriginalRequest()->getTaskList().push_back(taskIndex + 1);
+    }
+    uniqueAutomationRequest->getOriginalRequest()->setTaskRelationships(scenario.m_relationships);
+    scenario.m_messages.push_back(uniqueAutomationRequest);
+
+    for (int32_t taskIndex = 0; taskIndex < scenario.m_numberTasks; taskIndex++)
+    {
+        auto taskPlanOptions = std::make_shared<uxas::messages::task::TaskPlanOptions>();
+        taskPlanOptions->setCorrespondingAutomationRequestID(requestId);
+        taskPlanOptions->setTaskID(taskIndex + 1);
+        std::string composition = "+(";
+        for (int32_t optionIndex = 0; optionIndex < scenario.m_numberOptions; optionIndex++)
+        {
+            auto taskOption = new uxas::messages::task::TaskOption;
+            taskOption->setTaskID(taskIndex + 1);
+            taskOption->setOptionID(optionIndex + 1);
+            taskOption->setCost(taskTimeDistribution(randomNumberGenerator));
+            for (int32_t vehicleIndex = 0; vehicleIndex < scenario.m_numberVehicles; vehicleIndex++)
+            {
+                taskOption->getEligibleEntities().push_back(firstVehicleId + vehicleIndex);
+            }
+            taskPlanOptions->getOptions().push_back(taskOption);
+            composition += ((optionIndex > 0) ? " p" : "p") + std::to_string(optionIndex + 1);
+        }
+        taskPlanOptions->setComposition(composition + ")");
+        scenario.m_messages.push_back(taskPlanOptions);
+    }
+
+    auto assignmentCostMatrix = std::make_shared<uxas::messages::task::AssignmentCostMatrix>();
+    assignmentCostMatrix->setCorrespondingAutomationRequestID(requestId);
+    for (int32_t vehicleIndex = 0; vehicleIndex < scenario.m_numberVehicles; vehicleIndex++)
+    {
+        for (int32_t toIndex = 0; toIndex < static_cast<int32_t>(taskOptionPositions.size()); toIndex++)
+        {
+            auto taskOptionCost = new uxas::messages::task::TaskOptionCost;
+            taskOptionCost->setVehicleID(firstVehicleId + vehicleIndex);
+            taskOptionCost->setDestinationTaskID(toIndex / scenario.m_numberOptions + 1);
+            taskOptionCost->setDestinationTaskOption(toIndex % scenario.m_numberOptions + 1);
+            taskOptionCost->setTimeToGo(getTravelTime_ms(vehiclePositions[vehicleIndex], taskOptionPositions[toIndex]));
+            assignmentCostMatrix->getCostMatrix().push_back(taskOptionCost);
+        }
+        for (int32_t fromIndex = 0; fromIndex < static_cast<int32_t>(taskOptionPositions.size()); fromIndex++)
+        {
+            for (int32_t toIndex = 0; toIndex < static_cast<int32_t>(taskOptionPositions.size()); toIndex++)
+            {
+                if ((fromIndex / scenario.m_numberOptions) == (toIndex / scenario.m_numberOptions))
+                {
+                    continue; // same task
+                }
+                auto taskOptionCost = new uxas::messages::task::TaskOptionCost;
+                taskOptionCost->setVehicleID(firstVehicleId + vehicleIndex);
+                taskOptionCost->setIntialTaskID(fromIndex / scenario.m_numberOptions + 1);
+                taskOptionCost->setIntialTaskOption(fromIndex % scenario.m_numberOptions + 1);
+                taskOptionCost->setDestinationTaskID(toIndex / scenario.m_numberOptions + 1);
+                taskOptionCost->setDestinationTaskOption(toIndex % scenario.m_numberOptions + 1);
+                taskOptionCost->setTimeToGo(getTravelTime_ms(taskOptionPositions[fromIndex], taskOptionPositions[toIndex]));
+                assignmentCostMatrix->getCostMatrix().push_back(taskOptionCost);
+            }
+        }
+    }
+    scenario.m_messages.push_back(assignmentCostMatrix);
+}
+
+/*! \brief  loads an LMCP XML message, as the SendMessagesService ('#' lines are comments)*/
+bool isMessageLoaded(const std::string& filePath, c_Scenario& scenario)
+{
+    std::ifstream file(filePath.c_str());
+    if (!file.is_open())
+    {
+        return (false);
+    }
+    std::string xml;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || (line[0] != '#'))
+        {
+            xml += line + "\n";
+        }
+    }
+    std::shared_ptr<avtas::lmcp::Object> lmcpObject(avtas::lmcp::xml::readXML(xml));
+    if (!lmcpObject)
+    {
+        return (false);
+    }
+    scenario.m_messages.push_back(lmcpObject);
+    return (true);
+}
+
+void saveScenario(const std::string& directory, const c_Scenario& scenario)
+{
+    for (size_t messageIndex = 0; messageIndex < scenario.m_messages.size(); messageIndex++)
+    {
+        std::string filePath = directory + ((*(directory.rbegin()) == '/') ? "" : "/") + scenario.m_name + "_" +
+                std::to_string(messageIndex) + "_" + scenario.m_messages[messageIndex]->getLmcpTypeName() + ".xml";
+        std::ofstream file(filePath.c_str());
+        file << scenario.m_messages[messageIndex]->toXML();
+    }
+}
+
+std::string getJsonString(const std::string& value)
+{
+    std::string jsonString("\"");
+    for (auto itCharacter = value.begin(); itCharacter != value.end(); itCharacter++)
+    {
+        if ((*itCharacter == '"') || (*itCharacter == '\\'))
+        {
+            jsonString += '\\';
+            jsonString += *itCharacter;
+        }
+        else if (static_cast<unsigned char>(*itCharacter) < 0x20)
+        {
+            jsonString += ' ';
+        }
+        else
+        {
+            jsonString += *itCharacter;
+        }
+    }
+    return (jsonString + "\"");
+}
+
+bool isScenarioParsed(const std::string& scenarioString, c_Scenario& scenario)
+{
+    // VxT[xO]
+    std::vector<int32_t> sizes;
+    std::stringstream sizesStream(scenarioString);
+    std::string size;
+    while (std::getline(sizesStream, size, 'x'))
+    {
+        sizes.push_back(std::atoi(size.c_str()));
+    }
+    if ((sizes.size() < 2) || (sizes.size() > 3) || (std::find_if(sizes.begin(), sizes.end(), [](int32_t value) { return (value <= 0); }) != sizes.end()))
+    {
+        return (false);
+    }
+    scenario.m_numberVehicles = sizes[0];
+    scenario.m_numberTasks = sizes[1];
+    scenario.m_numberOptions = (sizes.size() > 2) ? (sizes[2]) : (1);
+    return (true);
+}
+
+/*! \brief  runs the scenario with a new service, e.g. no warm start from the previous run*/
+bool isScenarioRunInProcess(const std::string& serviceXml, const c_Scenario& scenario, uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& result)
+{
+    uxas::service::AssignmentTreeBranchBoundBenchmark assignmentBenchmark;
+    if (!assignmentBenchmark.configureBenchmark(serviceXml))
+    {
+        result.m_errors = "could not parse the service configuration [" + serviceXml + "]";
+        return (false);
+    }
+    return (assignmentBenchmark.isAssignmentRun(scenario.m_messages, result));
+}
+
+#ifndef _WIN32
+/*! \brief  the result, except the peak memory, as text: the numbers on the first line, then the errors*/
+std::string getResultString(const uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& result)
+{
+    std::stringstream resultStream;
+    resultStream.precision(17);
+    resultStream << result.m_cost << " " << result.m_isOptimal << " " << result.m_numberNodesVisited << " " << result.m_nodesPerSecond << " "
+            << result.m_timeToFirstAssignment_ms << " " << result.m_timeToBestAssignment_ms << " " << result.m_searchTime_ms << " "
+            << result.m_totalTime_ms << " " << result.m_numberSummaries << "\n" << result.m_errors;
+    return (resultStream.str());
+}
+
+bool isResultParsed(const std::string& resultString, uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& result)
+{
+    std::stringstream resultStream(resultString);
+    resultStream >> result.m_cost >> result.m_isOptimal >> result.m_numberNodesVisited >> result.m_nodesPerSecond
+            >> result.m_timeToFirstAssignment_ms >> result.m_timeToBestAssignment_ms >> result.m_searchTime_ms
+            >> result.m_totalTime_ms >> result.m_numberSummaries;
+    if (resultStream.fail() || (resultStream.get() != '\n'))
+    {
+        return (false);
+    }
+    result.m_errors.assign(std::istreambuf_iterator<char>(resultStream), std::istreambuf_iterator<char>());
+    return (true);
+}
+#endif
+
+/*! \brief  runs the scenario in a child process and reports the child's peak resident memory. 
+ * The peak of a process is never reset, so measured in this process, a run would report 
+ * the peak of the largest earlier run.*/
+bool isScenarioRun(const std::string& serviceXml, const c_Scenario& scenario, uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& result)
+{
+#ifndef _WIN32
+    int resultPipe[2];
+    if (pipe(resultPipe) != 0)
+    {
+        result.m_errors = "could not create the result pipe";
+        return (false);
+    }
+    std::cout.flush();
+    pid_t childId = fork();
+    if (childId < 0)
+    {
+        close(resultPipe[0]);
+        close(resultPipe[1]);
+        result.m_errors = "could not start the child process of the run";
+        return (false);
+    }
+    if (childId == 0)
+    {
+        close(resultPipe[0]);
+        bool isSuccess = isScenarioRunInProcess(serviceXml, scenario, result);
+        std::string resultString = getResultString(result);
+        for (size_t writtenSize = 0; writtenSize < resultString.size();)
+        {
+            ssize_t size = write(resultPipe[1], resultString.data() + writtenSize, resultString.size() - writtenSize);
+            if (size <= 0)
+            {
+                break;
+            }
+            writtenSize += static_cast<size_t>(size);
+        }
+        close(resultPipe[1]);
+        _exit(isSuccess ? 0 : 1);
+    }
+
+    close(resultPipe[1]);
+    std::string resultString;
+    char buffer[4096];
+    ssize_t size;
+    while (((size = read(resultPipe[0], buffer, sizeof(buffer))) > 0) || ((size < 0) && (errno == EINTR)))
+    {
+        if (size > 0)
+        {
+            resultString.append(buffer, static_cast<size_t>(size));
+        }
+    }
+    close(resultPipe[0]);
+
+    int status(0);
+    struct rusage resourceUsage;
+    if ((wait4(childId, &status, 0, &resourceUsage) != childId) || !WIFEXITED(status) || !isResultParsed(resultString, result))
+    {
+        result = uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result();
+        result.m_errors = "the child process of the run did not complete";
+        return (false);
+    }
+#ifdef __APPLE__
+    result.m_peakMemory_kB = resourceUsage.ru_maxrss / 1024; // bytes
+#else
+    result.m_peakMemory_kB = resourceUsage.ru_maxrss;
+#endif
+    return (result.m_errors.empty());
+#else
+    return (isScenarioRunInProcess(serviceXml, scenario, result));
+#endif
+}
+
+}; //namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<c_Scenario> scenarios;
+    c_Scenario loadedScenario;
+    loadedScenario.m_name = "loaded";
+    std::vector<std::string> scenarioStrings;
+    uint32_t seed(1);
+    std::string relationships;
+    std::string saveDirectory;
+    std::string serviceXml("<Service NumberNodesMaximum=\"-1\"/>");
+    uint32_t numberRepetitions(1);
+    std::string outputFilePath("AssignmentTreeBranchBoundBenchmark.json");
+
+    for (int argumentIndex = 1; argumentIndex < argc; argumentIndex++)
+    {
+        std::string argument(argv[argumentIndex]);
+        bool isValue(argumentIndex + 1 < argc);
+        if ((argument == "--scenario") && isValue)
+        {
+            scenarioStrings.push_back(argv[++argumentIndex]);
+        }
+        else if ((argument == "--seed") && isValue)
+        {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++argumentIndex], nullptr, 10));
+        }
+        else if ((argument == "--relationships") && isValue)
+        {
+            relationships = argv[++argumentIndex];
+        }
+        else if ((argument == "--load") && isValue)
+        {
+            std::string filePath(argv[++argumentIndex]);
+            if (!isMessageLoaded(filePath, loadedScenario))
+            {
+                std::cerr << "could not load an LMCP message from [" << filePath << "]" << std::endl;
+                return (1);
+            }
+        }
+        else if ((argument == "--save") && isValue)
+        {
+            saveDirectory = argv[++argumentIndex];
+        }
+        else if ((argument == "--service") && isValue)
+        {
+            serviceXml = argv[++argumentIndex];
+        }
+        else if ((argument == "--repetitions") && isValue)
+        {
+            numberRepetitions = std::max(1, std::atoi(argv[++argumentIndex]));
+        }
+        else if ((argument == "--output") && isValue)
+        {
+            outputFilePath = argv[++argumentIndex];
+        }
+        else if (argument == "--log")
+        {
+            uxas::common::log::LogManagerDefaultInitializer::initializeConsoleLogger();
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--scenario VxT[xO]]... [--seed N] [--relationships S] [--load FILE]... [--save DIRECTORY]"
+                    << " [--service XML] [--repetitions N] [--output FILE] [--log]" << std::endl;
+            return (1);
+        }
+    }
+
+    {
+        uxas::service::AssignmentTreeBranchBoundBenchmark assignmentBenchmark;
+        if (!assignmentBenchmark.configureBenchmark(serviceXml))
+        {
+            std::cerr << "could not parse the service configuration [" << serviceXml << "]" << std::endl;
+            return (1);
+        }
+    }
+
+    if (!loadedScenario.m_messages.empty())
+    {
+        scenarios.push_back(loadedScenario);
+    }
+    else
+    {
+        if (scenarioStrings.empty())
+        {
+            scenarioStrings = {"3x8", "4x8", "3x7x2"};
+        }
+        for (auto itScenarioString = scenarioStrings.begin(); itScenarioString != scenarioStrings.end(); itScenarioString++)
+        {
+            c_Scenario scenario;
+            if (!isScenarioParsed(*itScenarioString, scenario))
+            {
+                std::cerr << "scenario [" << *itScenarioString << "] is not VxT[xO]" << std::endl;
+                return (1);
+            }
+            scenario.m_seed = seed;
+            scenario.m_relationships = relationships;
+            scenario.m_name = *itScenarioString + "_seed" + std::to_string(seed);
+            generateScenario(scenario);
+            if (!saveDirectory.empty())
+            {
+                saveScenario(saveDirectory, scenario);
+            }
+            scenarios.push_back(scenario);
+        }
+    }
+
+    std::stringstream json;
+    json << "{\n  \"benchmark\": \"AssignmentTreeBranchBound\",\n  \"service\": " << getJsonString(serviceXml)
+            << ",\n  \"repetitions\": " << numberRepetitions << ",\n  \"scenarios\": [";
+    bool isSuccess(true);
+    for (auto itScenario = scenarios.begin(); itScenario != scenarios.end(); itScenario++)
+    {
+        std::vector<uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result> results;
+        for (uint32_t repetition = 0; repetition < numberRepetitions; repetition++)
+        {
+            uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result result;
+            isSuccess = isScenarioRun(serviceXml, *itScenario, result) && isSuccess;
+            results.push_back(result);
+        }
+        std::sort(results.begin(), results.end(),
+                  [](const uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& lhs, const uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& rhs)
+                  { return (lhs.m_totalTime_ms < rhs.m_totalTime_ms); });
+        const uxas::service::AssignmentTreeBranchBoundBenchmark::c_Result& result = results[results.size() / 2];
+
+        std::cout << itScenario->m_name << ": cost[" << result.m_cost << "] optimal[" << result.m_isOptimal << "] nodes["
+                << result.m_numberNodesVisited << "] nodes/s[" << static_cast<int64_t>(result.m_nodesPerSecond) << "] first["
+                << result.m_timeToFirstAssignment_ms << " ms] best[" << result.m_timeToBestAssignment_ms << " ms] total["
+                << result.m_totalTime_ms << " ms] peak memory[" << result.m_peakMemory_kB << " kB]"
+                << (result.m_errors.empty() ? "" : " errors[" + result.m_errors + "]") << std::endl;
+
+        json << ((itScenario == scenarios.begin()) ? "\n" : ",\n") << "    {\n"
+                << "      \"name\": " << getJsonString(itScenario->m_name) << ",\n"
+                << "      \"vehicles\": " << itScenario->m_numberVehicles << ",\n"
+                << "      \"tasks\": " << itScenario->m_numberTasks << ",\n"
+                << "      \"options\": " << itScenario->m_numberOptions << ",\n"
+                << "      \"seed\": " << itScenario->m_seed << ",\n"
+                << "      \"relationships\": " << getJsonString(itScenario->m_relationships) << ",\n"
+                << "      \"cost\": " << result.m_cost << ",\n"
+                << "      \"isOptimal\": " << (result.m_isOptimal ? "true" : "false") << ",\n"
+                << "      \"numberNodesVisited\": " << result.m_numberNodesVisited << ",\n"
+                << "      \"nodesPerSecond\": " << result.m_nodesPerSecond << ",\n"
+                << "      \"timeToFirstAssignment_ms\": " << result.m_timeToFirstAssignment_ms << ",\n"
+                << "      \"timeToBestAssignment_ms\": " << result.m_timeToBestAssignment_ms << ",\n"
+                << "      \"searchTime_ms\": " << result.m_searchTime_ms << ",\n"
+                << "      \"totalTime_ms\": " << result.m_totalTime_ms << ",\n"
+                << "      \"peakMemory_kB\": " << result.m_peakMemory_kB << ",\n"
+                << "      \"numberSummaries\": " << result.m_numberSummaries << ",\n"
+                << "      \"errors\": " << getJsonString(result.m_errors) << "\n"
+                << "    }";
+    }
+    json << "\n  ]\n}\n";
+
+    std::ofstream outputFile(outputFilePath.c_str());
+    outputFile << json.str();
+    if (!outputFile.good())
+    {
+        std::cerr << "could not write [" << outputFilePath << "]" << std::endl;
+        return (1);
+    }
+    return (isSuccess ? 0 : 1);
+}
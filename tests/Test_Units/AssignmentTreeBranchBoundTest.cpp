@@ -0,0 +1,445 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentTreeBranchBoundTest.cpp
+ *
+ * Unit tests of the assignment search. The assignments are run in process,
+ * without the network.
+ */
+#include "gtest/gtest.h"
+
+#include "AssignmentTreeBranchBoundService.h"
+#include "Algebra.h"
+
+#include "uxas/messages/task/UniqueAutomationRequest.h"
+#include "uxas/messages/task/TaskPlanOptions.h"
+#include "uxas/messages/task/AssignmentCostMatrix.h"
+
+#include "pugixml.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace uxas
+{
+namespace service
+{
+
+/*! \class AssignmentTreeBranchBoundTestService
+ *  \brief Runs the assignment of the AssignmentTreeBranchBoundService synchronously
+ * and keeps the search state of the request. Messages are not sent.
+ */
+class AssignmentTreeBranchBoundTestService : public AssignmentTreeBranchBoundService
+{
+public:
+    AssignmentTreeBranchBoundTestService(const std::string& serviceXml)
+    {
+        pugi::xml_document xmlDocument;
+        if (xmlDocument.load(serviceXml.c_str()) && xmlDocument.first_child())
+        {
+            m_isConfigured = configure(xmlDocument.first_child());
+        }
+    };
+
+    /*! \brief  returns the search state of the request, nullptr if the messages are incomplete*/
+    std::shared_ptr<c_StaticAssignmentParameters> runAssignment(const std::shared_ptr<uxas::messages::task::UniqueAutomationRequest>& uniqueAutomationRequest,
+                                                                const std::vector< std::shared_ptr<uxas::messages::task::TaskPlanOptions> >& taskPlanOptions,
+                                                                const std::shared_ptr<uxas::messages::task::AssignmentCostMatrix>& assignmentCostMatrix)
+    {
+        auto assigmentPrerequisites = std::make_shared<AssigmentPrerequisites>();
+        assigmentPrerequisites->m_uniqueAutomationRequest = uniqueAutomationRequest;
+        for (auto itTaskPlanOptions = taskPlanOptions.begin(); itTaskPlanOptions != taskPlanOptions.end(); itTaskPlanOptions++)
+        {
+            assigmentPrerequisites->m_taskIdVsTaskPlanOptions[(*itTaskPlanOptions)->getTaskID()] = *itTaskPlanOptions;
+        }
+        assigmentPrerequisites->m_assignmentCostMatrix = assignmentCostMatrix;
+        if (!m_isConfigured || !assigmentPrerequisites->isAssignmentReady(false))
+        {
+            return (nullptr);
+        }
+        runCalculateAssignment(assigmentPrerequisites);
+        return (assigmentPrerequisites->m_assignmentParameters);
+    };
+
+protected:
+    void sendAssignmentBroadcastMessage(const std::shared_ptr<avtas::lmcp::Object>& lmcpObject) override { };
+
+private:
+    bool m_isConfigured{false};
+};
+
+}; //namespace service
+}; //namespace uxas
+
+using uxas::service::AssignmentTreeBranchBoundTestService;
+using uxas::service::c_StaticAssignmentParameters;
+using uxas::service::c_TaskAssignmentState;
+
+namespace
+{
+
+class c_Scenario
+{
+public:
+    std::shared_ptr<uxas::messages::task::UniqueAutomationRequest> m_uniqueAutomationRequest;
+    std::vector< std::shared_ptr<uxas::messages::task::TaskPlanOptions> > m_taskPlanOptions;
+    std::shared_ptr<uxas::messages::task::AssignmentCostMatrix> m_assignmentCostMatrix;
+};
+
+/*! \brief  vehicles and task options at random locations, every vehicle is eligible for
+ * every task option unless isSparse, then some eligibilities and costs are missing*/
+c_Scenario
+getScenario(const int32_t& numberVehicles, const int32_t& numberTasks, const int32_t& numberOptions, const uint32_t& seed,
+            const std::string& relationships = std::string(), const bool& isSparse = false)
+{
+    const int64_t requestId(1);
+    const int64_t firstVehicleId(100);
+    std::mt19937 randomNumberGenerator(seed);
+    std::uniform_real_distribution<double> positionDistribution(0.0, 10000.0);
+    std::uniform_int_distribution<int64_t> taskTimeDistribution(30000, 120000);
+    std::bernoulli_distribution missingDistribution(isSparse ? 0.2 : 0.0);
+    std::vector< std::pair<double, double> > positions;
+    for (int32_t positionIndex = 0; positionIndex < numberVehicles + numberTasks * numberOptions; positionIndex++)
+    {
+        positions.push_back(std::make_pair(positionDistribution(randomNumberGenerator), positionDistribution(randomNumberGenerator)));
+    }
+    auto getTravelTime_ms = [&positions, &numberVehicles](const int32_t& fromIndex, const int32_t& toIndex) -> int64_t
+    {
+        // vehicles, then task options
+        const std::pair<double, double>& from = positions[fromIndex];
+        const std::pair<double, double>& to = positions[numberVehicles + toIndex];
+        return (static_cast<int64_t>(std::hypot(to.first - from.first, to.second - from.second) * 1000.0 / 20.0));
+    };
+
+    c_Scenario scenario;
+    scenario.m_uniqueAutomationRequest = std::make_shared<uxas::messages::task::UniqueAutomationRequest>();
+    scenario.m_uniqueAutomationRequest->setRequestID(requestId);
+    for (int32_t vehicleIndex = 0; vehicleIndex < numberVehicles; vehicleIndex++)
+    {
+        scenario.m_uniqueAutomationRequest->getOriginalRequest()->getEntityList().push_back(firstVehicleId + vehicleIndex);
+    }
+    for (int32_t taskIndex = 0; taskIndex < numberTasks; taskIndex++)
+    {
+        scenario.m_uniqueAutomationRequest->getOriginalRequest()->getTaskList().push_back(taskIndex + 1);
+    }
+    scenario.m_uniqueAutomationRequest->getOriginalRequest()->setTaskRelationships(relationships);
+
+    for (int32_t taskIndex = 0; taskIndex < numberTasks; taskIndex++)
+    {
+        auto taskPlanOptions = std::make_shared<uxas::messages::task::TaskPlanOptions>();
+        taskPlanOptions->setCorrespondingAutomationRequestID(requestId);
+        taskPlanOptions->setTaskID(taskIndex + 1);
+        std::string composition = "+(";
+        for (int32_t optionIndex = 0; optionIndex < numberOptions; optionIndex++)
+        {
+            auto taskOption = new uxas::messages::task::TaskOption;
+            taskOption->setTaskID(taskIndex + 1);
+            taskOption->setOptionID(optionIndex + 1);
+            taskOption->setCost(taskTimeDistribution(randomNumberGenerator));
+            for (int32_t vehicleIndex = 0; vehicleIndex < numberVehicles; vehicleIndex++)
+            {
+                if (!missingDistribution(randomNumberGenerator))
+                {
+                    taskOption->getEligibleEntities().push_back(firstVehicleId + vehicleIndex);
+                }
+            }
+            taskPlanOptions->getOptions().push_back(taskOption);
+            composition += ((optionIndex > 0) ? " p" : "p") + std::to_string(optionIndex + 1);
+        }
+        taskPlanOptions->setComposition(composition + ")");
+        scenario.m_taskPlanOptions.push_back(taskPlanOptions);
+    }
+
+    scenario.m_assignmentCostMatrix = std::make_shared<uxas::messages::task::AssignmentCostMatrix>();
+    scenario.m_assignmentCostMatrix->setCorrespondingAutomationRequestID(requestId);
+    const int32_t numberTaskOptions(numberTasks * numberOptions);
+    for (int32_t vehicleIndex = 0; vehicleIndex < numberVehicles; vehicleIndex++)
+    {
+        for (int32_t fromIndex = -1; fromIndex < numberTaskOptions; fromIndex++)
+        {
+            for (int32_t toIndex = 0; toIndex < numberTaskOptions; toIndex++)
+            {
+                if (((fromIndex >= 0) && ((fromIndex / numberOptions) == (toIndex / numberOptions))) || missingDistribution(randomNumberGenerator))
+                {
+                    continue; // same task
+                }
+                auto taskOptionCost = new uxas::messages::task::TaskOptionCost;
+                taskOptionCost->setVehicleID(firstVehicleId + vehicleIndex);
+                if (fromIndex >= 0)
+                {
+                    taskOptionCost->setIntialTaskID(fromIndex / numberOptions + 1);
+                    taskOptionCost->setIntialTaskOption(fromIndex % numberOptions + 1);
+                }
+                taskOptionCost->setDestinationTaskID(toIndex / numberOptions + 1);
+                taskOptionCost->setDestinationTaskOption(toIndex % numberOptions + 1);
+                taskOptionCost->setTimeToGo((fromIndex >= 0) ? (getTravelTime_ms(numberVehicles + fromIndex, toIndex)) : (getTravelTime_ms(vehicleIndex, toIndex)));
+                scenario.m_assignmentCostMatrix->getCostMatrix().push_back(taskOptionCost);
+            }
+        }
+    }
+    return (scenario);
+};
+
+std::shared_ptr<c_StaticAssignmentParameters>
+runAssignment(const std::string& serviceXml, const c_Scenario& scenario)
+{
+    AssignmentTreeBranchBoundTestService testService(serviceXml);
+    return (testService.runAssignment(scenario.m_uniqueAutomationRequest, scenario.m_taskPlanOptions, scenario.m_assignmentCostMatrix));
+};
+
+/*! \brief  cost of the assignment, -1 -> no assignment*/
+int64_t
+getCost(const std::shared_ptr<c_StaticAssignmentParameters>& assignmentParameters)
+{
+    if (!assignmentParameters || (assignmentParameters->m_numberCompleteAssignments <= 0))
+    {
+        return (-1);
+    }
+    return (assignmentParameters->m_minimumAssignmentCostCandidate);
+};
+
+};
+
+TEST(AssignmentTreeBranchBoundTest, CostTableEqualsCostMatrix)
+{
+    for (uint32_t seed = 1; seed <= 3; seed++)
+    {
+        c_Scenario scenario = getScenario(3, 5, 2, seed, std::string(), true);
+        auto assignmentParameters = runAssignment("<Service NumberNodesMaximum=\"1\"/>", scenario);
+        ASSERT_TRUE(assignmentParameters);
+        const uxas::service::c_AssignmentCostTable& costTable = assignmentParameters->m_costTable;
+
+        // the lookups the search used before the costs were compiled
+        std::map< std::tuple<int64_t, int64_t, int64_t>, int64_t > vehicleFromToVsTravelTime_ms;
+        for (auto itTaskOptionCost = scenario.m_assignmentCostMatrix->getCostMatrix().begin(); itTaskOptionCost != scenario.m_assignmentCostMatrix->getCostMatrix().end(); itTaskOptionCost++)
+        {
+            vehicleFromToVsTravelTime_ms[std::make_tuple((*itTaskOptionCost)->getVehicleID(),
+                                                         c_TaskAssignmentState::getTaskAndOptionId((*itTaskOptionCost)->getIntialTaskID(), (*itTaskOptionCost)->getIntialTaskOption()),
+                                                         c_TaskAssignmentState::getTaskAndOptionId((*itTaskOptionCost)->getDestinationTaskID(), (*itTaskOptionCost)->getDestinationTaskOption()))]
+                    = (*itTaskOptionCost)->getTimeToGo();
+        }
+        std::map< std::pair<int64_t, int64_t>, int64_t > vehicleTaskOptionVsTaskTime_ms;
+        for (auto itTaskPlanOptions = scenario.m_taskPlanOptions.begin(); itTaskPlanOptions != scenario.m_taskPlanOptions.end(); itTaskPlanOptions++)
+        {
+            for (auto itOption = (*itTaskPlanOptions)->getOptions().begin(); itOption != (*itTaskPlanOptions)->getOptions().end(); itOption++)
+            {
+                for (auto itVehicle = (*itOption)->getEligibleEntities().begin(); itVehicle != (*itOption)->getEligibleEntities().end(); itVehicle++)
+                {
+                    vehicleTaskOptionVsTaskTime_ms[std::make_pair(*itVehicle, c_TaskAssignmentState::getTaskAndOptionId((*itOption)->getTaskID(), (*itOption)->getOptionID()))] = (*itOption)->getCost();
+                }
+            }
+        }
+
+        ASSERT_EQ(3u, costTable.getNumberVehicles());
+        ASSERT_EQ(10u, costTable.getNumberTaskOptions());
+        for (int32_t vehicleIndex = 0; vehicleIndex < static_cast<int32_t>(costTable.getNumberVehicles()); vehicleIndex++)
+        {
+            int64_t vehicleId = costTable.getVehicleId(vehicleIndex);
+            EXPECT_EQ(vehicleIndex, costTable.getVehicleIndex(vehicleId));
+            for (int32_t toIndex = 0; toIndex < static_cast<int32_t>(costTable.getNumberTaskOptions()); toIndex++)
+            {
+                int64_t toId = costTable.getTaskOptionId(toIndex);
+                EXPECT_EQ(toIndex, costTable.getTaskOptionIndex(toId));
+                auto itTaskTime = vehicleTaskOptionVsTaskTime_ms.find(std::make_pair(vehicleId, toId));
+                EXPECT_EQ((itTaskTime != vehicleTaskOptionVsTaskTime_ms.end()) ? (itTaskTime->second) : (-1), costTable.getTaskTime_ms(vehicleIndex, toIndex));
+                // location 0 is the vehicle's starting location
+                for (int32_t fromIndex = -1; fromIndex < static_cast<int32_t>(costTable.getNumberTaskOptions()); fromIndex++)
+                {
+                    int64_t fromId = (fromIndex < 0) ? (0) : (costTable.getTaskOptionId(fromIndex));
+                    int32_t fromLocationIndex = (fromIndex < 0) ? (0) : (uxas::service::c_AssignmentCostTable::getLocationIndex(fromIndex));
+                    auto itTravelTime = vehicleFromToVsTravelTime_ms.find(std::make_tuple(vehicleId, fromId, toId));
+                    ASSERT_EQ((itTravelTime != vehicleFromToVsTravelTime_ms.end()) ? (itTravelTime->second) : (-1), costTable.getTravelTime_ms(vehicleIndex, fromLocationIndex, toIndex))
+                            << "vehicle " << vehicleId << " from " << fromId << " to " << toId;
+                }
+            }
+        }
+        EXPECT_EQ(-1, costTable.getVehicleIndex(99));
+        EXPECT_EQ(-1, costTable.getTaskOptionIndex(c_TaskAssignmentState::getTaskAndOptionId(99, 1)));
+    }
+}
+
+TEST(AssignmentTreeBranchBoundTest, LowerBoundNeverExceedsOptimum)
+{
+    // the last relationship shares a task between required branches
+    std::vector<std::string> relationships{"", ".(p1 p2 p3)", "|(+(p1 p2) .(p3 p4) p5 p6)", "|(+(p1 p2) +(p1 p3) .(p4 p5) p6)"};
+    for (uint32_t seed = 1; seed <= 3; seed++)
+    {
+        for (auto itRelationships = relationships.begin(); itRelationships != relationships.end(); itRelationships++)
+        {
+            for (int32_t numberOptions = 1; numberOptions <= 2; numberOptions++)
+            {
+                c_Scenario scenario = getScenario(3, 6, numberOptions, seed, *itRelationships);
+                auto assignmentParameters = runAssignment("<Service NumberNodesMaximum=\"-1\"/>", scenario);
+                int64_t optimumCost = getCost(assignmentParameters);
+                ASSERT_LT(0, optimumCost);
+
+                // pruning with the lower bounds keeps the optimum
+                for (std::string lowerBound : {"MinimumIncoming", "LoadBalance"})
+                {
+                    EXPECT_EQ(optimumCost, getCost(runAssignment("<Service NumberNodesMaximum=\"-1\" LowerBound=\"" + lowerBound + "\"/>", scenario)))
+                            << lowerBound << " seed " << seed << " relationships " << *itRelationships;
+                }
+
+                // the bounds of each partial assignment on the way to the optimum
+                for (std::string lowerBound : {"MinimumIncoming", "LoadBalance"})
+                {
+                    uxas::service::c_AssignmentLowerBound assignmentLowerBound;
+                    assignmentLowerBound.initialize((lowerBound == "LoadBalance") ? (uxas::service::c_AssignmentLowerBound::LowerBoundType::LOAD_BALANCE)
+                                                    : (uxas::service::c_AssignmentLowerBound::LowerBoundType::MINIMUM_INCOMING),
+                                                    assignmentParameters->algebra, assignmentParameters->m_actionIndexVsTaskOptionIndex,
+                                                    assignmentParameters->m_costTable);
+                    ASSERT_TRUE(assignmentLowerBound.isEnabled());
+                    const std::vector<uxas::service::c_AssignmentStep>& assignmentSteps = assignmentParameters->m_candidateAssignmentSteps;
+                    std::vector<int64_t> vehicleTravelTimeTotals_ms(assignmentParameters->m_costTable.getNumberVehicles(), 0);
+                    std::vector<uint8_t> isTaskOptionAssigned(assignmentParameters->m_costTable.getNumberTaskOptions(), 0);
+                    // the vehicles' totals of the optimal assignment
+                    std::vector<int64_t> finalTravelTimeTotals_ms(vehicleTravelTimeTotals_ms);
+                    for (auto itAssignmentStep = assignmentSteps.begin(); itAssignmentStep != assignmentSteps.end(); itAssignmentStep++)
+                    {
+                        finalTravelTimeTotals_ms[itAssignmentStep->m_vehicleIndex] = itAssignmentStep->m_travelTimeTotal_ms;
+                    }
+                    ASSERT_EQ(optimumCost, *std::max_element(finalTravelTimeTotals_ms.begin(), finalTravelTimeTotals_ms.end()));
+                    int64_t cumulativeCost(0);
+                    for (auto itTotal = finalTravelTimeTotals_ms.begin(); itTotal != finalTravelTimeTotals_ms.end(); itTotal++)
+                    {
+                        cumulativeCost += *itTotal;
+                    }
+
+                    for (size_t numberSteps = 0; numberSteps <= assignmentSteps.size(); numberSteps++)
+                    {
+                        EXPECT_LE(assignmentLowerBound.getMinMaxLowerBound(vehicleTravelTimeTotals_ms, isTaskOptionAssigned), optimumCost)
+                                << lowerBound << " seed " << seed << " relationships " << *itRelationships << " steps " << numberSteps;
+                        EXPECT_LE(assignmentLowerBound.getCumulativeLowerBound(vehicleTravelTimeTotals_ms, isTaskOptionAssigned), cumulativeCost)
+                                << lowerBound << " seed " << seed << " relationships " << *itRelationships << " steps " << numberSteps;
+                        if (numberSteps < assignmentSteps.size())
+                        {
+                            vehicleTravelTimeTotals_ms[assignmentSteps[numberSteps].m_vehicleIndex] = assignmentSteps[numberSteps].m_travelTimeTotal_ms;
+                            isTaskOptionAssigned[assignmentSteps[numberSteps].m_taskOptionIndex] = 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(AssignmentTreeBranchBoundTest, RefinementIsNeverWorse)
+{
+    for (uint32_t seed = 1; seed <= 5; seed++)
+    {
+        c_Scenario scenario = getScenario(3, 7, 1, seed);
+        int64_t optimumCost = getCost(runAssignment("<Service NumberNodesMaximum=\"-1\" LowerBound=\"LoadBalance\"/>", scenario));
+        for (std::string numberNodesMaximum : {"0", "100"})
+        {
+            int64_t searchCost = getCost(runAssignment("<Service NumberNodesMaximum=\"" + numberNodesMaximum + "\"/>", scenario));
+            int64_t refinedCost = getCost(runAssignment("<Service NumberNodesMaximum=\"" + numberNodesMaximum + "\" RefinementTime_ms=\"50\"/>", scenario));
+            ASSERT_LT(0, searchCost);
+            EXPECT_LE(refinedCost, searchCost) << "seed " << seed << " nodes " << numberNodesMaximum;
+            EXPECT_LE(optimumCost, refinedCost) << "seed " << seed << " nodes " << numberNodesMaximum;
+        }
+    }
+}
+
+TEST(AssignmentTreeBranchBoundTest, WarmStartIsNeverWorse)
+{
+    for (uint32_t seed = 1; seed <= 5; seed++)
+    {
+        c_Scenario scenario = getScenario(3, 7, 1, seed);
+        int64_t optimumCost = getCost(runAssignment("<Service NumberNodesMaximum=\"-1\" LowerBound=\"LoadBalance\"/>", scenario));
+        for (std::string numberNodesMaximum : {"0", "100"})
+        {
+            // the second request starts from the first request's assignment
+            AssignmentTreeBranchBoundTestService testService("<Service NumberNodesMaximum=\"" + numberNodesMaximum + "\" IncrementalAssignment=\"true\"/>");
+            int64_t coldCost = getCost(testService.runAssignment(scenario.m_uniqueAutomationRequest, scenario.m_taskPlanOptions, scenario.m_assignmentCostMatrix));
+            auto warmParameters = testService.runAssignment(scenario.m_uniqueAutomationRequest, scenario.m_taskPlanOptions, scenario.m_assignmentCostMatrix);
+            int64_t warmCost = getCost(warmParameters);
+            ASSERT_LT(0, coldCost);
+            EXPECT_LE(warmCost, coldCost) << "seed " << seed << " nodes " << numberNodesMaximum;
+            EXPECT_LE(optimumCost, warmCost) << "seed " << seed << " nodes " << numberNodesMaximum;
+            // the warm start is not an assignment found by the search: the search stops at a better one or is complete
+            EXPECT_TRUE((warmParameters->m_numberSearchedAssignments > 0) || (warmCost == optimumCost)) << "seed " << seed << " nodes " << numberNodesMaximum;
+        }
+
+        // a previous assignment without some of the tasks is repaired, the complete search still finds the optimum
+        c_Scenario previousScenario = getScenario(3, 5, 1, seed);
+        AssignmentTreeBranchBoundTestService testService("<Service NumberNodesMaximum=\"-1\" IncrementalAssignment=\"true\"/>");
+        EXPECT_LT(0, getCost(testService.runAssignment(previousScenario.m_uniqueAutomationRequest, previousScenario.m_taskPlanOptions, previousScenario.m_assignmentCostMatrix)));
+        EXPECT_EQ(optimumCost, getCost(testService.runAssignment(scenario.m_uniqueAutomationRequest, scenario.m_taskPlanOptions, scenario.m_assignmentCostMatrix)));
+    }
+}
+
+TEST(AssignmentTreeBranchBoundTest, CompiledAlgebraEqualsParseTree)
+{
+    // actions may appear in more than one branch of an alternative
+    std::vector<std::string> algebraStrings{
+        "p1",
+        ".(p1 p2 p3)",
+        "+(p1 p2 p3)",
+        "|(p1 p2 p3)",
+        ".(p1 |(p2 +(p3 p4)) p5)",
+        "+(.(p1 p2) |(p3 .(p4 p5)) p6)",
+        "|(.(p1 p2) .(p3 p4))",
+        "|(+(p1 p2) .(p3 |(p4 p5)) p6)",
+        ".(|(p1 p2) |(p3 p4) +(p5 p6))",
+        "+(|(.(p1 p2) p3) .(+(p4 p5) |(p6 p2)))",
+        "|(.(p1 +(p2 p3)) .(p3 p1) +(p4 p5 p6))",
+    };
+    const uxas::common::utilities::v_action_t actionIds{1, 2, 3, 4, 5, 6};
+    for (auto itAlgebraString = algebraStrings.begin(); itAlgebraString != algebraStrings.end(); itAlgebraString++)
+    {
+        uxas::common::utilities::CAlgebra algebra;
+        ASSERT_TRUE(algebra.initAtomicObjectives(actionIds));
+        ASSERT_TRUE(algebra.initAlgebraString(*itAlgebraString));
+        ASSERT_NE(nullptr, algebra.parseTreeRoot);
+
+        std::vector<uint64_t> executedActionBits;
+        std::vector<uint64_t> nextLeafBits;
+        std::vector<int> nextActionIndices;
+        for (uint32_t executedSet = 0; executedSet < (1u << actionIds.size()); executedSet++)
+        {
+            uxas::common::utilities::v_action_t executedActionIds;
+            executedActionBits.assign(algebra.getNumberBitsetWords(), 0);
+            for (size_t actionNo = 0; actionNo < actionIds.size(); actionNo++)
+            {
+                if ((executedSet >> actionNo) & 1)
+                {
+                    executedActionIds.push_back(actionIds[actionNo]);
+                    uxas::common::utilities::CAlgebra::setBit(executedActionBits, algebra.getActionIndex(actionIds[actionNo]));
+                }
+            }
+
+            bool encounterExecuted(false);
+            uxas::common::utilities::v_action_t parseTreeNextActionIds = algebra.parseTreeRoot->nextActions(executedActionIds, encounterExecuted);
+
+            algebra.searchNext(executedActionBits, nextLeafBits, nextActionIndices);
+            uxas::common::utilities::v_action_t compiledNextActionIds;
+            for (auto itActionIndex = nextActionIndices.begin(); itActionIndex != nextActionIndices.end(); itActionIndex++)
+            {
+                compiledNextActionIds.push_back(algebra.getActionID(*itActionIndex));
+            }
+            ASSERT_EQ(parseTreeNextActionIds, compiledNextActionIds) << *itAlgebraString << " executed set " << executedSet;
+
+            uxas::common::utilities::v_action_t nextActionIds;
+            algebra.searchNext(executedActionIds, nextActionIds);
+            ASSERT_EQ(parseTreeNextActionIds, nextActionIds) << *itAlgebraString << " executed set " << executedSet;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,187 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   LengthPrefixedSerialBufferTest.cpp
+ *
+ * Unit tests of the length-prefixed stream framing (and its CRC32C) used by
+ * the TCP bridge.
+ */
+#include "gtest/gtest.h"
+
+#include "UxAS_LengthPrefixedSerialBuffer.h"
+
+#include <string>
+#include <vector>
+
+using uxas::common::LengthPrefixedSerialBuffer;
+
+namespace
+{
+
+uint32_t
+getCrc32c(const std::string& data)
+{
+    return (LengthPrefixedSerialBuffer::calculateCrc32c(data.data(), data.size()));
+};
+
+std::vector<std::string>
+getAllPayloads(LengthPrefixedSerialBuffer& buffer)
+{
+    std::vector<std::string> payloads;
+    std::string payload;
+    while (buffer.getNextPayloadString(payload))
+    {
+        payloads.push_back(payload);
+    }
+    return (payloads);
+};
+
+};
+
+TEST(LengthPrefixedSerialBufferTest, Crc32cKnownAnswers)
+{
+    // RFC 3720 (iSCSI) appendix B.4 test vectors and the common check value
+    std::string incrementing;
+    std::string decrementing;
+    for (int i = 0; i < 32; i++)
+    {
+        incrementing.push_back(static_cast<char>(i));
+        decrementing.push_back(static_cast<char>(31 - i));
+    }
+    EXPECT_EQ(0x00000000u, getCrc32c(""));
+    EXPECT_EQ(0xE3069283u, getCrc32c("123456789"));
+    EXPECT_EQ(0x8A9136AAu, getCrc32c(std::string(32, '\x00')));
+    EXPECT_EQ(0x62A8AB43u, getCrc32c(std::string(32, '\xFF')));
+    EXPECT_EQ(0x46DD794Eu, getCrc32c(incrementing));
+    EXPECT_EQ(0x113FDB5Cu, getCrc32c(decrementing));
+}
+
+TEST(LengthPrefixedSerialBufferTest, Crc32cUnalignedLengths)
+{
+    // the 4-byte slices and the byte-wise tail agree for every length and offset
+    std::string data("The quick brown fox jumps over the lazy dog 0123456789");
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+        for (size_t size = 0; size + offset <= data.size(); size++)
+        {
+            uint32_t crc = 0xFFFFFFFF;
+            for (size_t i = offset; i < offset + size; i++)
+            {
+                crc ^= static_cast<uint8_t>(data[i]);
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    crc = (crc & 1) ? (crc >> 1) ^ 0x82F63B78 : (crc >> 1);
+                }
+            }
+            ASSERT_EQ(crc ^ 0xFFFFFFFF, LengthPrefixedSerialBuffer::calculateCrc32c(data.data() + offset, size));
+        }
+    }
+}
+
+TEST(LengthPrefixedSerialBufferTest, FrameLayout)
+{
+    std::string framed = LengthPrefixedSerialBuffer::createFramedString("abc", true);
+    ASSERT_EQ(LengthPrefixedSerialBuffer::s_headerSize + 3 + LengthPrefixedSerialBuffer::s_checksumSize, framed.size());
+    EXPECT_EQ("UxLP", framed.substr(0, 4));
+    EXPECT_EQ(LengthPrefixedSerialBuffer::s_frameVersion, static_cast<uint8_t>(framed[4]));
+    EXPECT_EQ(LengthPrefixedSerialBuffer::s_checksumFlag, static_cast<uint8_t>(framed[5]));
+    EXPECT_EQ(std::string("\x00\x00\x00\x03", 4), framed.substr(8, 4));
+    EXPECT_EQ("abc", framed.substr(12, 3));
+
+    EXPECT_EQ(1, LengthPrefixedSerialBuffer::isFramedData(framed.data(), framed.size()));
+    EXPECT_EQ(-1, LengthPrefixedSerialBuffer::isFramedData(framed.data(), 2));
+    EXPECT_EQ(0, LengthPrefixedSerialBuffer::isFramedData("+=+=", 4));
+}
+
+TEST(LengthPrefixedSerialBufferTest, SplitFrames)
+{
+    std::vector<std::string> sent{"first payload", std::string(1000, 'x'), "a", "last$payload"};
+    std::string stream;
+    for (size_t i = 0; i < sent.size(); i++)
+    {
+        stream += LengthPrefixedSerialBuffer::createFramedString(sent[i], (i % 2) == 0);
+    }
+
+    // every chunk size, including single bytes and chunks spanning frames
+    for (size_t chunkSize : {size_t(1), size_t(3), size_t(12), size_t(13), size_t(100), stream.size()})
+    {
+        LengthPrefixedSerialBuffer buffer;
+        std::vector<std::string> received;
+        for (size_t position = 0; position < stream.size(); position += chunkSize)
+        {
+            buffer.appendData(stream.data() + position, std::min(chunkSize, stream.size() - position));
+            std::vector<std::string> payloads = getAllPayloads(buffer);
+            received.insert(received.end(), payloads.begin(), payloads.end());
+        }
+        EXPECT_EQ(sent, received) << "chunk size " << chunkSize;
+        EXPECT_EQ(sent.size(), buffer.m_validDeserializeCount);
+        EXPECT_EQ(0u, buffer.m_invalidDeserializeCount);
+    }
+}
+
+TEST(LengthPrefixedSerialBufferTest, PartialFrame)
+{
+    std::string framed = LengthPrefixedSerialBuffer::createFramedString("payload", true);
+    LengthPrefixedSerialBuffer buffer;
+    std::string payload;
+
+    // header only, then all but the last checksum byte
+    buffer.appendData(framed.data(), LengthPrefixedSerialBuffer::s_headerSize);
+    EXPECT_FALSE(buffer.getNextPayloadString(payload));
+    buffer.appendData(framed.data() + LengthPrefixedSerialBuffer::s_headerSize, framed.size() - LengthPrefixedSerialBuffer::s_headerSize - 1);
+    EXPECT_FALSE(buffer.getNextPayloadString(payload));
+    buffer.appendData(framed.data() + framed.size() - 1, 1);
+    EXPECT_TRUE(buffer.getNextPayloadString(payload));
+    EXPECT_EQ("payload", payload);
+
+    // cleared data is not returned
+    buffer.appendData(framed.data(), framed.size() - 1);
+    buffer.clear();
+    buffer.appendData(framed.data(), framed.size());
+    EXPECT_TRUE(buffer.getNextPayloadString(payload));
+    EXPECT_FALSE(buffer.getNextPayloadString(payload));
+}
+
+TEST(LengthPrefixedSerialBufferTest, CorruptChecksum)
+{
+    std::string corrupt = LengthPrefixedSerialBuffer::createFramedString("corrupted", true);
+    corrupt[LengthPrefixedSerialBuffer::s_headerSize + 2] ^= 0x01;
+    LengthPrefixedSerialBuffer buffer;
+    std::string stream = corrupt + LengthPrefixedSerialBuffer::createFramedString("valid", true);
+    buffer.appendData(stream.data(), stream.size());
+
+    // the corrupt frame is skipped, the following frame is received
+    EXPECT_EQ(std::vector<std::string>{"valid"}, getAllPayloads(buffer));
+    EXPECT_EQ(1u, buffer.m_invalidDeserializeCount);
+    EXPECT_EQ(1u, buffer.m_validDeserializeCount);
+}
+
+TEST(LengthPrefixedSerialBufferTest, CorruptHeaderResynchronizes)
+{
+    // garbage before a frame, a frame with an invalid version and an oversized length
+    std::string badVersion = LengthPrefixedSerialBuffer::createFramedString("bad version", false);
+    badVersion[4] = 99;
+    std::string oversized = LengthPrefixedSerialBuffer::createFramedString("oversized", false);
+    oversized[8] = '\x7F';
+    std::string stream = std::string("garbage bytes") + badVersion + oversized
+            + LengthPrefixedSerialBuffer::createFramedString("valid", false);
+
+    LengthPrefixedSerialBuffer buffer;
+    buffer.appendData(stream.data(), stream.size());
+    EXPECT_EQ(std::vector<std::string>{"valid"}, getAllPayloads(buffer));
+    EXPECT_LT(0u, buffer.m_disregardedDataCount);
+    EXPECT_EQ(1u, buffer.m_validDeserializeCount);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,155 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   LmcpObjectNetworkClientBaseTest.cpp
+ *
+ * Unit tests of the processing of a batch of received messages by
+ * uxas::communications::LmcpObjectNetworkClientBase. The batches are processed
+ * directly, without the network.
+ */
+#include "gtest/gtest.h"
+
+#include "LmcpObjectNetworkClientBase.h"
+#include "LmcpObjectMessageSenderPipe.h"
+
+#include "afrl/cmasi/KeyValuePair.h"
+#include "uxas/messages/uxnative/KillService.h"
+
+#include "Constants/UxAS_String.h"
+#include "stdUniquePtr.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+class BatchTestNetworkClient : public uxas::communications::LmcpObjectNetworkClientBase
+{
+public:
+
+    using uxas::communications::LmcpObjectNetworkClientBase::processReceivedLmcpMessageBatch;
+    using uxas::communications::LmcpObjectNetworkClientBase::processReceivedSerializedLmcpMessageBatch;
+
+    /** \brief Keys of the processed KeyValuePair messages (type names of other
+     * messages, addresses of serialized messages), in order */
+    std::vector<std::string> m_processed;
+
+protected:
+
+    bool
+    processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override
+    {
+        auto keyValuePair = std::dynamic_pointer_cast<afrl::cmasi::KeyValuePair>(receivedLmcpMessage->getObject());
+        m_processed.push_back(keyValuePair ? keyValuePair->getKey() : receivedLmcpMessage->getObject()->getLmcpTypeName());
+        return (false);
+    };
+
+    bool
+    processReceivedSerializedLmcpMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedSerializedLmcpMessage) override
+    {
+        m_processed.push_back(receivedSerializedLmcpMessage->getAddress());
+        return (false);
+    };
+};
+
+std::unique_ptr<uxas::communications::data::LmcpMessage>
+getLmcpMessage(avtas::lmcp::Object* lmcpObject)
+{
+    auto messageAttributes = uxas::stduxas::make_unique<uxas::communications::data::MessageAttributes>();
+    messageAttributes->setAttributes(uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), "", "1", "2");
+    return (uxas::stduxas::make_unique<uxas::communications::data::LmcpMessage>(std::move(messageAttributes), std::unique_ptr<avtas::lmcp::Object>(lmcpObject)));
+};
+
+std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+getSerializedMessage(const std::string& address, avtas::lmcp::Object* lmcpObject)
+{
+    std::unique_ptr<avtas::lmcp::Object> object(lmcpObject);
+    auto serializedMessage = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+    serializedMessage->setAddressAttributesAndPayload(address, uxas::common::ContentType::lmcp(), object->getFullLmcpTypeName(), "", "1", "2",
+                                                      uxas::communications::LmcpObjectMessageSenderPipe::serializeMessage(object.get()));
+    return (serializedMessage);
+};
+
+afrl::cmasi::KeyValuePair*
+getKeyValuePair(const std::string& key)
+{
+    auto keyValuePair = new afrl::cmasi::KeyValuePair;
+    keyValuePair->setKey(key);
+    return (keyValuePair);
+};
+
+uxas::messages::uxnative::KillService*
+getKillService(int64_t serviceId)
+{
+    auto killService = new uxas::messages::uxnative::KillService;
+    killService->setServiceID(serviceId);
+    return (killService);
+};
+
+}
+
+TEST(LmcpObjectNetworkClientBaseTest, MessagesBeforeKillServiceAreProcessed)
+{
+    const uint32_t messageCount{5};
+    BatchTestNetworkClient networkClient;
+    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> > receivedLmcpMessages(16);
+    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::LmcpMessage> > processLmcpMessages(16);
+
+    // a KillService message of another network client does not terminate this one
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        receivedLmcpMessages.push_back(getLmcpMessage(getKeyValuePair(std::to_string(i))));
+    }
+    receivedLmcpMessages.push_back(getLmcpMessage(getKillService(networkClient.m_networkId + 1)));
+    EXPECT_FALSE(networkClient.processReceivedLmcpMessageBatch(receivedLmcpMessages, processLmcpMessages));
+    EXPECT_EQ(messageCount + 1, networkClient.m_processed.size());
+
+    networkClient.m_processed.clear();
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        receivedLmcpMessages.push_back(getLmcpMessage(getKeyValuePair(std::to_string(i))));
+    }
+    receivedLmcpMessages.push_back(getLmcpMessage(getKillService(networkClient.m_networkId)));
+    receivedLmcpMessages.push_back(getLmcpMessage(getKeyValuePair("after")));
+    EXPECT_TRUE(networkClient.processReceivedLmcpMessageBatch(receivedLmcpMessages, processLmcpMessages));
+
+    // every message before the KillService message is processed, in order
+    ASSERT_EQ(messageCount, networkClient.m_processed.size());
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        EXPECT_EQ(std::to_string(i), networkClient.m_processed[i]);
+    }
+    EXPECT_TRUE(receivedLmcpMessages.empty());
+}
+
+TEST(LmcpObjectNetworkClientBaseTest, SerializedMessagesBeforeKillServiceAreProcessed)
+{
+    const uint32_t messageCount{5};
+    BatchTestNetworkClient networkClient;
+    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > receivedSerializedLmcpMessages(16);
+    uxas::common::RingBuffer< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > processSerializedLmcpMessages(16);
+
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        receivedSerializedLmcpMessages.push_back(getSerializedMessage("message" + std::to_string(i), getKeyValuePair(std::to_string(i))));
+    }
+    receivedSerializedLmcpMessages.push_back(getSerializedMessage(uxas::messages::uxnative::KillService::Subscription, getKillService(networkClient.m_networkId)));
+    receivedSerializedLmcpMessages.push_back(getSerializedMessage("after", getKeyValuePair("after")));
+    EXPECT_TRUE(networkClient.processReceivedSerializedLmcpMessageBatch(receivedSerializedLmcpMessages, processSerializedLmcpMessages));
+
+    ASSERT_EQ(messageCount, networkClient.m_processed.size());
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        EXPECT_EQ("message" + std::to_string(i), networkClient.m_processed[i]);
+    }
+    EXPECT_TRUE(receivedSerializedLmcpMessages.empty());
+}
@@ -0,0 +1,122 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   RingBufferTest.cpp
+ *
+ * Unit tests of the fixed capacity uxas::common::RingBuffer used for batches
+ * of received messages.
+ */
+#include "gtest/gtest.h"
+
+#include "UxAS_RingBuffer.h"
+
+#include <memory>
+
+TEST(RingBufferTest, PushPopOrder)
+{
+    uxas::common::RingBuffer<int> buffer(4);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(4u, buffer.capacity());
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(buffer.push_back(int(i)));
+    }
+    EXPECT_EQ(3u, buffer.size());
+    EXPECT_EQ(0, buffer[0]);
+    EXPECT_EQ(2, buffer[2]);
+
+    // first-in, first-out
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(i, buffer.pop_front());
+    }
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(RingBufferTest, WrapAround)
+{
+    uxas::common::RingBuffer<int> buffer(3);
+    int nextPush{0};
+    int nextPop{0};
+    // repeatedly add two and remove two so the front index wraps around the storage
+    for (int cycle = 0; cycle < 10; cycle++)
+    {
+        EXPECT_TRUE(buffer.push_back(int(nextPush++)));
+        EXPECT_TRUE(buffer.push_back(int(nextPush++)));
+        EXPECT_EQ(nextPop, buffer[0]);
+        EXPECT_EQ(nextPop + 1, buffer[1]);
+        EXPECT_EQ(nextPop++, buffer.pop_front());
+        EXPECT_EQ(nextPop++, buffer.pop_front());
+    }
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(RingBufferTest, FixedCapacity)
+{
+    // storage does not grow - adding to a full buffer is rejected
+    uxas::common::RingBuffer<int> buffer(2);
+    EXPECT_TRUE(buffer.push_back(1));
+    EXPECT_TRUE(buffer.push_back(2));
+    EXPECT_TRUE(buffer.full());
+    EXPECT_FALSE(buffer.push_back(3));
+    EXPECT_EQ(2u, buffer.size());
+    EXPECT_EQ(2u, buffer.capacity());
+    EXPECT_EQ(1, buffer.pop_front());
+    EXPECT_FALSE(buffer.full());
+    EXPECT_TRUE(buffer.push_back(3));
+    EXPECT_EQ(2, buffer.pop_front());
+    EXPECT_EQ(3, buffer.pop_front());
+
+    // zero capacity is promoted to a capacity of one
+    uxas::common::RingBuffer<int> minimumBuffer(0);
+    EXPECT_EQ(1u, minimumBuffer.capacity());
+    EXPECT_TRUE(minimumBuffer.push_back(1));
+    EXPECT_FALSE(minimumBuffer.push_back(2));
+}
+
+TEST(RingBufferTest, PopBackAndClear)
+{
+    uxas::common::RingBuffer< std::shared_ptr<int> > buffer(3);
+    auto element = std::make_shared<int>(7);
+    buffer.push_back(std::make_shared<int>(1));
+    buffer.push_back(std::shared_ptr<int>(element));
+    EXPECT_EQ(2, element.use_count());
+
+    // removed elements are released
+    buffer.pop_back();
+    EXPECT_EQ(1, element.use_count());
+    EXPECT_EQ(1u, buffer.size());
+
+    buffer.push_back(std::shared_ptr<int>(element));
+    buffer.push_back(std::make_shared<int>(3));
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(1, element.use_count());
+
+    // buffer is reusable after clear
+    EXPECT_TRUE(buffer.push_back(std::make_shared<int>(4)));
+    EXPECT_EQ(4, *buffer.pop_front());
+}
+
+TEST(RingBufferTest, MoveOnlyElements)
+{
+    uxas::common::RingBuffer< std::unique_ptr<int> > buffer(2);
+    EXPECT_TRUE(buffer.push_back(std::unique_ptr<int>(new int(5))));
+    std::unique_ptr<int> element = buffer.pop_front();
+    ASSERT_TRUE(element);
+    EXPECT_EQ(5, *element);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
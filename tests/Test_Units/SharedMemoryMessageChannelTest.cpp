@@ -0,0 +1,203 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   SharedMemoryMessageChannelTest.cpp
+ *
+ * Unit tests of the shared memory ring buffers used by the shared memory
+ * bridge. Server and client ends are opened in the same process.
+ */
+#include "gtest/gtest.h"
+
+#include "SharedMemoryMessageChannel.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using uxas::communications::transport::SharedMemoryMessageChannel;
+
+namespace
+{
+
+// 4-byte length precedes each message in the ring
+const uint32_t c_lengthSize{4};
+
+std::string
+getChannelName(const std::string& testName)
+{
+    return ("/uxas_test_" + testName + "_" + std::to_string(getpid()));
+};
+
+};
+
+TEST(SharedMemoryMessageChannelTest, SendReceiveBothDirections)
+{
+    SharedMemoryMessageChannel server;
+    SharedMemoryMessageChannel client;
+    ASSERT_TRUE(server.open(getChannelName("SendReceive"), 256, true));
+    ASSERT_TRUE(client.open(getChannelName("SendReceive"), 0, false));
+
+    std::string message;
+    EXPECT_FALSE(client.receive(message));
+    EXPECT_TRUE(server.send("to client"));
+    EXPECT_TRUE(client.send("to server"));
+    EXPECT_TRUE(client.receive(message));
+    EXPECT_EQ("to client", message);
+    EXPECT_TRUE(server.receive(message));
+    EXPECT_EQ("to server", message);
+    EXPECT_FALSE(server.receive(message));
+}
+
+TEST(SharedMemoryMessageChannelTest, WrapAround)
+{
+    SharedMemoryMessageChannel server;
+    SharedMemoryMessageChannel client;
+    // records of 4 + 13 bytes do not divide the ring capacity, so records and lengths straddle the end of the ring
+    ASSERT_TRUE(server.open(getChannelName("WrapAround"), 64, true));
+    ASSERT_TRUE(client.open(getChannelName("WrapAround"), 0, false));
+
+    std::string message;
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        std::string sent = "message " + std::to_string(1000 + i) + "!";
+        ASSERT_EQ(13u, sent.size());
+        ASSERT_TRUE(server.send(sent));
+        ASSERT_TRUE(client.receive(message));
+        EXPECT_EQ(sent, message);
+    }
+    EXPECT_FALSE(client.receive(message));
+}
+
+TEST(SharedMemoryMessageChannelTest, FullRing)
+{
+    SharedMemoryMessageChannel server;
+    SharedMemoryMessageChannel client;
+    ASSERT_TRUE(server.open(getChannelName("FullRing"), 64, true));
+    ASSERT_TRUE(client.open(getChannelName("FullRing"), 0, false));
+
+    // three 16-byte records fill 48 of 64 bytes; a fourth record of 20 bytes does not fit
+    std::string message(12, 'a');
+    EXPECT_TRUE(server.send(message));
+    EXPECT_TRUE(server.send(message));
+    EXPECT_TRUE(server.send(message));
+    EXPECT_FALSE(server.send(std::string(16, 'b')));
+    EXPECT_FALSE(server.waitForSend(16, 10));
+
+    // space is available again once a record is received
+    std::string received;
+    EXPECT_TRUE(client.receive(received));
+    EXPECT_TRUE(server.waitForSend(16, 10));
+    EXPECT_TRUE(server.send(std::string(16, 'b')));
+    EXPECT_TRUE(client.receive(received));
+    EXPECT_TRUE(client.receive(received));
+    EXPECT_TRUE(client.receive(received));
+    EXPECT_EQ(std::string(16, 'b'), received);
+}
+
+TEST(SharedMemoryMessageChannelTest, MessageAtCapacityBoundary)
+{
+    const uint32_t capacity{64};
+    SharedMemoryMessageChannel server;
+    SharedMemoryMessageChannel client;
+    ASSERT_TRUE(server.open(getChannelName("Boundary"), capacity, true));
+    ASSERT_TRUE(client.open(getChannelName("Boundary"), 0, false));
+
+    // a record (length and message) exactly filling the ring fits, one byte more never does
+    EXPECT_FALSE(server.send(std::string(capacity - c_lengthSize + 1, 'x')));
+    EXPECT_FALSE(server.waitForSend(capacity - c_lengthSize + 1, 0));
+
+    std::string received;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        // after a partial record the full-size record starts (and wraps) mid-ring
+        ASSERT_TRUE(server.send(std::string(i, 'p')));
+        ASSERT_TRUE(client.receive(received));
+        std::string sent(capacity - c_lengthSize, static_cast<char>('a' + i));
+        sent[0] = 'S';
+        sent.back() = 'E';
+        ASSERT_TRUE(server.send(sent));
+        EXPECT_FALSE(server.send("y"));
+        ASSERT_TRUE(client.receive(received));
+        EXPECT_EQ(sent, received);
+    }
+}
+
+TEST(SharedMemoryMessageChannelTest, ClientRequiresServer)
+{
+    SharedMemoryMessageChannel client;
+    EXPECT_FALSE(client.open(getChannelName("NoServer"), 0, false));
+
+    // a server re-using an existing segment re-initializes it
+    SharedMemoryMessageChannel firstServer;
+    ASSERT_TRUE(firstServer.open(getChannelName("Reopen"), 128, true));
+    ASSERT_TRUE(firstServer.send("stale"));
+    SharedMemoryMessageChannel secondServer;
+    ASSERT_TRUE(secondServer.open(getChannelName("Reopen"), 128, true));
+    ASSERT_TRUE(client.open(getChannelName("Reopen"), 0, false));
+    std::string received;
+    EXPECT_FALSE(client.receive(received));
+}
+
+TEST(SharedMemoryMessageChannelTest, WaitWakesOnSend)
+{
+    SharedMemoryMessageChannel server;
+    SharedMemoryMessageChannel client;
+    ASSERT_TRUE(server.open(getChannelName("Wait"), 1024, true));
+    ASSERT_TRUE(client.open(getChannelName("Wait"), 0, false));
+
+    EXPECT_FALSE(client.waitForReceive(10));
+
+    const uint32_t messageCount{1000};
+    std::thread sender([&server, messageCount]
+    {
+        for (uint32_t i = 0; i < messageCount; i++)
+        {
+            std::string message = std::to_string(i);
+            while (!server.send(message))
+            {
+                server.waitForSend(message.size(), 1000);
+            }
+        }
+    });
+
+    std::string received;
+    for (uint32_t i = 0; i < messageCount; i++)
+    {
+        while (!client.receive(received))
+        {
+            ASSERT_TRUE(client.waitForReceive(5000));
+        }
+        EXPECT_EQ(std::to_string(i), received);
+    }
+    sender.join();
+}
+
+TEST(SharedMemoryMessageChannelTest, InterruptEndsWait)
+{
+    SharedMemoryMessageChannel server;
+    ASSERT_TRUE(server.open(getChannelName("Interrupt"), 128, true));
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread interrupter([&server]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        server.interrupt();
+    });
+    EXPECT_FALSE(server.waitForReceive(10000));
+    interrupter.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
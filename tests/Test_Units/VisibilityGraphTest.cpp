@@ -0,0 +1,353 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   VisibilityGraphTest.cpp
+ *
+ * Unit tests of the visibility graph. The faster ways of building the graph
+ * and finding shortest paths are compared to their reference versions.
+ */
+#include "gtest/gtest.h"
+
+#include "VisibilityGraph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using n_FrameworkLib::CPathInformation;
+using n_FrameworkLib::CPosition;
+using n_FrameworkLib::CVisibilityGraph;
+using n_FrameworkLib::V_POSITION_t;
+
+namespace
+{
+
+const double c_regionSize_m{10000.0};
+const double c_polygonExpansion_m{30.0};
+
+// regular polygons (4 to 6 sides) at random positions inside the boundary
+std::vector<V_POSITION_t>
+getObstacles(const size_t& numberObstacles, const uint32_t& seed)
+{
+    std::vector<V_POSITION_t> obstacles;
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> center_m(500.0, c_regionSize_m - 500.0);
+    for (size_t obstacleIndex = 0; obstacleIndex < numberObstacles; obstacleIndex++)
+    {
+        double centerEast_m = center_m(random);
+        double centerNorth_m = center_m(random);
+        double radius_m = 50.0 + static_cast<double>(random() % 200);
+        size_t numberSides = 4 + random() % 3;
+        V_POSITION_t obstacle;
+        for (size_t side = 0; side < numberSides; side++)
+        {
+            double angle_rad = 2.0 * M_PI * static_cast<double>(side) / static_cast<double>(numberSides);
+            obstacle.push_back(CPosition(centerNorth_m + radius_m * std::sin(angle_rad), centerEast_m + radius_m * std::cos(angle_rad), 0.0));
+        }
+        obstacles.push_back(obstacle);
+    }
+    return (obstacles);
+};
+
+void
+addPolygons(CVisibilityGraph& visibilityGraph, const std::vector<V_POSITION_t>& obstacles)
+{
+    V_POSITION_t boundary{CPosition(0.0, 0.0, 0.0), CPosition(0.0, c_regionSize_m, 0.0),
+        CPosition(c_regionSize_m, c_regionSize_m, 0.0), CPosition(c_regionSize_m, 0.0, 0.0)};
+    ASSERT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errAddPolygon(1, boundary.begin(), boundary.end(), true, 0.0));
+    for (size_t obstacleIndex = 0; obstacleIndex < obstacles.size(); obstacleIndex++)
+    {
+        V_POSITION_t obstacle(obstacles[obstacleIndex]);
+        visibilityGraph.errAddPolygon(static_cast<int>(100 + obstacleIndex), obstacle.begin(), obstacle.end(), false, c_polygonExpansion_m);
+    }
+    ASSERT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errFinalizePolygons());
+};
+
+void
+buildGraph(CVisibilityGraph& visibilityGraph, const std::vector<V_POSITION_t>& obstacles)
+{
+    addPolygons(visibilityGraph, obstacles);
+    ASSERT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errBuildVisibilityGraph());
+    ASSERT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errInitializeGraphBase());
+};
+
+std::vector<CPosition>
+getPositions(const size_t& numberPositions, const uint32_t& seed)
+{
+    std::vector<CPosition> positions;
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> position_m(10.0, c_regionSize_m - 10.0);
+    for (size_t positionIndex = 0; positionIndex < numberPositions; positionIndex++)
+    {
+        double north_m = position_m(random);
+        positions.push_back(CPosition(north_m, position_m(random), 0.0));
+    }
+    return (positions);
+};
+
+std::shared_ptr<CPathInformation>
+getPathInformation(const CPosition& start, const CPosition& end)
+{
+    auto pathInformation = std::make_shared<CPathInformation>();
+    pathInformation->posGetStart() = start;
+    pathInformation->posGetEnd() = end;
+    return (pathInformation);
+};
+
+int
+getPathLength(CVisibilityGraph& visibilityGraph, const CPosition& start, const CPosition& end)
+{
+    auto pathInformation = getPathInformation(start, end);
+    visibilityGraph.isFindPath(pathInformation);
+    return (pathInformation->iGetLength());
+};
+
+// the route cost between two positions and the length of the base graph part of its path, checked against the route
+int
+getRouteLength(CVisibilityGraph& visibilityGraph, const CPosition& start, const CPosition& end)
+{
+    const int endId(1000);
+    n_FrameworkLib::PTR_M_INT_PATHINFORMATION_t distanceMapStart(new n_FrameworkLib::M_INT_PATHINFORMATION_t);
+    n_FrameworkLib::PTR_M_INT_PATHINFORMATION_t distanceMapEnd(new n_FrameworkLib::M_INT_PATHINFORMATION_t);
+    EXPECT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errFindShortestPathLinear(start, endId, end, distanceMapStart, distanceMapEnd));
+    const CPathInformation& route = (*distanceMapStart)[endId];
+
+    // the path lists the base vertices from the first one up to, but not including, the last one
+    CVisibilityGraph::PTR_DEQUE_POSITION_t path(new CVisibilityGraph::D_POSITION_t);
+    EXPECT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errFindShortestPathLinear(start, end, path));
+    if (route.iGetIndexBaseBegin() < 0)
+    {
+        EXPECT_TRUE(path->empty());
+    }
+    else
+    {
+        const V_POSITION_t& vertices = visibilityGraph.vposGetVerticiesBase();
+        EXPECT_FALSE(path->empty());
+        path->push_back(vertices[route.iGetIndexBaseEnd()]);
+        double pathLength_m(0.0);
+        for (size_t positionIndex = 1; positionIndex < path->size(); positionIndex++)
+        {
+            pathLength_m += (*path)[positionIndex - 1].relativeDistance2D_m((*path)[positionIndex]);
+        }
+        // edge lengths are truncated to meters
+        EXPECT_NEAR(static_cast<double>(visibilityGraph.iGetVertexDistanceBase(route.iGetIndexBaseBegin(), route.iGetIndexBaseEnd())),
+                    pathLength_m, static_cast<double>(path->size()));
+    }
+    return (route.iGetLength());
+};
+
+std::set< std::pair<int, int> >
+getVisibleEdges(const CVisibilityGraph& visibilityGraph)
+{
+    std::set< std::pair<int, int> > visibleEdges;
+    for (auto itEdge = visibilityGraph.veGetEdgesVisibleBase().begin(); itEdge != visibilityGraph.veGetEdgesVisibleBase().end(); itEdge++)
+    {
+        visibleEdges.insert(std::make_pair(std::min(itEdge->first, itEdge->second), std::max(itEdge->first, itEdge->second)));
+    }
+    return (visibleEdges);
+};
+
+};
+
+TEST(VisibilityGraphTest, ParallelShortestPathsEqualSerial)
+{
+    std::vector<V_POSITION_t> obstacles = getObstacles(30, 7);
+    for (bool isCompact : {true, false})
+    {
+        CVisibilityGraph serialGraph;
+        serialGraph.szGetNumberThreadsBase() = 1;
+        serialGraph.bGetCompactVertexParentBase() = isCompact;
+        buildGraph(serialGraph, obstacles);
+        CVisibilityGraph parallelGraph;
+        parallelGraph.szGetNumberThreadsBase() = 4;
+        parallelGraph.bGetCompactVertexParentBase() = isCompact;
+        buildGraph(parallelGraph, obstacles);
+
+        size_t numberVertices = serialGraph.szGetNumberVerticesBase();
+        ASSERT_LT(0u, numberVertices);
+        ASSERT_EQ(numberVertices, parallelGraph.szGetNumberVerticesBase());
+        for (size_t from = 0; from < numberVertices; from++)
+        {
+            for (size_t to = 0; to < numberVertices; to++)
+            {
+                ASSERT_EQ(serialGraph.iGetVertexDistanceBase(from, to), parallelGraph.iGetVertexDistanceBase(from, to))
+                        << "from " << from << " to " << to << " compact " << isCompact;
+                ASSERT_EQ(serialGraph.vtxGetVertexParentBase(from, to), parallelGraph.vtxGetVertexParentBase(from, to))
+                        << "from " << from << " to " << to << " compact " << isCompact;
+            }
+        }
+    }
+}
+
+TEST(VisibilityGraphTest, LazyShortestPathsEqualMatrix)
+{
+    std::vector<V_POSITION_t> obstacles = getObstacles(30, 7);
+    CVisibilityGraph matrixGraph;
+    buildGraph(matrixGraph, obstacles);
+    // a cache smaller than the number of sources, so trees are evicted and recomputed
+    CVisibilityGraph lazyGraph;
+    lazyGraph.bGetLazyShortestPathsBase() = true;
+    lazyGraph.szGetShortestPathTreeCacheSizeBase() = 4;
+    buildGraph(lazyGraph, obstacles);
+
+    size_t numberVertices = matrixGraph.szGetNumberVerticesBase();
+    ASSERT_EQ(numberVertices, lazyGraph.szGetNumberVerticesBase());
+    for (size_t from = 0; from < numberVertices; from++)
+    {
+        for (size_t to = 0; to < numberVertices; to++)
+        {
+            ASSERT_EQ(matrixGraph.iGetVertexDistanceBase(from, to), lazyGraph.iGetVertexDistanceBase(from, to)) << "from " << from << " to " << to;
+        }
+    }
+
+    // A* between the start and end positions finds paths of the same length as the matrices
+    std::vector<CPosition> positions = getPositions(200, 3);
+    for (size_t positionIndex = 0; positionIndex + 1 < positions.size(); positionIndex += 2)
+    {
+        const CPosition& start = positions[positionIndex];
+        const CPosition& end = positions[positionIndex + 1];
+        EXPECT_EQ(getPathLength(matrixGraph, start, end), getPathLength(lazyGraph, start, end)) << "pair " << positionIndex / 2;
+
+        // paths of equal length may pass through different vertices
+        EXPECT_EQ(getRouteLength(matrixGraph, start, end), getRouteLength(lazyGraph, start, end)) << "pair " << positionIndex / 2;
+    }
+}
+
+TEST(VisibilityGraphTest, EdgeGridEqualsBruteForce)
+{
+    CVisibilityGraph visibilityGraph;
+    addPolygons(visibilityGraph, getObstacles(40, 7));
+    ASSERT_EQ(CVisibilityGraph::errNoError, visibilityGraph.errBuildVisibilityGraph());
+    ASSERT_TRUE(visibilityGraph.edggrdGetPolygonEdgesBase().bGetValid());
+
+    // the graph only uses the grid for its own polygons, a copy is checked edge by edge
+    CVisibilityGraph::V_POLYGON_t polygons(visibilityGraph.vplygnGetPolygons());
+    const V_POSITION_t& vertices = visibilityGraph.vposGetVerticiesBase();
+    std::mt19937 random(3);
+    // segments may start or end outside of the boundary
+    std::uniform_real_distribution<double> position_m(-100.0, c_regionSize_m + 100.0);
+    for (size_t segment = 0; segment < 20000; segment++)
+    {
+        CPosition start(position_m(random), position_m(random), 0.0);
+        CPosition end(position_m(random), position_m(random), 0.0);
+        int32_t endIndex(-1);
+        if ((segment % 4) == 0)
+        {
+            // segments to a polygon vertex skip the edges of that vertex
+            endIndex = static_cast<int32_t>(random() % vertices.size());
+            end = vertices[endIndex];
+        }
+        ASSERT_EQ(visibilityGraph.bFindIntersection(vertices, polygons, start, end, -1, endIndex),
+                  visibilityGraph.bFindIntersection(vertices, visibilityGraph.vplygnGetPolygons(), start, end, -1, endIndex)) << "segment " << segment;
+    }
+}
+
+TEST(VisibilityGraphTest, IncrementalKeepOutEqualsRebuild)
+{
+    std::vector<V_POSITION_t> obstacles = getObstacles(40, 11);
+    for (bool isLazy : {false, true})
+    {
+        CVisibilityGraph incrementalGraph;
+        incrementalGraph.bGetLazyShortestPathsBase() = isLazy;
+        buildGraph(incrementalGraph, std::vector<V_POSITION_t>(obstacles.begin(), obstacles.begin() + 30));
+        size_t numberInserted(0);
+        for (size_t obstacleIndex = 30; obstacleIndex < obstacles.size(); obstacleIndex++)
+        {
+            V_POSITION_t obstacle(obstacles[obstacleIndex]);
+            auto error = incrementalGraph.errAddKeepOutPolygonBase(static_cast<int>(100 + obstacleIndex), obstacle.begin(), obstacle.end(), c_polygonExpansion_m);
+            // overlapping keep-out zones require merging, i.e. a rebuild
+            ASSERT_TRUE((error == CVisibilityGraph::errNoError) || (error == CVisibilityGraph::errPolygonMerging)) << "error " << error;
+            numberInserted += (error == CVisibilityGraph::errNoError) ? (1) : (0);
+        }
+        ASSERT_LT(0u, numberInserted);
+
+        // the same polygons, built at once
+        CVisibilityGraph rebuiltGraph;
+        rebuiltGraph.bGetLazyShortestPathsBase() = isLazy;
+        rebuiltGraph.vposGetVerticiesBase() = incrementalGraph.vposGetVerticiesBase();
+        rebuiltGraph.vplygnGetPolygons() = incrementalGraph.vplygnGetPolygons();
+        for (auto itPolygon = rebuiltGraph.vplygnGetPolygons().begin(); itPolygon != rebuiltGraph.vplygnGetPolygons().end(); itPolygon++)
+        {
+            itPolygon->errFinalizePolygon(rebuiltGraph.vposGetVerticiesBase());
+        }
+        ASSERT_EQ(CVisibilityGraph::errNoError, rebuiltGraph.errBuildVisibilityGraph());
+        ASSERT_EQ(CVisibilityGraph::errNoError, rebuiltGraph.errInitializeGraphBase());
+
+        EXPECT_EQ(getVisibleEdges(rebuiltGraph), getVisibleEdges(incrementalGraph)) << "lazy " << isLazy;
+        size_t numberVertices = rebuiltGraph.szGetNumberVerticesBase();
+        ASSERT_EQ(numberVertices, incrementalGraph.szGetNumberVerticesBase());
+        for (size_t from = 0; from < numberVertices; from++)
+        {
+            for (size_t to = 0; to < numberVertices; to++)
+            {
+                ASSERT_EQ(rebuiltGraph.iGetVertexDistanceBase(from, to), incrementalGraph.iGetVertexDistanceBase(from, to))
+                        << "from " << from << " to " << to << " lazy " << isLazy;
+            }
+        }
+        std::vector<CPosition> positions = getPositions(100, 5);
+        for (size_t positionIndex = 0; positionIndex + 1 < positions.size(); positionIndex += 2)
+        {
+            EXPECT_EQ(getPathLength(rebuiltGraph, positions[positionIndex], positions[positionIndex + 1]),
+                      getPathLength(incrementalGraph, positions[positionIndex], positions[positionIndex + 1])) << "pair " << positionIndex / 2 << " lazy " << isLazy;
+        }
+    }
+}
+
+TEST(VisibilityGraphTest, FindPathsEqualsFindPath)
+{
+    std::vector<V_POSITION_t> obstacles = getObstacles(30, 11);
+    for (bool isLazy : {false, true})
+    {
+        CVisibilityGraph visibilityGraph;
+        visibilityGraph.bGetLazyShortestPathsBase() = isLazy;
+        buildGraph(visibilityGraph, obstacles);
+
+        // all pairs of the positions, as requested by the route planner
+        std::vector<CPosition> positions = getPositions(12, 7);
+        std::vector< std::shared_ptr<CPathInformation> > singlePaths;
+        std::vector< std::shared_ptr<CPathInformation> > batchPaths;
+        for (size_t from = 0; from < positions.size(); from++)
+        {
+            for (size_t to = 0; to < positions.size(); to++)
+            {
+                if (from != to)
+                {
+                    singlePaths.push_back(getPathInformation(positions[from], positions[to]));
+                    batchPaths.push_back(getPathInformation(positions[from], positions[to]));
+                }
+            }
+        }
+        std::vector<bool> isSingleFound;
+        for (auto itPath = singlePaths.begin(); itPath != singlePaths.end(); itPath++)
+        {
+            isSingleFound.push_back(visibilityGraph.isFindPath(*itPath));
+        }
+        bool isBatchFound = visibilityGraph.isFindPaths(batchPaths);
+
+        // paths of equal length may pass through different vertices, so only the lengths are compared
+        bool isAllSingleFound(true);
+        for (size_t pathIndex = 0; pathIndex < singlePaths.size(); pathIndex++)
+        {
+            isAllSingleFound = isAllSingleFound && isSingleFound[pathIndex];
+            EXPECT_EQ(singlePaths[pathIndex]->iGetLength(), batchPaths[pathIndex]->iGetLength()) << "path " << pathIndex << " lazy " << isLazy;
+        }
+        EXPECT_EQ(isAllSingleFound, isBatchFound) << "lazy " << isLazy;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}